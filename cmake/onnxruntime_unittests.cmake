@@ -896,10 +896,18 @@ if (NOT onnxruntime_ENABLE_TRAINING_TORCH_INTEROP)
       ${BENCHMARK_DIR}/tptest.cc
       ${BENCHMARK_DIR}/eigen.cc
       ${BENCHMARK_DIR}/copy.cc
+      ${BENCHMARK_DIR}/controlflow.cc
+      ${BENCHMARK_DIR}/elementwise_fusion.cc
       ${BENCHMARK_DIR}/gelu.cc
+      ${BENCHMARK_DIR}/rnn.cc
+      ${BENCHMARK_DIR}/gather.cc
+      ${BENCHMARK_DIR}/run_async.cc
       ${BENCHMARK_DIR}/activation.cc
       ${BENCHMARK_DIR}/quantize.cc
-      ${BENCHMARK_DIR}/reduceminmax.cc)
+      ${BENCHMARK_DIR}/reduceminmax.cc
+      ${BENCHMARK_DIR}/non_max_suppression.cc
+      ${BENCHMARK_DIR}/stft.cc
+      ${BENCHMARK_DIR}/string_dictionary.cc)
     target_include_directories(onnxruntime_benchmark PRIVATE ${ONNXRUNTIME_ROOT} ${onnxruntime_graph_header} ${ONNXRUNTIME_ROOT}/core/mlas/inc)
     if(WIN32)
       target_compile_options(onnxruntime_benchmark PRIVATE "$<$<COMPILE_LANGUAGE:CUDA>:-Xcompiler /wd4141>"
@@ -40,6 +40,14 @@ namespace onnxruntime {
 
 std::unique_ptr<OpKernelInfo> CopyOpKernelInfo(const OpKernelInfo& info);
 
+// Arithmetic work and memory traffic of a single kernel invocation.
+// Used by the profiler to report the achieved GFLOP/s and GB/s of each node for roofline analysis.
+struct KernelCost {
+  double flops{0.0};
+  double bytes_read{0.0};
+  double bytes_written{0.0};
+};
+
 class OpKernel {
  public:
   using DoneCallback = std::function<void()>;
@@ -116,6 +124,16 @@ class OpKernel {
     return Status::OK();
   }
 
+  // Override this function to provide a cost model for the kernel.
+  // It is called by the executor when profiling is enabled, after Compute succeeded with the same context, so the
+  // shapes of the inputs are those of the invocation being profiled. Inputs that were pre-packed are not available
+  // from the context and have to be accounted for using the shape saved in PrePack.
+  // @param cost: The FLOPs performed and the bytes read and written by the invocation.
+  // @return false if the kernel does not provide a cost model.
+  virtual bool GetCost(const OpKernelContext& /*context*/, /*out*/ KernelCost& /*cost*/) const {
+    return false;
+  }
+
   const OrtMemoryInfo& Allocator(int id, OrtMemType mem_type) const;
   const OpKernelInfo& Info() const {
     return *op_kernel_info_;
@@ -406,7 +406,17 @@ class Node {
 
 #if !defined(ORT_MINIMAL_BUILD)
   /** Gets the Node's mutable attributes. */
-  NodeAttributes& GetMutableAttributes() noexcept { return attributes_; }
+  NodeAttributes& GetMutableAttributes() noexcept {
+    // someone fetching these is going to change something
+    has_inferencing_signature_ = false;
+    return attributes_;
+  }
+
+  /** Gets the value of Graph::NumResolves of the main graph after the Resolve call which last ran type and shape
+  inferencing on this Node, or -1 if it never ran. With Graph::SetIncrementalResolve, Resolve skips the Nodes whose
+  schema, attributes, input and output names and types, and input producers or initializers haven't changed since,
+  so a larger value means that the Node or its inputs have changed. */
+  int LastInferencingResolve() const noexcept { return last_inferencing_resolve_; }
 
   /** Gets the Graph instance that is instantiated from a GraphProto attribute during Graph::Resolve.
   @param attr_name Attribute name for the GraphProto attribute.
@@ -643,6 +653,14 @@ class Node {
 
   // Graph instances for subgraphs that are owned by this Node
   std::vector<std::unique_ptr<Graph>> subgraphs_;
+
+#if !defined(ORT_MINIMAL_BUILD)
+  // What the type and shape inferencing of the Node depended on, other than its attributes, when it last ran in an
+  // incremental Resolve. Changing the attributes clears has_inferencing_signature_.
+  std::string inferencing_signature_;
+  bool has_inferencing_signature_ = false;
+  int last_inferencing_resolve_ = -1;
+#endif
 };
 
 /**
@@ -974,6 +992,12 @@ class Graph {
   */
   bool RemoveNode(NodeIndex node_index);
 
+  /** Remove a NodeArg which is not used by any Node, and is not an input, output or initializer of this Graph.
+  e.g. the output of a Node that an optimizer added then removed. Unlike the NodeArgs without type, such a NodeArg
+  isn't removed by Resolve.
+  @returns true if the NodeArg was removed, false if it doesn't exist or is still used. */
+  bool RemoveNodeArg(const std::string& name);
+
   /** Add an edge between two Nodes.
   @param src_node_index NodeIndex of source Node that is providing output to the destination Node.
   @param dst_node_index NodeIndex of destination Node that is receiving input from the source Node.
@@ -1012,6 +1036,22 @@ class Graph {
     return graph_resolve_needed_;
   }
 
+#if !defined(ORT_MINIMAL_BUILD)
+  /** Gets the number of times Resolve has processed a modified Graph. Always 0 for a subgraph, as Resolve
+  processes the subgraphs with the main graph. */
+  int NumResolves() const noexcept {
+    return num_resolves_;
+  }
+
+  /** Sets whether Resolve skips the type and shape inferencing and the verification of the Nodes whose schema,
+  attributes, input and output names and types, and input producers or initializers haven't changed since they were
+  last verified (see Node::LastInferencingResolve). Disabled by default. Set on the main graph, applies to the
+  subgraphs too. */
+  void SetIncrementalResolve(bool incremental) noexcept {
+    incremental_resolve_ = incremental;
+  }
+#endif
+
   /** Sets flag that Graph::graph_proto_ needs to be updated to reflect changes in the Graph. */
   Graph& SetGraphProtoSyncNeeded() noexcept {
     graph_proto_sync_needed_ = true;
@@ -1670,6 +1710,9 @@ class Graph {
   // number of times Resolve has run.
   int num_resolves_ = 0;
 
+  // whether Resolve skips the unchanged Nodes. see SetIncrementalResolve.
+  bool incremental_resolve_ = false;
+
   const logging::Logger& logger_;
 
   // If true, all inconsistencies encountered during shape and type inference
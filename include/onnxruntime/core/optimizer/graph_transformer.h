@@ -3,6 +3,7 @@
 
 #pragma once
 #include <string>
+#include <vector>
 
 #include "core/common/common.h"
 #include "core/common/inlined_containers.h"
@@ -40,8 +41,26 @@ class GraphTransformer {
   */
   common::Status Apply(Graph& graph, bool& modified, const logging::Logger& logger) const;
 
+  /** Apply the transformation to the given Nodes of the main graph, and to the subgraphs of these Nodes only.
+  GraphTransformerManager uses this to revisit the Nodes affected by the changes made to the Graph since the
+  transformer was last applied. Transformers which don't support it (SupportsApplyToNodes returns false) are applied
+  to the whole Graph.
+  @param[out] modified Set to true if the Graph was modified.
+  @returns Status with success or error information.
+  */
+  common::Status ApplyToNodes(Graph& graph, const InlinedHashSet<NodeIndex>& nodes, bool& modified,
+                              const logging::Logger& logger) const;
+
   virtual bool ShouldOnlyApplyOnce() const { return false; }
 
+  /** Gets the op types of the Nodes the transformer starts matching from. If the Graph and its subgraphs contain none
+  of them the transformer can't modify the Graph and GraphTransformerManager skips it.
+  If empty, the transformer may modify any Graph. */
+  virtual std::vector<std::string> TargetOpTypes() const { return {}; }
+
+  /** Whether the transformer overrides ApplyToNodesImpl to only apply to the given Nodes. */
+  virtual bool SupportsApplyToNodes() const { return false; }
+
  protected:
   /** Helper method to call ApplyImpl on any subgraphs in the Node. */
   common::Status Recurse(Node& node, bool& modified, int graph_level, const logging::Logger& logger) const {
@@ -67,6 +86,13 @@ class GraphTransformer {
   virtual common::Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger)
       const = 0;
 
+  // Apply the transform to the given nodes of the main graph and their subgraphs. Applies to the whole graph unless
+  // overridden, in which case SupportsApplyToNodes should return true.
+  virtual common::Status ApplyToNodesImpl(Graph& graph, const InlinedHashSet<NodeIndex>& /*nodes*/, bool& modified,
+                                          const logging::Logger& logger) const {
+    return ApplyImpl(graph, modified, 0, logger);
+  }
+
   const std::string name_;
   const InlinedHashSet<std::string_view> compatible_provider_types_;
 };
@@ -53,6 +53,12 @@ class RuleBasedGraphTransformer : public GraphTransformer {
   /** Returns the total number of rules that are registered in this transformer. */
   size_t RulesCount() const;
 
+  /** The op types of the registered rules, or none if a rule is evaluated on all op types. */
+  std::vector<std::string> TargetOpTypes() const override;
+
+  /** Rules match a Node and its neighbors, so the transformer can be applied to the Nodes around the changes. */
+  bool SupportsApplyToNodes() const override { return true; }
+
  protected:
   /** Applies the given set of rewrite rules on the Node of this Graph.
       @param[in] graph The Graph.
@@ -77,6 +83,14 @@ class RuleBasedGraphTransformer : public GraphTransformer {
 
   // Performs a single top-down traversal of the graph and applies all registered rules.
   common::Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  // Performs a single top-down traversal of the given nodes of the main graph and their subgraphs.
+  common::Status ApplyToNodesImpl(Graph& graph, const InlinedHashSet<NodeIndex>& nodes, bool& modified,
+                                  const logging::Logger& logger) const override;
+
+  // Applies the rules to the nodes of the graph in topological order, or only to the ones in 'nodes' if not null.
+  common::Status ApplyInTopologicalOrder(Graph& graph, const InlinedHashSet<NodeIndex>* nodes, bool& modified,
+                                         int graph_level, const logging::Logger& logger) const;
 };
 
 }  // namespace onnxruntime
@@ -30,7 +30,7 @@
 *
 * This value is used by some API functions to behave as this version of the header expects.
 */
-#define ORT_API_VERSION 12
+#define ORT_API_VERSION 13
 
 #ifdef __cplusplus
 extern "C" {
@@ -582,6 +582,17 @@ typedef OrtCustomThreadHandle (*OrtCustomCreateThreadFn)(void* ort_custom_thread
 */
 typedef void (*OrtCustomJoinThreadFn)(OrtCustomThreadHandle ort_custom_thread_handle);
 
+/** \brief Completion callback of OrtApi::RunAsync
+*
+* \param[in] user_data The user_data passed to OrtApi::RunAsync
+* \param[in] outputs The outputs array passed to OrtApi::RunAsync. On success it holds the outputs of the run.
+* \param[in] num_outputs Number of elements in the outputs array
+* \param[in] status nullptr on success, otherwise the error of the run. It is owned by the callback and must be
+*     released with OrtApi::ReleaseStatus.
+*/
+typedef void(ORT_API_CALL* OrtRunAsyncCallbackFn)(_In_opt_ void* user_data, _In_ OrtValue** outputs,
+                                                  size_t num_outputs, _In_opt_ OrtStatusPtr status);
+
 /** \brief The C API
 *
 * All C API functions are defined inside this structure as pointers to functions.
@@ -3486,6 +3497,78 @@ struct OrtApi {
   * \since Version 1.12.
   */
   ORT_CLASS_RELEASE(KernelInfo);
+
+  /// \name OrtSession
+  /// @{
+
+  /** \brief Get the cumulative per-node latency statistics of a session
+  *
+  * Statistics are only collected if the "session.enable_node_stats" session config entry is set to "1"
+  * (see onnxruntime_session_options_config_keys.h). They accumulate across all Run calls since the session was
+  * initialized or OrtApi::SessionResetNodeStats was last called.
+  *
+  * The result is a JSON document with two arrays. "nodes" has an entry per node, including nodes in subgraphs
+  * whose names are prefixed with the path of the containing control flow node, and "op_types" has the entries
+  * aggregated per operator type. Each entry has the number of executions, the total, mean, min, p50, p90, p99 and
+  * max latency in microseconds, and the total bytes of tensor inputs and outputs processed.
+  *
+  * \param[in] session
+  * \param[in] allocator Allocator used to allocate the returned string
+  * \param[out] out Null terminated string with the statistics as JSON. Must be freed using the allocator.
+  *
+  * \snippet{doc} snippets.dox OrtStatus Return Value
+  *
+  * \since Version 1.13.
+  */
+  ORT_API2_STATUS(SessionGetNodeStats, _In_ const OrtSession* session, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
+
+  /** \brief Clear the per-node latency statistics of a session
+  *
+  * \param[in] session
+  *
+  * \snippet{doc} snippets.dox OrtStatus Return Value
+  *
+  * \since Version 1.13.
+  */
+  ORT_API2_STATUS(SessionResetNodeStats, _Inout_ OrtSession* session);
+
+  /** \brief Run the model asynchronously
+  *
+  * Same as OrtApi::Run, except that the run is scheduled on the intra op thread pool of the session and this
+  * function returns without waiting for it. `callback` is called with the outputs or the error once the run
+  * completes, on the thread that executed it. It is called on the calling thread, before this function returns, if
+  * the thread pool could not enqueue the run. This lets a caller have many runs in flight without blocking one
+  * thread per run.
+  *
+  * The names and the ::OrtRunOptions are copied, and the input ::OrtValue%s are referenced by the run, so only the
+  * data of the inputs and the `outputs` array must stay valid until `callback` is called. The session must not be
+  * released before `callback` has been called for all its pending runs.
+  *
+  * \param[in] session The session must have an intra op thread pool, so intra_op_num_threads must not be 1.
+  * \param[in] run_options If nullptr, will use a default ::OrtRunOptions
+  * \param[in] input_names Array of null terminated UTF8 encoded strings of the input names
+  * \param[in] inputs Array of ::OrtValue%s of the input values
+  * \param[in] input_len Number of elements in the input_names and inputs arrays
+  * \param[in] output_names Array of null terminated UTF8 encoded strings of the output names
+  * \param[in] output_names_len Number of elements in the output_names and outputs array
+  * \param[in,out] outputs Array of ::OrtValue%s that the outputs are stored in, passed to `callback`. As with
+  *     OrtApi::Run it can hold nullptr values, in this case the ::OrtValue objects are allocated by the run.
+  * \param[in] callback Called once with the result of the run if this function succeeds. Not called otherwise.
+  * \param[in] user_data Passed to `callback`
+  *
+  * \snippet{doc} snippets.dox OrtStatus Return Value
+  *
+  * \since Version 1.13.
+  */
+  ORT_API2_STATUS(RunAsync, _Inout_ OrtSession* session, _In_opt_ const OrtRunOptions* run_options,
+                  _In_reads_(input_len) const char* const* input_names,
+                  _In_reads_(input_len) const OrtValue* const* inputs, size_t input_len,
+                  _In_reads_(output_names_len) const char* const* output_names, size_t output_names_len,
+                  _Inout_updates_all_(output_names_len) OrtValue** outputs,
+                  _In_ OrtRunAsyncCallbackFn callback, _In_opt_ void* user_data);
+
+  /// @}
 };
 
 /*
@@ -16,6 +16,7 @@
 #include "onnxruntime_c_api.h"
 #include <cstddef>
 #include <array>
+#include <future>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -543,6 +544,28 @@ struct Session : Base<OrtSession> {
 
   void Run(const RunOptions& run_options, const struct IoBinding&);  ///< Wraps OrtApi::RunWithBinding
 
+  /** \brief Run the model asynchronously, calling a callback with the results in user provided outputs
+  *
+  * Wraps OrtApi::RunAsync. The data of the inputs and the output_values array must stay valid until the
+  * callback is called.
+  */
+  void RunAsync(const RunOptions& run_options, const char* const* input_names, const Value* input_values, size_t input_count,
+                const char* const* output_names, Value* output_values, size_t output_count,
+                OrtRunAsyncCallbackFn callback, void* user_data);
+
+#ifndef ORT_NO_EXCEPTIONS
+  /** \brief Run the model asynchronously, returning a future of the results
+  *
+  * Wraps OrtApi::RunAsync. The data of the inputs must stay valid until the future is ready. If the run fails, the
+  * future holds an Ort::Exception.
+  *
+  * \return A future of the std::vector of Value objects that directly maps to the output_count
+  */
+  std::future<std::vector<Value>> RunAsync(const RunOptions& run_options, const char* const* input_names,
+                                           const Value* input_values, size_t input_count,
+                                           const char* const* output_names, size_t output_count);
+#endif
+
   size_t GetInputCount() const;                   ///< Returns the number of model inputs
   size_t GetOutputCount() const;                  ///< Returns the number of model outputs
   size_t GetOverridableInitializerCount() const;  ///< Returns the number of inputs that have defaults that can be overridden
@@ -610,6 +633,15 @@ struct Session : Base<OrtSession> {
   */
   AllocatedStringPtr EndProfilingAllocated(OrtAllocator* allocator) const;  ///< Wraps OrtApi::SessionEndProfiling
   uint64_t GetProfilingStartTimeNs() const;                                 ///< Wraps OrtApi::SessionGetProfilingStartTimeNs
+
+  /** \brief Returns the per-node latency statistics as JSON.
+  *
+  * \param allocator to allocate memory for the string returned
+  * \return a instance of smart pointer that would deallocate the buffer when out of scope.
+  */
+  AllocatedStringPtr GetNodeStatsAllocated(OrtAllocator* allocator) const;  ///< Wraps OrtApi::SessionGetNodeStats
+  void ResetNodeStats();                                                    ///< Wraps OrtApi::SessionResetNodeStats
+
   ModelMetadata GetModelMetadata() const;                                   ///< Wraps OrtApi::SessionGetModelMetadata
 
   TypeInfo GetInputTypeInfo(size_t index) const;                   ///< Wraps OrtApi::SessionGetInputTypeInfo
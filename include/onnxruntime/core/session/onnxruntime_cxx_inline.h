@@ -626,6 +626,53 @@ inline void Session::Run(const RunOptions& run_options, const IoBinding& io_bind
   ThrowOnError(GetApi().RunWithBinding(p_, run_options, io_binding));
 }
 
+inline void Session::RunAsync(const RunOptions& run_options, const char* const* input_names, const Value* input_values, size_t input_count,
+                              const char* const* output_names, Value* output_values, size_t output_count,
+                              OrtRunAsyncCallbackFn callback, void* user_data) {
+  static_assert(sizeof(Value) == sizeof(OrtValue*), "Value is really just an array of OrtValue* in memory, so we can reinterpret_cast safely");
+  auto ort_input_values = reinterpret_cast<const OrtValue**>(const_cast<Value*>(input_values));
+  auto ort_output_values = reinterpret_cast<OrtValue**>(output_values);
+  ThrowOnError(GetApi().RunAsync(p_, run_options, input_names, ort_input_values, input_count, output_names, output_count,
+                                 ort_output_values, callback, user_data));
+}
+
+#ifndef ORT_NO_EXCEPTIONS
+namespace detail {
+// State of a Session::RunAsync returning a future, owned by the run until its callback
+struct AsyncRun {
+  std::promise<std::vector<Value>> promise;
+  std::vector<Value> outputs;
+
+  static void ORT_API_CALL OnCompletion(void* user_data, OrtValue** /*outputs*/, size_t /*num_outputs*/, OrtStatusPtr status) {
+    std::unique_ptr<AsyncRun> async_run{static_cast<AsyncRun*>(user_data)};
+    if (status != nullptr) {
+      std::string error_message = GetApi().GetErrorMessage(status);
+      OrtErrorCode error_code = GetApi().GetErrorCode(status);
+      GetApi().ReleaseStatus(status);
+      async_run->promise.set_exception(std::make_exception_ptr(Exception(std::move(error_message), error_code)));
+    } else {
+      async_run->promise.set_value(std::move(async_run->outputs));
+    }
+  }
+};
+}  // namespace detail
+
+inline std::future<std::vector<Value>> Session::RunAsync(const RunOptions& run_options, const char* const* input_names,
+                                                         const Value* input_values, size_t input_count,
+                                                         const char* const* output_names, size_t output_count) {
+  auto async_run = std::make_unique<detail::AsyncRun>();
+  for (size_t i = 0; i < output_count; i++)
+    async_run->outputs.emplace_back(nullptr);
+  auto future = async_run->promise.get_future();
+
+  RunAsync(run_options, input_names, input_values, input_count, output_names, async_run->outputs.data(), output_count,
+           detail::AsyncRun::OnCompletion, async_run.get());
+  // owned by the run from now on, the callback may already have been called
+  async_run.release();
+  return future;
+}
+#endif
+
 inline size_t Session::GetInputCount() const {
   size_t out;
   ThrowOnError(GetApi().SessionGetInputCount(p_, &out));
@@ -698,6 +745,16 @@ inline uint64_t Session::GetProfilingStartTimeNs() const {
   return out;
 }
 
+inline AllocatedStringPtr Session::GetNodeStatsAllocated(OrtAllocator* allocator) const {
+  char* out;
+  ThrowOnError(GetApi().SessionGetNodeStats(p_, allocator, &out));
+  return AllocatedStringPtr(out, detail::AllocatedFree(allocator));
+}
+
+inline void Session::ResetNodeStats() {
+  ThrowOnError(GetApi().SessionResetNodeStats(p_));
+}
+
 inline ModelMetadata Session::GetModelMetadata() const {
   OrtModelMetadata* out;
   ThrowOnError(GetApi().SessionGetModelMetadata(p_, &out));
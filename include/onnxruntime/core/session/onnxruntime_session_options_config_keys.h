@@ -126,3 +126,97 @@ static const char* const kOrtSessionOptionsConfigForceSpinningStop = "session.fo
 // "0": in some cases warnings will be logged but processing will continue. The default.
 // May be useful to expose bugs in models.
 static const char* const kOrtSessionOptionsConfigStrictShapeTypeInference = "session.strict_shape_type_inference";
+
+// "1": collect cumulative per-node latency histograms and bytes processed for every Run.
+// The statistics can be queried with OrtApi::SessionGetNodeStats and cleared with OrtApi::SessionResetNodeStats.
+// "0": statistics are not collected. The default.
+// Collection requires reading a clock and the input/output sizes for each node executed, which adds a small
+// overhead per node.
+static const char* const kOrtSessionOptionsConfigEnableNodeStats = "session.enable_node_stats";
+
+// How the offsets of the activations in the memory pattern buffer are chosen when enable_mem_pattern is set.
+// "trace": each activation is placed when it is allocated in the first Run, in the best-fitting free gap. The default.
+// "greedy_by_size": after the first Run the lifetimes of all the activations are known, and the offsets are
+// re-planned placing the largest activations first.
+// "greedy_by_breadth": like "greedy_by_size", placing first the activations that are live when the total size of
+// the live activations is the largest.
+// "min_peak": the best of "greedy_by_size" and "greedy_by_breadth".
+// A re-planned layout is only used if it has a lower peak than the "trace" one.
+static const char* const kOrtSessionOptionsConfigMemoryPatternStrategy = "session.memory_pattern_strategy";
+
+// "1": for models whose inputs have symbolic dimensions, the memory pattern is planned at session initialization for
+// all the shapes of the inputs, from the dims of the activations given as expressions over the symbolic dims of the
+// inputs, e.g. "2*sequence + 1" as written by symbolic_shape_infer.py. The offsets for new input shapes are then
+// computed without tracing a Run, so the first Run with a new sequence length already uses the memory pattern.
+// Activations whose shape can't be expressed this way are allocated dynamically. Requires enable_mem_pattern and
+// the sequential execution mode. Defaults to "0".
+static const char* const kOrtSessionOptionsConfigSymbolicMemoryPattern = "session.symbolic_memory_pattern";
+
+// "1": the kernels of the operators of the built-in domains assigned to the CPU execution provider are created and
+// their constant initializers are pre-packed concurrently on the intra-op thread pool during session initialization.
+// "0": kernels are created and pre-packed one at a time. The default.
+// Kernels of other execution providers and custom operators are always created sequentially as their constructors
+// are not known to be thread safe.
+static const char* const kOrtSessionOptionsConfigParallelInitialization = "session.parallel_initialization";
+
+// "1": the Python bindings return the CPU tensor outputs of InferenceSession.run and IOBinding.copy_outputs_to_cpu as
+// numpy arrays that wrap the output buffers of onnxruntime instead of copies of them. Each array keeps its buffer alive
+// through its base object, so the buffer is released when the last array or view using it is released.
+// "0": the outputs are copied into new numpy arrays. The default.
+// With an IOBinding, the arrays share the memory of the bound outputs, which a later run using the same binding may
+// overwrite. String tensors and tensors on other devices are always copied.
+static const char* const kOrtSessionOptionsConfigPythonZeroCopyOutputs = "session.python_zero_copy_outputs";
+
+// Tensors for which the statistics used to calibrate the static quantization of the model are collected, as in
+// onnxruntime/python/tools/quantization/calibrate.py. "*" collects all the float and float16 tensors of the main graph
+// which aren't initializers, otherwise the value is a comma separated list of tensor names. Not set by default.
+// The minimum and maximum values of the tensors, and their histograms if kOrtSessionOptionsConfigCalibrationHistogramBins
+// is set, accumulate over the Run calls as the nodes are executed, without adding the tensors to the graph outputs.
+// Graph optimizations may remove or rename the tensors, so they should be disabled.
+static const char* const kOrtSessionOptionsConfigCalibrationTensors = "session.calibration_tensors";
+
+// Number of bins of the histograms of the tensors of kOrtSessionOptionsConfigCalibrationTensors.
+// "0": only the minimum and maximum values are collected. The default.
+static const char* const kOrtSessionOptionsConfigCalibrationHistogramBins = "session.calibration_histogram_bins";
+
+// Enable the incremental application of the graph transformers. "0": every transformer is applied to the whole graph
+// in each graph transformation step. The default. "1": incremental.
+// When incremental, a transformer isn't applied again until the graph changes, nor while the graph has none of the op
+// types it matches, and Graph::Resolve skips the inferencing and verification of the unchanged nodes.
+// Only BiasGeluFusion, GemmActivationFusion and MatMulAddFusion declare the op types they match. The rule based
+// transformers are only applied again to the changed nodes and their direct producers and consumers, so a pattern
+// completed by a change further away from its matched node isn't rewritten.
+static const char* const kOrtSessionOptionsEnableIncrementalGraphTransformation =
+    "optimization.enable_incremental_graph_transformation";
+
+// Evaluate the nodes folded by constant folding in parallel on the intra-op thread pool. "0": disabled. The default.
+// "1": the nodes which only depend on constants are evaluated together in parallel, then the nodes depending on them.
+static const char* const kOrtSessionOptionsConstantFoldingParallel = "optimization.constant_folding_parallel";
+
+// Limits on the size of the initializers created by constant folding. A node is not folded if the size in bytes of
+// its outputs exceeds the ratio times the size of its constant inputs, or the absolute size.
+// "0": no limit. The default for both.
+static const char* const kOrtSessionOptionsConstantFoldingMaxOutputToInputSizeRatio =
+    "optimization.constant_folding_max_output_to_input_size_ratio";
+static const char* const kOrtSessionOptionsConstantFoldingMaxOutputSizeInBytes =
+    "optimization.constant_folding_max_output_size_in_bytes";
+
+// Fuse the chains of float element-wise operators assigned to the CPU execution provider into FusedElementwise
+// nodes with the level 2 optimizations. "0": disabled. The default. "1": enabled.
+// The fused steps use the implementations of the unfused kernels, but the vectorized loops split the tensors
+// differently, so the results may differ in the last bits as with the other opt-in fusions.
+static const char* const kOrtSessionOptionsEnableElementwiseFusion = "optimization.enable_elementwise_fusion";
+
+// Use the NHWC layout for the float convolutions and pooling operators assigned to the CPU execution provider.
+// "0": the NCHWc layout transformer handles float models if the platform supports it. The default.
+// "1": the NhwcTransformer converts the float Conv, FusedConv, MaxPool, AveragePool and GlobalAveragePool nodes to
+// their NHWC kernels and the transpose optimizer pushes the layout change through the operators between them.
+// The NCHWc layout transformer is not registered in this case.
+static const char* const kOrtSessionOptionsEnableNhwcFloatLayout = "optimization.enable_nhwc_float_layout";
+
+// Peak size in bytes of the activations of the main graph to reach by recomputing cheap intermediate values (element-wise,
+// Cast, Expand, Tile, Transpose and Resize outputs) right before their late consumers instead of keeping them allocated.
+// The lifetimes are estimated for the static shapes as the allocation planner computes them. The achieved peak and
+// the extra operations are logged. Applied with the level 3 optimizations. "0": disabled. The default.
+static const char* const kOrtSessionOptionsRematerializationMemoryBudget =
+    "optimization.rematerialization_memory_budget";
@@ -3,6 +3,7 @@
 
 #include "attention_cpu_base.h"
 #include "attention_helper.h"
+#include "core/providers/cpu/kernel_cost_utils.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/graph/onnx_protobuf.h"
 #include "core/util/math.h"
@@ -28,6 +29,8 @@ class Attention : public OpKernel, public AttentionCPUBase {
 
   Status Compute(OpKernelContext* context) const override;
 
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override;
+
   Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
                  /*out*/ bool& is_packed,
                  /*out*/ PrePackedWeights* prepacked_weights) override;
@@ -566,5 +569,51 @@ Status Attention<T>::Compute(OpKernelContext* context) const {
                         qkv_head_size[0], qkv_head_size[2], v_hidden_size,
                         extra_add_qk, context);
 }
+
+template <typename T>
+bool Attention<T>::GetCost(const OpKernelContext& context, KernelCost& cost) const {
+  const Tensor* input = context.Input<Tensor>(0);
+  const Tensor* weights = is_prepack_ ? nullptr : context.Input<Tensor>(1);
+  const Tensor* past = context.Input<Tensor>(4);
+  const TensorShape& weights_shape = (weights ? weights->Shape() : weight_shape_);
+
+  const auto shape = input->Shape().GetDims();
+  const double batch_size = static_cast<double>(shape[0]);
+  const double sequence_length = static_cast<double>(shape[1]);
+  const double input_hidden_size = static_cast<double>(shape[2]);
+  const double all_sequence_length = sequence_length + (past != nullptr ? static_cast<double>(past->Shape()[3]) : 0.0);
+
+  double q_hidden_size = static_cast<double>(weights_shape[1]) / 3;
+  double k_hidden_size = q_hidden_size;
+  double v_hidden_size = q_hidden_size;
+  if (qkv_hidden_sizes_.size() != 0) {
+    q_hidden_size = static_cast<double>(qkv_hidden_sizes_[0]);
+    k_hidden_size = static_cast<double>(qkv_hidden_sizes_[1]);
+    v_hidden_size = static_cast<double>(qkv_hidden_sizes_[2]);
+  }
+
+  const double num_heads = static_cast<double>(num_heads_);
+  const double score_size = batch_size * num_heads * sequence_length * all_sequence_length;
+
+  // QKV projection: input(BS, D) x weights(D, H1 + H2 + H3) + bias
+  cost.flops = 2.0 * batch_size * sequence_length * input_hidden_size * (q_hidden_size + k_hidden_size + v_hidden_size);
+  // Q x K' per head, and the scaled, masked softmax of the scores (roughly 5 operations per score)
+  cost.flops += 2.0 * score_size * (q_hidden_size / num_heads) + 5.0 * score_size;
+  // softmax(Q x K') x V per head
+  cost.flops += 2.0 * score_size * (v_hidden_size / num_heads);
+
+  cost.bytes_read = kernel_cost_utils::InputBytes(context);
+  if (weights == nullptr) {
+    cost.bytes_read += kernel_cost_utils::ShapeBytes(weights_shape, sizeof(T));
+  }
+
+  cost.bytes_written = batch_size * sequence_length * v_hidden_size * sizeof(T);
+  if (context.OutputCount() > 1) {
+    // present state holds K and V for all the sequence
+    cost.bytes_written += batch_size * all_sequence_length * (k_hidden_size + v_hidden_size) * sizeof(T);
+  }
+  return true;
+}
+
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -0,0 +1,215 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
+#include "core/util/math_cpuonly.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Sum or mean of bags of rows of an embedding table, created by the EmbeddingBagFusion transformer from Gather
+// followed by ReduceSum or ReduceMean. Each bag is accumulated directly into its output row instead of
+// materializing the gathered rows, and the bags are processed in parallel.
+class EmbeddingBag final : public OpKernel {
+ public:
+  explicit EmbeddingBag(const OpKernelInfo& info) : OpKernel(info) {
+    const std::string mode = info.GetAttrOrDefault<std::string>("mode", "sum");
+    ORT_ENFORCE(mode == "sum" || mode == "mean", "The 'mode' attribute of EmbeddingBag must be 'sum' or 'mean', got ",
+                mode);
+    mean_ = mode == "mean";
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  template <typename T, typename Tind>
+  Status ComputeImpl(OpKernelContext* context, const Tensor& weight, const Tensor& indices, const Tensor* offsets,
+                     const Tensor* per_sample_weights, const Tensor* scale, const Tensor* zero_point) const;
+
+  bool mean_;
+};
+
+ONNX_OPERATOR_KERNEL_EX(
+    EmbeddingBag,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", {DataTypeImpl::GetTensorType<float>(),
+                              DataTypeImpl::GetTensorType<int8_t>(),
+                              DataTypeImpl::GetTensorType<uint8_t>()})
+        .TypeConstraint("Tind", {DataTypeImpl::GetTensorType<int32_t>(),
+                                 DataTypeImpl::GetTensorType<int64_t>()}),
+    EmbeddingBag);
+
+namespace {
+
+// output += weight * row
+inline void AccumulateRow(const float* row, float weight, float /*zero_point*/, int64_t embedding_dim,
+                          float* output) {
+  EigenVectorArrayMap<float> output_map(output, embedding_dim);
+  output_map += ConstEigenVectorArrayMap<float>(row, embedding_dim) * weight;
+}
+
+// output += scale * (row - zero_point), with the scale of the row multiplied by its weight
+template <typename T>
+inline void AccumulateRow(const T* row, float scale, float zero_point, int64_t embedding_dim, float* output) {
+  EigenVectorArrayMap<float> output_map(output, embedding_dim);
+  output_map += (ConstEigenVectorArrayMap<T>(row, embedding_dim).template cast<float>() - zero_point) * scale;
+}
+
+}  // namespace
+
+template <typename T, typename Tind>
+Status EmbeddingBag::ComputeImpl(OpKernelContext* context, const Tensor& weight, const Tensor& indices,
+                                 const Tensor* offsets, const Tensor* per_sample_weights, const Tensor* scale,
+                                 const Tensor* zero_point) const {
+  const int64_t num_embeddings = weight.Shape()[0];
+  const int64_t embedding_dim = weight.Shape()[1];
+  const int64_t num_indices = indices.Shape().Size();
+  const Tind* indices_data = indices.Data<Tind>();
+
+  // Check the indices first in case there's a out of bound index.
+  for (int64_t i = 0; i < num_indices; ++i) {
+    const int64_t idx = static_cast<int64_t>(indices_data[i]);
+    ORT_RETURN_IF(idx < -num_embeddings || idx >= num_embeddings, "indices element out of data bounds, idx=", idx,
+                  " must be within the inclusive range [", -num_embeddings, ",", num_embeddings - 1, "]");
+  }
+
+  // bag b is [bag_begin(b), bag_begin(b + 1)) of the indices
+  int64_t num_bags = 0;
+  int64_t bag_size = 0;
+  const Tind* offsets_data = nullptr;
+  if (offsets == nullptr) {
+    num_bags = indices.Shape()[0];
+    bag_size = indices.Shape()[1];
+  } else {
+    num_bags = offsets->Shape()[0];
+    offsets_data = offsets->Data<Tind>();
+    for (int64_t b = 0; b < num_bags; ++b) {
+      const int64_t end = b + 1 < num_bags ? static_cast<int64_t>(offsets_data[b + 1]) : num_indices;
+      ORT_RETURN_IF(offsets_data[b] < 0 || offsets_data[b] > end || end > num_indices,
+                    "offsets must be non-decreasing and within [0, ", num_indices, "], got ", offsets_data[b],
+                    " at position ", b);
+    }
+  }
+
+  auto bag_begin = [&](int64_t b) -> int64_t {
+    if (offsets_data == nullptr) {
+      return b * bag_size;
+    }
+    return b < num_bags ? static_cast<int64_t>(offsets_data[b]) : num_indices;
+  };
+
+  Tensor* output = context->Output(0, {num_bags, embedding_dim});
+  if (num_bags == 0 || embedding_dim == 0) {
+    return Status::OK();
+  }
+
+  const T* weight_data = weight.Data<T>();
+  const float* per_sample_weights_data = per_sample_weights != nullptr ? per_sample_weights->Data<float>() : nullptr;
+  const float* scale_data = scale != nullptr ? scale->Data<float>() : nullptr;
+  const T* zero_point_data = zero_point != nullptr ? zero_point->Data<T>() : nullptr;
+  float* output_data = output->MutableData<float>();
+
+  const double average_bag_size = static_cast<double>(num_indices) / static_cast<double>(num_bags);
+  const TensorOpCost cost{average_bag_size * static_cast<double>(embedding_dim * sizeof(T)),
+                          static_cast<double>(embedding_dim * sizeof(float)),
+                          2.0 * average_bag_size * static_cast<double>(embedding_dim)};
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(num_bags), cost,
+      [&](std::ptrdiff_t first_bag, std::ptrdiff_t last_bag) {
+        for (std::ptrdiff_t b = first_bag; b < last_bag; ++b) {
+          float* y = output_data + b * embedding_dim;
+          EigenVectorArrayMap<float>(y, embedding_dim).setZero();
+
+          const int64_t begin = bag_begin(b);
+          const int64_t end = bag_begin(b + 1);
+          for (int64_t i = begin; i < end; ++i) {
+            int64_t row = static_cast<int64_t>(indices_data[i]);
+            row = row < 0 ? row + num_embeddings : row;
+
+            float row_scale = per_sample_weights_data != nullptr ? per_sample_weights_data[i] : 1.0f;
+            float row_zero_point = 0.0f;
+            if (scale_data != nullptr) {
+              row_scale *= scale_data[row];
+              row_zero_point = zero_point_data != nullptr ? static_cast<float>(zero_point_data[row]) : 0.0f;
+            }
+
+            AccumulateRow(weight_data + row * embedding_dim, row_scale, row_zero_point, embedding_dim, y);
+          }
+
+          if (mean_ && end > begin) {
+            EigenVectorArrayMap<float>(y, embedding_dim) *= 1.0f / static_cast<float>(end - begin);
+          }
+        }
+      });
+
+  return Status::OK();
+}
+
+Status EmbeddingBag::Compute(OpKernelContext* context) const {
+  const Tensor* weight = context->Input<Tensor>(0);
+  const Tensor* indices = context->Input<Tensor>(1);
+  const Tensor* offsets = context->Input<Tensor>(2);
+  const Tensor* per_sample_weights = context->Input<Tensor>(3);
+  const Tensor* scale = context->Input<Tensor>(4);
+  const Tensor* zero_point = context->Input<Tensor>(5);
+
+  const auto& weight_shape = weight->Shape();
+  ORT_RETURN_IF_NOT(weight_shape.NumDimensions() == 2, "weight must have 2 dimensions, got ", weight_shape);
+  const int64_t num_embeddings = weight_shape[0];
+
+  const auto& indices_shape = indices->Shape();
+  if (indices_shape.NumDimensions() == 2) {
+    ORT_RETURN_IF(offsets != nullptr, "offsets must not be provided with 2-D indices.");
+  } else {
+    ORT_RETURN_IF_NOT(indices_shape.NumDimensions() == 1, "indices must have 1 or 2 dimensions, got ", indices_shape);
+    ORT_RETURN_IF(offsets == nullptr, "offsets must be provided with 1-D indices.");
+    ORT_RETURN_IF_NOT(offsets->Shape().NumDimensions() == 1, "offsets must have 1 dimension, got ", offsets->Shape());
+    ORT_RETURN_IF_NOT(offsets->DataType() == indices->DataType(), "offsets must have the type of indices.");
+  }
+
+  if (per_sample_weights != nullptr) {
+    ORT_RETURN_IF(mean_, "per_sample_weights are only supported with mode 'sum'.");
+    ORT_RETURN_IF_NOT(per_sample_weights->Shape() == indices_shape, "per_sample_weights must have the shape ",
+                      indices_shape, " of indices, got ", per_sample_weights->Shape());
+  }
+
+  const bool is_quantized = !weight->IsDataType<float>();
+  if (is_quantized) {
+    ORT_RETURN_IF(scale == nullptr, "scale must be provided with a quantized table.");
+    ORT_RETURN_IF_NOT(scale->Shape().NumDimensions() == 1 && scale->Shape()[0] == num_embeddings,
+                      "scale must have the shape [", num_embeddings, "], got ", scale->Shape());
+    ORT_RETURN_IF_NOT(zero_point == nullptr || zero_point->Shape() == scale->Shape(),
+                      "zero_point must have the shape [", num_embeddings, "], got ", zero_point->Shape());
+  } else {
+    ORT_RETURN_IF(scale != nullptr || zero_point != nullptr,
+                  "scale and zero_point are only supported with a quantized table.");
+  }
+
+  const bool int32_indices = indices->IsDataType<int32_t>();
+  if (weight->IsDataType<float>()) {
+    return int32_indices
+               ? ComputeImpl<float, int32_t>(context, *weight, *indices, offsets, per_sample_weights, scale,
+                                             zero_point)
+               : ComputeImpl<float, int64_t>(context, *weight, *indices, offsets, per_sample_weights, scale,
+                                             zero_point);
+  }
+  if (weight->IsDataType<int8_t>()) {
+    return int32_indices
+               ? ComputeImpl<int8_t, int32_t>(context, *weight, *indices, offsets, per_sample_weights, scale,
+                                              zero_point)
+               : ComputeImpl<int8_t, int64_t>(context, *weight, *indices, offsets, per_sample_weights, scale,
+                                              zero_point);
+  }
+  return int32_indices
+             ? ComputeImpl<uint8_t, int32_t>(context, *weight, *indices, offsets, per_sample_weights, scale,
+                                             zero_point)
+             : ComputeImpl<uint8_t, int64_t>(context, *weight, *indices, offsets, per_sample_weights, scale,
+                                             zero_point);
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
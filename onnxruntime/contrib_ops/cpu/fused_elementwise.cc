@@ -0,0 +1,295 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "core/common/inlined_containers.h"
+#include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/platform/threadpool.h"
+#include "core/providers/cpu/kernel_cost_utils.h"
+#include "core/util/math_cpuonly.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Interpreter for a chain of element-wise operators created by the ElementwiseFusion transformer.
+// The input is processed in blocks that are small enough to stay in the L1 cache: each block is copied to the output
+// and all the steps are applied to it in place before moving on to the next block, so the input is read and the
+// output is written only once whatever the length of the chain.
+// Each step computes its operator as the unfused kernel does (Eigen or MLAS) so the fusion doesn't change the results.
+class FusedElementwise final : public OpKernel {
+ public:
+  explicit FusedElementwise(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override;
+
+ private:
+  enum class OpCode {
+    kAbs,
+    kCeil,
+    kErf,
+    kExp,
+    kFloor,
+    kLog,
+    kNeg,
+    kReciprocal,
+    kRelu,
+    kSigmoid,
+    kSqrt,
+    kTanh,
+    kAdd,
+    kSub,
+    kRSub,
+    kMul,
+    kDiv,
+    kRDiv,
+  };
+
+  struct Step {
+    OpCode op;
+    int operand;  // input index of the other argument of a binary step, -1 for a unary step
+  };
+
+  // The other argument of a binary step, which repeats every 'size' elements of the chain value.
+  struct Operand {
+    const float* data;
+    int64_t size;
+  };
+
+  void ApplySteps(float* values, int64_t start, int64_t count, gsl::span<const Operand> operands) const;
+
+  InlinedVector<Step> steps_;
+};
+
+ONNX_OPERATOR_KERNEL_EX(
+    FusedElementwise,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    FusedElementwise);
+
+namespace {
+
+// Number of elements processed by all the steps of the chain at once.
+constexpr int64_t kBlockSize = 1024;
+
+template <typename Fn>
+void ApplyUnary(float* values, int64_t count, Fn fn) {
+  for (int64_t i = 0; i < count; ++i) {
+    values[i] = fn(values[i]);
+  }
+}
+
+// Apply an Eigen array expression in place, as the unfused kernels of the operators implemented with Eigen.
+template <typename Fn>
+void ApplyEigen(float* values, int64_t count, Fn fn) {
+  EigenVectorArrayMap<float> value_map(values, count);
+  value_map = fn(value_map);
+}
+
+// Apply fn(value, operand) to the elements [start, start + count) of the chain value, 'values' pointing to the
+// element at 'start'.
+template <typename Fn>
+void ApplyBinary(float* values, int64_t start, int64_t count, const float* operand, int64_t operand_size, Fn fn) {
+  if (operand_size == 1) {
+    const float b = *operand;
+    for (int64_t i = 0; i < count; ++i) {
+      values[i] = fn(values[i], b);
+    }
+    return;
+  }
+
+  // the operand is repeated along the leading dimensions so process the block one repetition segment at a time
+  int64_t offset = start % operand_size;
+  while (count > 0) {
+    const int64_t segment = std::min(count, operand_size - offset);
+    const float* b = operand + offset;
+    for (int64_t i = 0; i < segment; ++i) {
+      values[i] = fn(values[i], b[i]);
+    }
+
+    values += segment;
+    count -= segment;
+    offset = 0;
+  }
+}
+
+}  // namespace
+
+FusedElementwise::FusedElementwise(const OpKernelInfo& info) : OpKernel(info) {
+  const auto ops = info.GetAttrsOrDefault<std::string>("ops");
+  const auto operands = info.GetAttrsOrDefault<int64_t>("operands");
+  ORT_ENFORCE(!ops.empty() && ops.size() == operands.size(),
+              "The 'ops' and 'operands' attributes must be non-empty and have the same size.");
+
+  static const InlinedHashMap<std::string, OpCode> op_codes = {
+      {"Abs", OpCode::kAbs},
+      {"Ceil", OpCode::kCeil},
+      {"Erf", OpCode::kErf},
+      {"Exp", OpCode::kExp},
+      {"Floor", OpCode::kFloor},
+      {"Log", OpCode::kLog},
+      {"Neg", OpCode::kNeg},
+      {"Reciprocal", OpCode::kReciprocal},
+      {"Relu", OpCode::kRelu},
+      {"Sigmoid", OpCode::kSigmoid},
+      {"Sqrt", OpCode::kSqrt},
+      {"Tanh", OpCode::kTanh},
+      {"Add", OpCode::kAdd},
+      {"Sub", OpCode::kSub},
+      {"RSub", OpCode::kRSub},
+      {"Mul", OpCode::kMul},
+      {"Div", OpCode::kDiv},
+      {"RDiv", OpCode::kRDiv},
+  };
+
+  const int num_inputs = static_cast<int>(info.GetInputCount());
+  steps_.reserve(ops.size());
+  for (size_t i = 0; i < ops.size(); ++i) {
+    auto it = op_codes.find(ops[i]);
+    ORT_ENFORCE(it != op_codes.end(), "Unsupported operator in FusedElementwise: ", ops[i]);
+
+    const bool is_binary = it->second >= OpCode::kAdd;
+    const int operand = static_cast<int>(operands[i]);
+    ORT_ENFORCE(is_binary ? (operand >= 0 && operand < num_inputs) : operand == -1,
+                "Invalid operand index ", operands[i], " for step ", i, " (", ops[i], ") of FusedElementwise.");
+
+    steps_.push_back({it->second, operand});
+  }
+}
+
+void FusedElementwise::ApplySteps(float* values, int64_t start, int64_t count,
+                                  gsl::span<const Operand> operands) const {
+  for (const auto& step : steps_) {
+    const Operand* operand = step.operand >= 0 ? &operands[step.operand] : nullptr;
+    switch (step.op) {
+      case OpCode::kAbs:
+        ApplyUnary(values, count, [](float a) { return std::abs(a); });
+        break;
+      case OpCode::kCeil:
+        ApplyUnary(values, count, [](float a) { return std::ceil(a); });
+        break;
+      case OpCode::kErf:
+        MlasComputeErf(values, values, static_cast<size_t>(count));
+        break;
+      case OpCode::kExp:
+        ApplyEigen(values, count, [](const EigenVectorArrayMap<float>& a) { return a.exp(); });
+        break;
+      case OpCode::kFloor:
+        ApplyUnary(values, count, [](float a) { return std::floor(a); });
+        break;
+      case OpCode::kLog:
+        ApplyEigen(values, count, [](const EigenVectorArrayMap<float>& a) { return a.log(); });
+        break;
+      case OpCode::kNeg:
+        ApplyUnary(values, count, [](float a) { return -a; });
+        break;
+      case OpCode::kReciprocal:
+        ApplyUnary(values, count, [](float a) { return 1.0f / a; });
+        break;
+      case OpCode::kRelu:
+        ApplyEigen(values, count, [](const EigenVectorArrayMap<float>& a) { return a.cwiseMax(0.0f); });
+        break;
+      case OpCode::kSigmoid:
+        MlasComputeLogistic(values, values, static_cast<size_t>(count));
+        break;
+      case OpCode::kSqrt:
+        ApplyUnary(values, count, [](float a) { return std::sqrt(a); });
+        break;
+      case OpCode::kTanh:
+        MlasComputeTanh(values, values, static_cast<size_t>(count));
+        break;
+      case OpCode::kAdd:
+        ApplyBinary(values, start, count, operand->data, operand->size, [](float a, float b) { return a + b; });
+        break;
+      case OpCode::kSub:
+        ApplyBinary(values, start, count, operand->data, operand->size, [](float a, float b) { return a - b; });
+        break;
+      case OpCode::kRSub:
+        ApplyBinary(values, start, count, operand->data, operand->size, [](float a, float b) { return b - a; });
+        break;
+      case OpCode::kMul:
+        ApplyBinary(values, start, count, operand->data, operand->size, [](float a, float b) { return a * b; });
+        break;
+      case OpCode::kDiv:
+        ApplyBinary(values, start, count, operand->data, operand->size, [](float a, float b) { return a / b; });
+        break;
+      case OpCode::kRDiv:
+        ApplyBinary(values, start, count, operand->data, operand->size, [](float a, float b) { return b / a; });
+        break;
+    }
+  }
+}
+
+Status FusedElementwise::Compute(OpKernelContext* context) const {
+  const Tensor* X = context->Input<Tensor>(0);
+  const auto& shape = X->Shape();
+  const auto dims = shape.GetDims();
+  const int64_t size = shape.Size();
+
+  // every operand must be a scalar or match the trailing dimensions of X once its leading 1s are removed so the
+  // chain value keeps the shape of X and the operand can be indexed with the flat offset modulo its size
+  const int num_inputs = context->InputCount();
+  InlinedVector<Operand> operands;
+  operands.reserve(num_inputs);
+  for (int i = 0; i < num_inputs; ++i) {
+    const Tensor* input = context->Input<Tensor>(i);
+    const auto input_dims = input->Shape().GetDims();
+    size_t first = 0;
+    while (first < input_dims.size() && input_dims[first] == 1) {
+      ++first;
+    }
+
+    const size_t rank = input_dims.size() - first;
+    bool valid = input_dims.size() <= dims.size();
+    for (size_t d = 0; valid && d < rank; ++d) {
+      valid = input_dims[first + d] == dims[dims.size() - rank + d];
+    }
+
+    ORT_RETURN_IF_NOT(valid, "FusedElementwise input ", i, " with shape ", input->Shape(),
+                      " is not a suffix broadcast of input 0 with shape ", shape);
+    operands.push_back({input->Data<float>(), input->Shape().Size()});
+  }
+
+  Tensor* Y = context->Output(0, shape);
+  if (size == 0) {
+    return Status::OK();
+  }
+
+  const float* x_data = X->Data<float>();
+  float* y_data = Y->MutableData<float>();
+  const int64_t num_blocks = (size + kBlockSize - 1) / kBlockSize;
+
+  // the chain value is computed in place in the output, which is read and written once per step
+  const TensorOpCost cost{static_cast<double>(kBlockSize * sizeof(float)),
+                          static_cast<double>(kBlockSize * sizeof(float)),
+                          static_cast<double>(kBlockSize * steps_.size())};
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), num_blocks, cost,
+      [&](std::ptrdiff_t first_block, std::ptrdiff_t last_block) {
+        for (std::ptrdiff_t block = first_block; block < last_block; ++block) {
+          const int64_t start = block * kBlockSize;
+          const int64_t count = std::min(kBlockSize, size - start);
+          float* values = y_data + start;
+          std::memcpy(values, x_data + start, static_cast<size_t>(count) * sizeof(float));
+
+          ApplySteps(values, start, count, operands);
+        }
+      });
+
+  return Status::OK();
+}
+
+bool FusedElementwise::GetCost(const OpKernelContext& context, KernelCost& cost) const {
+  kernel_cost_utils::ElementwiseCost(context, static_cast<double>(steps_.size()), sizeof(float), cost);
+  return true;
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
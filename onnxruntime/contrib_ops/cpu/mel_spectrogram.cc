@@ -0,0 +1,199 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <vector>
+
+#include "core/common/inlined_containers.h"
+#include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
+#include "core/providers/cpu/signal/fft.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Mel spectrogram front end of speech models: onesided STFT, magnitude or power of each frequency bin, projection on
+// the mel filter bank and optional log, created by the MelSpectrogramFusion transformer.
+// Each frame goes through all the steps while it is in the cache instead of materializing the complex spectrogram,
+// and only the non-zero band of each mel filter is multiplied instead of running a dense MatMul.
+class MelSpectrogram final : public OpKernel {
+ public:
+  explicit MelSpectrogram(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  // The mel weight matrix stored as the band between the first and the last non-zero weight of each filter, i.e. of
+  // each column of the matrix. The filters are triangular so the bands are a few bins wide.
+  struct FilterBank {
+    int64_t num_bins = 0;
+    InlinedVector<int64_t> begin;   // first bin of the band of each filter
+    InlinedVector<int64_t> offset;  // offset of the weights of each filter in 'weights', and the total size
+    std::vector<float> weights;
+  };
+
+  static Status BuildFilterBank(const Tensor& mel_weight_matrix, FilterBank& filter_bank);
+
+  int64_t power_;
+  bool apply_log_;
+  float log_offset_;
+
+  // set when the mel weight matrix is a constant initializer
+  std::unique_ptr<FilterBank> constant_filter_bank_;
+
+  mutable signal::FftPlanCache plan_cache_;
+};
+
+ONNX_OPERATOR_KERNEL_EX(
+    MelSpectrogram,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    MelSpectrogram);
+
+MelSpectrogram::MelSpectrogram(const OpKernelInfo& info) : OpKernel(info) {
+  power_ = info.GetAttrOrDefault<int64_t>("power", 2);
+  ORT_ENFORCE(power_ == 1 || power_ == 2, "The 'power' attribute of MelSpectrogram must be 1 or 2, got ", power_);
+  apply_log_ = info.GetAttrOrDefault<int64_t>("apply_log", 0) != 0;
+  log_offset_ = info.GetAttrOrDefault<float>("log_offset", 0.0f);
+
+  const Tensor* mel_weight_matrix = nullptr;
+  if (info.TryGetConstantInput(3, &mel_weight_matrix)) {
+    constant_filter_bank_ = std::make_unique<FilterBank>();
+    ORT_THROW_IF_ERROR(BuildFilterBank(*mel_weight_matrix, *constant_filter_bank_));
+  }
+}
+
+Status MelSpectrogram::BuildFilterBank(const Tensor& mel_weight_matrix, FilterBank& filter_bank) {
+  const auto& shape = mel_weight_matrix.Shape();
+  ORT_RETURN_IF_NOT(shape.NumDimensions() == 2, "The mel weight matrix must have 2 dimensions, got ", shape);
+
+  const int64_t num_bins = shape[0];
+  const int64_t num_mel_bins = shape[1];
+  const float* weights = mel_weight_matrix.Data<float>();
+
+  filter_bank.num_bins = num_bins;
+  filter_bank.begin.assign(static_cast<size_t>(num_mel_bins), 0);
+  filter_bank.offset.assign(static_cast<size_t>(num_mel_bins) + 1, 0);
+  filter_bank.weights.clear();
+  for (int64_t m = 0; m < num_mel_bins; ++m) {
+    int64_t first = 0;
+    while (first < num_bins && weights[first * num_mel_bins + m] == 0.0f) {
+      ++first;
+    }
+
+    int64_t last = num_bins;
+    while (last > first && weights[(last - 1) * num_mel_bins + m] == 0.0f) {
+      --last;
+    }
+
+    filter_bank.begin[m] = first;
+    for (int64_t bin = first; bin < last; ++bin) {
+      filter_bank.weights.push_back(weights[bin * num_mel_bins + m]);
+    }
+    filter_bank.offset[m + 1] = static_cast<int64_t>(filter_bank.weights.size());
+  }
+
+  return Status::OK();
+}
+
+Status MelSpectrogram::Compute(OpKernelContext* context) const {
+  const Tensor* signal = context->Input<Tensor>(0);
+  const Tensor* frame_step_tensor = context->Input<Tensor>(1);
+  const Tensor* window = context->Input<Tensor>(2);
+
+  const auto& signal_shape = signal->Shape();
+  ORT_RETURN_IF_NOT(signal_shape.NumDimensions() == 2 || (signal_shape.NumDimensions() == 3 && signal_shape[2] == 1),
+                    "MelSpectrogram expects real signals of shape [batch_size, signal_length] or "
+                    "[batch_size, signal_length, 1], got ",
+                    signal_shape);
+  ORT_RETURN_IF_NOT(frame_step_tensor->Shape().Size() == 1, "frame_step must be a scalar.");
+  ORT_RETURN_IF_NOT(window->Shape().NumDimensions() == 1, "window must have 1 dimension, got ", window->Shape());
+
+  const int64_t batch_size = signal_shape[0];
+  const int64_t signal_length = signal_shape[1];
+  const int64_t frame_step = *frame_step_tensor->Data<int64_t>();
+  const int64_t frame_length = window->Shape()[0];
+  ORT_RETURN_IF_NOT(frame_step > 0, "frame_step must be greater than zero, got ", frame_step);
+  // as STFT, which the fused node replaces, the window must be shorter than the signal
+  ORT_RETURN_IF_NOT(frame_length > 0 && frame_length < signal_length,
+                    "The window length must be at least 1 and smaller than the signal length ", signal_length,
+                    ", got ", frame_length);
+
+  FilterBank filter_bank_storage;
+  const FilterBank* filter_bank = constant_filter_bank_.get();
+  if (filter_bank == nullptr) {
+    ORT_RETURN_IF_ERROR(BuildFilterBank(*context->Input<Tensor>(3), filter_bank_storage));
+    filter_bank = &filter_bank_storage;
+  }
+
+  // the onesided transform of a real frame has frame_length / 2 + 1 frequency bins
+  const int64_t num_bins = (frame_length >> 1) + 1;
+  ORT_RETURN_IF_NOT(filter_bank->num_bins == num_bins, "The mel weight matrix has ", filter_bank->num_bins,
+                    " rows but the window length of ", frame_length, " gives ", num_bins, " frequency bins.");
+
+  const int64_t num_mel_bins = static_cast<int64_t>(filter_bank->begin.size());
+  const int64_t num_frames = (signal_length - frame_length) / frame_step + 1;
+  Tensor* Y = context->Output(0, {batch_size, num_frames, num_mel_bins});
+
+  const int64_t total_frames = batch_size * num_frames;
+  if (total_frames == 0) {
+    return Status::OK();
+  }
+
+  const auto plan = plan_cache_.Get<float>(static_cast<size_t>(frame_length), false);
+  const float* signal_data = signal->Data<float>();
+  const float* window_data = window->Data<float>();
+  float* Y_data = Y->MutableData<float>();
+
+  const double length = static_cast<double>(frame_length);
+  const TensorOpCost cost{length * sizeof(float), static_cast<double>(num_mel_bins * sizeof(float)),
+                          5.0 * length * std::max(1.0, std::log2(length)) + 4.0 * static_cast<double>(num_bins) +
+                              2.0 * static_cast<double>(filter_bank->weights.size())};
+  concurrency::ThreadPool::TryParallelFor(
+      context->GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(total_frames), cost,
+      [&](std::ptrdiff_t first_frame, std::ptrdiff_t last_frame) {
+        std::vector<float> frame(static_cast<size_t>(frame_length));
+        std::vector<std::complex<float>> spectrum(static_cast<size_t>(num_bins));
+        std::vector<std::complex<float>> scratch(plan->ScratchSize());
+        std::vector<float> magnitudes(static_cast<size_t>(num_bins));
+
+        for (std::ptrdiff_t f = first_frame; f < last_frame; ++f) {
+          const int64_t batch_idx = f / num_frames;
+          const int64_t frame_idx = f % num_frames;
+          const float* x = signal_data + batch_idx * signal_length + frame_idx * frame_step;
+          for (int64_t j = 0; j < frame_length; ++j) {
+            frame[j] = x[j] * window_data[j];
+          }
+
+          plan->TransformReal(frame.data(), spectrum.data(), scratch.data());
+
+          for (int64_t k = 0; k < num_bins; ++k) {
+            const float power = std::norm(spectrum[k]);
+            magnitudes[k] = power_ == 2 ? power : std::sqrt(power);
+          }
+
+          float* y = Y_data + f * num_mel_bins;
+          for (int64_t m = 0; m < num_mel_bins; ++m) {
+            const float* weights = filter_bank->weights.data() + filter_bank->offset[m];
+            const float* band = magnitudes.data() + filter_bank->begin[m];
+            const int64_t band_size = filter_bank->offset[m + 1] - filter_bank->offset[m];
+            float sum = 0.0f;
+            for (int64_t k = 0; k < band_size; ++k) {
+              sum += weights[k] * band[k];
+            }
+
+            y[m] = apply_log_ ? std::log(sum + log_offset_) : sum;
+          }
+        }
+      });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,529 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "nhwc_ops.h"
+#include <numeric>
+#include "core/common/safeint.h"
+#include "core/mlas/inc/mlas.h"
+#include "core/util/math.h"
+
+namespace onnxruntime {
+using ConvPadVector = ConvAttributes::ConvPadVector;
+namespace contrib {
+
+void NhwcConv::ReorderFilter(const float* input, float* output, size_t output_channels, size_t input_channels,
+                             size_t kernel_size) {
+  for (size_t k = 0; k < kernel_size; k++) {
+    for (size_t ic = 0; ic < input_channels; ic++) {
+      for (size_t oc = 0; oc < output_channels; oc++) {
+        size_t index = (oc * input_channels * kernel_size) + (ic * kernel_size) + k;
+        *output++ = input[index];
+      }
+    }
+  }
+}
+
+Status NhwcConv::PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                         /*out*/ bool& is_packed,
+                         /*out*/ PrePackedWeights* prepacked_weights) {
+  is_packed = false;
+
+  // Support packing the weight matrix.
+  if (input_idx != 1) {
+    return Status::OK();
+  }
+
+  const auto& shape = tensor.Shape().GetDims();
+  const size_t rank = shape.size();
+  if (rank <= 2 || shape[0] % conv_attrs_.group != 0) {
+    return Status::OK();
+  }
+
+  // Note: The tensor has already been allocated with this tensor shape, so all
+  // shape indices are guaranteed to fit inside size_t.
+  const size_t output_channels = static_cast<size_t>(shape[0]);
+  const size_t group_input_channels = static_cast<size_t>(shape[1]);
+  const size_t kernel_size =
+      static_cast<size_t>(std::accumulate(shape.data() + 2, shape.data() + rank, 1LL, std::multiplies<int64_t>()));
+  const size_t group_count = static_cast<size_t>(conv_attrs_.group);
+  const size_t group_output_channels = output_channels / group_count;
+  const size_t kernel_dim = group_input_channels * kernel_size;
+
+  W_shape_ = tensor.Shape();
+
+  const size_t reordered_W_data_size = SafeInt<size_t>(sizeof(float)) * output_channels * kernel_dim;
+  auto* reordered_W = static_cast<float*>(alloc->Alloc(reordered_W_data_size));
+  reordered_W_buffer_ = BufferUniquePtr(reordered_W, BufferDeleter(alloc));
+  ReorderFilter(tensor.Data<float>(), reordered_W, output_channels, group_input_channels, kernel_size);
+
+  // The depthwise convolution uses the reordered filter directly, the other convolutions pack the filter of
+  // each group for MlasGemm.
+  size_t packed_W_data_size = 0;
+  if (group_input_channels != 1 || group_output_channels != 1) {
+    packed_W_size_ = MlasGemmPackBSize(group_output_channels, kernel_dim);
+    if (packed_W_size_ != 0) {
+      packed_W_data_size = SafeInt<size_t>(group_count) * packed_W_size_;
+      auto* packed_W = static_cast<uint8_t*>(alloc->Alloc(packed_W_data_size));
+
+      // Initialize memory to 0 as there could be some padding associated with pre-packed
+      // buffer memory and we don not want it uninitialized and generate different hashes
+      // if and when we try to cache this pre-packed buffer for sharing between sessions.
+      memset(packed_W, 0, packed_W_data_size);
+      packed_W_buffer_ = BufferUniquePtr(packed_W, BufferDeleter(alloc));
+
+      for (size_t group_id = 0; group_id < group_count; ++group_id) {
+        MlasGemmPackB(CblasNoTrans,
+                      group_output_channels,
+                      kernel_dim,
+                      reordered_W + group_id * group_output_channels,
+                      output_channels,
+                      packed_W + group_id * packed_W_size_);
+      }
+
+      // The reordered filter is only needed to pack it.
+      reordered_W_buffer_.reset();
+    }
+  }
+
+  if (prepacked_weights != nullptr) {
+    // One of the buffers is nullptr, the shared buffers are restored in the same order.
+    const size_t shared_reordered_W_size = reordered_W_buffer_ ? reordered_W_data_size : 0;
+    prepacked_weights->buffers_.push_back(std::move(packed_W_buffer_));
+    prepacked_weights->buffer_sizes_.push_back(packed_W_data_size);
+    prepacked_weights->buffers_.push_back(std::move(reordered_W_buffer_));
+    prepacked_weights->buffer_sizes_.push_back(shared_reordered_W_size);
+  }
+
+  is_packed = true;
+  return Status::OK();
+}
+
+Status NhwcConv::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                           int input_idx,
+                                           /*out*/ bool& used_shared_buffers) {
+  if (input_idx != 1) {
+    return Status::OK();
+  }
+
+  used_shared_buffers = true;
+  packed_W_buffer_ = std::move(prepacked_buffers[0]);
+  reordered_W_buffer_ = std::move(prepacked_buffers[1]);
+
+  return Status::OK();
+}
+
+Status NhwcConv::Compute(OpKernelContext* context) const {
+  const size_t num_inputs = OpKernel::Node().InputDefs().size();
+  const Tensor* X = context->Input<Tensor>(0);
+  // the filter is not an input of the context once it is prepacked
+  const bool is_W_packed = packed_W_buffer_ != nullptr || reordered_W_buffer_ != nullptr;
+  const Tensor* W = is_W_packed ? nullptr : context->Input<Tensor>(1);
+  const TensorShape& W_shape = W != nullptr ? W->Shape() : W_shape_;
+  const Tensor* B = num_inputs >= 3 ? context->Input<Tensor>(2) : nullptr;
+
+  ORT_RETURN_IF_ERROR(conv_attrs_.ValidateInputShape(X->Shape(), W_shape, true));
+
+  TensorShapeVector kernel_shape;
+  ORT_RETURN_IF_ERROR(conv_attrs_.ComputeKernelShape(W_shape, kernel_shape));
+
+  const size_t kernel_rank = kernel_shape.size();
+  ORT_RETURN_IF_NOT(kernel_rank == 1 || kernel_rank == 2, "NHWC Conv only supports 1D and 2D kernels.");
+
+  ConvPadVector pads(conv_attrs_.pads);
+  if (pads.empty()) {
+    pads.resize(kernel_rank * 2, 0);
+  }
+  TensorShapeVector dilations(conv_attrs_.dilations);
+  if (dilations.empty()) {
+    dilations.resize(kernel_rank, 1);
+  }
+  TensorShapeVector strides(conv_attrs_.strides);
+  if (strides.empty()) {
+    strides.resize(kernel_rank, 1);
+  }
+
+  const int64_t N = X->Shape()[0];
+  const int64_t C = X->Shape()[1 + kernel_rank];
+  const int64_t M = W_shape[0];
+
+  TensorShapeVector Y_dims({N});
+  TensorShape input_shape = X->Shape().Slice(1, 1 + kernel_rank);
+  ORT_RETURN_IF_ERROR(conv_attrs_.InferPadsAndOutputShape(input_shape, kernel_shape, strides, dilations, pads, Y_dims));
+  Y_dims.push_back(M);
+  Tensor* Y = context->Output(0, TensorShape(Y_dims));
+  TensorShape output_shape = Y->Shape().Slice(1, 1 + kernel_rank);
+
+  // Bail out early if one of the dimensions is zero.
+  if (Y->Shape().Size() == 0) {
+    return Status::OK();
+  }
+
+  const int64_t input_image_size = input_shape.Size();
+  const int64_t output_image_size = output_shape.Size();
+  const int64_t kernel_size = TensorShape(kernel_shape).Size();
+
+  const int64_t group_count = conv_attrs_.group;
+  const int64_t group_input_channels = W_shape[1];
+  const int64_t group_output_channels = M / group_count;
+  const int64_t kernel_dim = group_input_channels * kernel_size;
+  const bool is_depthwise_conv = (group_input_channels == 1 && group_output_channels == 1);
+
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+  // Handle the case of a dynamic weight filter.
+  BufferUniquePtr reordered_W_buffer;
+  const float* reordered_W = static_cast<const float*>(reordered_W_buffer_.get());
+  const auto* packed_W = static_cast<const uint8_t*>(packed_W_buffer_.get());
+  if (W != nullptr) {
+    auto* W_data = static_cast<float*>(alloc->Alloc(SafeInt<size_t>(sizeof(float)) * W_shape.Size()));
+    reordered_W_buffer = BufferUniquePtr(W_data, BufferDeleter(alloc));
+    ReorderFilter(W->Data<float>(), W_data, static_cast<size_t>(M), static_cast<size_t>(group_input_channels),
+                  static_cast<size_t>(kernel_size));
+    reordered_W = W_data;
+  }
+
+  BufferUniquePtr col_buffer;
+  BufferUniquePtr indirection_buffer;
+  std::vector<float> padding_data;
+
+  if (is_depthwise_conv) {
+    // Allocate indirection buffer pointers and prepare a padding vector for
+    // the im2col transform.
+    auto* indirection_data = alloc->Alloc(SafeInt<size_t>(sizeof(const float*)) * kernel_size * output_image_size);
+    indirection_buffer = BufferUniquePtr(indirection_data, BufferDeleter(alloc));
+    padding_data.resize(static_cast<size_t>(C), 0.0f);
+  } else if (kernel_size != 1 || !conv_attrs_.HasStridesOneAndNoPadding()) {
+    // Pointwise convolutions can use the original input tensor in place,
+    // otherwise a temporary buffer is required for the im2col transform.
+    auto* col_data = alloc->Alloc(SafeInt<size_t>(sizeof(float)) * kernel_dim * output_image_size);
+    col_buffer = BufferUniquePtr(col_data, BufferDeleter(alloc));
+  }
+
+  const auto* Xdata = X->Data<float>();
+  const auto* Bdata = B != nullptr ? B->Data<float>() : nullptr;
+  auto* Ydata = Y->MutableData<float>();
+
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+
+  // Partition the output image into slices of rows of the GEMM, small enough for the im2col columns of a slice to
+  // stay in the cache and numerous enough to use all the threads.
+  constexpr int64_t output_block_count = 16;
+  const int64_t degree_of_par = concurrency::ThreadPool::DegreeOfParallelism(thread_pool);
+  int64_t stride_m = std::max<int64_t>((64 * 1024) / kernel_dim, output_block_count);
+  stride_m = std::min(stride_m, (output_image_size + degree_of_par - 1) / degree_of_par);
+  stride_m = (stride_m + output_block_count - 1) / output_block_count * output_block_count;
+  const int64_t task_count = (output_image_size + stride_m - 1) / stride_m;
+
+  for (int64_t image_id = 0; image_id < N; ++image_id) {
+    auto conv_worker = [&](ptrdiff_t batch) {
+      const int64_t output_start = batch * stride_m;
+      const int64_t output_count = std::min(stride_m, output_image_size - output_start);
+      auto* worker_output = Ydata + output_start * M;
+
+      if (is_depthwise_conv) {
+        auto* worker_indirection_buffer =
+            static_cast<float const**>(indirection_buffer.get()) + output_start * kernel_size;
+        math::Im2col<float, StorageOrder::NHWC>()(
+            Xdata,
+            C,
+            input_shape.GetDims().data(),
+            output_shape.GetDims().data(),
+            kernel_shape.data(),
+            strides.data(),
+            dilations.data(),
+            pads.data(),
+            static_cast<ptrdiff_t>(kernel_rank),
+            output_start,
+            output_count,
+            worker_indirection_buffer,
+            padding_data.data());
+        MlasConvDepthwiseNhwc(
+            worker_indirection_buffer,
+            reordered_W,
+            Bdata,
+            worker_output,
+            static_cast<size_t>(M),
+            static_cast<size_t>(output_count),
+            static_cast<size_t>(kernel_size));
+      } else {
+        // The bias is accumulated by the GEMM of each group.
+        float beta = 0.0f;
+        if (Bdata != nullptr) {
+          for (int64_t i = 0; i < output_count; ++i) {
+            std::copy_n(Bdata, M, worker_output + i * M);
+          }
+          beta = 1.0f;
+        }
+
+        for (int64_t group_id = 0; group_id < group_count; ++group_id) {
+          // Prepare the im2col transformation or use the input buffer directly for
+          // pointwise convolutions.
+          const auto* group_input_data = Xdata + group_id * group_input_channels;
+          MLAS_SGEMM_DATA_PARAMS gemm_params;
+          if (col_buffer) {
+            auto* worker_col_buffer = static_cast<float*>(col_buffer.get()) + output_start * kernel_dim;
+            if (kernel_rank == 2) {
+              math::Im2col<float, StorageOrder::NHWC>()(
+                  group_input_data,
+                  group_input_channels,
+                  C,
+                  input_shape[0],
+                  input_shape[1],
+                  kernel_shape[0],
+                  kernel_shape[1],
+                  dilations[0],
+                  dilations[1],
+                  pads[0],
+                  pads[1],
+                  strides[0],
+                  strides[1],
+                  output_shape[1],
+                  output_start,
+                  output_count,
+                  worker_col_buffer);
+            } else {
+              math::Im2col<float, StorageOrder::NHWC>()(
+                  group_input_data,
+                  group_input_channels,
+                  C,
+                  1,
+                  input_shape[0],
+                  1,
+                  kernel_shape[0],
+                  1,
+                  dilations[0],
+                  0,
+                  pads[0],
+                  1,
+                  strides[0],
+                  output_shape[0],
+                  output_start,
+                  output_count,
+                  worker_col_buffer);
+            }
+            gemm_params.A = worker_col_buffer;
+            gemm_params.lda = static_cast<size_t>(kernel_dim);
+          } else {
+            gemm_params.A = group_input_data + output_start * C;
+            gemm_params.lda = static_cast<size_t>(C);
+          }
+
+          if (packed_W != nullptr) {
+            gemm_params.B = reinterpret_cast<const float*>(packed_W + group_id * packed_W_size_);
+            gemm_params.BIsPacked = true;
+          } else {
+            gemm_params.B = reordered_W + group_id * group_output_channels;
+            gemm_params.ldb = static_cast<size_t>(M);
+          }
+          gemm_params.C = worker_output + group_id * group_output_channels;
+          gemm_params.ldc = static_cast<size_t>(M);
+          gemm_params.beta = beta;
+
+          MlasGemm(CblasNoTrans,
+                   CblasNoTrans,
+                   static_cast<size_t>(output_count),
+                   static_cast<size_t>(group_output_channels),
+                   static_cast<size_t>(kernel_dim),
+                   gemm_params,
+                   nullptr);
+        }
+      }
+
+      MlasActivation(&activation_, worker_output, nullptr, static_cast<size_t>(output_count), static_cast<size_t>(M),
+                     static_cast<size_t>(M));
+    };
+
+    concurrency::ThreadPool::TrySimpleParallelFor(thread_pool, task_count, conv_worker);
+
+    Xdata += input_image_size * C;
+    Ydata += output_image_size * M;
+  }
+
+  return Status::OK();
+}
+
+Status NhwcPoolBase::NhwcPool(OpKernelContext* context, MLAS_POOLING_KIND kind) const {
+  const auto* X = context->Input<Tensor>(0);
+  const TensorShape& input_shape = X->Shape();
+
+  const size_t input_rank = input_shape.NumDimensions();
+  ORT_RETURN_IF_NOT(input_rank >= 3, "Input dimension cannot be less than 3.");
+
+  const int64_t N = input_shape[0];
+  const int64_t C = input_shape[input_rank - 1];
+  const size_t spatial_dims = input_rank - 2;
+
+  // Compute the output size and effective padding for this pooling operation. A global pooling has a kernel of
+  // the input image size.
+  TensorShapeVector kernel_shape(spatial_dims, 1);
+  TensorShapeVector strides(spatial_dims, 1);
+  TensorShapeVector dilations(spatial_dims, 1);
+  TensorShapeVector pads(spatial_dims * 2, 0);
+  TensorShapeVector output_dims({N});
+  int64_t kernel_size = 1;
+  int64_t input_image_size = 1;
+  int64_t output_image_size = 1;
+  for (size_t dim = 0; dim < spatial_dims; ++dim) {
+    const int64_t input_dim = input_shape[dim + 1];
+    int64_t output_dim = 1;
+    if (pool_attrs_.global_pooling) {
+      kernel_shape[dim] = input_dim;
+    } else {
+      kernel_shape[dim] = pool_attrs_.kernel_shape[dim];
+      strides[dim] = pool_attrs_.strides[dim];
+      dilations[dim] = pool_attrs_.dilations[dim];
+      pads[dim] = pool_attrs_.pads[dim];
+      pads[spatial_dims + dim] = pool_attrs_.pads[spatial_dims + dim];
+      pool_attrs_.ComputeSizePadDilations(input_dim,
+                                          strides[dim],
+                                          kernel_shape[dim],
+                                          &pads.at(dim),
+                                          &pads.at(spatial_dims + dim),
+                                          dilations[dim],
+                                          &output_dim);
+    }
+    output_dims.push_back(output_dim);
+
+    kernel_size *= kernel_shape[dim];
+    input_image_size *= input_dim;
+    output_image_size *= output_dim;
+  }
+  output_dims.push_back(C);
+
+  Tensor* Y = context->Output(0, output_dims);
+
+  // Bail out early if one of the dimensions is zero.
+  if (Y->Shape().Size() == 0) {
+    return Status::OK();
+  }
+
+  // Allocate indirection buffer pointers and prepare a padding vector for the im2col transform. The padding
+  // does not change the maximum or the sum of a window.
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+  auto* indirection_data = alloc->Alloc(SafeInt<size_t>(sizeof(const float*)) * kernel_size * output_image_size);
+  BufferUniquePtr indirection_buffer(indirection_data, BufferDeleter(alloc));
+  std::vector<float> padding_data(static_cast<size_t>(C),
+                                  kind == MlasMaximumPooling ? std::numeric_limits<float>::lowest() : 0.0f);
+
+  const auto* Xdata = X->Data<float>();
+  auto* Ydata = Y->MutableData<float>();
+
+  concurrency::ThreadPool* thread_pool = context->GetOperatorThreadPool();
+
+  // Each worker pools a slice of the output image.
+  constexpr int64_t output_batch_count = 64;
+  const int64_t task_count = (output_image_size + output_batch_count - 1) / output_batch_count;
+
+  for (int64_t image_id = 0; image_id < N; ++image_id) {
+    auto pool_worker = [&](ptrdiff_t batch) {
+      const int64_t output_start = batch * output_batch_count;
+      const int64_t output_count = std::min(output_image_size - output_start, output_batch_count);
+      auto* worker_indirection_buffer =
+          static_cast<float const**>(indirection_buffer.get()) + output_start * kernel_size;
+      math::Im2col<float, StorageOrder::NHWC>()(
+          Xdata,
+          C,
+          input_shape.GetDims().data() + 1,
+          output_dims.data() + 1,
+          kernel_shape.data(),
+          strides.data(),
+          dilations.data(),
+          pads.data(),
+          static_cast<ptrdiff_t>(spatial_dims),
+          output_start,
+          output_count,
+          worker_indirection_buffer,
+          padding_data.data());
+
+      auto* worker_output = Ydata + output_start * C;
+      if (kind == MlasMaximumPooling) {
+        MlasMaximumPoolNhwc(
+            worker_indirection_buffer,
+            worker_output,
+            static_cast<size_t>(C),
+            static_cast<size_t>(output_count),
+            static_cast<size_t>(kernel_size));
+      } else {
+        MlasAveragePoolNhwc(
+            worker_indirection_buffer,
+            padding_data.data(),
+            kind == MlasAveragePoolingIncludePad,
+            worker_output,
+            static_cast<size_t>(C),
+            static_cast<size_t>(output_count),
+            static_cast<size_t>(kernel_size));
+      }
+    };
+
+    concurrency::ThreadPool::TrySimpleParallelFor(thread_pool, task_count, pool_worker);
+
+    Xdata += input_image_size * C;
+    Ydata += output_image_size * C;
+  }
+
+  return Status::OK();
+}
+
+Status NhwcMaxPoolFloat::Compute(OpKernelContext* context) const {
+  ORT_RETURN_IF_NOT(OpKernel::Node().OutputDefs().size() == 1 || !OpKernel::Node().OutputDefs()[1]->Exists(),
+                    "NHWC MaxPool does not support the Indices output.");
+  return NhwcPoolBase::NhwcPool(context, MlasMaximumPooling);
+}
+
+Status NhwcAveragePool::Compute(OpKernelContext* context) const {
+  return NhwcPoolBase::NhwcPool(context, pool_attrs_.count_include_pad ? MlasAveragePoolingIncludePad
+                                                                       : MlasAveragePoolingExcludePad);
+}
+
+#define ONNX_CPU_OPERATOR_TYPED_NHWC_KERNEL(name, ver, type, builder, ...) \
+  ONNX_OPERATOR_TYPED_KERNEL_EX(name, kMSInternalNHWCDomain, ver, type, kCpuExecutionProvider, builder, __VA_ARGS__)
+
+#define ONNX_CPU_OPERATOR_VERSIONED_TYPED_NHWC_KERNEL(name, startver, endver, type, builder, ...)                \
+  ONNX_OPERATOR_VERSIONED_TYPED_KERNEL_EX(name, kMSInternalNHWCDomain, startver, endver, type, kCpuExecutionProvider, \
+                                          builder, __VA_ARGS__)
+
+ONNX_CPU_OPERATOR_TYPED_NHWC_KERNEL(
+    Conv,
+    11,
+    float,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    NhwcConv);
+
+ONNX_CPU_OPERATOR_VERSIONED_TYPED_NHWC_KERNEL(
+    MaxPool,
+    11,
+    11,
+    float,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    NhwcMaxPoolFloat);
+
+ONNX_CPU_OPERATOR_TYPED_NHWC_KERNEL(
+    MaxPool,
+    12,
+    float,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    NhwcMaxPoolFloat);
+
+ONNX_CPU_OPERATOR_TYPED_NHWC_KERNEL(
+    AveragePool,
+    11,
+    float,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    NhwcAveragePool);
+
+ONNX_CPU_OPERATOR_TYPED_NHWC_KERNEL(
+    GlobalAveragePool,
+    1,
+    float,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    NhwcAveragePool);
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,75 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+#include "core/providers/cpu/nn/conv_attributes.h"
+#include "core/providers/cpu/nn/pool.h"
+#include "contrib_ops/cpu/fused_activation.h"
+
+namespace onnxruntime {
+namespace contrib {
+
+// Float kernels of the layout sensitive ONNX operators in the kMSInternalNHWCDomain domain, which the
+// NhwcTransformer uses for float models. The inputs and outputs are in channels last format, the weights of Conv
+// keep the ONNX format.
+class NhwcConv final : public OpKernel {
+ public:
+  NhwcConv(const OpKernelInfo& info) : OpKernel(info), conv_attrs_(info) {
+    ORT_ENFORCE(GetFusedActivationAttr(info, activation_).IsOK());
+  }
+
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 /*out*/ bool& is_packed,
+                 /*out*/ PrePackedWeights* prepacked_weights) override;
+
+  Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                   int input_idx,
+                                   /*out*/ bool& used_shared_buffers) override;
+
+  Status Compute(OpKernelContext* context) const override;
+
+ private:
+  // Reorder the filter from MCK1..Kn to K1..KnCM, so that the rows of a group are the im2col columns.
+  static void ReorderFilter(const float* input, float* output, size_t output_channels, size_t input_channels,
+                            size_t kernel_size);
+
+  ConvAttributes conv_attrs_;
+
+  MLAS_ACTIVATION activation_;
+
+  TensorShape W_shape_;
+  BufferUniquePtr reordered_W_buffer_;
+  // the reordered filter of each group packed for MlasGemm, unless the convolution is depthwise
+  BufferUniquePtr packed_W_buffer_;
+  size_t packed_W_size_{0};
+};
+
+class NhwcPoolBase : public PoolBase {
+ public:
+  NhwcPoolBase(const OpKernelInfo& info) : PoolBase(info) {
+  }
+
+  Status NhwcPool(OpKernelContext* context, MLAS_POOLING_KIND kind) const;
+};
+
+class NhwcMaxPoolFloat final : public OpKernel, public NhwcPoolBase {
+ public:
+  NhwcMaxPoolFloat(const OpKernelInfo& info) : OpKernel(info), NhwcPoolBase(info) {
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
+class NhwcAveragePool final : public OpKernel, public NhwcPoolBase {
+ public:
+  NhwcAveragePool(const OpKernelInfo& info) : OpKernel(info), NhwcPoolBase(info) {
+  }
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
+}  // namespace contrib
+}  // namespace onnxruntime
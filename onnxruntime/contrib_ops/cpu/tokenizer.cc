@@ -5,6 +5,7 @@
 #include "core/common/utf8_util.h"
 #include "core/framework/tensor.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
 #include "re2/re2.h"
 
 namespace onnxruntime {
@@ -30,6 +31,15 @@ class Tokenizer final : public OpKernel {
                          size_t N, size_t C,
                          gsl::span<const int64_t> input_dims) const;
 
+  // Tokenizes every input string into its row of tokens, in parallel.
+  template <typename TokenizeFn>
+  Status TokenizeRows(OpKernelContext* ctx, size_t N, size_t C, TokenizeFn tokenize,
+                      std::vector<std::vector<re2::StringPiece>>& rows, size_t& max_tokens) const;
+
+  // Writes each row of tokens into its max_tokens strings of the output, in parallel.
+  Status OutputRows(OpKernelContext* ctx, gsl::span<const int64_t> input_dims,
+                    const std::vector<std::vector<re2::StringPiece>>& rows, size_t max_tokens) const;
+
   bool mark_{false};
   std::string pad_value_;
   int64_t mincharnum_{0};
@@ -51,6 +61,18 @@ ONNX_CPU_OPERATOR_TYPED_MS_KERNEL(
 namespace tokenizer_details {
 constexpr char start_text = 0x2;
 constexpr char end_text = 0x3;
+
+// Rough cost of tokenizing one string, the strings are processed in parallel
+const TensorOpCost tokenize_cost{64.0, 64.0, 1024.0};
+
+inline bool ValidateUtf8(const std::string& s, size_t& utf8_chars) {
+  auto* const data = reinterpret_cast<const unsigned char*>(s.data());
+  if (is_ascii(data, s.size())) {
+    utf8_chars = s.size();
+    return true;
+  }
+  return utf8_validate(data, s.size(), utf8_chars);
+}
 }  // namespace tokenizer_details
 
 using namespace tokenizer_details;
@@ -118,23 +140,29 @@ Status Tokenizer::CharTokenize(OpKernelContext* ctx, size_t N, size_t C,
   // With char tokenzation we get as many tokens as the number of
   // utf8 characters in the string. So for every string we calculate its character(utf8) length
   // add padding and add start/end test separators if necessary
-  size_t max_tokens = 0;
   auto X = ctx->Input<Tensor>(0);
   auto const input_data = X->template Data<std::string>();
-  auto curr_input = input_data;
-  auto const last = input_data + N * C;
-  while (curr_input != last) {
-    const auto& s = *curr_input;
-    size_t tokens = 0;  // length in utf8 chars
-    if (!utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size(),
-                       tokens)) {
+  const size_t num_strings = N * C;
+  std::vector<size_t> string_tokens(num_strings);
+  std::vector<uint8_t> string_valid(num_strings);
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_strings), tokenize_cost,
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          string_valid[i] = ValidateUtf8(input_data[i], string_tokens[i]);
+        }
+      });
+
+  size_t max_tokens = 0;
+  for (size_t i = 0; i < num_strings; ++i) {
+    if (!string_valid[i]) {
       // Please do not include the input text in the error message as it could
       // be deemed as a compliance violation by teams using this operator
       return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
                     "Input string contains invalid utf8 chars");
     }
-    max_tokens = std::max(max_tokens, tokens);
-    ++curr_input;
+    max_tokens = std::max(max_tokens, string_tokens[i]);
   }
 
   std::vector<int64_t> output_dims(input_dims.begin(), input_dims.end());
@@ -154,71 +182,153 @@ Status Tokenizer::CharTokenize(OpKernelContext* ctx, size_t N, size_t C,
   TensorShape output_shape(output_dims);
   auto output_tensor = ctx->Output(0, output_shape);
   auto const output_data = output_tensor->template MutableData<std::string>();
-  size_t output_index = 0;
-  curr_input = input_data;
-  while (curr_input != last) {
-    const auto& s = *curr_input;
-    if (mark_) {
-      (output_data + output_index)->assign(&start_text, 1);
-      ++output_index;
-    }
-    size_t tokens = 0;
-    const size_t str_len = s.size();
-    for (size_t token_idx = 0; token_idx < str_len;) {
-      size_t tlen = 0;
-      bool result = utf8_bytes(static_cast<unsigned char>(s[token_idx]), tlen);
-      assert(result);
-      (void)result;
-      assert(token_idx + tlen <= str_len);
-      *(output_data + output_index) = s.substr(token_idx, tlen);
-      ++output_index;
-      token_idx += tlen;
-      ++tokens;
-    }
-    if (mark_) {
-      (output_data + output_index)->assign(&end_text, 1);
-      ++output_index;
-    }
-    // Padding strings
-    assert(tokens + (static_cast<size_t>(mark_) * 2) <= max_tokens);
-    const size_t pads = max_tokens - (static_cast<size_t>(mark_) * 2) - tokens;
-    for (size_t p = 0; p < pads; ++p) {
-      *(output_data + output_index) = pad_value_;
-      ++output_index;
-    }
-    ++curr_input;
+
+  // Every string has max_tokens output strings
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_strings), tokenize_cost,
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          const auto& s = input_data[i];
+          size_t output_index = static_cast<size_t>(i) * max_tokens;
+          if (mark_) {
+            (output_data + output_index)->assign(&start_text, 1);
+            ++output_index;
+          }
+          const size_t tokens = string_tokens[i];
+          const size_t str_len = s.size();
+          if (tokens == str_len) {
+            // ASCII, one byte per character
+            for (size_t token_idx = 0; token_idx < str_len; ++token_idx) {
+              (output_data + output_index)->assign(1, s[token_idx]);
+              ++output_index;
+            }
+          } else {
+            for (size_t token_idx = 0; token_idx < str_len;) {
+              size_t tlen = 0;
+              bool result = utf8_bytes(static_cast<unsigned char>(s[token_idx]), tlen);
+              assert(result);
+              (void)result;
+              assert(token_idx + tlen <= str_len);
+              (output_data + output_index)->assign(s, token_idx, tlen);
+              ++output_index;
+              token_idx += tlen;
+            }
+          }
+          if (mark_) {
+            (output_data + output_index)->assign(&end_text, 1);
+            ++output_index;
+          }
+          // Padding strings
+          assert(tokens + (static_cast<size_t>(mark_) * 2) <= max_tokens);
+          const size_t pads = max_tokens - (static_cast<size_t>(mark_) * 2) - tokens;
+          for (size_t p = 0; p < pads; ++p) {
+            *(output_data + output_index) = pad_value_;
+            ++output_index;
+          }
+        }
+      });
+  return Status::OK();
+}
+
+template <typename TokenizeFn>
+Status Tokenizer::TokenizeRows(OpKernelContext* ctx, size_t N, size_t C, TokenizeFn tokenize,
+                               std::vector<std::vector<re2::StringPiece>>& rows, size_t& max_tokens) const {
+  auto X = ctx->Input<Tensor>(0);
+  auto const input_data = X->template Data<std::string>();
+  const size_t num_strings = N * C;
+  rows.resize(num_strings);
+  std::vector<Status> statuses(num_strings);
+
+  // re2::RE2 is thread safe, the strings are tokenized concurrently
+  concurrency::ThreadPool::TryParallelFor(
+      ctx->GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(num_strings), tokenize_cost,
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          statuses[i] = tokenize(input_data[i], rows[i]);
+        }
+      });
+
+  // report the error of the first invalid string, as if the strings were tokenized in order
+  max_tokens = 0;
+  for (size_t i = 0; i < num_strings; ++i) {
+    ORT_RETURN_IF_ERROR(statuses[i]);
+    max_tokens = std::max(max_tokens, rows[i].size());
   }
   return Status::OK();
 }
 
+Status Tokenizer::OutputRows(OpKernelContext* ctx, gsl::span<const int64_t> input_dims,
+                             const std::vector<std::vector<re2::StringPiece>>& rows, size_t max_tokens) const {
+  std::vector<int64_t> output_dims(input_dims.begin(), input_dims.end());
+  // Check if we have no output due to either empty input
+  // everything is a separator
+  if (max_tokens == 0) {
+    output_dims.push_back(0);
+    TensorShape output_shape(output_dims);
+    ctx->Output(0, output_shape);
+    return Status::OK();
+  }
+
+  if (mark_) {
+    max_tokens += 2;  // Start/end markers as separate tokens
+  }
+
+  output_dims.push_back(max_tokens);
+  TensorShape output_shape(output_dims);
+
+  auto output_tensor = ctx->Output(0, output_shape);
+  auto const output_data = output_tensor->template MutableData<std::string>();
+
+  // Every row has max_tokens output strings
+  concurrency::ThreadPool::TryParallelFor(
+      ctx->GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(rows.size()), tokenize_cost,
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t r = first; r < last; ++r) {
+          const auto& row = rows[r];
+          size_t output_index = static_cast<size_t>(r) * max_tokens;
+          if (mark_) {
+            (output_data + output_index)->assign(&start_text, 1);
+            ++output_index;
+          }
+          // Output tokens for this row
+          for (const auto& token : row) {
+            (output_data + output_index)->assign(token.data(), token.size());
+            ++output_index;
+          }
+          if (mark_) {
+            (output_data + output_index)->assign(&end_text, 1);
+            ++output_index;
+          }
+          assert(row.size() + (static_cast<size_t>(mark_) * 2) <= max_tokens);
+          const size_t pads = max_tokens - (static_cast<size_t>(mark_) * 2) - row.size();
+          for (size_t p = 0; p < pads; ++p) {
+            *(output_data + output_index) = pad_value_;
+            ++output_index;
+          }
+        }
+      });
+  return Status::OK();
+}
+
 Status Tokenizer::SeparatorExpressionTokenizer(OpKernelContext* ctx,
                                                size_t N, size_t C,
                                                gsl::span<const int64_t> input_dims) const {
   using namespace re2;
-  std::vector<std::vector<StringPiece>> rows;
-  rows.reserve(N * C);
 
   // We do not constraint the search to match
   // on the beginning or end of the string
   const RE2::Anchor anchor = RE2::UNANCHORED;
 
-  // Scan all strings and attempt to find separators in them
-  // collect all the output tokens here
-  size_t max_tokens = 0;
-  auto X = ctx->Input<Tensor>(0);
-  auto const input_data = X->template Data<std::string>();
-  auto curr_input = input_data;
-  auto const last = input_data + N * C;
-  while (curr_input != last) {
-    const auto& s = *curr_input;
+  // Attempt to find separators in a string
+  // and collect all the output tokens in its row
+  auto tokenize = [this, anchor](const std::string& s, std::vector<StringPiece>& row) -> Status {
     size_t utf8_chars = 0;  // length in utf8 chars
-    if (!utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size(),
-                       utf8_chars)) {
+    if (!ValidateUtf8(s, utf8_chars)) {
       return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
                     "Input string contains invalid utf8 chars: " + s);
     }
 
-    std::vector<StringPiece> row{s};
+    row.emplace_back(s);
 
     for (const auto& sep : separators_) {
       std::vector<StringPiece> tokens;
@@ -271,99 +381,32 @@ Status Tokenizer::SeparatorExpressionTokenizer(OpKernelContext* ctx,
       // Replace the row with the results of this tokenezation
       row.swap(tokens);
     }  // separators_
-    max_tokens = std::max(max_tokens, row.size());
-    rows.push_back(std::move(row));
-    ++curr_input;
-  }
-
-  std::vector<int64_t> output_dims(input_dims.begin(), input_dims.end());
-  // Check if we have no output due to either empty input
-  // everything is a separator
-  if (max_tokens == 0) {
-    output_dims.push_back(0);
-    TensorShape output_shape(output_dims);
-    ctx->Output(0, output_shape);
     return Status::OK();
-  }
-
-  if (mark_) {
-    max_tokens += 2;  // Start/end markers as separate tokens
-  }
-
-  output_dims.push_back(max_tokens);
-  TensorShape output_shape(output_dims);
+  };
 
-  auto output_tensor = ctx->Output(0, output_shape);
-  auto const output_data = output_tensor->template MutableData<std::string>();
-
-#ifdef _DEBUG
-  const size_t max_output_index = N * C * max_tokens;
-#endif
-  size_t output_index = 0;
-  curr_input = input_data;
-  for (auto& row : rows) {
-#ifdef _DEBUG
-    size_t c_idx = output_index;
-#endif
-    if (mark_) {
-      (output_data + output_index)->assign(&start_text, 1);
-      ++output_index;
-    }
-    // Output tokens for this row
-    for (const auto& token : row) {
-      (output_data + output_index)->assign(token.data(), token.size());
-      ++output_index;
-    }
-    if (mark_) {
-      (output_data + output_index)->assign(&end_text, 1);
-      ++output_index;
-    }
-    const size_t pads = max_tokens - (static_cast<size_t>(mark_) * 2) - row.size();
-    for (size_t p = 0; p < pads; ++p) {
-      *(output_data + output_index) = pad_value_;
-      ++output_index;
-    }
-#ifdef _DEBUG
-    assert(output_index <= max_output_index);
-    assert((output_index - c_idx) <= max_tokens);
-#endif
-    ++curr_input;
-  }
-  return Status::OK();
+  std::vector<std::vector<StringPiece>> rows;
+  size_t max_tokens = 0;
+  ORT_RETURN_IF_ERROR(TokenizeRows(ctx, N, C, tokenize, rows, max_tokens));
+  return OutputRows(ctx, input_dims, rows, max_tokens);
 }
 
 Status Tokenizer::TokenExpression(OpKernelContext* ctx,
                                   size_t N, size_t C,
                                   gsl::span<const int64_t> input_dims) const {
   using namespace re2;
-  // Represents a token that will be output after
-  // first is the index, second is the size;
-  std::vector<std::vector<StringPiece>> tokens;
-  tokens.reserve(N * C);
-
-  size_t max_tokens = 0;
-  auto X = ctx->Input<Tensor>(0);
-  auto const input_data = X->template Data<std::string>();
-  auto curr_input = input_data;
-  auto const last = input_data + N * C;
 
   // We do not constraint the search to match
   // on the beginning or end of the string
   const RE2::Anchor anchor = RE2::UNANCHORED;
 
-  while (curr_input != last) {
-    const auto& s = *curr_input;
-
+  // Collect the matches of the expression in a string
+  auto tokenize = [this, anchor](const std::string& s, std::vector<StringPiece>& row) -> Status {
     size_t utf8_chars = 0;
-    if (!utf8_validate(reinterpret_cast<const unsigned char*>(s.data()), s.size(),
-                       utf8_chars)) {
+    if (!ValidateUtf8(s, utf8_chars)) {
       return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
                     "Input string contains invalid utf8 chars: " + s);
     }
 
-    tokens.emplace_back();
-    auto& row = tokens.back();
-
     StringPiece text(s);
     const auto end_pos = s.length();
     size_t start_pos = 0;
@@ -395,67 +438,13 @@ Status Tokenizer::TokenExpression(OpKernelContext* ctx,
         }
       }
     } while (match);
-    max_tokens = std::max(max_tokens, row.size());
-    ++curr_input;
-  }
-
-  // Check for empty output
-  std::vector<int64_t> output_dims(input_dims.begin(), input_dims.end());
-  // Check if we have no output due to either empty input
-  // everything is a separator
-  if (max_tokens == 0) {
-    output_dims.push_back(0);
-    TensorShape output_shape(output_dims);
-    ctx->Output(0, output_shape);
     return Status::OK();
-  }
-
-  if (mark_) {
-    max_tokens += 2;  // Start/end markers as separate tokens
-  }
+  };
 
-  output_dims.push_back(max_tokens);
-  TensorShape output_shape(output_dims);
-
-  auto output_tensor = ctx->Output(0, output_shape);
-  auto const output_data = output_tensor->template MutableData<std::string>();
-
-#ifdef _DEBUG
-  const size_t max_output_index = N * C * max_tokens;
-#endif
-  curr_input = input_data;
-  size_t output_index = 0;
-  for (const auto& row : tokens) {
-    assert(curr_input != last);
-#ifdef _DEBUG
-    size_t c_idx = output_index;
-#endif
-    if (mark_) {
-      (output_data + output_index)->assign(&start_text, 1);
-      ++output_index;
-    }
-    // Output tokens for this row
-    for (const auto& token : row) {
-      (output_data + output_index)->assign(token.data(), token.length());
-      ++output_index;
-    }
-    if (mark_) {
-      (output_data + output_index)->assign(&end_text, 1);
-      ++output_index;
-    }
-    const size_t pads = max_tokens - (static_cast<size_t>(mark_) * 2) - row.size();
-    for (size_t p = 0; p < pads; ++p) {
-      *(output_data + output_index) = pad_value_;
-      ++output_index;
-    }
-#ifdef _DEBUG
-    assert(output_index <= max_output_index);
-    assert((output_index - c_idx) <= max_tokens);
-#endif
-    ++curr_input;
-  }
-
-  return Status::OK();
+  std::vector<std::vector<StringPiece>> rows;
+  size_t max_tokens = 0;
+  ORT_RETURN_IF_ERROR(TokenizeRows(ctx, N, C, tokenize, rows, max_tokens));
+  return OutputRows(ctx, input_dims, rows, max_tokens);
 }
 
 Status Tokenizer::Compute(OpKernelContext* ctx) const {
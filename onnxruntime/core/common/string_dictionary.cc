@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/string_dictionary.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "core/common/common.h"
+
+namespace onnxruntime {
+
+namespace {
+
+constexpr size_t kMinSlots = 16;
+
+uint64_t Load64(const char* p) {
+  uint64_t value;
+  memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+// finalization of MurmurHash3, every input bit affects every output bit
+uint64_t Mix(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+}  // namespace
+
+uint64_t StringDictionary::Hash(std::string_view str) {
+  constexpr uint64_t kMultiplier = 0x9e3779b97f4a7c15ULL;
+  const char* p = str.data();
+  size_t remaining = str.size();
+  uint64_t h = remaining * kMultiplier;
+
+  // 8 characters at a time
+  for (; remaining >= 8; remaining -= 8, p += 8) {
+    h = (h ^ Mix(Load64(p))) * kMultiplier;
+  }
+
+  if (remaining > 0) {
+    uint64_t tail = 0;
+    memcpy(&tail, p, remaining);
+    h = (h ^ Mix(tail)) * kMultiplier;
+  }
+
+  return Mix(h);
+}
+
+void StringDictionary::Reserve(size_t count, size_t total_length) {
+  offsets_.reserve(count + 1);
+  chars_.reserve(total_length);
+
+  size_t num_slots = kMinSlots;
+  while (num_slots < 2 * count) {
+    num_slots *= 2;
+  }
+
+  if (num_slots > slots_.size()) {
+    Rehash(num_slots);
+  }
+}
+
+size_t StringDictionary::FindSlot(std::string_view str, uint64_t hash) const {
+  const size_t mask = slots_.size() - 1;
+  for (size_t i = static_cast<size_t>(hash) & mask;; i = (i + 1) & mask) {
+    const Slot& slot = slots_[i];
+    if (slot.id == kNotFound || (slot.hash == hash && Get(slot.id) == str)) {
+      return i;
+    }
+  }
+}
+
+StringDictionary::Id StringDictionary::Insert(std::string_view str, bool& inserted) {
+  // keep the table at most half full
+  if (2 * (Size() + 1) > slots_.size()) {
+    Rehash(std::max(kMinSlots, 2 * slots_.size()));
+  }
+
+  const uint64_t hash = Hash(str);
+  Slot& slot = slots_[FindSlot(str, hash)];
+  if (slot.id != kNotFound) {
+    inserted = false;
+    return slot.id;
+  }
+
+  ORT_ENFORCE(Size() < kNotFound, "Too many strings in the dictionary.");
+  slot.hash = hash;
+  slot.id = static_cast<Id>(Size());
+  chars_.insert(chars_.end(), str.begin(), str.end());
+  offsets_.push_back(chars_.size());
+  inserted = true;
+  return slot.id;
+}
+
+void StringDictionary::Rehash(size_t num_slots) {
+  std::vector<Slot> slots(num_slots, Slot{0, kNotFound});
+  const size_t mask = num_slots - 1;
+
+  // the hashes are stored so the strings don't need to be hashed again
+  for (const Slot& slot : slots_) {
+    if (slot.id == kNotFound) {
+      continue;
+    }
+
+    size_t i = static_cast<size_t>(slot.hash) & mask;
+    while (slots[i].id != kNotFound) {
+      i = (i + 1) & mask;
+    }
+    slots[i] = slot;
+  }
+
+  slots_ = std::move(slots);
+}
+
+}  // namespace onnxruntime
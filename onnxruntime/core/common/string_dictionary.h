@@ -0,0 +1,76 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+namespace onnxruntime {
+
+/**
+ * Set of strings numbered in insertion order, for the string lookup tables of the kernels (LabelEncoder,
+ * CategoryMapper, TfIdfVectorizer) which are built once from attributes and then only searched.
+ * The strings are copied into one contiguous buffer and indexed by an open addressing hash table with linear
+ * probing. Each slot stores the full hash of its string so that a lookup only compares the strings whose hashes
+ * match, and the table is kept at most half full so that most lookups touch a single slot.
+ * The values associated with the strings are stored by the users in arrays indexed by the string ids.
+ * Find may be called concurrently once the dictionary is built.
+ */
+class StringDictionary {
+ public:
+  using Id = uint32_t;
+  static constexpr Id kNotFound = std::numeric_limits<Id>::max();
+
+  StringDictionary() = default;
+
+  // Reserve space for 'count' strings of 'total_length' characters.
+  void Reserve(size_t count, size_t total_length = 0);
+
+  // Add 'str' if it is not in the dictionary. Returns the id of 'str', and sets 'inserted' if it was added.
+  Id Insert(std::string_view str, bool& inserted);
+
+  Id Insert(std::string_view str) {
+    bool inserted;
+    return Insert(str, inserted);
+  }
+
+  // Id of 'str', or kNotFound.
+  Id Find(std::string_view str) const {
+    if (slots_.empty()) {
+      return kNotFound;
+    }
+    return slots_[FindSlot(str, Hash(str))].id;
+  }
+
+  // The string of an id returned by Insert.
+  std::string_view Get(Id id) const {
+    return std::string_view(chars_.data() + offsets_[id], offsets_[id + 1] - offsets_[id]);
+  }
+
+  size_t Size() const { return offsets_.size() - 1; }
+  bool Empty() const { return Size() == 0; }
+
+  static uint64_t Hash(std::string_view str);
+
+ private:
+  struct Slot {
+    uint64_t hash;
+    Id id;
+  };
+
+  // index of the slot of 'str', or of the empty slot where it would be inserted
+  size_t FindSlot(std::string_view str, uint64_t hash) const;
+  void Rehash(size_t num_slots);
+
+  // characters of all the strings, the string of id i is [offsets_[i], offsets_[i + 1])
+  std::vector<char> chars_;
+  std::vector<size_t> offsets_{0};
+
+  // number of slots is a power of 2, empty slots have the id kNotFound
+  std::vector<Slot> slots_;
+};
+
+}  // namespace onnxruntime
@@ -5,9 +5,31 @@
 
 #include "core/common/common.h"
 
+#include <cstring>
+
 namespace onnxruntime {
 namespace utf8_util {
 
+// Returns true if all the bytes are 7-bit ASCII, so every byte is a character.
+// Checks 8 bytes at a time.
+inline bool is_ascii(const unsigned char* s, size_t len) {
+  constexpr uint64_t high_bits = 0x8080808080808080ULL;
+  size_t idx = 0;
+  for (; idx + 8 <= len; idx += 8) {
+    uint64_t word;
+    memcpy(&word, s + idx, sizeof(word));
+    if ((word & high_bits) != 0) {
+      return false;
+    }
+  }
+  for (; idx < len; ++idx) {
+    if ((s[idx] & 0x80) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // Returns the number of bytes in the utf8 character
 // by analyzing its leading byte
 inline bool utf8_bytes(unsigned char ch, size_t& len) {
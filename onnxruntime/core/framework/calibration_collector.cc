@@ -0,0 +1,223 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/calibration_collector.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <unordered_map>
+
+#include "core/framework/op_kernel_context_internal.h"
+#include "core/graph/graph_viewer.h"
+#include "core/graph/onnx_protobuf.h"
+#include "core/mlas/inc/mlas.h"
+
+namespace onnxruntime {
+
+namespace {
+
+constexpr size_t kBinBlockSize = 1024;
+
+// Count the values in the bins of a histogram of [-threshold, threshold], which covers all of them. The values must
+// be finite.
+void AddToHistogram(const float* values, size_t num_values, float threshold, std::vector<uint64_t>& histogram) {
+  const auto num_bins = static_cast<int32_t>(histogram.size());
+  if (threshold == 0.0f) {
+    // all the values are 0. numpy uses the range [-0.5, 0.5] in this case, which puts them in the middle bin.
+    histogram[num_bins / 2] += num_values;
+    return;
+  }
+
+  // value * scale + half_num_bins is in [0, num_bins] and doesn't overflow, unlike value + threshold.
+  const float half_num_bins = static_cast<float>(num_bins) / 2.0f;
+  const float scale = half_num_bins / threshold;
+  std::array<int32_t, kBinBlockSize> bins;
+  for (size_t begin = 0; begin < num_values; begin += kBinBlockSize) {
+    const size_t block_size = std::min(kBinBlockSize, num_values - begin);
+    const float* block = values + begin;
+
+    // the bins of a block are computed in a loop the compiler vectorizes, the counts are then updated one at a time.
+    // the bin position is not negative so the conversion truncates to the floor, and the values equal to
+    // threshold go to the last bin as with numpy.
+    for (size_t i = 0; i < block_size; ++i) {
+      bins[i] = std::min(static_cast<int32_t>(block[i] * scale + half_num_bins), num_bins - 1);
+    }
+    for (size_t i = 0; i < block_size; ++i) {
+      ++histogram[std::max(bins[i], 0)];
+    }
+  }
+}
+
+bool IsFloatTensorType(const NodeArg& arg) {
+  const auto* type = arg.TypeAsProto();
+  if (type == nullptr || !type->has_tensor_type()) {
+    return false;
+  }
+
+  const auto elem_type = type->tensor_type().elem_type();
+  return elem_type == ONNX_NAMESPACE::TensorProto_DataType_FLOAT ||
+         elem_type == ONNX_NAMESPACE::TensorProto_DataType_FLOAT16;
+}
+
+}  // namespace
+
+void CalibrationCollector::TensorStats::Accumulate(const float* values, size_t num_values, size_t num_bins) {
+  auto is_finite = [](float value) { return std::isfinite(value); };
+
+  // NaN and infinite values have no bin, and would make the range and the histogram meaningless.
+  // the finite values are copied only if there are others.
+  std::vector<float> finite_values;
+  const auto num_finite = static_cast<size_t>(std::count_if(values, values + num_values, is_finite));
+  if (num_finite != num_values) {
+    non_finite_count += num_values - num_finite;
+    finite_values.reserve(num_finite);
+    std::copy_if(values, values + num_values, std::back_inserter(finite_values), is_finite);
+    values = finite_values.data();
+    num_values = num_finite;
+  }
+
+  if (num_values == 0) {
+    return;
+  }
+
+  float batch_min;
+  float batch_max;
+  MlasFindMinMaxElement(values, &batch_min, &batch_max, num_values);
+
+  if (count == 0) {
+    min = batch_min;
+    max = batch_max;
+  } else {
+    min = std::min(min, batch_min);
+    max = std::max(max, batch_max);
+  }
+
+  if (num_bins > 0) {
+    const float batch_threshold = std::max(std::abs(batch_min), std::abs(batch_max));
+    if (count == 0) {
+      histogram.assign(num_bins, 0);
+      threshold = batch_threshold;
+    } else if (batch_threshold > threshold) {
+      if (threshold == 0.0f) {
+        // the values so far are all 0, which stays in the middle bin
+        threshold = batch_threshold;
+      } else {
+        // add whole bins of the current width on both sides
+        const size_t old_num_bins = histogram.size();
+        const double stride = 2.0 * threshold / static_cast<double>(old_num_bins);
+        const auto half_increased_bins = static_cast<size_t>((batch_threshold - threshold) / stride) + 1;
+        std::vector<uint64_t> expanded(old_num_bins + 2 * half_increased_bins, 0);
+        std::copy(histogram.begin(), histogram.end(), expanded.begin() + half_increased_bins);
+        histogram = std::move(expanded);
+        threshold = static_cast<float>(threshold + static_cast<double>(half_increased_bins) * stride);
+      }
+    }
+
+    AddToHistogram(values, num_values, threshold, histogram);
+  }
+
+  count += num_values;
+}
+
+CalibrationCollector::CalibrationCollector(const GraphViewer& graph_viewer,
+                                           const std::unordered_set<std::string>& tensor_names, size_t num_bins)
+    : num_bins_(num_bins), node_slots_(graph_viewer.MaxNodeIndex()) {
+  std::unordered_map<std::string, size_t> entry_indices;
+
+  auto add_slot = [&](NodeIndex node_index, bool is_input, int arg_index, const NodeArg& arg) {
+    if (!arg.Exists() || graph_viewer.IsInitializedTensor(arg.Name())) {
+      return;
+    }
+
+    // without a list of tensors only the ones known to be float are collected. the types of the listed tensors are
+    // checked when they are collected, as they may be unknown if the model has no shape information.
+    if (tensor_names.empty() ? !IsFloatTensorType(arg) : tensor_names.count(arg.Name()) == 0) {
+      return;
+    }
+
+    // a graph input is collected once, by the first node consuming it
+    auto inserted = entry_indices.emplace(arg.Name(), entries_.size());
+    if (!inserted.second) {
+      return;
+    }
+
+    auto entry = std::make_unique<Entry>();
+    entry->tensor_name = arg.Name();
+    entries_.push_back(std::move(entry));
+    node_slots_[node_index].push_back(Slot{is_input, arg_index, inserted.first->second});
+  };
+
+  for (const auto& node : graph_viewer.Nodes()) {
+    const auto& input_defs = node.InputDefs();
+    for (size_t i = 0; i < input_defs.size(); ++i) {
+      // the other inputs are collected by the nodes producing them
+      if (graph_viewer.GetProducerNode(input_defs[i]->Name()) == nullptr) {
+        add_slot(node.Index(), true, static_cast<int>(i), *input_defs[i]);
+      }
+    }
+
+    const auto& output_defs = node.OutputDefs();
+    for (size_t i = 0; i < output_defs.size(); ++i) {
+      add_slot(node.Index(), false, static_cast<int>(i), *output_defs[i]);
+    }
+  }
+}
+
+void CalibrationCollector::Collect(NodeIndex node_index, OpKernelContextInternal& op_kernel_context) {
+  if (node_index >= node_slots_.size()) {
+    return;
+  }
+
+  std::vector<float> converted;
+  for (const Slot& slot : node_slots_[node_index]) {
+    const OrtValue* value = slot.is_input ? op_kernel_context.GetInputMLValue(slot.arg_index)
+                                          : op_kernel_context.GetOutputMLValue(slot.arg_index);
+    if (value == nullptr || !value->IsTensor()) {
+      continue;
+    }
+
+    const Tensor& tensor = value->Get<Tensor>();
+    if (tensor.Location().device.Type() != OrtDevice::CPU) {
+      continue;
+    }
+
+    const auto num_values = static_cast<size_t>(tensor.Shape().Size());
+    const float* values = nullptr;
+    if (tensor.IsDataType<float>()) {
+      values = tensor.Data<float>();
+    } else if (tensor.IsDataType<MLFloat16>()) {
+      converted.resize(num_values);
+      MlasConvertHalfToFloatBuffer(reinterpret_cast<const unsigned short*>(tensor.Data<MLFloat16>()),
+                                   converted.data(), num_values);
+      values = converted.data();
+    } else {
+      continue;
+    }
+
+    Entry& entry = *entries_[slot.entry_index];
+    std::lock_guard<std::mutex> lock(entry.mutex);
+    entry.stats.Accumulate(values, num_values, num_bins_);
+  }
+}
+
+void CalibrationCollector::Reset() {
+  for (auto& entry : entries_) {
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    entry->stats = TensorStats();
+  }
+}
+
+std::map<std::string, CalibrationCollector::TensorStats> CalibrationCollector::GetStats() const {
+  std::map<std::string, TensorStats> stats;
+  for (const auto& entry : entries_) {
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    if (entry->stats.count > 0 || entry->stats.non_finite_count > 0) {
+      stats.emplace(entry->tensor_name, entry->stats);
+    }
+  }
+  return stats;
+}
+
+}  // namespace onnxruntime
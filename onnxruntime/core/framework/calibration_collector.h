@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/graph/basic_types.h"
+
+namespace onnxruntime {
+
+class GraphViewer;
+class OpKernelContextInternal;
+
+/**
+ * Accumulates the statistics used to calibrate the static quantization of a model for float and float16 tensors
+ * consumed or produced by the nodes of a graph: the minimum and maximum values, and optionally a histogram of the
+ * values. The executors pass each node to Collect once it is computed, so the tensors are read in place instead of
+ * being added to the graph outputs and copied out of the session.
+ * The histogram matches HistogramCollector.collect_value of the Python calibrators: num_bins bins over
+ * [-threshold, threshold], where threshold is the largest absolute value seen. When a larger absolute value is seen,
+ * bins of the same width are added on both sides so that the existing counts keep their bins.
+ * NaN and infinite values are left out of the minimum, maximum and histogram, and only counted.
+ * Enabled with the kOrtSessionOptionsConfigCalibrationTensors session option.
+ */
+class CalibrationCollector {
+ public:
+  /**
+   * @param tensor_names Tensors to collect. If empty, all the float and float16 tensors of the graph except the
+   *        initializers are collected. Names of tensors not in the graph are ignored.
+   * @param num_bins Number of bins of the histograms, or 0 to only collect the minimum and maximum values.
+   */
+  CalibrationCollector(const GraphViewer& graph_viewer, const std::unordered_set<std::string>& tensor_names,
+                       size_t num_bins);
+
+  // Accumulate the collected tensors of the inputs and outputs of a node that was computed.
+  void Collect(NodeIndex node_index, OpKernelContextInternal& op_kernel_context);
+
+  void Reset();
+
+  struct TensorStats {
+    // number of finite values
+    uint64_t count{0};
+    // number of NaN and infinite values
+    uint64_t non_finite_count{0};
+    float min{0.0f};
+    float max{0.0f};
+    // the histogram covers [-threshold, threshold]
+    float threshold{0.0f};
+    std::vector<uint64_t> histogram;
+
+    // Add 'values' to the statistics, using num_bins bins for the first histogram. Not thread safe.
+    void Accumulate(const float* values, size_t num_values, size_t num_bins);
+  };
+
+  // Copy of the statistics of the collected tensors which have had values, by tensor name. The minimum, maximum and
+  // histogram are only set if count isn't 0.
+  std::map<std::string, TensorStats> GetStats() const;
+
+  size_t NumBins() const noexcept { return num_bins_; }
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(CalibrationCollector);
+
+  struct Entry {
+    std::string tensor_name;
+    mutable std::mutex mutex;
+    TensorStats stats;
+  };
+
+  // Input or output of a node that is collected once the node is computed.
+  struct Slot {
+    bool is_input;
+    int arg_index;
+    size_t entry_index;
+  };
+
+  size_t num_bins_;
+  std::vector<std::unique_ptr<Entry>> entries_;
+  // indexed by NodeIndex
+  std::vector<std::vector<Slot>> node_slots_;
+};
+
+}  // namespace onnxruntime
@@ -38,7 +38,6 @@ IExecutionFrame::IExecutionFrame(const OrtValueNameIdxMap& ort_value_idx_map,
 
 IExecutionFrame::~IExecutionFrame() = default;
 
-#ifdef ENABLE_ATEN
 Status IExecutionFrame::SetOutputMLValue(int index, const OrtValue& ort_value) {
   int ort_value_idx = GetNodeIdxToMLValueIdx(index);
   if (ort_value_idx == NodeIndexInfo::kInvalidEntry || static_cast<size_t>(ort_value_idx) >= all_values_size_) {
@@ -52,7 +51,6 @@ Status IExecutionFrame::SetOutputMLValue(int index, const OrtValue& ort_value) {
   }
   return Status::OK();
 }
-#endif
 
 #ifdef ENABLE_TRAINING
 void IExecutionFrame::UpdateFeeds(gsl::span<const int> feed_mlvalue_idxs, gsl::span<const OrtValue> feeds) {
@@ -307,6 +305,10 @@ void IExecutionFrame::Init(gsl::span<const int> feed_mlvalue_idxs, gsl::span<con
   }
 }
 
+void IExecutionFrame::ClearValues() {
+  all_values_.clear();
+}
+
 Status IExecutionFrame::GetOutputs(std::vector<OrtValue>& fetches) {
   auto num_fetches = fetch_mlvalue_idxs_.size();
 
@@ -339,22 +341,7 @@ ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span
     : IExecutionFrame(session_state.GetOrtValueNameIdxMap(), session_state.GetNodeIndexInfo(), fetch_mlvalue_idxs),
       session_state_(session_state),
       mem_patterns_(nullptr) {
-  Init(
-      feed_mlvalue_idxs, feeds, session_state.GetInitializedTensors(),
-#if !defined(DISABLE_SPARSE_TENSORS)
-      [&session_state](const std::string& name) -> bool {
-        int idx = -1;
-        if (session_state.GetOrtValueNameIdxMap().GetIdx(name, idx).IsOK()) {
-          return session_state.IsSparseInitializer(idx);
-        }
-        return false;
-      },
-#else
-      [&](const std::string& /*name*/) -> bool {
-        return false;
-      },
-#endif
-      fetches);
+  InitValues(feed_mlvalue_idxs, feeds, fetches);
 
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   MemoryInfo::IncreaseIteration();
@@ -390,7 +377,8 @@ ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span
       mem_patterns_ = session_state.GetMemoryPatternGroup(feeds, feed_mlvalue_idxs, inferred_shapes_);
       // if no existing patterns, generate one in this execution frame
       if (!mem_patterns_) {
-        planner_.emplace(*session_state.GetExecutionPlan());
+        planner_.emplace(*session_state.GetExecutionPlan(), /*trace_using_counters*/ false,
+                         session_state.GetMemPatternStrategy());
       } else {
         // pre-allocate the big chunk requested in memory pattern.
         // all the internal kernel's input/output tensors will be allocated on these buffer.
@@ -458,6 +446,40 @@ ExecutionFrame::ExecutionFrame(gsl::span<const int> feed_mlvalue_idxs, gsl::span
 
 ExecutionFrame::~ExecutionFrame() = default;
 
+void ExecutionFrame::InitValues(gsl::span<const int> feed_mlvalue_idxs, gsl::span<const OrtValue> feeds,
+                                gsl::span<const OrtValue> fetches) {
+  const SessionState& session_state = session_state_;
+  Init(
+      feed_mlvalue_idxs, feeds, session_state.GetInitializedTensors(),
+#if !defined(DISABLE_SPARSE_TENSORS)
+      [&session_state](const std::string& name) -> bool {
+        int idx = -1;
+        if (session_state.GetOrtValueNameIdxMap().GetIdx(name, idx).IsOK()) {
+          return session_state.IsSparseInitializer(idx);
+        }
+        return false;
+      },
+#else
+      [&](const std::string& /*name*/) -> bool {
+        return false;
+      },
+#endif
+      fetches);
+}
+
+bool ExecutionFrame::CanReset() const {
+  // a frame that is tracing allocations must be discarded so the next one picks up the generated patterns, and
+  // custom allocators are specific to the fetches the frame was created with.
+  return !planner_.has_value() && custom_allocators_.empty();
+}
+
+void ExecutionFrame::Reset(gsl::span<const int> feed_mlvalue_idxs, gsl::span<const OrtValue> feeds,
+                           gsl::span<const OrtValue> fetches) {
+  ORT_ENFORCE(CanReset(), "ExecutionFrame with a memory pattern planner or custom allocators can not be reset.");
+  ClearValues();
+  InitValues(feed_mlvalue_idxs, feeds, fetches);
+}
+
 Status ExecutionFrame::CopyTensor(const Tensor& src, Tensor& dest) const {
   return session_state_.GetDataTransferMgr().CopyTensor(src, dest);
 }
@@ -876,7 +898,16 @@ Status ExecutionFrame::GeneratePatterns(MemoryPatternGroup& out) {
     return Status(ONNXRUNTIME, FAIL, "Memory pattern planner is not enabled on this execution framework.");
   }
 
-  return planner_->GeneratePatterns(out);
+  ORT_RETURN_IF_ERROR(planner_->GeneratePatterns(out));
+
+  for (size_t i = 0, end = out.locations.size(); i < end; ++i) {
+    LOGS(session_state_.Logger(), VERBOSE) << "Memory pattern for " << out.locations[i].ToString()
+                                           << ": trace order peak size " << out.patterns[i].TracedPeakSize()
+                                           << " bytes, planned peak size " << out.patterns[i].PlannedPeakSize()
+                                           << " bytes, using peak size " << out.patterns[i].PeakSize() << " bytes";
+  }
+
+  return Status::OK();
 }
 
 bool ExecutionFrame::TryGetInferredShape(int index, TensorShape& shape) const {
@@ -39,6 +39,9 @@ class IExecutionFrame {
             const std::function<bool(const std::string& name)>& is_initializer_sparse_func,
             gsl::span<const OrtValue> fetches);
 
+  // Release all the values so the frame can be initialized again with Init.
+  void ClearValues();
+
  public:
   virtual ~IExecutionFrame();
 
@@ -51,10 +54,9 @@ class IExecutionFrame {
   const OrtValue* GetNodeInputOrOutputMLValue(int index) const;
   OrtValue* GetMutableNodeInputOrOutputMLValue(int index);
 
-#ifdef ENABLE_ATEN
-  // Override the index-th output with ort_value
+  // Override the index-th output with ort_value.
+  // If the output is already allocated the data is copied into it, otherwise the output shares ort_value.
   Status SetOutputMLValue(int index, const OrtValue& ort_value);
-#endif
   
 #ifdef ENABLE_TRAINING  
   void UpdateFeeds(gsl::span<const int> feed_mlvalue_idxs, gsl::span<const OrtValue> feeds);
@@ -140,6 +142,15 @@ class ExecutionFrame final : public IExecutionFrame {
 
   ~ExecutionFrame() override;
 
+  // Whether the frame can be reset for another execution. See Reset.
+  bool CanReset() const;
+
+  // Prepare the frame for another execution of the graph with new feeds and fetches, keeping the memory pattern
+  // buffers allocated. The feeds must have the same shapes as the feeds the frame was created with as the memory
+  // pattern and inferred shapes depend on them, and CanReset() must be true.
+  void Reset(gsl::span<const int> feed_mlvalue_idxs, gsl::span<const OrtValue> feeds,
+             gsl::span<const OrtValue> fetches);
+
   // TODO: These two AllocateMLValue... methods are in the API purely for unit test usage.
   // Fix the unit tests so they set an execution plan that results in these methods being called by
   // GetOrCreateNodeOutputMLValue instead
@@ -187,6 +198,9 @@ class ExecutionFrame final : public IExecutionFrame {
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ExecutionFrame);
 
+  void InitValues(gsl::span<const int> feed_mlvalue_idxs, gsl::span<const OrtValue> feeds,
+                  gsl::span<const OrtValue> fetches);
+
   AllocatorPtr GetAllocatorImpl(const OrtMemoryInfo& info) const override;
   Status ReleaseMLValueImpl(int ort_value_idx) override;
   Status CreateNodeOutputMLValueImpl(OrtValue& ort_value, int ort_value_idx, const TensorShape* shape) override;
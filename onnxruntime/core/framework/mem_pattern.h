@@ -7,6 +7,18 @@
 #include "core/framework/allocation_planner.h"
 
 namespace onnxruntime {
+// How the offsets of the blocks in a memory pattern are chosen.
+// kTraceOrder places each block when it is allocated while tracing a run, in the first best-fitting gap.
+// The other strategies plan the offsets after the run, when the lifetime of every block is known, processing the
+// blocks in a heuristic order as in the TFLite arena and GPU memory planners. The result is only used if its peak
+// is lower than the trace order one.
+enum class MemPatternStrategy : uint8_t {
+  kTraceOrder,
+  kGreedyBySize,     // largest blocks first
+  kGreedyByBreadth,  // blocks live at the points with the largest total live size first
+  kMinPeak,          // best of all the strategies
+};
+
 struct MemoryBlock {
   size_t offset_{0};
   size_t size_{0};
@@ -20,17 +32,22 @@ struct MemoryBlock {
 
 class MemoryPattern {
   friend class MemPatternPlanner;
+  friend class SymbolicMemoryPlan;
 
  public:
   MemoryPattern() = default;
 
   MemoryPattern(MemoryPattern&& rhs) noexcept
       : patterns_{std::move(rhs.patterns_)},
-        peak_size_{std::move(rhs.peak_size_)} {}
+        peak_size_{std::move(rhs.peak_size_)},
+        traced_peak_size_{std::move(rhs.traced_peak_size_)},
+        planned_peak_size_{std::move(rhs.planned_peak_size_)} {}
 
   MemoryPattern& operator=(MemoryPattern&& rhs) noexcept {
     patterns_ = std::move(rhs.patterns_);
     peak_size_ = std::move(rhs.peak_size_);
+    traced_peak_size_ = std::move(rhs.traced_peak_size_);
+    planned_peak_size_ = std::move(rhs.planned_peak_size_);
     return *this;
   }
 
@@ -38,6 +55,18 @@ class MemoryPattern {
     return peak_size_;
   }
 
+  // Peak size with the offsets assigned in trace order. Differs from PeakSize() if a MemPatternStrategy other than
+  // kTraceOrder found a smaller layout.
+  size_t TracedPeakSize() const {
+    return traced_peak_size_;
+  }
+
+  // Peak size with the offsets planned by the MemPatternStrategy, even if they weren't used as they don't improve on
+  // the trace order ones. PeakSize() is the smaller of TracedPeakSize() and PlannedPeakSize().
+  size_t PlannedPeakSize() const {
+    return planned_peak_size_;
+  }
+
   const MemoryBlock* GetBlock(int ml_value_idx) const {
     auto it = patterns_.find(ml_value_idx);
     if (it == patterns_.end())
@@ -56,6 +85,8 @@ class MemoryPattern {
 
   InlinedHashMap<int, MemoryBlock> patterns_;
   size_t peak_size_{0};
+  size_t traced_peak_size_{0};
+  size_t planned_peak_size_{0};
 };
 
 struct MemoryPatternGroup {
@@ -0,0 +1,172 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/mem_pattern_offset_planner.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+#include "core/common/safeint.h"
+
+namespace onnxruntime {
+
+namespace {
+
+constexpr size_t kNotPlaced = std::numeric_limits<size_t>::max();
+
+// Place the blocks in the given order, each one in the best-fitting gap between the placed blocks it is live with.
+size_t PlaceBlocks(const std::vector<MemoryBlockLifetime>& blocks, const std::vector<size_t>& order,
+                   std::vector<size_t>& offsets) {
+  offsets.assign(blocks.size(), kNotPlaced);
+
+  std::vector<size_t> placed;
+  placed.reserve(order.size());
+  // [offset, end) of the placed blocks that are live at the same time as the block being placed
+  std::vector<std::pair<size_t, size_t>> live_ranges;
+  SafeInt<size_t> peak_size = 0;
+
+  for (size_t idx : order) {
+    const auto& block = blocks[idx];
+    if (block.size == 0) {
+      offsets[idx] = 0;
+      continue;
+    }
+
+    live_ranges.clear();
+    for (size_t other : placed) {
+      if (block.Overlaps(blocks[other])) {
+        live_ranges.emplace_back(offsets[other], offsets[other] + blocks[other].size);
+      }
+    }
+    std::sort(live_ranges.begin(), live_ranges.end());
+
+    size_t current = 0;
+    size_t best_offset = kNotPlaced;
+    size_t best_waste = std::numeric_limits<size_t>::max();
+    for (const auto& range : live_ranges) {
+      if (range.first > current) {
+        const size_t gap = range.first - current;
+        if (gap >= block.size && gap - block.size < best_waste) {
+          best_waste = gap - block.size;
+          best_offset = current;
+        }
+      }
+      current = std::max(current, range.second);
+    }
+
+    if (best_offset == kNotPlaced) {
+      best_offset = current;
+    }
+
+    offsets[idx] = best_offset;
+    peak_size = std::max<size_t>(peak_size, SafeInt<size_t>(best_offset) + block.size);
+    placed.push_back(idx);
+  }
+
+  return peak_size;
+}
+
+// Largest blocks first. Ties are broken by allocation time so the result is deterministic.
+std::vector<size_t> GreedyBySizeOrder(const std::vector<MemoryBlockLifetime>& blocks) {
+  std::vector<size_t> order(blocks.size());
+  std::iota(order.begin(), order.end(), size_t{0});
+  std::stable_sort(order.begin(), order.end(), [&blocks](size_t a, size_t b) {
+    if (blocks[a].size != blocks[b].size) {
+      return blocks[a].size > blocks[b].size;
+    }
+    return blocks[a].alloc_time < blocks[b].alloc_time;
+  });
+  return order;
+}
+
+// The blocks live at the point with the largest total live size (breadth) first, largest block first, then those
+// of the point with the next largest breadth, and so on. Only allocation times need to be considered as the set of
+// live blocks can only grow at one of them.
+std::vector<size_t> GreedyByBreadthOrder(const std::vector<MemoryBlockLifetime>& blocks) {
+  std::vector<size_t> alloc_times;
+  alloc_times.reserve(blocks.size());
+  for (const auto& block : blocks) {
+    alloc_times.push_back(block.alloc_time);
+  }
+  std::sort(alloc_times.begin(), alloc_times.end());
+  alloc_times.erase(std::unique(alloc_times.begin(), alloc_times.end()), alloc_times.end());
+
+  auto is_live_at = [](const MemoryBlockLifetime& block, size_t time) {
+    return block.alloc_time <= time && time < block.free_time;
+  };
+
+  std::vector<std::pair<size_t, size_t>> breadths;  // (breadth, time)
+  breadths.reserve(alloc_times.size());
+  for (size_t time : alloc_times) {
+    size_t breadth = 0;
+    for (const auto& block : blocks) {
+      if (is_live_at(block, time)) {
+        breadth += block.size;
+      }
+    }
+    breadths.emplace_back(breadth, time);
+  }
+  std::stable_sort(breadths.begin(), breadths.end(),
+                   [](const std::pair<size_t, size_t>& a, const std::pair<size_t, size_t>& b) {
+                     return a.first > b.first;
+                   });
+
+  const auto by_size = GreedyBySizeOrder(blocks);
+  std::vector<bool> ordered(blocks.size(), false);
+  std::vector<size_t> order;
+  order.reserve(blocks.size());
+  for (const auto& breadth : breadths) {
+    for (size_t idx : by_size) {
+      if (!ordered[idx] && is_live_at(blocks[idx], breadth.second)) {
+        ordered[idx] = true;
+        order.push_back(idx);
+      }
+    }
+  }
+
+  return order;
+}
+
+}  // namespace
+
+Status ParseMemPatternStrategy(const std::string& name, MemPatternStrategy& strategy) {
+  if (name == "trace") {
+    strategy = MemPatternStrategy::kTraceOrder;
+  } else if (name == "greedy_by_size") {
+    strategy = MemPatternStrategy::kGreedyBySize;
+  } else if (name == "greedy_by_breadth") {
+    strategy = MemPatternStrategy::kGreedyByBreadth;
+  } else if (name == "min_peak") {
+    strategy = MemPatternStrategy::kMinPeak;
+  } else {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid memory pattern strategy: '", name,
+                           "'. Valid values are 'trace', 'greedy_by_size', 'greedy_by_breadth' and 'min_peak'.");
+  }
+
+  return Status::OK();
+}
+
+size_t PlanMemoryOffsets(const std::vector<MemoryBlockLifetime>& blocks, MemPatternStrategy strategy,
+                         std::vector<size_t>& offsets) {
+  switch (strategy) {
+    case MemPatternStrategy::kGreedyBySize:
+      return PlaceBlocks(blocks, GreedyBySizeOrder(blocks), offsets);
+    case MemPatternStrategy::kGreedyByBreadth:
+      return PlaceBlocks(blocks, GreedyByBreadthOrder(blocks), offsets);
+    case MemPatternStrategy::kMinPeak: {
+      const size_t by_size_peak = PlaceBlocks(blocks, GreedyBySizeOrder(blocks), offsets);
+      std::vector<size_t> by_breadth_offsets;
+      const size_t by_breadth_peak = PlaceBlocks(blocks, GreedyByBreadthOrder(blocks), by_breadth_offsets);
+      if (by_breadth_peak < by_size_peak) {
+        offsets = std::move(by_breadth_offsets);
+        return by_breadth_peak;
+      }
+      return by_size_peak;
+    }
+    default:
+      ORT_THROW("Memory pattern strategy ", static_cast<int>(strategy), " does not plan offsets statically.");
+  }
+}
+
+}  // namespace onnxruntime
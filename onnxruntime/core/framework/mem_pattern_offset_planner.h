@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/mem_pattern.h"
+
+namespace onnxruntime {
+
+// Size and lifetime of a block in a memory pattern.
+// The block is live from alloc_time up to, but not including, free_time. Times are only compared with each other.
+struct MemoryBlockLifetime {
+  size_t size{0};
+  size_t alloc_time{0};
+  size_t free_time{std::numeric_limits<size_t>::max()};
+
+  bool Overlaps(const MemoryBlockLifetime& other) const {
+    return alloc_time < other.free_time && other.alloc_time < free_time;
+  }
+};
+
+// Parse the value of the kOrtSessionOptionsConfigMemoryPatternStrategy session option.
+Status ParseMemPatternStrategy(const std::string& name, MemPatternStrategy& strategy);
+
+// Assign an offset to each block so that blocks with overlapping lifetimes do not overlap in memory.
+// This is the static offset assignment problem solved by the TFLite arena planner: blocks are processed in the
+// order given by the strategy and each one is put in the smallest gap between the already placed blocks it is
+// live with that fits it, or after them.
+// 'strategy' must not be kTraceOrder, which needs the blocks to be placed while tracing.
+// Returns the peak size, i.e. the size of the buffer required to hold all the blocks.
+size_t PlanMemoryOffsets(const std::vector<MemoryBlockLifetime>& blocks, MemPatternStrategy strategy,
+                         std::vector<size_t>& offsets);
+
+}  // namespace onnxruntime
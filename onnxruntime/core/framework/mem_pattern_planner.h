@@ -19,6 +19,7 @@ limitations under the License.
 #include <list>
 #include "core/common/safeint.h"
 #include "core/framework/mem_pattern.h"
+#include "core/framework/mem_pattern_offset_planner.h"
 #include "core/framework/allocation_planner.h"
 #include "core/platform/ort_mutex.h"
 
@@ -26,11 +27,14 @@ namespace onnxruntime {
 // MemPatternPlanner is used to trace allocation/free steps
 // in a single iteration, record the pattern and cached for
 // future request if they have the same input shape.
+// With a MemPatternStrategy other than kTraceOrder the lifetime of each allocation is recorded as well, and the
+// offsets are re-planned with the strategy when the pattern is generated.
 // Thread-safe.
 class MemPatternPlanner {
  public:
   // only the Training code currently uses the program counter based logic
-  MemPatternPlanner(bool using_counters) : using_counters_{using_counters} {}
+  MemPatternPlanner(bool using_counters, MemPatternStrategy strategy = MemPatternStrategy::kTraceOrder)
+      : using_counters_{using_counters}, strategy_{strategy} {}
 
 #ifdef ENABLE_TRAINING
   // TODO: OverlappingTimeSchedules should be private
@@ -135,8 +139,9 @@ class MemPatternPlanner {
 
     std::lock_guard<OrtMutex> lock(lock_);
 
+    const size_t alloc_time = trace_time_++;
     if (size == 0) {
-      allocs_.emplace_back(ml_value_idx, MemoryBlock(0, 0));
+      allocs_.emplace_back(ml_value_idx, MemoryBlock(0, 0), alloc_time);
       return;
     }
 
@@ -174,7 +179,7 @@ class MemPatternPlanner {
     // we only need to bounds check the addition of size to best_offset as that is the only time we extend
     // the maximum size of the buffer.
     buffer_size_ = std::max(buffer_size_, SafeInt<size_t>(best_offset) + size);
-    allocs_.emplace_back(ml_value_idx, MemoryBlock(best_offset, size));
+    allocs_.emplace_back(ml_value_idx, MemoryBlock(best_offset, size), alloc_time);
     std::list<int>::iterator best_fit_it = blocks_.end();
     for (auto it = blocks_.begin(); it != blocks_.end(); it++) {
       if (allocs_[*it].block_.offset_ < best_offset)
@@ -194,6 +199,7 @@ class MemPatternPlanner {
 
     for (auto it = blocks_.begin(); it != blocks_.end(); it++) {
       if (allocs_[*it].index_ == ml_value_index) {
+        allocs_[*it].free_time_ = trace_time_++;
         blocks_.erase(it);
         break;
       }
@@ -235,11 +241,17 @@ class MemPatternPlanner {
 
     MemoryPattern pattern;
     pattern.peak_size_ = buffer_size_;
+    pattern.traced_peak_size_ = buffer_size_;
+    pattern.planned_peak_size_ = buffer_size_;
     pattern.patterns_.reserve(allocs_.size());
     for (auto& alloc : allocs_) {
       pattern.patterns_.insert_or_assign(alloc.index_, alloc.block_);
     }
 
+    if (!using_counters_ && strategy_ != MemPatternStrategy::kTraceOrder) {
+      PlanOffsets(pattern);
+    }
+
     return pattern;
   }
 
@@ -250,17 +262,46 @@ class MemPatternPlanner {
     const AllocPlanPerValue::ProgramCounter* counter_{nullptr};
     bool reuse_{false};
     OrtValueAllocationBlock() = default;
+    // trace time of the allocation and of the free. allocations that are never freed stay live until the end.
+    size_t alloc_time_{0};
+    size_t free_time_{std::numeric_limits<size_t>::max()};
     OrtValueAllocationBlock(int index, const MemoryBlock& block) : index_(index), block_(block), reuse_{false} {}
+    OrtValueAllocationBlock(int index, const MemoryBlock& block, size_t alloc_time)
+        : index_(index), block_(block), reuse_{false}, alloc_time_{alloc_time} {}
     OrtValueAllocationBlock(int index, const AllocPlanPerValue::ProgramCounter& counter, const MemoryBlock& block)
         : index_(index), block_(block), counter_(&counter), reuse_{true} {
     }
   };
 
+  // Replace the trace order offsets in pattern with those planned by strategy_ if that has a smaller peak.
+  void PlanOffsets(MemoryPattern& pattern) const {
+    std::vector<MemoryBlockLifetime> lifetimes;
+    lifetimes.reserve(allocs_.size());
+    for (const auto& alloc : allocs_) {
+      lifetimes.push_back({alloc.block_.size_, alloc.alloc_time_, alloc.free_time_});
+    }
+
+    std::vector<size_t> offsets;
+    const size_t peak_size = PlanMemoryOffsets(lifetimes, strategy_, offsets);
+    pattern.planned_peak_size_ = peak_size;
+    if (peak_size >= pattern.peak_size_) {
+      return;
+    }
+
+    pattern.peak_size_ = peak_size;
+    for (size_t i = 0, end = allocs_.size(); i < end; ++i) {
+      pattern.patterns_.insert_or_assign(allocs_[i].index_, MemoryBlock(offsets[i], allocs_[i].block_.size_));
+    }
+  }
+
   std::vector<OrtValueAllocationBlock> allocs_;
   // blocks_ the list of currently allocated memory blocks, sorted in order of their offset
   std::list<int> blocks_;
   SafeInt<size_t> buffer_size_{0};
   bool using_counters_;
+  MemPatternStrategy strategy_;
+  // logical clock of the TraceAllocation/TraceFree calls
+  size_t trace_time_{0};
   mutable OrtMutex lock_;
 };
 
@@ -0,0 +1,340 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/node_stats_recorder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include "core/framework/op_kernel_context_internal.h"
+#include "core/framework/session_state.h"
+#include "core/graph/graph_viewer.h"
+
+namespace onnxruntime {
+namespace profiling {
+
+namespace {
+
+int FloorLog2(uint64_t value) {
+  int result = 0;
+  for (int shift = 32; shift > 0; shift >>= 1) {
+    if (value >= (uint64_t{1} << shift)) {
+      value >>= shift;
+      result += shift;
+    }
+  }
+  return result;
+}
+
+void AtomicMin(std::atomic<uint64_t>& target, uint64_t value) {
+  uint64_t current = target.load(std::memory_order_relaxed);
+  while (value < current &&
+         !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+void AtomicMax(std::atomic<uint64_t>& target, uint64_t value) {
+  uint64_t current = target.load(std::memory_order_relaxed);
+  while (value > current &&
+         !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+void WriteJsonString(std::ostream& out, const std::string& str) {
+  out << '"';
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        out << "\\\"";
+        break;
+      case '\\':
+        out << "\\\\";
+        break;
+      case '\n':
+        out << "\\n";
+        break;
+      case '\t':
+        out << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+          out << c;
+        }
+    }
+  }
+  out << '"';
+}
+
+void WriteEntryFields(std::ostream& out, const NodeStatsReport::Entry& entry) {
+  const auto& latency = entry.latency;
+  constexpr double kNsPerUs = 1000.0;
+  out << "\"op_type\":";
+  WriteJsonString(out, entry.op_type);
+  out << ",\"count\":" << latency.count
+      << ",\"total_us\":" << latency.sum / kNsPerUs
+      << ",\"mean_us\":" << latency.Mean() / kNsPerUs
+      << ",\"min_us\":" << latency.min / kNsPerUs
+      << ",\"p50_us\":" << latency.Percentile(50) / kNsPerUs
+      << ",\"p90_us\":" << latency.Percentile(90) / kNsPerUs
+      << ",\"p99_us\":" << latency.Percentile(99) / kNsPerUs
+      << ",\"max_us\":" << latency.max / kNsPerUs
+      << ",\"input_bytes\":" << entry.input_bytes
+      << ",\"output_bytes\":" << entry.output_bytes;
+}
+
+void CollectNodeStatsImpl(const SessionState& session_state, const std::string& prefix, NodeStatsReport& report) {
+  const auto* recorder = session_state.GetNodeStatsRecorder();
+  if (recorder == nullptr) {
+    return;
+  }
+
+  const auto& entries = recorder->Entries();
+  for (size_t i = 0, end = entries.size(); i < end; ++i) {
+    const auto* node_entry = entries[i].get();
+    if (node_entry == nullptr) {
+      continue;
+    }
+
+    NodeStatsReport::Entry entry;
+    entry.op_type = node_entry->op_type;
+    entry.latency = node_entry->latency.GetSnapshot();
+    entry.input_bytes = node_entry->input_bytes.load(std::memory_order_relaxed);
+    entry.output_bytes = node_entry->output_bytes.load(std::memory_order_relaxed);
+    entry.num_nodes = 1;
+
+    // Derive something meaningful if node name field is blank, matching what the profiler does
+    const std::string name = node_entry->node_name.empty() ? MakeString(node_entry->op_type, "_", i)
+                                                           : node_entry->node_name;
+    report.per_node[prefix + name].Merge(entry);
+    report.per_op_type[entry.op_type].Merge(entry);
+  }
+
+  const auto& graph_viewer = session_state.GetGraphViewer();
+  for (const auto& node_to_subgraphs : session_state.GetSubgraphSessionStateMap()) {
+    const auto* node = graph_viewer.GetNode(node_to_subgraphs.first);
+    const std::string node_name = node == nullptr || node->Name().empty()
+                                      ? MakeString("node_", node_to_subgraphs.first)
+                                      : node->Name();
+    for (const auto& attr_to_subgraph : node_to_subgraphs.second) {
+      CollectNodeStatsImpl(*attr_to_subgraph.second,
+                           MakeString(prefix, node_name, "/", attr_to_subgraph.first, "/"),
+                           report);
+    }
+  }
+}
+
+}  // namespace
+
+void LatencyHistogram::Record(uint64_t value) noexcept {
+  buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+  count_.fetch_add(1, std::memory_order_relaxed);
+  sum_.fetch_add(value, std::memory_order_relaxed);
+  AtomicMin(min_, value);
+  AtomicMax(max_, value);
+}
+
+void LatencyHistogram::Reset() noexcept {
+  for (auto& bucket : buckets_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  count_.store(0, std::memory_order_relaxed);
+  sum_.store(0, std::memory_order_relaxed);
+  min_.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+  max_.store(0, std::memory_order_relaxed);
+}
+
+size_t LatencyHistogram::BucketIndex(uint64_t value) noexcept {
+  // values in the first two octaves map 1:1 to a bucket
+  if (value < 2 * kSubBucketCount) {
+    return static_cast<size_t>(value);
+  }
+
+  const int exponent = FloorLog2(value);
+  if (exponent >= kMaxExponent) {
+    return kNumBuckets - 1;
+  }
+
+  // mantissa is in [kSubBucketCount, 2 * kSubBucketCount)
+  const uint64_t mantissa = value >> (exponent - kSubBucketBits);
+  return static_cast<size_t>((exponent - kSubBucketBits + 1) * kSubBucketCount + mantissa - kSubBucketCount);
+}
+
+uint64_t LatencyHistogram::BucketLowerBound(size_t index) noexcept {
+  if (index < 2 * kSubBucketCount) {
+    return index;
+  }
+
+  const int exponent = static_cast<int>(index / kSubBucketCount) + kSubBucketBits - 1;
+  const uint64_t mantissa = index % kSubBucketCount + kSubBucketCount;
+  return mantissa << (exponent - kSubBucketBits);
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::GetSnapshot() const {
+  Snapshot snapshot;
+  for (size_t i = 0; i < kNumBuckets; ++i) {
+    snapshot.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+  }
+
+  snapshot.count = count_.load(std::memory_order_relaxed);
+  snapshot.sum = sum_.load(std::memory_order_relaxed);
+  if (snapshot.count > 0) {
+    snapshot.min = min_.load(std::memory_order_relaxed);
+    snapshot.max = max_.load(std::memory_order_relaxed);
+  }
+
+  return snapshot;
+}
+
+void LatencyHistogram::Snapshot::Merge(const Snapshot& other) {
+  if (other.count == 0) {
+    return;
+  }
+
+  min = count == 0 ? other.min : std::min(min, other.min);
+  max = std::max(max, other.max);
+  count += other.count;
+  sum += other.sum;
+  for (size_t i = 0; i < kNumBuckets; ++i) {
+    buckets[i] += other.buckets[i];
+  }
+}
+
+uint64_t LatencyHistogram::Snapshot::Percentile(double percentile) const {
+  if (count == 0) {
+    return 0;
+  }
+
+  const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+  const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped / 100.0 * count)));
+
+  uint64_t cumulative = 0;
+  for (size_t i = 0; i < kNumBuckets; ++i) {
+    cumulative += buckets[i];
+    if (cumulative >= rank) {
+      const uint64_t lower = BucketLowerBound(i);
+      const uint64_t upper = i + 1 < kNumBuckets ? BucketLowerBound(i + 1) : max + 1;
+      const uint64_t mid = lower + (upper - lower - 1) / 2;
+      return std::min(std::max(mid, min), max);
+    }
+  }
+
+  // counts are read without synchronization so a concurrent Record() may leave the buckets one behind 'count'
+  return max;
+}
+
+NodeStatsRecorder::NodeStatsRecorder(const GraphViewer& graph_viewer)
+    : entries_(graph_viewer.MaxNodeIndex()) {
+  for (const auto& node : graph_viewer.Nodes()) {
+    auto entry = std::make_unique<NodeEntry>();
+    entry->node_name = node.Name();
+    entry->op_type = node.OpType();
+    entries_[node.Index()] = std::move(entry);
+  }
+}
+
+void NodeStatsRecorder::Record(NodeIndex node_index, uint64_t duration_ns,
+                               size_t input_bytes, size_t output_bytes) noexcept {
+  if (node_index >= entries_.size() || entries_[node_index] == nullptr) {
+    return;
+  }
+
+  auto& entry = *entries_[node_index];
+  entry.latency.Record(duration_ns);
+  entry.input_bytes.fetch_add(input_bytes, std::memory_order_relaxed);
+  entry.output_bytes.fetch_add(output_bytes, std::memory_order_relaxed);
+}
+
+void NodeStatsRecorder::Reset() noexcept {
+  for (auto& entry : entries_) {
+    if (entry) {
+      entry->latency.Reset();
+      entry->input_bytes.store(0, std::memory_order_relaxed);
+      entry->output_bytes.store(0, std::memory_order_relaxed);
+    }
+  }
+}
+
+void NodeStatsReport::Entry::Merge(const Entry& other) {
+  if (op_type.empty()) {
+    op_type = other.op_type;
+  }
+
+  latency.Merge(other.latency);
+  input_bytes += other.input_bytes;
+  output_bytes += other.output_bytes;
+  num_nodes += other.num_nodes;
+}
+
+std::string NodeStatsReport::ToJson() const {
+  std::ostringstream out;
+  out << std::fixed << std::setprecision(3);
+  out << "{\"nodes\":[";
+  bool first = true;
+  for (const auto& name_entry : per_node) {
+    out << (first ? "" : ",") << "{\"name\":";
+    WriteJsonString(out, name_entry.first);
+    out << ",";
+    WriteEntryFields(out, name_entry.second);
+    out << "}";
+    first = false;
+  }
+
+  out << "],\"op_types\":[";
+  first = true;
+  for (const auto& op_type_entry : per_op_type) {
+    out << (first ? "" : ",") << "{";
+    WriteEntryFields(out, op_type_entry.second);
+    out << ",\"num_nodes\":" << op_type_entry.second.num_nodes << "}";
+    first = false;
+  }
+
+  out << "]}";
+  return out.str();
+}
+
+void CalculateTensorInputOutputSizes(OpKernelContextInternal& op_kernel_context,
+                                     size_t& input_bytes, size_t& output_bytes) {
+  input_bytes = 0;
+  output_bytes = 0;
+
+  for (int i = 0, end = op_kernel_context.InputCount(); i < end; ++i) {
+    const OrtValue* p_input = op_kernel_context.GetInputMLValue(i);
+    if (p_input != nullptr && p_input->IsTensor()) {
+      input_bytes += p_input->Get<Tensor>().SizeInBytes();
+    }
+  }
+
+  for (int i = 0, end = op_kernel_context.OutputCount(); i < end; ++i) {
+    const OrtValue* p_output = op_kernel_context.GetOutputMLValue(i);
+    if (p_output != nullptr && p_output->IsTensor()) {
+      output_bytes += p_output->Get<Tensor>().SizeInBytes();
+    }
+  }
+}
+
+NodeStatsReport CollectNodeStats(const SessionState& session_state) {
+  NodeStatsReport report;
+  CollectNodeStatsImpl(session_state, "", report);
+  return report;
+}
+
+void ResetNodeStats(const SessionState& session_state) {
+  auto* recorder = session_state.GetNodeStatsRecorder();
+  if (recorder != nullptr) {
+    recorder->Reset();
+  }
+
+  for (const auto& node_to_subgraphs : session_state.GetSubgraphSessionStateMap()) {
+    for (const auto& attr_to_subgraph : node_to_subgraphs.second) {
+      ResetNodeStats(*attr_to_subgraph.second);
+    }
+  }
+}
+
+}  // namespace profiling
+}  // namespace onnxruntime
@@ -0,0 +1,147 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/graph/basic_types.h"
+
+namespace onnxruntime {
+
+class GraphViewer;
+class OpKernelContextInternal;
+class SessionState;
+
+namespace profiling {
+
+/**
+ * Cumulative latency histogram with log-linear (HDR style) buckets.
+ * Values below 2^kSubBucketBits are counted exactly; above that each power of two is split into
+ * 2^kSubBucketBits linear sub-buckets, which bounds the relative error of a percentile to ~6%.
+ * All updates are relaxed atomic increments so Record() can be called concurrently without locks.
+ */
+class LatencyHistogram {
+ public:
+  static constexpr int kSubBucketBits = 4;
+  static constexpr uint64_t kSubBucketCount = uint64_t{1} << kSubBucketBits;
+  // largest tracked magnitude is 2^kMaxExponent ns (~18 minutes). larger values go to the last bucket.
+  static constexpr int kMaxExponent = 40;
+  static constexpr size_t kNumBuckets = (kMaxExponent - kSubBucketBits + 1) * kSubBucketCount;
+
+  LatencyHistogram() { Reset(); }
+
+  void Record(uint64_t value) noexcept;
+  void Reset() noexcept;
+
+  // Bucket index a value is counted in, and the inclusive lower bound of a bucket.
+  static size_t BucketIndex(uint64_t value) noexcept;
+  static uint64_t BucketLowerBound(size_t index) noexcept;
+
+  /**
+   * Non-atomic copy of a histogram. Snapshots can be merged to aggregate nodes, e.g. per op type.
+   */
+  struct Snapshot {
+    uint64_t count{0};
+    uint64_t sum{0};
+    uint64_t min{0};
+    uint64_t max{0};
+    std::array<uint64_t, kNumBuckets> buckets{};
+
+    void Merge(const Snapshot& other);
+
+    // Value at the given percentile in [0, 100]. Returns the midpoint of the bucket containing that rank,
+    // clamped to the observed [min, max] range.
+    uint64_t Percentile(double percentile) const;
+
+    double Mean() const { return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count); }
+  };
+
+  Snapshot GetSnapshot() const;
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(LatencyHistogram);
+
+  std::atomic<uint64_t> count_;
+  std::atomic<uint64_t> sum_;
+  std::atomic<uint64_t> min_;
+  std::atomic<uint64_t> max_;
+  std::array<std::atomic<uint64_t>, kNumBuckets> buckets_;
+};
+
+/**
+ * Per-node latency and bytes processed statistics for the nodes of one graph.
+ * The set of nodes is fixed at construction, so the executors can update entries concurrently without locking.
+ * Enabled with the kOrtSessionOptionsConfigEnableNodeStats session option.
+ */
+class NodeStatsRecorder {
+ public:
+  explicit NodeStatsRecorder(const GraphViewer& graph_viewer);
+
+  void Record(NodeIndex node_index, uint64_t duration_ns, size_t input_bytes, size_t output_bytes) noexcept;
+
+  void Reset() noexcept;
+
+  struct NodeEntry {
+    std::string node_name;
+    std::string op_type;
+    LatencyHistogram latency;
+    std::atomic<uint64_t> input_bytes{0};
+    std::atomic<uint64_t> output_bytes{0};
+  };
+
+  // nullptr if node_index does not refer to a node of the graph.
+  const NodeEntry* GetEntry(NodeIndex node_index) const noexcept {
+    return node_index < entries_.size() ? entries_[node_index].get() : nullptr;
+  }
+
+  const std::vector<std::unique_ptr<NodeEntry>>& Entries() const noexcept { return entries_; }
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(NodeStatsRecorder);
+
+  // indexed by NodeIndex. null for indices without a node.
+  std::vector<std::unique_ptr<NodeEntry>> entries_;
+};
+
+/**
+ * Aggregated view of the node statistics of a session, including nodes in subgraphs.
+ * Subgraph node names are prefixed with the path of the control flow node and attribute, e.g. "loop_0/body/add".
+ */
+struct NodeStatsReport {
+  struct Entry {
+    std::string op_type;
+    LatencyHistogram::Snapshot latency;
+    uint64_t input_bytes{0};
+    uint64_t output_bytes{0};
+    uint64_t num_nodes{0};
+
+    void Merge(const Entry& other);
+  };
+
+  std::map<std::string, Entry> per_node;
+  std::map<std::string, Entry> per_op_type;
+
+  // Serializes the report as JSON with latencies in microseconds.
+  std::string ToJson() const;
+};
+
+// Sum of the sizes in bytes of the tensor inputs and outputs of a kernel invocation.
+void CalculateTensorInputOutputSizes(OpKernelContextInternal& op_kernel_context,
+                                     size_t& input_bytes, size_t& output_bytes);
+
+// Collect the statistics for session_state and any nested subgraphs. Returns an empty report if collection is
+// not enabled.
+NodeStatsReport CollectNodeStats(const SessionState& session_state);
+
+// Reset the statistics for session_state and any nested subgraphs.
+void ResetNodeStats(const SessionState& session_state);
+
+}  // namespace profiling
+}  // namespace onnxruntime
@@ -208,7 +208,6 @@ OrtValue* OpKernelContext::GetOutputMLValue(int index) {
   return execution_frame_->GetMutableNodeInputOrOutputMLValue(output_arg_index);
 }
 
-#ifdef ENABLE_ATEN
 Status OpKernelContext::SetOutputMLValue(int index, const OrtValue& ort_value) {
   if (index < 0 || index >= OutputCount()) {
     return Status(common::ONNXRUNTIME, common::FAIL,
@@ -219,6 +218,5 @@ Status OpKernelContext::SetOutputMLValue(int index, const OrtValue& ort_value) {
   auto output_arg_index = GetOutputArgIndex(index);
   return execution_frame_->SetOutputMLValue(output_arg_index, ort_value);
 }
-#endif
 
 }  // namespace onnxruntime
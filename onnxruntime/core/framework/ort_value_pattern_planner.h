@@ -21,7 +21,9 @@ class OrtValuePatternPlanner {
  public:
   // trace_using_counters should be true if the TraceAllocation with ProgramCounter is used. Only one
   // variant of the TraceAllocation calls may be used.
-  explicit OrtValuePatternPlanner(const ExecutionPlanBase& execution_plan, bool trace_using_counters = false);
+  // strategy is how the offsets of the patterns are chosen. See MemPatternStrategy.
+  explicit OrtValuePatternPlanner(const ExecutionPlanBase& execution_plan, bool trace_using_counters = false,
+                                  MemPatternStrategy strategy = MemPatternStrategy::kTraceOrder);
 #ifdef ENABLE_TRAINING
   common::Status TraceAllocation(int ort_value_idx, const AllocPlanPerValue::ProgramCounter& counter, size_t size);
 #endif
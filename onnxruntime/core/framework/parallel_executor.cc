@@ -11,6 +11,7 @@
 #include "core/common/logging/logging.h"
 #include "core/framework/allocation_planner.h"
 #include "core/framework/execution_frame.h"
+#include "core/framework/node_stats_recorder.h"
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/utils.h"
@@ -117,6 +118,9 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
   TimePoint sync_time_begin;
   TimePoint kernel_begin_time;
   const bool f_profiler_enabled = session_state.Profiler().IsEnabled();
+  profiling::NodeStatsRecorder* const node_stats_recorder = session_state.GetNodeStatsRecorder();
+  CalibrationCollector* const calibration_collector = session_state.GetCalibrationCollector();
+  TimePoint node_stats_begin_time;
   const SequentialExecutionPlan& exec_plan = *session_state.GetExecutionPlan();
 
   // Avoid context switching if possible.
@@ -186,6 +190,10 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
     // call compute on the kernel
     VLOGS(logger, 1) << "Computing kernel: " << node.Name();
 
+    if (node_stats_recorder != nullptr) {
+      node_stats_begin_time = std::chrono::high_resolution_clock::now();
+    }
+
     // Execute the kernel.
     ORT_TRY {
 #ifdef ENABLE_TRAINING
@@ -212,13 +220,35 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
       break;
     }
 
+    if (node_stats_recorder != nullptr) {
+      const auto duration = std::chrono::high_resolution_clock::now() - node_stats_begin_time;
+      size_t input_bytes = 0;
+      size_t output_bytes = 0;
+      profiling::CalculateTensorInputOutputSizes(op_kernel_context, input_bytes, output_bytes);
+      node_stats_recorder->Record(node_index,
+                                  std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),
+                                  input_bytes, output_bytes);
+    }
+
+    if (calibration_collector != nullptr) {
+      calibration_collector->Collect(node_index, op_kernel_context);
+    }
+
     if (f_profiler_enabled) {
+      const auto compute_duration =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() -
+                                                               kernel_begin_time);
+      std::unordered_map<std::string, std::string> event_args{
+          {"op_name", p_op_kernel->KernelDef().OpName()},
+          {"provider", p_op_kernel->KernelDef().Provider()},
+          {"thread_scheduling_stats", concurrency::ThreadPool::StopProfiling(session_state.GetThreadPool())},
+      };
+      utils::AddKernelCostArgs(*p_op_kernel, op_kernel_context, compute_duration, event_args);
+
       session_state.Profiler().EndTimeAndRecordEvent(profiling::NODE_EVENT,
                                                      node.Name() + "_kernel_time",
                                                      kernel_begin_time,
-                                                     {{"op_name", p_op_kernel->KernelDef().OpName()},
-                                                      {"provider", p_op_kernel->KernelDef().Provider()},
-                                                      {"thread_scheduling_stats", concurrency::ThreadPool::StopProfiling(session_state.GetThreadPool())}});
+                                                     std::move(event_args));
 
       sync_time_begin = session_state.Profiler().Start();
     }
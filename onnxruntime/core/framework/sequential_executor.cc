@@ -3,6 +3,7 @@
 
 #include "core/framework/sequential_executor.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 #include <vector>
@@ -11,6 +12,7 @@
 #include "core/common/logging/logging.h"
 #include "core/framework/allocation_planner.h"
 #include "core/framework/execution_frame.h"
+#include "core/framework/node_stats_recorder.h"
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/utils.h"
@@ -146,6 +148,14 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
                                    std::vector<OrtValue>& fetches,
                                    const std::unordered_map<size_t, CustomAllocator>& fetch_allocators,
                                    const logging::Logger& logger) {
+  ExecutionFrame frame{feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs, fetches, fetch_allocators, session_state};
+  return ExecuteWithFrame(session_state, frame, feeds, fetch_mlvalue_idxs, fetches, logger);
+}
+
+Status SequentialExecutor::ExecuteWithFrame(const SessionState& session_state, ExecutionFrame& frame,
+                                            const std::vector<OrtValue>& feeds,
+                                            const std::vector<int>& fetch_mlvalue_idxs,
+                                            std::vector<OrtValue>& fetches, const logging::Logger& logger) {
   const bool is_profiler_enabled = session_state.Profiler().IsEnabled();
   TimePoint tp;
   TimePoint sync_time_begin;
@@ -160,7 +170,9 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     tp = session_state.Profiler().Start();
   }
 
-  ExecutionFrame frame{feed_mlvalue_idxs, feeds, fetch_mlvalue_idxs, fetches, fetch_allocators, session_state};
+  profiling::NodeStatsRecorder* const node_stats_recorder = session_state.GetNodeStatsRecorder();
+  CalibrationCollector* const calibration_collector = session_state.GetCalibrationCollector();
+  TimePoint node_stats_begin_time;
 
 #if !defined(ORT_MINIMAL_BUILD)
   const auto* const to_be_executed_nodes = session_state.GetToBeExecutedNodes(fetch_mlvalue_idxs);
@@ -325,6 +337,10 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
                                node_name_for_profiling, input_type_shape);
     }
 
+    if (node_stats_recorder != nullptr) {
+      node_stats_begin_time = std::chrono::high_resolution_clock::now();
+    }
+
     Status compute_status;
     {
 #ifdef CONCURRENCY_VISUALIZER
@@ -355,6 +371,11 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
 #endif
     }
 
+    TimePoint kernel_end_time;
+    if (is_profiler_enabled) {
+      kernel_end_time = std::chrono::high_resolution_clock::now();
+    }
+
     if (!compute_status.IsOK()) {
       std::ostringstream ss;
       ss << "Non-zero status code returned while running " << node.OpType() << " node. Name:'" << node.Name()
@@ -369,6 +390,20 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       return Status(compute_status.Category(), compute_status.Code(), msg_string);
     }
 
+    if (node_stats_recorder != nullptr) {
+      const auto duration = std::chrono::high_resolution_clock::now() - node_stats_begin_time;
+      size_t input_bytes = 0;
+      size_t output_bytes = 0;
+      profiling::CalculateTensorInputOutputSizes(op_kernel_context, input_bytes, output_bytes);
+      node_stats_recorder->Record(node_index,
+                                  std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),
+                                  input_bytes, output_bytes);
+    }
+
+    if (calibration_collector != nullptr) {
+      calibration_collector->Collect(node_index, op_kernel_context);
+    }
+
     if (is_profiler_enabled) {
       // Calculate total output sizes for this operation.
       CalculateTotalOutputSizes(&op_kernel_context, total_output_sizes, node_name_for_profiling, output_type_shape);
@@ -386,22 +421,27 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
                 << "\n";
 #endif
 
+      // Log additional operation args / info.
+      std::unordered_map<std::string, std::string> event_args{
+          {"op_name", p_op_kernel->KernelDef().OpName()},
+          {"provider", p_op_kernel->KernelDef().Provider()},
+          {"graph_index", std::to_string(p_op_kernel->Node().Index())},
+          {"exec_plan_index", std::to_string(node_index)},
+          {"activation_size", std::to_string(input_activation_sizes)},
+          {"parameter_size", std::to_string(input_parameter_sizes)},
+          {"output_size", std::to_string(total_output_sizes)},
+          {"input_type_shape", input_type_shape},
+          {"output_type_shape", output_type_shape},
+          {"thread_scheduling_stats", concurrency::ThreadPool::StopProfiling(session_state.GetThreadPool())},
+      };
+      const auto compute_duration =
+          std::chrono::duration_cast<std::chrono::nanoseconds>(kernel_end_time - kernel_begin_time);
+      utils::AddKernelCostArgs(*p_op_kernel, op_kernel_context, compute_duration, event_args);
+
       session_state.Profiler().EndTimeAndRecordEvent(profiling::NODE_EVENT,
                                                      node_name_for_profiling + "_kernel_time",
                                                      kernel_begin_time,
-                                                     // Log additional operation args / info.
-                                                     {
-                                                         {"op_name", p_op_kernel->KernelDef().OpName()},
-                                                         {"provider", p_op_kernel->KernelDef().Provider()},
-                                                         {"graph_index", std::to_string(p_op_kernel->Node().Index())},
-                                                         {"exec_plan_index", std::to_string(node_index)},
-                                                         {"activation_size", std::to_string(input_activation_sizes)},
-                                                         {"parameter_size", std::to_string(input_parameter_sizes)},
-                                                         {"output_size", std::to_string(total_output_sizes)},
-                                                         {"input_type_shape", input_type_shape},
-                                                         {"output_type_shape", output_type_shape},
-                                                         {"thread_scheduling_stats", concurrency::ThreadPool::StopProfiling(session_state.GetThreadPool())},
-                                                     });
+                                                     std::move(event_args));
       sync_time_begin = session_state.Profiler().Start();
     }
 
@@ -16,6 +16,8 @@
 #include "core/framework/op_kernel_context_internal.h"
 
 namespace onnxruntime {
+class ExecutionFrame;
+
 class SequentialExecutor : public IExecutor {
  public:
   SequentialExecutor(const bool& terminate_flag = false, const bool only_execute_path_to_fetches = false)
@@ -27,6 +29,12 @@ class SequentialExecutor : public IExecutor {
                          const std::unordered_map<size_t, CustomAllocator>& fetch_allocators,
                          const logging::Logger& logger) override;
 
+  // Execute the graph using an ExecutionFrame created by the caller, e.g. one that is reused across the iterations
+  // of a control flow node. 'frame' must have been created or reset with 'feeds' and 'fetches'.
+  common::Status ExecuteWithFrame(const SessionState& session_state, ExecutionFrame& frame,
+                                  const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
+                                  std::vector<OrtValue>& fetches, const logging::Logger& logger);
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SequentialExecutor);
   const bool& terminate_flag_;
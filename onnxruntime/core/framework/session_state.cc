@@ -7,10 +7,12 @@
 
 #include "core/platform/ort_mutex.h"
 #include "core/common/logging/logging.h"
+#include "core/common/parse_string.h"
 #include "core/common/safeint.h"
 #include "core/flatbuffers/schema/ort.fbs.h"
 #include "core/framework/allocator.h"
 #include "core/framework/kernel_def_hash_helpers.h"
+#include "core/framework/mem_pattern_offset_planner.h"
 #include "core/framework/node_index_info.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/ort_value_pattern_planner.h"
@@ -170,7 +172,48 @@ const KernelCreateInfo& SessionState::GetNodeKernelCreateInfo(NodeIndex node_ind
   return *entry->second;
 }
 
-Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_manager) {
+// The kernels of the built-in CPU operators only read their node and the constant state of the session when they
+// are created or pre-packed, so this can be done concurrently for different nodes. Custom op kernels and the kernels
+// of other EPs may depend on state that is not thread-safe.
+static bool CanInitializeKernelConcurrently(const Node& node) {
+  if (node.GetExecutionProviderType() != kCpuExecutionProvider) {
+    return false;
+  }
+
+  const auto& domain = node.Domain();
+  return domain == kOnnxDomain || domain == kOnnxDomainAlias || domain == kMLDomain || domain == kMSDomain ||
+         domain == kMSNchwcDomain;
+}
+
+// Run fn(i) for i in [0, total) using the thread pool, converting exceptions to a Status as they can't cross the
+// thread pool. Returns the first failure in index order.
+template <typename Fn>
+static Status ParallelForWithStatus(concurrency::ThreadPool* thread_pool, size_t total, Fn&& fn) {
+  if (total == 0) {
+    return Status::OK();
+  }
+
+  InlinedVector<Status> statuses(total);
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(total), [&statuses, &fn](std::ptrdiff_t i) {
+        ORT_TRY {
+          statuses[i] = fn(static_cast<size_t>(i));
+        }
+        ORT_CATCH(const std::exception& ex) {
+          ORT_HANDLE_EXCEPTION([&]() {
+            statuses[i] = ORT_MAKE_STATUS(ONNXRUNTIME, RUNTIME_EXCEPTION, ex.what());
+          });
+        }
+      });
+
+  for (auto& status : statuses) {
+    ORT_RETURN_IF_ERROR(status);
+  }
+
+  return Status::OK();
+}
+
+Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_manager, bool parallel) {
   const auto& nodes = graph_viewer_->Nodes();
   if (!nodes.empty()) {
     size_t max_nodeid = 0;
@@ -179,7 +222,8 @@ Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_
     }
     session_kernels_.clear();
     session_kernels_.resize(max_nodeid + 1);
-    for (const auto& node : nodes) {
+
+    auto create_kernel = [this, &kernel_registry_manager](const Node& node) -> Status {
       // construct and save the kernels
       const KernelCreateInfo& kci = GetNodeKernelCreateInfo(node.Index());
 
@@ -188,8 +232,23 @@ Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_
       const IExecutionProvider& exec_provider = *execution_providers_.Get(exec_provider_name);
 
       // assumes vector is already resize()'ed to the number of nodes in the graph
-      ORT_RETURN_IF_ERROR(kernel_registry_manager.CreateKernel(node, exec_provider, *this, kci, session_kernels_[node.Index()]));
+      return kernel_registry_manager.CreateKernel(node, exec_provider, *this, kci, session_kernels_[node.Index()]);
+    };
+
+    InlinedVector<const Node*> concurrent_nodes;
+    for (const auto& node : nodes) {
+      if (parallel && CanInitializeKernelConcurrently(node)) {
+        concurrent_nodes.push_back(&node);
+      } else {
+        ORT_RETURN_IF_ERROR(create_kernel(node));
+      }
     }
+
+    // each kernel is written to its own slot of session_kernels_
+    ORT_RETURN_IF_ERROR(ParallelForWithStatus(thread_pool_, concurrent_nodes.size(),
+                                              [&concurrent_nodes, &create_kernel](size_t i) {
+                                                return create_kernel(*concurrent_nodes[i]);
+                                              }));
   }
   node_index_info_.emplace(*graph_viewer_, ort_value_name_idx_map_);
   return Status::OK();
@@ -315,132 +374,200 @@ static std::string GenerateKeyForPrepackedWeightsMap(const std::string& op_type,
 }
 
 Status SessionState::PrepackConstantInitializedTensors(InlinedHashMap<std::string, size_t>& constant_initializers_use_count,
-                                                       const std::unordered_map<std::string, const OrtValue*>& initializers_to_share_map) {
-  auto prepacked_constant_weights = [this, &constant_initializers_use_count, &initializers_to_share_map](
-                                        bool should_cache_prepacked_weights_for_shared_initializers) -> Status {
-    for (auto& node : GetGraphViewer().Nodes()) {
-      auto kernel = GetMutableKernel(node.Index());
-      int input_idx = 0;
-      for (auto& input_def : node.InputDefs()) {
-        if (input_def->Exists()) {
-          const std::string& input_name = input_def->Name();
-          SessionState* st = this;
-          // subgraph can use the value from outer scope,
-          // so it needs to check if current node uses constant initialized tensor from current and outer graphs
-          do {
-            int ort_value_idx;
-            if (st->GetOrtValueNameIdxMap().GetIdx(input_name, ort_value_idx).IsOK()) {
-              std::unordered_map<int, OrtValue>& constant_initialized_tensors = st->constant_initialized_tensors_;
-
-              if (constant_initialized_tensors.count(ort_value_idx)) {
-                bool is_packed = false;
-                const Tensor& const_initialized_tensor = constant_initialized_tensors[ort_value_idx].Get<Tensor>();
-
-                auto iter = initializers_to_share_map.find(input_name);
-                bool is_shared_initializer = (iter != initializers_to_share_map.end());
-
-                // Caching pre-packed weights is limited to shared initializers associated with the CPU EP for now
-                if (is_shared_initializer && should_cache_prepacked_weights_for_shared_initializers &&
-                    node.GetExecutionProviderType() == kCpuExecutionProvider) {  // caching of pre-packed weights' turned ON
-
-                  AllocatorPtr allocator_for_caching = prepacked_weights_container_->GetOrCreateAllocator(CPU);
-                  ORT_ENFORCE(allocator_for_caching.get() != nullptr);
-
-                  PrePackedWeights weights_to_be_filled_in;
-                  // The reason we invoke PrePack() before looking into the container for any pre-packed weight
-                  // cached by another instance of the same op_type (for the same constant initializer) is because
-                  // to truly know if we can use a cached pre-packed weight, we would have to compare the cached pre-packed
-                  // weight with the pre-packed weight generated by this instance of the same op_type because other static
-                  // properties of the node like node attributes could play a role in the pre-packed weights' contents.
-                  ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx, allocator_for_caching,
-                                                      is_packed,
-                                                      &weights_to_be_filled_in));
-
-                  if (is_packed) {
-                    // BUG CHECK: Ensure that the kernel has filled in the pre-packed weight to be cached if the weight was pre-packed
-                    ORT_ENFORCE(weights_to_be_filled_in.buffers_.size() > 0, "The kernel corresponding to the node ", node.Name(),
-                                " doesn't have an implementation that can cache computed pre-packed weights");
-
-                    const auto& op_type = node.OpType();
-
-                    // Sanity check
-                    // TODO: Check if some version of the ONNX IR allows op_type to be empty
-                    ORT_ENFORCE(!op_type.empty(), "The op type of a node cannot be empty");
-
-                    // The key for the pre-packed weights container lookup is the op_type + hash of the prepacked-weight
-                    // that we just got by invoking PrePack() on this kernel.
-
-                    const std::string& prepacked_weights_container_key = GenerateKeyForPrepackedWeightsMap(op_type,
-                                                                                                           weights_to_be_filled_in);
-
-                    bool container_contains_packed_weight = prepacked_weights_container_->HasWeight(prepacked_weights_container_key);
-
-                    if (container_contains_packed_weight) {
-                      LOGS(logger_, INFO) << "Using cached version of pre-packed weight for constant initializer: " << input_name
-                                          << " used in the node: " << node.Name() << " which is of op type: " << node.OpType();
-
-                      ORT_RETURN_IF_ERROR(KernelUseSharedPrePackedBuffers(*kernel, input_idx,
-                                                                          prepacked_weights_container_->GetWeight(prepacked_weights_container_key),
-                                                                          node.Name()));
-
-                      ++used_shared_pre_packed_weights_counter_;
-                    } else {  // container doesn't contain the pre-packed weight - so write into it for sharing across kernel instances
-
-                      if (!prepacked_weights_container_->WriteWeight(prepacked_weights_container_key, std::move(weights_to_be_filled_in))) {
-                        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Unable to write the provided PrePackedWeights instance into the container");
-                      }
+                                                       const std::unordered_map<std::string, const OrtValue*>& initializers_to_share_map,
+                                                       bool parallel) {
+  // A constant initializer input of a node that may be pre-packed by its kernel.
+  struct PrePackInput {
+    int input_idx;
+    const std::string* input_name;
+    SessionState* session_state;  // the session state owning the initializer, which may be an outer scope one
+    int ort_value_idx;
+    const Tensor* tensor;
+    bool is_packed;
+  };
 
-                      ORT_RETURN_IF_ERROR(KernelUseSharedPrePackedBuffers(*kernel, input_idx,
-                                                                          prepacked_weights_container_->GetWeight(prepacked_weights_container_key),
-                                                                          node.Name()));
-                    }
-                  }
+  // The constant initializer inputs of a node. PrePack calls for the same kernel must not run concurrently.
+  struct NodePrePackInputs {
+    const Node* node;
+    OpKernel* kernel;
+    InlinedVector<PrePackInput> inputs;
+  };
 
-                } else {  // caching of pre-packed weights' turned OFF
-                  AllocatorPtr session_cpu_alloc = kernel->Info().GetAllocator(0, OrtMemType::OrtMemTypeDefault);
-                  ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx,
-                                                      session_cpu_alloc,  // use allocator tied to this session
-                                                      is_packed,
-                                                      nullptr  // no caching required
-                                                      ));
-                }
-                if (is_packed) {
-                  ++number_of_prepacks_counter_;
-
-                  if (constant_initializers_use_count.count(input_name) && --constant_initializers_use_count[input_name] == 0) {
-                    // release the constant initialized tensor
-                    st->initialized_tensors_.erase(ort_value_idx);
-                    constant_initialized_tensors.erase(ort_value_idx);
-                  }
-                }
-              }
-              // stop searching in 2 cases:
-              // 1. value is not from OuterScope
-              // 2. value is from OuterScope and the current OuterScope has the value
-              if (st != this || !st->graph_.IsOuterScopeValue(input_name)) {
-                break;
-              }
+  // find the constant initializer inputs of all the nodes first, so that the PrePack calls for different nodes are
+  // independent. an initializer is only released once all its consumers have pre-packed it.
+  InlinedVector<NodePrePackInputs> nodes_to_prepack;
+  for (auto& node : GetGraphViewer().Nodes()) {
+    NodePrePackInputs node_inputs{&node, GetMutableKernel(node.Index()), {}};
+    int input_idx = 0;
+    for (auto& input_def : node.InputDefs()) {
+      if (input_def->Exists()) {
+        const std::string& input_name = input_def->Name();
+        SessionState* st = this;
+        // subgraph can use the value from outer scope,
+        // so it needs to check if current node uses constant initialized tensor from current and outer graphs
+        do {
+          int ort_value_idx;
+          if (st->GetOrtValueNameIdxMap().GetIdx(input_name, ort_value_idx).IsOK()) {
+            auto it = st->constant_initialized_tensors_.find(ort_value_idx);
+            if (it != st->constant_initialized_tensors_.end()) {
+              node_inputs.inputs.push_back({input_idx, &input_name, st, ort_value_idx, &it->second.Get<Tensor>(),
+                                            false});
             }
-            st = st->Parent();
-          } while (st);
+            // stop searching in 2 cases:
+            // 1. value is not from OuterScope
+            // 2. value is from OuterScope and the current OuterScope has the value
+            if (st != this || !st->graph_.IsOuterScopeValue(input_name)) {
+              break;
+            }
+          }
+          st = st->Parent();
+        } while (st);
+      }
+      input_idx++;
+    }
+
+    if (!node_inputs.inputs.empty()) {
+      nodes_to_prepack.push_back(std::move(node_inputs));
+    }
+  }
+
+  auto prepack_node = [this, &initializers_to_share_map](NodePrePackInputs& node_inputs,
+                                                         bool should_cache_prepacked_weights_for_shared_initializers)
+      -> Status {
+    const Node& node = *node_inputs.node;
+    OpKernel* kernel = node_inputs.kernel;
+    for (auto& input : node_inputs.inputs) {
+      const int input_idx = input.input_idx;
+      const std::string& input_name = *input.input_name;
+      const Tensor& const_initialized_tensor = *input.tensor;
+      bool is_packed = false;
+
+      auto iter = initializers_to_share_map.find(input_name);
+      bool is_shared_initializer = (iter != initializers_to_share_map.end());
+
+      // Caching pre-packed weights is limited to shared initializers associated with the CPU EP for now
+      if (is_shared_initializer && should_cache_prepacked_weights_for_shared_initializers &&
+          node.GetExecutionProviderType() == kCpuExecutionProvider) {  // caching of pre-packed weights' turned ON
+
+        AllocatorPtr allocator_for_caching = prepacked_weights_container_->GetOrCreateAllocator(CPU);
+        ORT_ENFORCE(allocator_for_caching.get() != nullptr);
+
+        PrePackedWeights weights_to_be_filled_in;
+        // The reason we invoke PrePack() before looking into the container for any pre-packed weight
+        // cached by another instance of the same op_type (for the same constant initializer) is because
+        // to truly know if we can use a cached pre-packed weight, we would have to compare the cached pre-packed
+        // weight with the pre-packed weight generated by this instance of the same op_type because other static
+        // properties of the node like node attributes could play a role in the pre-packed weights' contents.
+        ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx, allocator_for_caching,
+                                            is_packed,
+                                            &weights_to_be_filled_in));
+
+        if (is_packed) {
+          // BUG CHECK: Ensure that the kernel has filled in the pre-packed weight to be cached if the weight was pre-packed
+          ORT_ENFORCE(weights_to_be_filled_in.buffers_.size() > 0, "The kernel corresponding to the node ", node.Name(),
+                      " doesn't have an implementation that can cache computed pre-packed weights");
+
+          const auto& op_type = node.OpType();
+
+          // Sanity check
+          // TODO: Check if some version of the ONNX IR allows op_type to be empty
+          ORT_ENFORCE(!op_type.empty(), "The op type of a node cannot be empty");
+
+          // The key for the pre-packed weights container lookup is the op_type + hash of the prepacked-weight
+          // that we just got by invoking PrePack() on this kernel.
+
+          const std::string& prepacked_weights_container_key = GenerateKeyForPrepackedWeightsMap(op_type,
+                                                                                                 weights_to_be_filled_in);
+
+          bool container_contains_packed_weight = prepacked_weights_container_->HasWeight(prepacked_weights_container_key);
+
+          if (container_contains_packed_weight) {
+            LOGS(logger_, INFO) << "Using cached version of pre-packed weight for constant initializer: " << input_name
+                                << " used in the node: " << node.Name() << " which is of op type: " << node.OpType();
+
+            ORT_RETURN_IF_ERROR(KernelUseSharedPrePackedBuffers(*kernel, input_idx,
+                                                                prepacked_weights_container_->GetWeight(prepacked_weights_container_key),
+                                                                node.Name()));
+
+            ++used_shared_pre_packed_weights_counter_;
+          } else {  // container doesn't contain the pre-packed weight - so write into it for sharing across kernel instances
+
+            if (!prepacked_weights_container_->WriteWeight(prepacked_weights_container_key, std::move(weights_to_be_filled_in))) {
+              return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Unable to write the provided PrePackedWeights instance into the container");
+            }
+
+            ORT_RETURN_IF_ERROR(KernelUseSharedPrePackedBuffers(*kernel, input_idx,
+                                                                prepacked_weights_container_->GetWeight(prepacked_weights_container_key),
+                                                                node.Name()));
+          }
         }
-        input_idx++;
+
+      } else {  // caching of pre-packed weights' turned OFF
+        AllocatorPtr session_cpu_alloc = kernel->Info().GetAllocator(0, OrtMemType::OrtMemTypeDefault);
+        ORT_RETURN_IF_ERROR(kernel->PrePack(const_initialized_tensor, input_idx,
+                                            session_cpu_alloc,  // use allocator tied to this session
+                                            is_packed,
+                                            nullptr  // no caching required
+                                            ));
       }
+
+      input.is_packed = is_packed;
     }
 
     return Status::OK();
   };
 
+  // release the initializers once all their consumers have pre-packed them
+  auto release_packed_initializers = [this, &constant_initializers_use_count](const NodePrePackInputs& node_inputs) {
+    for (const auto& input : node_inputs.inputs) {
+      if (!input.is_packed) {
+        continue;
+      }
+
+      ++number_of_prepacks_counter_;
+
+      const std::string& input_name = *input.input_name;
+      if (constant_initializers_use_count.count(input_name) && --constant_initializers_use_count[input_name] == 0) {
+        // release the constant initialized tensor
+        input.session_state->initialized_tensors_.erase(input.ort_value_idx);
+        input.session_state->constant_initialized_tensors_.erase(input.ort_value_idx);
+      }
+    }
+  };
+
   bool should_cache_prepacked_weights_for_shared_initializers = (prepacked_weights_container_ != nullptr);
 
   if (should_cache_prepacked_weights_for_shared_initializers) {
     // serialize calls to the method that looks up the container, calls UseCachedPrePackedWeight/PrePack
     // and writes pre-packed weights to the container
     std::lock_guard<onnxruntime::OrtMutex> l(prepacked_weights_container_->mutex_);
-    return prepacked_constant_weights(true);
+    for (auto& node_inputs : nodes_to_prepack) {
+      ORT_RETURN_IF_ERROR(prepack_node(node_inputs, true));
+      release_packed_initializers(node_inputs);
+    }
   } else {
-    return prepacked_constant_weights(false);
+    // the nodes pre-packed sequentially release their initializers right away, as before, so the original and
+    // packed weights are not all held at once. the concurrent ones release them after the whole batch.
+    InlinedVector<NodePrePackInputs*> concurrent_nodes;
+    for (auto& node_inputs : nodes_to_prepack) {
+      if (parallel && CanInitializeKernelConcurrently(*node_inputs.node)) {
+        concurrent_nodes.push_back(&node_inputs);
+      } else {
+        ORT_RETURN_IF_ERROR(prepack_node(node_inputs, false));
+        release_packed_initializers(node_inputs);
+      }
+    }
+
+    ORT_RETURN_IF_ERROR(ParallelForWithStatus(thread_pool_, concurrent_nodes.size(),
+                                              [&concurrent_nodes, &prepack_node](size_t i) {
+                                                return prepack_node(*concurrent_nodes[i], false);
+                                              }));
+    for (const auto* node_inputs : concurrent_nodes) {
+      release_packed_initializers(*node_inputs);
+    }
   }
+
+  return Status::OK();
 }
 
 static int64_t CalculateMemoryPatternsKey(const gsl::span<const OrtValue>& tensor_inputs) {
@@ -695,9 +822,17 @@ const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(
       out_inferred_shapes = &shape_insert.first->second;
       return ptr;
     }
-#else
-    ORT_UNUSED_PARAMETER(feed_mlvalue_idxs);
 #endif
+    if (symbolic_memory_plan_) {
+      MemoryPatternGroup mem_patterns;
+      const auto status = symbolic_memory_plan_->GeneratePatterns(feed_mlvalue_idxs, tensor_inputs, mem_patterns);
+      if (status.IsOK()) {
+        auto patt_insert = mem_patterns_.insert_or_assign(key, std::move(mem_patterns));
+        return &patt_insert.first->second;
+      }
+      LOGS(logger_, INFO) << "The symbolic memory plan can't be used for the feeds, the memory pattern is traced: "
+                          << status.ErrorMessage();
+    }
     return nullptr;
   }
 
@@ -1410,15 +1545,44 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
                   });
   }
 
+  // the duration of each initialization phase is recorded in the profile
+  auto start_phase = [this]() {
+    return profiler_.IsEnabled() ? profiler_.Start() : TimePoint{};
+  };
+  auto end_phase = [this](const char* phase, const TimePoint& start_time) {
+    if (profiler_.IsEnabled()) {
+      profiler_.EndTimeAndRecordEvent(profiling::SESSION_EVENT, phase, start_time,
+                                      {{"graph_name", graph_viewer_->Name()}});
+    }
+  };
+
+  const bool parallel_initialization =
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigParallelInitialization, "0") == "1";
+
+  TimePoint phase_start = start_phase();
   SubgraphsKernelCreateInfoMaps subgraphs_kernel_create_info_maps;
   AccumulateAllNestedSubgraphsInfo(*this, "", 0, subgraphs_kernel_create_info_maps);
 
+  ORT_RETURN_IF_ERROR(ParseMemPatternStrategy(
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigMemoryPatternStrategy, "trace"),
+      mem_pattern_strategy_));
+
   SequentialPlannerContext context(session_options.execution_mode, session_options.execution_order, session_options.enable_mem_reuse);
   ORT_RETURN_IF_ERROR(SequentialPlanner::CreatePlan(parent_node, *graph_viewer_, valid_outer_scope_node_args,
                                                     execution_providers_, kernel_create_info_map_,
                                                     subgraphs_kernel_create_info_maps,
                                                     outer_scope_node_arg_to_location_map,
                                                     ort_value_name_idx_map_, context, p_seq_exec_plan_));
+
+  // the lifetimes of the sequential plan only hold for a sequential execution
+  if (enable_mem_pattern_ && session_options.execution_mode == ExecutionMode::ORT_SEQUENTIAL &&
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigSymbolicMemoryPattern, "0") == "1") {
+    symbolic_memory_plan_ = SymbolicMemoryPlan::Create(*graph_viewer_, *p_seq_exec_plan_, ort_value_name_idx_map_);
+    if (!symbolic_memory_plan_) {
+      LOGS(logger_, INFO) << "The symbolic memory plan doesn't hold every activation of the graph, "
+                             "the memory patterns are traced.";
+    }
+  }
   // Record the allocation plan
 
   // Uncomment the below to dump the allocation plan to std::cout
@@ -1426,6 +1590,7 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   MemoryInfo::GenerateTensorMap(GetExecutionPlan(), GetOrtValueNameIdxMap());
 #endif
+  end_phase("allocation_planning", phase_start);
 
   // Memory pattern tracer allocates all initializers on a single contiguous
   // buffer. This has the effect of reducing memory fragmentation.
@@ -1449,6 +1614,7 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
       ITensorAllocator::Create(false, *p_seq_exec_plan_, *this, weights_buffers_));
 #endif
 
+  phase_start = start_phase();
   const auto& initializer_allocation_order = p_seq_exec_plan_->initializer_allocation_order;
 
   // move initializers from TensorProto instances in Graph to OrtValue instances in SessionState
@@ -1472,16 +1638,46 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
   if (remove_initializers) {
     CleanInitializedTensorsFromGraph();
   }
+  end_phase("initializer_loading", phase_start);
+
+  phase_start = start_phase();
+  ORT_RETURN_IF_ERROR(CreateKernels(kernel_registry_manager, parallel_initialization));
+  end_phase("kernel_creation", phase_start);
 
-  ORT_RETURN_IF_ERROR(CreateKernels(kernel_registry_manager));
+  if (session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigEnableNodeStats, "0") == "1") {
+    node_stats_recorder_ = std::make_unique<profiling::NodeStatsRecorder>(*graph_viewer_);
+  }
+
+  const std::string calibration_tensors =
+      session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigCalibrationTensors, "");
+  if (!calibration_tensors.empty() && !graph_viewer_->IsSubgraph()) {
+    std::unordered_set<std::string> tensor_names;
+    if (calibration_tensors != "*") {
+      std::istringstream names(calibration_tensors);
+      for (std::string name; std::getline(names, name, ',');) {
+        if (!name.empty()) {
+          tensor_names.insert(name);
+        }
+      }
+    }
+
+    size_t num_bins = 0;
+    ORT_RETURN_IF_ERROR(ParseStringWithClassicLocale(
+        session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigCalibrationHistogramBins, "0"),
+        num_bins));
+    calibration_collector_ = std::make_unique<CalibrationCollector>(*graph_viewer_, tensor_names, num_bins);
+  }
 
 #ifndef ENABLE_TRAINING
   const auto disable_prepacking =
       session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigDisablePrepacking, "0");
 
   if (disable_prepacking != "1") {
+    phase_start = start_phase();
     ORT_RETURN_IF_ERROR(PrepackConstantInitializedTensors(constant_initializers_use_count,
-                                                          session_options.initializers_to_share_map));
+                                                          session_options.initializers_to_share_map,
+                                                          parallel_initialization));
+    end_phase("prepacking", phase_start);
   }
 #endif
 
@@ -15,6 +15,7 @@
 #include "core/common/logging/logging.h"
 #include "core/common/profiler.h"
 #include "core/framework/allocation_planner.h"
+#include "core/framework/calibration_collector.h"
 #include "core/framework/callback.h"
 #include "core/framework/data_transfer_manager.h"
 #include "core/framework/execution_providers.h"
@@ -26,8 +27,10 @@
 #include "core/framework/mem_pattern.h"
 #include "core/framework/ort_value.h"
 #include "core/framework/node_index_info.h"
+#include "core/framework/node_stats_recorder.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/ort_value_name_idx_map.h"
+#include "core/framework/symbolic_memory_plan.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/onnx_protobuf.h"
 #include "core/platform/ort_mutex.h"
@@ -203,6 +206,18 @@ class SessionState {
   */
   profiling::Profiler& Profiler() const noexcept { return profiler_; }
 
+  /**
+  Get the per-node statistics recorder for this graph.
+  nullptr unless enabled via kOrtSessionOptionsConfigEnableNodeStats.
+  */
+  profiling::NodeStatsRecorder* GetNodeStatsRecorder() const noexcept { return node_stats_recorder_.get(); }
+
+  /**
+  Get the collector of the quantization calibration statistics of the main graph.
+  nullptr unless enabled via kOrtSessionOptionsConfigCalibrationTensors, and for subgraphs.
+  */
+  CalibrationCollector* GetCalibrationCollector() const noexcept { return calibration_collector_.get(); }
+
   /**
   Get cached memory pattern based on input shapes
   Must be called only when all values contain tensors
@@ -232,6 +247,11 @@ class SessionState {
   */
   bool GetEnableMemoryPattern() const;
 
+  /**
+  Get how the offsets of the memory patterns generated for this session state are chosen
+  */
+  MemPatternStrategy GetMemPatternStrategy() const { return mem_pattern_strategy_; }
+
   /**
   Get enable memory re-use flag.
   */
@@ -350,7 +370,9 @@ class SessionState {
   void CreateGraphInfo();
 
   // create kernels using info in kernel_create_info_map_
-  Status CreateKernels(const KernelRegistryManager& custom_registry_manager);
+  // if parallel is true the kernels of the built-in CPU operators are created concurrently using the intra-op
+  // thread pool.
+  Status CreateKernels(const KernelRegistryManager& custom_registry_manager, bool parallel);
 
   // remove TensorProto versions of initializers from Graph instance
   // (replaced byOrtValue instances in initialized_tensors_)
@@ -359,9 +381,12 @@ class SessionState {
   /**
    * Prepack the constant initialized tensors for better performance.
    * The original constant initialized tensors will be removed to save memory.
+   * If parallel is true and pre-packed weights are not shared between sessions, the kernels of the CPU EP are
+   * pre-packed concurrently using the intra-op thread pool.
    */
   Status PrepackConstantInitializedTensors(InlinedHashMap<std::string, size_t>& constant_initializers_use_count,
-                                           const std::unordered_map<std::string, const OrtValue*>& initializers_to_share_map);
+                                           const std::unordered_map<std::string, const OrtValue*>& initializers_to_share_map,
+                                           bool parallel);
 
   SessionState* GetMutableSubgraphSessionState(onnxruntime::NodeIndex index, const std::string& attribute_name);
 
@@ -480,9 +505,21 @@ class SessionState {
   const logging::Logger& logger_;
   profiling::Profiler& profiler_;
 
+  // per-node latency statistics. the recorder is updated by the executors using atomics so it is
+  // not const even though SessionState is passed to them by const-ref.
+  std::unique_ptr<profiling::NodeStatsRecorder> node_stats_recorder_;
+
+  // quantization calibration statistics, updated by the executors as the node stats.
+  std::unique_ptr<CalibrationCollector> calibration_collector_;
+
   // switch for enable memory pattern optimization or not.
   bool enable_mem_pattern_;
 
+  MemPatternStrategy mem_pattern_strategy_{MemPatternStrategy::kTraceOrder};
+
+  // memory pattern planned for all the shapes of the inputs, if kOrtSessionOptionsConfigSymbolicMemoryPattern is set.
+  std::unique_ptr<SymbolicMemoryPlan> symbolic_memory_plan_;
+
   // lock for the mem_patterns_
   mutable OrtMutex mem_patterns_lock_;
   // cache for the generated mem_patterns. key is calculated based on input shapes.
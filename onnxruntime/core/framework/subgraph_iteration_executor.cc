@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/subgraph_iteration_executor.h"
+
+#include "core/framework/execution_frame.h"
+#include "core/framework/session_state.h"
+#include "core/framework/utils.h"
+
+namespace onnxruntime {
+
+SubgraphIterationExecutor::SubgraphIterationExecutor(const SessionState& session_state,
+                                                     const FeedsFetchesManager& feeds_fetches_manager,
+                                                     const bool& terminate_flag, const logging::Logger& logger)
+    : session_state_(session_state),
+      feeds_fetches_manager_(feeds_fetches_manager),
+      terminate_flag_(terminate_flag),
+      logger_(logger),
+      executor_(terminate_flag) {
+}
+
+SubgraphIterationExecutor::~SubgraphIterationExecutor() = default;
+
+bool SubgraphIterationExecutor::FeedShapesMatchFrame(const std::vector<OrtValue>& feeds) const {
+  if (feeds.size() != frame_feed_shapes_.size()) {
+    return false;
+  }
+
+  for (size_t i = 0, end = feeds.size(); i < end; ++i) {
+    if (feeds[i].IsTensor() && feeds[i].Get<Tensor>().Shape() != frame_feed_shapes_[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+Status SubgraphIterationExecutor::Execute(const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
+                                          const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators) {
+  if (feeds_fetches_manager_.GetDeviceCopyChecks().status != DeviceCopyCheck::NoCopy || !fetch_allocators.empty()) {
+    frame_.reset();
+    return utils::ExecuteSubgraph(session_state_, feeds_fetches_manager_, feeds, fetches, fetch_allocators,
+                                  ExecutionMode::ORT_SEQUENTIAL, terminate_flag_, logger_);
+  }
+
+  const auto& feeds_fetches_info = feeds_fetches_manager_.GetFeedsFetchesInfo();
+
+  if (frame_ && frame_->CanReset() && FeedShapesMatchFrame(feeds)) {
+    frame_->Reset(feeds_fetches_info.feeds_mlvalue_idxs, feeds, fetches);
+  } else {
+    // release the previous frame and its memory pattern buffers before allocating new ones
+    frame_.reset();
+    frame_ = std::make_unique<ExecutionFrame>(feeds_fetches_info.feeds_mlvalue_idxs, feeds,
+                                              feeds_fetches_info.fetches_mlvalue_idxs, fetches,
+                                              std::unordered_map<size_t, IExecutor::CustomAllocator>{},
+                                              session_state_);
+
+    frame_feed_shapes_.clear();
+    frame_feed_shapes_.reserve(feeds.size());
+    for (const auto& feed : feeds) {
+      frame_feed_shapes_.push_back(feed.IsTensor() ? feed.Get<Tensor>().Shape() : TensorShape{});
+    }
+  }
+
+  auto status = executor_.ExecuteWithFrame(session_state_, *frame_, feeds, feeds_fetches_info.fetches_mlvalue_idxs,
+                                           fetches, logger_);
+  if (!status.IsOK()) {
+    frame_.reset();
+  }
+
+  return status;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/framework/feeds_fetches_manager.h"
+#include "core/framework/iexecutor.h"
+#include "core/framework/sequential_executor.h"
+#include "core/framework/tensor_shape.h"
+
+namespace onnxruntime {
+class ExecutionFrame;
+class SessionState;
+
+namespace logging {
+class Logger;
+}
+
+// Executes a subgraph once per iteration of a control flow node such as Scan or Loop.
+//
+// Creating a new executor and ExecutionFrame for each iteration, as utils::ExecuteSubgraph does, includes
+// looking up the memory pattern for the feed shapes and allocating its buffers. For a subgraph with a trivial body
+// that dominates the cost of a long sequence. Instead, the ExecutionFrame is kept alive and reset with the feeds and
+// fetches of the next iteration as long as the feed shapes don't change.
+//
+// utils::ExecuteSubgraph is used if the feeds or fetches need to be copied across devices or custom allocators
+// are provided for the fetches.
+// Not thread-safe. Create one instance for each execution of the control flow node.
+class SubgraphIterationExecutor {
+ public:
+  // The feeds_fetches_manager should have been finalized. See IControlFlowNode::SetupSubgraphExecutionInfo.
+  SubgraphIterationExecutor(const SessionState& session_state, const FeedsFetchesManager& feeds_fetches_manager,
+                            const bool& terminate_flag, const logging::Logger& logger);
+
+  ~SubgraphIterationExecutor();
+
+  // Execute one iteration.
+  Status Execute(const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
+                 const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators);
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SubgraphIterationExecutor);
+
+  bool FeedShapesMatchFrame(const std::vector<OrtValue>& feeds) const;
+
+  const SessionState& session_state_;
+  const FeedsFetchesManager& feeds_fetches_manager_;
+  const bool& terminate_flag_;
+  const logging::Logger& logger_;
+
+  SequentialExecutor executor_;
+  std::unique_ptr<ExecutionFrame> frame_;
+
+  // shapes of the tensor feeds 'frame_' was created with. empty shape for other feeds.
+  InlinedVector<TensorShape> frame_feed_shapes_;
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,402 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/symbolic_dim_expression.h"
+
+#include <cctype>
+#include <cstring>
+#include <limits>
+#include <numeric>
+
+#include "core/common/safeint.h"
+
+namespace onnxruntime {
+
+// Recursive descent parser of a dim_param, emitting the operations in postfix order:
+//   sum     := product (('+' | '-') product)*
+//   product := unary (('*' | '/' | '//' | '%') unary)*
+//   unary   := ('-' | '+') unary | power
+//   power   := primary ('**' unary)?
+//   primary := integer | symbol | function '(' sum (',' sum)* ')' | '(' sum ')'
+class SymbolicDimExpressionParser {
+ public:
+  using OpKind = SymbolicDimExpression::OpKind;
+
+  SymbolicDimExpressionParser(const std::string& text, const InlinedHashMap<std::string, size_t>& symbol_indices,
+                              InlinedVector<SymbolicDimExpression::Op>& ops)
+      : text_(text), symbol_indices_(symbol_indices), ops_(ops) {}
+
+  Status Parse() {
+    ORT_RETURN_IF_ERROR(ParseSum());
+    SkipSpaces();
+    ORT_RETURN_IF(pos_ != text_.size(), "Unexpected character at position ", pos_, " of the expression '", text_, "'");
+    return Status::OK();
+  }
+
+ private:
+  // bound on the nesting of the expressions, so the recursion can't overflow the stack
+  static constexpr int kMaxDepth = 64;
+
+  void SkipSpaces() {
+    while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+      ++pos_;
+    }
+  }
+
+  bool LookingAt(const char* token) {
+    SkipSpaces();
+    return text_.compare(pos_, std::strlen(token), token) == 0;
+  }
+
+  bool Consume(const char* token) {
+    if (!LookingAt(token)) {
+      return false;
+    }
+    pos_ += std::strlen(token);
+    return true;
+  }
+
+  void Emit(OpKind kind, int64_t value = 0) {
+    ops_.push_back({kind, value});
+  }
+
+  Status ParseSum() {
+    ORT_RETURN_IF_ERROR(ParseProduct());
+    while (true) {
+      if (Consume("+")) {
+        ORT_RETURN_IF_ERROR(ParseProduct());
+        Emit(OpKind::kAdd);
+      } else if (Consume("-")) {
+        ORT_RETURN_IF_ERROR(ParseProduct());
+        Emit(OpKind::kSub);
+      } else {
+        return Status::OK();
+      }
+    }
+  }
+
+  Status ParseProduct() {
+    ORT_RETURN_IF_ERROR(ParseUnary());
+    while (true) {
+      OpKind kind;
+      if (Consume("//")) {
+        kind = OpKind::kFloorDiv;
+      } else if (Consume("/")) {
+        kind = OpKind::kDiv;
+      } else if (Consume("%")) {
+        kind = OpKind::kMod;
+      } else if (!LookingAt("**") && Consume("*")) {
+        kind = OpKind::kMul;
+      } else {
+        return Status::OK();
+      }
+      ORT_RETURN_IF_ERROR(ParseUnary());
+      Emit(kind);
+    }
+  }
+
+  Status ParseUnary() {
+    ORT_RETURN_IF(++depth_ > kMaxDepth, "The expression '", text_, "' is nested too deeply");
+    if (Consume("-")) {
+      ORT_RETURN_IF_ERROR(ParseUnary());
+      Emit(OpKind::kNeg);
+    } else if (Consume("+")) {
+      ORT_RETURN_IF_ERROR(ParseUnary());
+    } else {
+      ORT_RETURN_IF_ERROR(ParsePower());
+    }
+    --depth_;
+    return Status::OK();
+  }
+
+  Status ParsePower() {
+    ORT_RETURN_IF_ERROR(ParsePrimary());
+    if (Consume("**")) {
+      ORT_RETURN_IF_ERROR(ParseUnary());
+      Emit(OpKind::kPow);
+    }
+    return Status::OK();
+  }
+
+  Status ParsePrimary() {
+    SkipSpaces();
+    ORT_RETURN_IF(pos_ == text_.size(), "Unexpected end of the expression '", text_, "'");
+
+    if (Consume("(")) {
+      ORT_RETURN_IF_ERROR(ParseSum());
+      ORT_RETURN_IF(!Consume(")"), "Missing ')' in the expression '", text_, "'");
+      return Status::OK();
+    }
+
+    const char c = text_[pos_];
+    if (std::isdigit(static_cast<unsigned char>(c))) {
+      int64_t value = 0;
+      while (pos_ < text_.size() && std::isdigit(static_cast<unsigned char>(text_[pos_]))) {
+        ORT_RETURN_IF(!SafeMultiply(value, int64_t{10}, value) || !SafeAdd(value, int64_t{text_[pos_] - '0'}, value),
+                      "Integer overflow in the expression '", text_, "'");
+        ++pos_;
+      }
+      Emit(OpKind::kConstant, value);
+      return Status::OK();
+    }
+
+    ORT_RETURN_IF(!std::isalpha(static_cast<unsigned char>(c)) && c != '_',
+                  "Unexpected character at position ", pos_, " of the expression '", text_, "'");
+    const size_t start = pos_;
+    while (pos_ < text_.size() && (std::isalnum(static_cast<unsigned char>(text_[pos_])) || text_[pos_] == '_')) {
+      ++pos_;
+    }
+    const std::string name = text_.substr(start, pos_ - start);
+
+    if (Consume("(")) {
+      return ParseFunction(name);
+    }
+
+    const auto symbol = symbol_indices_.find(name);
+    ORT_RETURN_IF(symbol == symbol_indices_.end(), "Unknown symbol '", name, "' in the expression '", text_, "'");
+    Emit(OpKind::kSymbol, static_cast<int64_t>(symbol->second));
+    return Status::OK();
+  }
+
+  // the name and the '(' are consumed
+  Status ParseFunction(const std::string& name) {
+    OpKind kind;
+    size_t min_args = 2;
+    size_t max_args = std::numeric_limits<size_t>::max();
+    if (name == "floor" || name == "ceiling") {
+      kind = name == "floor" ? OpKind::kFloor : OpKind::kCeiling;
+      min_args = max_args = 1;
+    } else if (name == "Max" || name == "Min") {
+      kind = name == "Max" ? OpKind::kMax : OpKind::kMin;
+      min_args = 1;
+    } else if (name == "Mod") {
+      kind = OpKind::kMod;
+      max_args = 2;
+    } else {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Unsupported function '", name, "' in the expression '", text_, "'");
+    }
+
+    size_t num_args = 0;
+    do {
+      ORT_RETURN_IF_ERROR(ParseSum());
+      ++num_args;
+      // Max and Min fold their arguments
+      if (num_args > 1 && (kind == OpKind::kMax || kind == OpKind::kMin)) {
+        Emit(kind);
+      }
+    } while (Consume(","));
+    ORT_RETURN_IF(!Consume(")"), "Missing ')' in the expression '", text_, "'");
+    ORT_RETURN_IF(num_args < min_args || num_args > max_args,
+                  "Invalid number of arguments of ", name, " in the expression '", text_, "'");
+
+    if (kind != OpKind::kMax && kind != OpKind::kMin) {
+      Emit(kind);
+    }
+    return Status::OK();
+  }
+
+  const std::string& text_;
+  const InlinedHashMap<std::string, size_t>& symbol_indices_;
+  InlinedVector<SymbolicDimExpression::Op>& ops_;
+  size_t pos_{0};
+  int depth_{0};
+};
+
+namespace {
+
+// num / den in lowest terms with den > 0. The operations return false on an overflow or a division by zero.
+struct Rational {
+  int64_t num;
+  int64_t den;
+};
+
+bool MakeRational(int64_t num, int64_t den, Rational& out) {
+  constexpr int64_t kMin = std::numeric_limits<int64_t>::min();
+  if (den == 0 || num == kMin || den == kMin) {
+    return false;
+  }
+  if (den < 0) {
+    num = -num;
+    den = -den;
+  }
+  const int64_t divisor = std::gcd(num, den);
+  out = {num / divisor, den / divisor};
+  return true;
+}
+
+bool Add(const Rational& a, const Rational& b, Rational& out) {
+  int64_t a_num, b_num, den;
+  return SafeMultiply(a.num, b.den, a_num) && SafeMultiply(b.num, a.den, b_num) &&
+         SafeMultiply(a.den, b.den, den) && SafeAdd(a_num, b_num, a_num) && MakeRational(a_num, den, out);
+}
+
+bool Mul(const Rational& a, const Rational& b, Rational& out) {
+  int64_t num, den;
+  return SafeMultiply(a.num, b.num, num) && SafeMultiply(a.den, b.den, den) && MakeRational(num, den, out);
+}
+
+bool Div(const Rational& a, const Rational& b, Rational& out) {
+  int64_t num, den;
+  return SafeMultiply(a.num, b.den, num) && SafeMultiply(a.den, b.num, den) && MakeRational(num, den, out);
+}
+
+Rational Neg(const Rational& a) {
+  // MakeRational excludes the minimum value, so the negation can't overflow
+  return {-a.num, a.den};
+}
+
+Rational Floor(const Rational& a) {
+  int64_t quotient = a.num / a.den;
+  if (a.num % a.den != 0 && a.num < 0) {
+    --quotient;
+  }
+  return {quotient, 1};
+}
+
+// a < b
+bool Less(const Rational& a, const Rational& b, bool& out) {
+  int64_t a_num, b_num;
+  if (!SafeMultiply(a.num, b.den, a_num) || !SafeMultiply(b.num, a.den, b_num)) {
+    return false;
+  }
+  out = a_num < b_num;
+  return true;
+}
+
+// floor(a / b) and a - b * floor(a / b), as the Python // and % operators
+bool FloorDiv(const Rational& a, const Rational& b, Rational& out) {
+  if (!Div(a, b, out)) {
+    return false;
+  }
+  out = Floor(out);
+  return true;
+}
+
+bool Mod(const Rational& a, const Rational& b, Rational& out) {
+  Rational quotient, product;
+  return FloorDiv(a, b, quotient) && Mul(b, quotient, product) && Add(a, Neg(product), out);
+}
+
+bool Pow(Rational base, const Rational& exponent, Rational& out) {
+  // only integer exponents, small enough for the result of a dimension
+  if (exponent.den != 1 || exponent.num > 64 || exponent.num < -64) {
+    return false;
+  }
+  int64_t e = exponent.num;
+  if (e < 0) {
+    if (!MakeRational(base.den, base.num, base)) {
+      return false;
+    }
+    e = -e;
+  }
+  out = {1, 1};
+  for (; e > 0; --e) {
+    if (!Mul(out, base, out)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+SymbolicDimExpression SymbolicDimExpression::Constant(int64_t value) {
+  SymbolicDimExpression expression;
+  expression.ops_.push_back({OpKind::kConstant, value});
+  return expression;
+}
+
+Status SymbolicDimExpression::Parse(const std::string& dim_param,
+                                    const InlinedHashMap<std::string, size_t>& symbol_indices,
+                                    SymbolicDimExpression& expression) {
+  expression.ops_.clear();
+  const auto symbol = symbol_indices.find(dim_param);
+  if (symbol != symbol_indices.end()) {
+    expression.ops_.push_back({OpKind::kSymbol, static_cast<int64_t>(symbol->second)});
+    return Status::OK();
+  }
+
+  SymbolicDimExpressionParser parser(dim_param, symbol_indices, expression.ops_);
+  return parser.Parse();
+}
+
+Status SymbolicDimExpression::Evaluate(gsl::span<const int64_t> symbol_values, int64_t& value) const {
+  InlinedVector<Rational> stack;
+  for (const Op& op : ops_) {
+    bool ok = true;
+    if (op.kind == OpKind::kConstant) {
+      stack.push_back({op.value, 1});
+      continue;
+    }
+    if (op.kind == OpKind::kSymbol) {
+      ORT_RETURN_IF(static_cast<size_t>(op.value) >= symbol_values.size(), "Missing value of symbol ", op.value);
+      stack.push_back({symbol_values[static_cast<size_t>(op.value)], 1});
+      continue;
+    }
+
+    ORT_RETURN_IF(stack.empty(), "Invalid symbolic dimension expression");
+    Rational& a = stack.back();
+    switch (op.kind) {
+      case OpKind::kNeg:
+        a = Neg(a);
+        continue;
+      case OpKind::kFloor:
+        a = Floor(a);
+        continue;
+      case OpKind::kCeiling:
+        a = Neg(Floor(Neg(a)));
+        continue;
+      default:
+        break;
+    }
+
+    ORT_RETURN_IF(stack.size() < 2, "Invalid symbolic dimension expression");
+    const Rational b = stack.back();
+    stack.pop_back();
+    Rational& lhs = stack.back();
+    const Rational lhs_value = lhs;
+    bool less = false;
+    switch (op.kind) {
+      case OpKind::kAdd:
+        ok = Add(lhs_value, b, lhs);
+        break;
+      case OpKind::kSub:
+        ok = Add(lhs_value, Neg(b), lhs);
+        break;
+      case OpKind::kMul:
+        ok = Mul(lhs_value, b, lhs);
+        break;
+      case OpKind::kDiv:
+        ok = Div(lhs_value, b, lhs);
+        break;
+      case OpKind::kFloorDiv:
+        ok = FloorDiv(lhs_value, b, lhs);
+        break;
+      case OpKind::kMod:
+        ok = Mod(lhs_value, b, lhs);
+        break;
+      case OpKind::kPow:
+        ok = Pow(lhs_value, b, lhs);
+        break;
+      case OpKind::kMax:
+        ok = Less(lhs_value, b, less);
+        lhs = less ? b : lhs_value;
+        break;
+      case OpKind::kMin:
+        ok = Less(b, lhs_value, less);
+        lhs = less ? b : lhs_value;
+        break;
+      default:
+        ok = false;
+        break;
+    }
+    ORT_RETURN_IF(!ok, "Overflow, division by zero or invalid operation in a symbolic dimension expression");
+  }
+
+  ORT_RETURN_IF(stack.size() != 1, "Invalid symbolic dimension expression");
+  ORT_RETURN_IF(stack.back().den != 1, "The symbolic dimension expression doesn't evaluate to an integer");
+  value = stack.back().num;
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+
+#include "gsl/gsl"
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+
+namespace onnxruntime {
+
+class SymbolicDimExpressionParser;
+
+/**
+An integer expression over symbolic dimensions, as written in the dim_param of a shape by
+python/tools/symbolic_shape_infer.py, e.g. "2*sequence + 1", "floor(sequence/2)" or "Max(past, 1) + sequence".
+The expressions can use integers, symbols, the operators + - * / // % ** and parentheses, and the functions floor,
+ceiling, Max, Min and Mod. '/' is an exact division: the intermediate values are rational numbers and the result of
+the expression must be an integer.
+The expression is stored in postfix order, so its evaluation is linear in its length.
+*/
+class SymbolicDimExpression {
+ public:
+  SymbolicDimExpression() = default;
+
+  static SymbolicDimExpression Constant(int64_t value);
+
+  /** Parse a dim_param.
+      @param symbol_indices Index of each symbol in the values given to Evaluate. A dim_param which is one of these
+      symbols is used as is, even if it isn't a valid expression, e.g. "batch size".
+  */
+  static Status Parse(const std::string& dim_param, const InlinedHashMap<std::string, size_t>& symbol_indices,
+                      SymbolicDimExpression& expression);
+
+  // Evaluate the expression with the values of the symbols. Fails if the result isn't an integer.
+  Status Evaluate(gsl::span<const int64_t> symbol_values, int64_t& value) const;
+
+ private:
+  friend class SymbolicDimExpressionParser;
+
+  enum class OpKind : uint8_t {
+    kConstant,
+    kSymbol,
+    kAdd,
+    kSub,
+    kMul,
+    kDiv,
+    kFloorDiv,
+    kMod,
+    kPow,
+    kNeg,
+    kFloor,
+    kCeiling,
+    kMax,
+    kMin,
+  };
+
+  struct Op {
+    OpKind kind;
+    // value of a kConstant, index of a kSymbol
+    int64_t value;
+  };
+
+  InlinedVector<Op> ops_;
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,255 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/symbolic_memory_plan.h"
+
+#include <algorithm>
+
+#include "core/common/safeint.h"
+#include "core/framework/allocator.h"
+#include "core/framework/data_types_internal.h"
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+
+namespace {
+
+// Value given to every symbol to order the activations by size when assigning the slots.
+constexpr int64_t kNominalSymbolValue = 64;
+
+// Size in bytes of a tensor, aligned as the execution frame allocates it.
+Status EvaluateSize(gsl::span<const SymbolicDimExpression> dims, size_t element_size,
+                    gsl::span<const int64_t> symbol_values, size_t& size) {
+  int64_t num_elements = 1;
+  for (const auto& dim : dims) {
+    int64_t dim_value;
+    ORT_RETURN_IF_ERROR(dim.Evaluate(symbol_values, dim_value));
+    ORT_RETURN_IF(dim_value < 0, "A symbolic dimension evaluates to the negative value ", dim_value);
+    ORT_RETURN_IF(!SafeMultiply(num_elements, dim_value, num_elements), "Size overflow");
+  }
+
+  ORT_RETURN_IF(!IAllocator::CalcMemSizeForArrayWithAlignment<kAllocAlignment>(static_cast<size_t>(num_elements),
+                                                                               element_size, &size),
+                "Size overflow");
+  return Status::OK();
+}
+
+// Whether a lifetime overlaps one of the lifetimes of a slot. The intervals of program counters are inclusive.
+bool Overlaps(const std::vector<std::pair<size_t, size_t>>& slot_intervals,
+              const AllocPlanPerValue::ProgramCounter& program_counter) {
+  const auto& starts = program_counter.Starts();
+  const auto& ends = program_counter.Ends();
+  for (size_t i = 0; i < starts.size(); ++i) {
+    for (const auto& interval : slot_intervals) {
+      if (interval.first <= ends[i] && starts[i] <= interval.second) {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
+std::unique_ptr<SymbolicMemoryPlan> SymbolicMemoryPlan::Create(const GraphViewer& graph_viewer,
+                                                               const SequentialExecutionPlan& execution_plan,
+                                                               const OrtValueNameIdxMap& ort_value_name_idx_map) {
+  auto plan = std::make_unique<SymbolicMemoryPlan>();
+
+  InlinedHashMap<std::string, size_t> symbol_indices;
+  for (const auto* input : graph_viewer.GetInputs()) {
+    const auto* shape = input->Shape();
+    int ort_value_idx;
+    if (shape == nullptr || !ort_value_name_idx_map.GetIdx(input->Name(), ort_value_idx).IsOK()) {
+      continue;
+    }
+
+    for (int k = 0, end = shape->dim_size(); k < end; ++k) {
+      const auto& dim = shape->dim(k);
+      if (!dim.has_dim_param()) {
+        continue;
+      }
+
+      const auto symbol = symbol_indices.insert({dim.dim_param(), plan->symbols_.size()});
+      if (symbol.second) {
+        plan->symbols_.push_back(dim.dim_param());
+      }
+      plan->symbol_sources_[ort_value_idx].push_back({static_cast<size_t>(k), symbol.first->second});
+    }
+  }
+
+  if (plan->symbols_.empty()) {
+    return nullptr;
+  }
+
+  // the activations allocated by the frame whose shape is expressed with the symbols
+  struct Candidate {
+    size_t value;
+    size_t location;
+    size_t nominal_size;
+    const AllocPlanPerValue::ProgramCounter* program_counter;
+  };
+
+  const std::vector<int64_t> nominal_values(plan->symbols_.size(), kNominalSymbolValue);
+  std::vector<Candidate> candidates;
+  for (const auto& step : execution_plan.execution_plan) {
+    const Node* node = graph_viewer.GetNode(step.node_index);
+    for (const auto* output : node->OutputDefs()) {
+      int ort_value_idx;
+      if (!output->Exists() || !ort_value_name_idx_map.GetIdx(output->Name(), ort_value_idx).IsOK()) {
+        continue;
+      }
+
+      // the activations a traced pattern would hold
+      const auto& alloc_plan = execution_plan.allocation_plan[ort_value_idx];
+      const auto* tensor_type = alloc_plan.value_type == nullptr ? nullptr : alloc_plan.value_type->AsTensorType();
+      if (alloc_plan.alloc_kind != AllocKind::kAllocate || tensor_type == nullptr ||
+          utils::IsDataTypeString(tensor_type->GetElementType())) {
+        continue;
+      }
+
+      // A pattern is final once cached, so an activation left out of the plan would be allocated dynamically in
+      // every Run instead of being traced. Keep tracing the patterns of such a graph.
+      const auto* shape = output->Shape();
+      if (!alloc_plan.program_counter.HasValidEntries() || shape == nullptr) {
+        return nullptr;
+      }
+
+      PlannedValue value{ort_value_idx, 0, tensor_type->GetElementType()->Size(), {}};
+      bool resolved = true;
+      for (const auto& dim : shape->dim()) {
+        SymbolicDimExpression expression;
+        if (dim.has_dim_value() && dim.dim_value() > 0) {
+          value.dims.push_back(SymbolicDimExpression::Constant(dim.dim_value()));
+        } else if (dim.has_dim_param() &&
+                   SymbolicDimExpression::Parse(dim.dim_param(), symbol_indices, expression).IsOK()) {
+          value.dims.push_back(std::move(expression));
+        } else {
+          resolved = false;
+          break;
+        }
+      }
+
+      if (!resolved) {
+        return nullptr;
+      }
+
+      auto location = std::find(plan->locations_.cbegin(), plan->locations_.cend(), alloc_plan.location);
+      if (location == plan->locations_.cend()) {
+        plan->locations_.push_back(alloc_plan.location);
+        location = plan->locations_.cend() - 1;
+      }
+
+      // the sizes only order the activations, an expression which doesn't evaluate for the nominal values is last
+      size_t nominal_size = 0;
+      if (!EvaluateSize(value.dims, value.element_size, nominal_values, nominal_size).IsOK()) {
+        nominal_size = 0;
+      }
+
+      candidates.push_back({plan->values_.size(), static_cast<size_t>(location - plan->locations_.cbegin()),
+                            nominal_size, &alloc_plan.program_counter});
+      plan->values_.push_back(std::move(value));
+    }
+  }
+
+  if (plan->values_.empty()) {
+    return nullptr;
+  }
+
+  // Largest activations first, each in the slot of the same location with the smallest size among the ones it can
+  // share, as the shared objects of the TFLite GPU memory planner.
+  std::stable_sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+    return a.nominal_size > b.nominal_size;
+  });
+
+  std::vector<std::vector<std::pair<size_t, size_t>>> slot_intervals;
+  std::vector<size_t> slot_nominal_sizes;
+  for (const auto& candidate : candidates) {
+    size_t best_slot = slot_intervals.size();
+    for (size_t slot = 0; slot < slot_intervals.size(); ++slot) {
+      if (plan->slot_locations_[slot] == candidate.location &&
+          !Overlaps(slot_intervals[slot], *candidate.program_counter) &&
+          (best_slot == slot_intervals.size() || slot_nominal_sizes[slot] < slot_nominal_sizes[best_slot])) {
+        best_slot = slot;
+      }
+    }
+
+    if (best_slot == slot_intervals.size()) {
+      slot_intervals.emplace_back();
+      slot_nominal_sizes.push_back(candidate.nominal_size);
+      plan->slot_locations_.push_back(candidate.location);
+    }
+
+    const auto& starts = candidate.program_counter->Starts();
+    const auto& ends = candidate.program_counter->Ends();
+    for (size_t i = 0; i < starts.size(); ++i) {
+      slot_intervals[best_slot].push_back({starts[i], ends[i]});
+    }
+    plan->values_[candidate.value].slot = best_slot;
+  }
+
+  return plan;
+}
+
+Status SymbolicMemoryPlan::GeneratePatterns(gsl::span<const int> feed_mlvalue_idxs, gsl::span<const OrtValue> feeds,
+                                            MemoryPatternGroup& output) const {
+  ORT_RETURN_IF(feed_mlvalue_idxs.size() != feeds.size(), "The number of feeds and feed indices differ");
+
+  std::vector<int64_t> symbol_values(symbols_.size(), -1);
+  for (size_t i = 0; i < feeds.size(); ++i) {
+    const auto sources = symbol_sources_.find(feed_mlvalue_idxs[i]);
+    if (sources == symbol_sources_.end()) {
+      continue;
+    }
+
+    ORT_RETURN_IF(!feeds[i].IsTensor(), "A feed with symbolic dimensions is not a tensor");
+    const auto& shape = feeds[i].Get<Tensor>().Shape();
+    for (const auto& source : sources->second) {
+      ORT_RETURN_IF(source.first >= shape.NumDimensions(), "A feed has fewer dimensions than its graph input");
+      int64_t& symbol_value = symbol_values[source.second];
+      ORT_RETURN_IF(symbol_value != -1 && symbol_value != shape[source.first],
+                    "The symbolic dimension ", symbols_[source.second], " has the values ", symbol_value, " and ",
+                    shape[source.first], " in the feeds");
+      symbol_value = shape[source.first];
+    }
+  }
+
+  for (size_t symbol = 0; symbol < symbols_.size(); ++symbol) {
+    ORT_RETURN_IF(symbol_values[symbol] < 0, "The symbolic dimension ", symbols_[symbol], " has no value in the feeds");
+  }
+
+  std::vector<size_t> value_sizes(values_.size());
+  std::vector<size_t> slot_sizes(slot_locations_.size(), 0);
+  for (size_t i = 0; i < values_.size(); ++i) {
+    const PlannedValue& value = values_[i];
+    ORT_RETURN_IF_ERROR(EvaluateSize(value.dims, value.element_size, symbol_values, value_sizes[i]));
+    slot_sizes[value.slot] = std::max(slot_sizes[value.slot], value_sizes[i]);
+  }
+
+  output.locations = locations_;
+  output.patterns.clear();
+  output.patterns.resize(locations_.size());
+
+  std::vector<size_t> slot_offsets(slot_locations_.size());
+  for (size_t slot = 0; slot < slot_locations_.size(); ++slot) {
+    MemoryPattern& pattern = output.patterns[slot_locations_[slot]];
+    slot_offsets[slot] = pattern.peak_size_;
+    ORT_RETURN_IF(!SafeAdd(pattern.peak_size_, slot_sizes[slot], pattern.peak_size_), "Size overflow");
+  }
+
+  for (size_t i = 0; i < values_.size(); ++i) {
+    const PlannedValue& value = values_[i];
+    output.patterns[slot_locations_[value.slot]].patterns_[value.ort_value_idx] =
+        MemoryBlock(slot_offsets[value.slot], value_sizes[i]);
+  }
+
+  for (auto& pattern : output.patterns) {
+    pattern.traced_peak_size_ = pattern.peak_size_;
+    pattern.planned_peak_size_ = pattern.peak_size_;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gsl/gsl"
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/framework/mem_pattern.h"
+#include "core/framework/ort_value.h"
+#include "core/framework/ort_value_name_idx_map.h"
+#include "core/framework/sequential_execution_plan.h"
+#include "core/framework/symbolic_dim_expression.h"
+#include "core/graph/graph_viewer.h"
+
+namespace onnxruntime {
+
+/**
+@class SymbolicMemoryPlan
+
+Memory pattern of a model with symbolic dimensions, planned once at session initialization for all the shapes of
+the inputs. The symbols are the dim_params of the graph inputs, and the dims of the activations are expressions over
+them (see SymbolicDimExpression), e.g. as written by symbolic_shape_infer.py.
+Each planned activation is assigned to a slot shared with activations whose lifetimes in the allocation plan don't
+overlap, so the assignment holds for any shapes. For given feeds the size of a slot is the size of its largest
+activation and the slots of a location are laid out one after another, which only takes evaluating the size of each
+activation: the pattern is available for the first Run with new shapes, without tracing it.
+The plan is only created if it holds all the activations a traced pattern would hold: the pattern it generates
+isn't traced again, so an activation with a shape that is unknown or not expressed with the symbols of the inputs
+would be allocated dynamically in every Run. The memory patterns of such a graph are traced.
+*/
+class SymbolicMemoryPlan {
+ public:
+  // Returns nullptr if the graph inputs have no symbolic dimension, or if no activation or not every activation
+  // can be planned.
+  static std::unique_ptr<SymbolicMemoryPlan> Create(const GraphViewer& graph_viewer,
+                                                    const SequentialExecutionPlan& execution_plan,
+                                                    const OrtValueNameIdxMap& ort_value_name_idx_map);
+
+  // Generate the memory patterns for the shapes of the feeds.
+  // Fails if the feeds don't give a consistent value to every symbol or a size doesn't evaluate.
+  Status GeneratePatterns(gsl::span<const int> feed_mlvalue_idxs, gsl::span<const OrtValue> feeds,
+                          MemoryPatternGroup& output) const;
+
+  size_t NumPlannedValues() const { return values_.size(); }
+  size_t NumSlots() const { return slot_locations_.size(); }
+
+ private:
+  struct PlannedValue {
+    int ort_value_idx;
+    size_t slot;
+    size_t element_size;
+    InlinedVector<SymbolicDimExpression> dims;
+  };
+
+  std::vector<std::string> symbols_;
+  // the (dim, symbol) pairs of each graph input with symbolic dimensions
+  InlinedHashMap<int, InlinedVector<std::pair<size_t, size_t>>> symbol_sources_;
+  std::vector<OrtMemoryInfo> locations_;
+  // index in locations_ of each slot
+  std::vector<size_t> slot_locations_;
+  std::vector<PlannedValue> values_;
+};
+
+}  // namespace onnxruntime
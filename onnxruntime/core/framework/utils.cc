@@ -811,5 +811,23 @@ bool IsInputOnCpu(const Node& node, const KernelCreateInfo* p_kci, size_t index)
   return false;
 }
 
+void AddKernelCostArgs(const OpKernel& op_kernel, const OpKernelContext& op_kernel_context,
+                       std::chrono::nanoseconds compute_duration,
+                       std::unordered_map<std::string, std::string>& event_args) {
+  KernelCost cost;
+  if (!op_kernel.GetCost(op_kernel_context, cost)) {
+    return;
+  }
+
+  // FLOPs per ns and bytes per ns are GFLOP/s and GB/s
+  const double duration_ns = static_cast<double>(std::max<int64_t>(compute_duration.count(), 1));
+  event_args.emplace("flops", std::to_string(cost.flops));
+  event_args.emplace("bytes_read", std::to_string(cost.bytes_read));
+  event_args.emplace("bytes_written", std::to_string(cost.bytes_written));
+  event_args.emplace("compute_ns", std::to_string(compute_duration.count()));
+  event_args.emplace("gflops_per_sec", std::to_string(cost.flops / duration_ns));
+  event_args.emplace("gbytes_per_sec", std::to_string((cost.bytes_read + cost.bytes_written) / duration_ns));
+}
+
 }  // namespace utils
 }  // namespace onnxruntime
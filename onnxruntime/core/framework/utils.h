@@ -3,6 +3,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <string>
+#include <unordered_map>
+
 #include "core/graph/basic_types.h"
 #include "core/framework/allocator.h"
 #include "core/framework/data_types.h"
@@ -189,5 +193,11 @@ int32_t ONNXTensorElementDataTypeToProtoTensorType(ONNXTensorElementDataType);
 common::Status VerifyInputTensorsAllocatedContiguously(OpKernelContext* context);
 #endif
 
+// Add the cost model of the kernel and the throughput it achieved to the args of its profiling event, for roofline
+// analysis of the profile (see tools/python/util/profile_roofline.py). Nothing is added if the kernel has no cost model.
+void AddKernelCostArgs(const OpKernel& op_kernel, const OpKernelContext& op_kernel_context,
+                       std::chrono::nanoseconds compute_duration,
+                       std::unordered_map<std::string, std::string>& event_args);
+
 }  // namespace utils
 }  // namespace onnxruntime
@@ -1207,6 +1207,144 @@ activation.)DOC")
                                   ONNX_NAMESPACE::convPoolShapeInference(ctx, true, false, 0, 1);
                                 }));
 
+constexpr const char* FusedElementwise_ver1_doc = R"DOC(
+A chain of element-wise operators fused into a single operator so that the input is read, and the output written,
+only once. The steps in the 'ops' attribute are applied in order to the chain value, which starts as input X.
+Unary steps are one of Abs, Ceil, Erf, Exp, Floor, Log, Neg, Reciprocal, Relu, Sigmoid, Sqrt and Tanh.
+Binary steps are one of Add, Sub, Mul and Div with the chain value as the first argument, or RSub and RDiv with it
+as the second argument. The other argument of a binary step is the input whose index is given by the matching entry
+of the 'operands' attribute, which is -1 for unary steps. It must be a scalar or, once its leading dimensions of
+size 1 are removed, have the same shape as the trailing dimensions of X, so that the chain value keeps the shape
+of X.)DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(FusedElementwise, 1,
+                            OpSchema()
+                                .SetDoc(FusedElementwise_ver1_doc)
+                                .Attr("ops", "The operator of each step of the chain.", AttributeProto::STRINGS)
+                                .Attr("operands",
+                                      "The index of the input that is the other argument of each binary step, "
+                                      "-1 for unary steps.",
+                                      AttributeProto::INTS)
+                                .Input(0, "X", "Input of the chain.", "T")
+                                .Input(1, "operands", "Other arguments of the binary steps.", "T",
+                                       OpSchema::Variadic, true, 0)
+                                .Output(0, "Y", "Output of the chain, with the same shape as X.", "T")
+                                .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors.")
+                                .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput));
+
+constexpr const char* MelSpectrogram_ver1_doc = R"DOC(
+Mel spectrogram of a batch of real signals. The signals are split into frames of the window length, frame_step
+samples apart, and each frame is multiplied by the window, which must be shorter than the signals as for STFT.
+The onesided DFT of each frame gives window_length / 2 + 1 frequency bins, whose magnitude (power = 1) or power
+(power = 2) is projected on the mel filter bank mel_weight_matrix, usually the output of MelWeightMatrix. When
+apply_log is set, log(mel + log_offset) is returned.
+This is equivalent to STFT, ReduceL2 or ReduceSumSquare over the last axis, MatMul with mel_weight_matrix and
+optionally Add and Log, without materializing the spectrogram.)DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(MelSpectrogram, 1,
+                            OpSchema()
+                                .SetDoc(MelSpectrogram_ver1_doc)
+                                .Attr("power", "1 to project the magnitude of the frequency bins, 2 for their power.",
+                                      AttributeProto::INT, static_cast<int64_t>(2))
+                                .Attr("apply_log", "Whether the log of the mel spectrogram is returned.",
+                                      AttributeProto::INT, static_cast<int64_t>(0))
+                                .Attr("log_offset", "Value added to the mel spectrogram before the log.",
+                                      AttributeProto::FLOAT, 0.0f)
+                                .Input(0, "signal",
+                                       "Real signals of shape [batch_size, signal_length] or "
+                                       "[batch_size, signal_length, 1].",
+                                       "T")
+                                .Input(1, "frame_step", "Number of samples between the starts of consecutive frames.",
+                                       "tensor(int64)")
+                                .Input(2, "window", "Window of shape [window_length] applied to each frame.", "T")
+                                .Input(3, "mel_weight_matrix",
+                                       "Mel filter bank of shape [window_length / 2 + 1, num_mel_bins].", "T")
+                                .Output(0, "output", "Mel spectrogram of shape [batch_size, num_frames, num_mel_bins].",
+                                        "T")
+                                .TypeConstraint("T", {"tensor(float)"}, "Constrain input and output types to float tensors.")
+                                .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+                                  propagateElemTypeFromInputToOutput(ctx, 0, 0);
+                                  if (!hasInputShape(ctx, 0) || !hasInputShape(ctx, 3)) {
+                                    return;
+                                  }
+
+                                  const auto& mel_weight_shape = getInputShape(ctx, 3);
+                                  if (mel_weight_shape.dim_size() != 2) {
+                                    fail_shape_inference("mel_weight_matrix must have 2 dimensions.");
+                                  }
+
+                                  // the number of frames depends on the value of frame_step
+                                  TensorShapeProto output_shape;
+                                  *output_shape.add_dim() = getInputShape(ctx, 0).dim(0);
+                                  output_shape.add_dim();
+                                  *output_shape.add_dim() = mel_weight_shape.dim(1);
+                                  updateOutputShape(ctx, 0, output_shape);
+                                }));
+
+constexpr const char* EmbeddingBag_ver1_doc = R"DOC(
+Sums or averages bags of rows of an embedding table, the pooling of the sparse features of recommendation models.
+With 2-D indices of shape [num_bags, bag_size], each row of indices is a bag. With 1-D indices, bag i is
+indices[offsets[i]:offsets[i + 1]], and the last bag ends at the end of indices. Negative indices count from the
+end of the table. Optional per_sample_weights multiply the rows before they are summed. An empty bag gives zeros.
+The table can be row-wise quantized to 8 bits, in which case row r is dequantized as
+scale[r] * (weight[r] - zero_point[r]).
+This is equivalent to Gather followed by ReduceSum or ReduceMean over the bag axis, without materializing the
+gathered rows.)DOC";
+
+ONNX_MS_OPERATOR_SET_SCHEMA(EmbeddingBag, 1,
+                            OpSchema()
+                                .SetDoc(EmbeddingBag_ver1_doc)
+                                .Attr("mode", "Reduction of the rows of a bag, 'sum' or 'mean'.",
+                                      AttributeProto::STRING, std::string("sum"))
+                                .Input(0, "weight", "Embedding table of shape [num_embeddings, embedding_dim].", "T")
+                                .Input(1, "indices", "Rows of the bags, of shape [num_bags, bag_size] or [num_indices].",
+                                       "Tind")
+                                .Input(2, "offsets",
+                                       "Start of each bag in 1-D indices, of shape [num_bags]. Required with 1-D "
+                                       "indices and not allowed with 2-D indices.",
+                                       "Tind", OpSchema::Optional)
+                                .Input(3, "per_sample_weights",
+                                       "Weights of the rows, of the shape of indices. Only allowed with mode 'sum'.",
+                                       "tensor(float)", OpSchema::Optional)
+                                .Input(4, "scale", "Scale of each row of a quantized table, of shape [num_embeddings].",
+                                       "tensor(float)", OpSchema::Optional)
+                                .Input(5, "zero_point",
+                                       "Zero point of each row of a quantized table, of shape [num_embeddings].", "T",
+                                       OpSchema::Optional)
+                                .Output(0, "output", "Reduced bags of shape [num_bags, embedding_dim].",
+                                        "tensor(float)")
+                                .TypeConstraint("T", {"tensor(float)", "tensor(int8)", "tensor(uint8)"},
+                                                "Constrain the table to float tensors or 8 bit quantized tensors.")
+                                .TypeConstraint("Tind", {"tensor(int32)", "tensor(int64)"},
+                                                "Constrain indices and offsets to integer tensors.")
+                                .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+                                  updateOutputElemType(ctx, 0, ONNX_NAMESPACE::TensorProto::FLOAT);
+                                  if (!hasInputShape(ctx, 0) || !hasInputShape(ctx, 1)) {
+                                    return;
+                                  }
+
+                                  const auto& weight_shape = getInputShape(ctx, 0);
+                                  if (weight_shape.dim_size() != 2) {
+                                    fail_shape_inference("weight must have 2 dimensions.");
+                                  }
+
+                                  const auto& indices_shape = getInputShape(ctx, 1);
+                                  TensorShapeProto output_shape;
+                                  if (indices_shape.dim_size() == 2) {
+                                    *output_shape.add_dim() = indices_shape.dim(0);
+                                  } else if (indices_shape.dim_size() == 1) {
+                                    if (hasInputShape(ctx, 2)) {
+                                      *output_shape.add_dim() = getInputShape(ctx, 2).dim(0);
+                                    } else {
+                                      output_shape.add_dim();
+                                    }
+                                  } else {
+                                    fail_shape_inference("indices must have 1 or 2 dimensions.");
+                                  }
+                                  *output_shape.add_dim() = weight_shape.dim(1);
+                                  updateOutputShape(ctx, 0, output_shape);
+                                }));
+
 ONNX_MS_OPERATOR_SET_SCHEMA(FusedGemm, 1,
                             OpSchema()
                                 .SetDoc(R"DOC(
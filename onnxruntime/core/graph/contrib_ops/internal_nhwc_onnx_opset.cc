@@ -16,7 +16,6 @@ using RegistrationFunc = std::function<void(ONNX_NAMESPACE::OpSchema&&)>;
 
 namespace {
 
-template <typename F>
 void RegisterNHWCSchema(const RegistrationFunc& f, ::ONNX_NAMESPACE::OpSchema&& schema) {
   // Need to copy the inferencing function from the temporary OpSchema object
   auto onnx_inferencing_func = schema.GetTypeAndShapeInferenceFunction();
@@ -66,11 +65,13 @@ void OpSet_Internal_NHWC_ONNX::ForEachSchema(const std::function<void(ONNX_NAMES
   REGISTER_NHWC_SCHEMA_WITH_ACTIVATION(fn, Conv, 11);
   REGISTER_NHWC_SCHEMA_WITH_ACTIVATION(fn, MaxPool, 11);
   REGISTER_NHWC_SCHEMA_WITH_ACTIVATION(fn, MaxPool, 12);
+  REGISTER_NHWC_SCHEMA(fn, AveragePool, 11);
+  REGISTER_NHWC_SCHEMA(fn, GlobalAveragePool, 1);
 
   // TODO: Add other layout sensitive ops when needed. Those are:
   //   QLinearConv,
   //   BatchNormalization,
-  //   AveragePool, GlobalAveragePool, GlobalMaxPool,
+  //   GlobalMaxPool,
   //   LRN,
   //   GridSample
   //   DepthToSpace, SpaceToDepth
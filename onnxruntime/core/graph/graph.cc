@@ -6,6 +6,7 @@
 #include <cassert>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include <stack>
 #include <queue>
@@ -880,6 +881,9 @@ void Node::CreateSubgraph(const std::string& attr_name) {
 
 void Node::AddAttributeProto(AttributeProto value) {
   utils::SetNodeAttribute(std::move(value), attributes_);
+#if !defined(ORT_MINIMAL_BUILD)
+  has_inferencing_signature_ = false;
+#endif
   if (graph_) {
     graph_->SetGraphResolveNeeded();
     graph_->SetGraphProtoSyncNeeded();
@@ -928,6 +932,9 @@ void Node::AddAttribute(std::string attr_name, GraphProto value) {
 
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 bool Node::ClearAttribute(const std::string& attr_name) {
+#if !defined(ORT_MINIMAL_BUILD)
+  has_inferencing_signature_ = false;
+#endif
   graph_->SetGraphResolveNeeded();
   graph_->SetGraphProtoSyncNeeded();
   return attributes_.erase(attr_name) > 0;
@@ -2012,6 +2019,9 @@ class InferenceContextImpl : public ONNX_NAMESPACE::InferenceContext {
 
   std::vector<TypeProto> InferredOutputTypes() const { return node_output_types_; }
 
+  // Whether the inferencing function asked for the data of an input.
+  bool ReadsInputData() const noexcept { return reads_input_data_; }
+
   const AttributeProto* getAttribute(const std::string& name) const override {
     auto& attribute_value_map = node_.GetAttributes();
     auto iter = attribute_value_map.find(name);
@@ -2044,6 +2054,9 @@ class InferenceContextImpl : public ONNX_NAMESPACE::InferenceContext {
   }
 
   const TensorProto* getInputData(size_t index) const override {
+    // the inferred types depend on the values of the constant inputs as well as on their types
+    reads_input_data_ = true;
+
     auto def = node_.InputDefs()[index];
     if (!def)
       return nullptr;
@@ -2090,8 +2103,47 @@ class InferenceContextImpl : public ONNX_NAMESPACE::InferenceContext {
   std::vector<std::unique_ptr<GraphInferencerImpl>> graph_inferencers_;
   const Graph& graph_;
   const Graph::ResolveOptions& options_;
+  mutable bool reads_input_data_ = false;
 };
 
+// What the type and shape inferencing of a node depends on other than its attributes: its schema, and the
+// names and types of its inputs and outputs. The output types are included as the inferencing merges the inferred
+// shapes with the existing ones. The producer of each input, or whether it's an initializer, is included too, so a
+// node whose input was replaced by an initializer of the same name and type, e.g. by constant folding, is reported as
+// changed and the transformers that need constant inputs revisit it.
+static std::string ComputeInferencingSignature(const Graph& graph, const Node& node) {
+  std::string signature;
+  const auto* op = node.Op();
+  signature.append(reinterpret_cast<const char*>(&op), sizeof(op));
+  for (int arg_count : node.InputArgCount()) {
+    signature.append(reinterpret_cast<const char*>(&arg_count), sizeof(arg_count));
+  }
+
+  auto append_defs = [&signature](ConstPointerContainer<std::vector<NodeArg*>> defs) {
+    for (const NodeArg* def : defs) {
+      signature.append(def->Name());
+      signature.push_back('\0');
+      const TypeProto* type = def->TypeAsProto();
+      if (type != nullptr) {
+        type->AppendToString(&signature);
+      }
+      signature.push_back('\0');
+    }
+    signature.push_back('\0');
+  };
+  append_defs(node.InputDefs());
+  append_defs(node.OutputDefs());
+
+  for (const NodeArg* def : node.InputDefs()) {
+    const Node* producer = def->Exists() ? graph.GetProducerNode(def->Name()) : nullptr;
+    const NodeIndex producer_index = producer != nullptr ? producer->Index() : std::numeric_limits<NodeIndex>::max();
+    signature.append(reinterpret_cast<const char*>(&producer_index), sizeof(producer_index));
+    signature.push_back(def->Exists() && graph.IsInitializedTensor(def->Name()) ? '\1' : '\0');
+  }
+
+  return signature;
+}
+
 Status Graph::InferAndVerifySubgraphTypes(const Node& node, Graph& subgraph,
                                           const std::vector<const TypeProto*>& input_types,
                                           std::vector<const TypeProto*>& output_types,
@@ -2405,6 +2457,24 @@ Status Graph::InferAndVerifyTypeMatch(Node& node, const OpSchema& op, const Reso
     }
   }
 
+  const Graph* main_graph = this;
+  while (main_graph->parent_graph_ != nullptr) {
+    main_graph = main_graph->parent_graph_;
+  }
+
+  // the next incremental Resolve can skip the node if nothing it depends on changes. the inferencing of nodes with
+  // subgraphs also depends on the subgraphs, and that of nodes reading the constant inputs on their values, so it
+  // always runs.
+  node.has_inferencing_signature_ =
+      main_graph->incremental_resolve_ && !context.ReadsInputData() && !node.ContainsSubgraph();
+  if (node.has_inferencing_signature_) {
+    node.inferencing_signature_ = ComputeInferencingSignature(*this, node);
+  } else {
+    node.inferencing_signature_.clear();
+  }
+
+  node.last_inferencing_resolve_ = main_graph->num_resolves_ + 1;
+
   return Status::OK();
 }
 
@@ -2499,10 +2569,26 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
   // and need to call Resolve
   lsc.output_names.insert(outer_scope_node_arg_names_.cbegin(), outer_scope_node_arg_names_.cend());
 
+  const Graph* main_graph = this;
+  while (main_graph->parent_graph_ != nullptr) {
+    main_graph = main_graph->parent_graph_;
+  }
+  const bool incremental = main_graph->incremental_resolve_;
+
   for (auto node_index : nodes_in_topological_order_) {
     // Node verification.
     auto& node = *GetNode(node_index);
 
+    // the node was verified by a previous incremental Resolve and nothing its type and shape inferencing depends on
+    // has changed. the whole signature is compared so a node is only skipped if it's unchanged.
+    if (incremental && node.has_inferencing_signature_ && !options.override_types &&
+        node.inferencing_signature_ == ComputeInferencingSignature(*this, node)) {
+      for (const auto* output_def : node.OutputDefs()) {
+        lsc.output_names.insert(output_def->Name());
+      }
+      continue;
+    }
+
     NodeProto node_proto;
     node.ToProto(node_proto);
     const auto& node_name = node.Name();
@@ -3252,6 +3338,31 @@ bool Graph::RemoveNode(NodeIndex p_index) {
 
   return ReleaseNode(p_index);
 }
+
+bool Graph::RemoveNodeArg(const std::string& name) {
+  auto entry = node_args_.find(name);
+  if (entry == node_args_.end()) {
+    return false;
+  }
+
+  const NodeArg* node_arg = entry->second.get();
+  if (IsInputsIncludingInitializers(node_arg) || IsOutput(node_arg) || IsInitializedTensor(name)) {
+    return false;
+  }
+
+  auto uses = [node_arg](const ConstPointerContainer<std::vector<NodeArg*>>& defs) {
+    return std::find(defs.begin(), defs.end(), node_arg) != defs.end();
+  };
+  for (const auto& node : Nodes()) {
+    if (uses(node.InputDefs()) || uses(node.OutputDefs()) || uses(node.ImplicitInputDefs())) {
+      return false;
+    }
+  }
+
+  value_info_.erase(node_arg);
+  node_args_.erase(entry);
+  return true;
+}
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -10,6 +10,19 @@ bool NodeCompare::operator()(const Node* n1, const Node* n2) const {
   return n1->Index() < n2->Index();
 }
 
+// Used for the default order. The inputs of a node are visited in the reverse order of the comparison, so the inputs
+// with a lower priority (higher value) are output after the other inputs of the node, e.g. a node recomputing a value
+// is output right before its consumer. The nodes of the same priority are compared as NodeCompare.
+struct DefaultOrderNodeCompare {
+  bool operator()(const Node* n1, const Node* n2) const {
+    if (n1->Priority() != n2->Priority()) {
+      return n1->Priority() > n2->Priority();
+    }
+
+    return n1->Index() < n2->Index();
+  }
+};
+
 #if !defined(ORT_MINIMAL_BUILD)
 struct PriorityNodeCompare {
   inline bool IsHighPri(const Node* n) const {
@@ -74,7 +87,7 @@ GraphViewer::GraphViewer(const Graph& graph, const IndexedSubGraph* filter_info)
       [this](const Node* n) {
         nodes_in_topological_order_.push_back(n->Index());
       },
-      NodeCompare());
+      DefaultOrderNodeCompare());
 
 #if !defined(ORT_MINIMAL_BUILD)
   graph.KahnsTopologicalSort(
@@ -798,6 +798,18 @@ MlasConvDepthwise(
     size_t KernelSize
     );
 
+void
+MLASCALL
+MlasConvDepthwiseNhwc(
+    const float* const* Input,
+    const float* Filter,
+    const float* Bias,
+    float* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    );
+
 //
 // Symmetric quantized integer convolution routines.
 //
@@ -941,6 +953,28 @@ MlasMaximumPool(
     size_t KernelSize
     );
 
+void
+MLASCALL
+MlasMaximumPoolNhwc(
+    const float* const* Input,
+    float* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    );
+
+void
+MLASCALL
+MlasAveragePoolNhwc(
+    const float* const* Input,
+    const float* PaddingVector,
+    bool CountIncludePad,
+    float* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    );
+
 //
 // Miscellaneous compute routines.
 //
@@ -1616,3 +1616,221 @@ MlasMaximumPool<uint8_t>(
     size_t OutputCount,
     size_t KernelSize
     );
+
+void
+MLASCALL
+MlasMaximumPoolNhwc(
+    const float* const* Input,
+    float* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the maximum pooling operation for single precision
+    floating point elements in channels last format.
+
+    The input is supplied as an indirection buffer. Every pointer in the
+    indirection buffer points at a Channels length vector (either from the
+    input tensor or a vector of padding values). These are grouped in batches
+    of length KernelSize that are processed by the kernel to produce a single
+    output of length Channels. These batches are then repeated OutputCount
+    times.
+
+Arguments:
+
+    Input - Supplies an indirection buffer to the elements of the input tensor.
+        The padding vector should be filled with the lowest float value.
+
+    Output - Supplies the output tensor in channels last format.
+
+    Channels - Supplies the number of channels.
+
+    OutputCount - Supplies the number of channel sized output elements to
+        produce.
+
+    KernelSize - Supplies the total number of channel sized kernel elements to
+        consume.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (OutputCount > 0) {
+
+        size_t ChannelOffset = 0;
+        size_t c = Channels;
+
+        while (c >= 8) {
+
+            MLAS_FLOAT32X4 MaximumVector0 = MlasLoadFloat32x4(&Input[0][ChannelOffset]);
+            MLAS_FLOAT32X4 MaximumVector1 = MlasLoadFloat32x4(&Input[0][ChannelOffset + 4]);
+
+            for (size_t k = 1; k < KernelSize; k++) {
+                MaximumVector0 = MlasMaximumFloat32x4(MaximumVector0, MlasLoadFloat32x4(&Input[k][ChannelOffset]));
+                MaximumVector1 = MlasMaximumFloat32x4(MaximumVector1, MlasLoadFloat32x4(&Input[k][ChannelOffset + 4]));
+            }
+
+            MlasStoreFloat32x4(&Output[0], MaximumVector0);
+            MlasStoreFloat32x4(&Output[4], MaximumVector1);
+            Output += 8;
+
+            ChannelOffset += 8;
+            c -= 8;
+        }
+
+        if (c >= 4) {
+
+            MLAS_FLOAT32X4 MaximumVector = MlasLoadFloat32x4(&Input[0][ChannelOffset]);
+
+            for (size_t k = 1; k < KernelSize; k++) {
+                MaximumVector = MlasMaximumFloat32x4(MaximumVector, MlasLoadFloat32x4(&Input[k][ChannelOffset]));
+            }
+
+            MlasStoreFloat32x4(&Output[0], MaximumVector);
+            Output += 4;
+
+            ChannelOffset += 4;
+            c -= 4;
+        }
+
+        while (c > 0) {
+
+            float MaximumValue = Input[0][ChannelOffset];
+
+            for (size_t k = 1; k < KernelSize; k++) {
+                MaximumValue = std::max(MaximumValue, Input[k][ChannelOffset]);
+            }
+
+            *Output++ = MaximumValue;
+
+            ChannelOffset += 1;
+            c -= 1;
+        }
+
+        Input += KernelSize;
+        OutputCount -= 1;
+    }
+}
+
+void
+MLASCALL
+MlasAveragePoolNhwc(
+    const float* const* Input,
+    const float* PaddingVector,
+    bool CountIncludePad,
+    float* Output,
+    size_t Channels,
+    size_t OutputCount,
+    size_t KernelSize
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the average pooling operation for single precision
+    floating point elements in channels last format.
+
+    The input is supplied as an indirection buffer as for MlasMaximumPoolNhwc.
+
+Arguments:
+
+    Input - Supplies an indirection buffer to the elements of the input tensor.
+
+    PaddingVector - Supplies the vector of zeros the indirection buffer points
+        at for the padding elements.
+
+    CountIncludePad - Supplies true if the padding elements are counted in the
+        divisor of the average, else the divisor of an output is the number of
+        its kernel elements that are not padding.
+
+    Output - Supplies the output tensor in channels last format.
+
+    Channels - Supplies the number of channels.
+
+    OutputCount - Supplies the number of channel sized output elements to
+        produce.
+
+    KernelSize - Supplies the total number of channel sized kernel elements to
+        consume.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (OutputCount > 0) {
+
+        size_t InputCount = KernelSize;
+
+        if (!CountIncludePad) {
+            for (size_t k = 0; k < KernelSize; k++) {
+                if (Input[k] == PaddingVector) {
+                    InputCount--;
+                }
+            }
+        }
+
+        const float Scale = (InputCount > 0) ? 1.0f / float(InputCount) : 0.0f;
+        const MLAS_FLOAT32X4 ScaleVector = MlasBroadcastFloat32x4(Scale);
+
+        size_t ChannelOffset = 0;
+        size_t c = Channels;
+
+        while (c >= 8) {
+
+            MLAS_FLOAT32X4 SumVector0 = MlasZeroFloat32x4();
+            MLAS_FLOAT32X4 SumVector1 = MlasZeroFloat32x4();
+
+            for (size_t k = 0; k < KernelSize; k++) {
+                SumVector0 = MlasAddFloat32x4(SumVector0, MlasLoadFloat32x4(&Input[k][ChannelOffset]));
+                SumVector1 = MlasAddFloat32x4(SumVector1, MlasLoadFloat32x4(&Input[k][ChannelOffset + 4]));
+            }
+
+            MlasStoreFloat32x4(&Output[0], MlasMultiplyFloat32x4(SumVector0, ScaleVector));
+            MlasStoreFloat32x4(&Output[4], MlasMultiplyFloat32x4(SumVector1, ScaleVector));
+            Output += 8;
+
+            ChannelOffset += 8;
+            c -= 8;
+        }
+
+        if (c >= 4) {
+
+            MLAS_FLOAT32X4 SumVector = MlasZeroFloat32x4();
+
+            for (size_t k = 0; k < KernelSize; k++) {
+                SumVector = MlasAddFloat32x4(SumVector, MlasLoadFloat32x4(&Input[k][ChannelOffset]));
+            }
+
+            MlasStoreFloat32x4(&Output[0], MlasMultiplyFloat32x4(SumVector, ScaleVector));
+            Output += 4;
+
+            ChannelOffset += 4;
+            c -= 4;
+        }
+
+        while (c > 0) {
+
+            float Sum = 0.0f;
+
+            for (size_t k = 0; k < KernelSize; k++) {
+                Sum += Input[k][ChannelOffset];
+            }
+
+            *Output++ = Sum * Scale;
+
+            ChannelOffset += 1;
+            c -= 1;
+        }
+
+        Input += KernelSize;
+        OutputCount -= 1;
+    }
+}
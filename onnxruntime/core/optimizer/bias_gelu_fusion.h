@@ -18,6 +18,8 @@ class BiasGeluFusion : public GraphTransformer {
   }
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  std::vector<std::string> TargetOpTypes() const override { return {"Gelu", "FastGelu"}; }
 };
 
 }  // namespace onnxruntime
@@ -1,7 +1,10 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
+#include <chrono>
 #include <limits>
+#include <map>
 
 #include "core/optimizer/constant_folding.h"
 #include "core/optimizer/utils.h"
@@ -9,6 +12,7 @@
 #include "core/optimizer/optimizer_execution_frame.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/tensorprotoutils.h"
+#include "core/platform/threadpool.h"
 
 using namespace onnxruntime::common;
 
@@ -18,12 +22,92 @@ ConstantFolding::ConstantFolding(const IExecutionProvider& execution_provider,
                                  bool skip_dequantize_linear,
                                  const InlinedHashSet<std::string_view>& compatible_execution_providers,
                                  const InlinedHashSet<std::string>& excluded_initializers) noexcept
+    : ConstantFolding(execution_provider, skip_dequantize_linear, ConstantFoldingSizeLimits{}, nullptr,
+                      compatible_execution_providers, excluded_initializers) {
+}
+
+ConstantFolding::ConstantFolding(const IExecutionProvider& execution_provider,
+                                 bool skip_dequantize_linear,
+                                 const ConstantFoldingSizeLimits& size_limits,
+                                 concurrency::ThreadPool* thread_pool,
+                                 const InlinedHashSet<std::string_view>& compatible_execution_providers,
+                                 const InlinedHashSet<std::string>& excluded_initializers) noexcept
     : GraphTransformer("ConstantFolding", compatible_execution_providers),
       skip_dequantize_linear_(skip_dequantize_linear),
+      size_limits_(size_limits),
+      thread_pool_(thread_pool),
       excluded_initializers_(excluded_initializers),
       execution_provider_(execution_provider) {
 }
 
+namespace {
+
+// Statistics of the folding of the nodes of an op type, logged once the graph is processed.
+struct FoldingStats {
+  size_t num_folded{0};
+  size_t num_skipped_for_size{0};
+  // total size of the constant inputs and of the outputs of the folded nodes
+  size_t input_bytes{0};
+  size_t output_bytes{0};
+};
+
+// A node with constant inputs, and the kernel and frame information to compute it.
+struct FoldingCandidate {
+  NodeIndex node_index;
+  size_t input_bytes{0};
+  std::unique_ptr<OptimizerExecutionFrame::Info> info;
+  std::unique_ptr<const OpKernel> kernel;
+  std::vector<int> fetch_mlvalue_idxs;
+  std::vector<OrtValue> fetches;
+};
+
+// Size in bytes of the outputs of a node according to their inferred shapes, or -1 if a shape isn't fully known.
+int64_t InferredOutputSizeInBytes(const Node& node) {
+  int64_t size = 0;
+  for (const auto* output : node.OutputDefs()) {
+    if (!output->Exists()) {
+      continue;
+    }
+
+    const auto* type = output->TypeAsProto();
+    const auto* shape = output->Shape();
+    if (type == nullptr || shape == nullptr || !utils::HasTensorType(*type) ||
+        !utils::HasElemType(type->tensor_type())) {
+      return -1;
+    }
+
+    const int64_t num_elements = utils::GetTensorShapeFromTensorShapeProto(*shape).Size();
+    if (num_elements < 0) {
+      return -1;
+    }
+
+    const auto* element_type = DataTypeImpl::TensorTypeFromONNXEnum(type->tensor_type().elem_type())->GetElementType();
+    size += num_elements * static_cast<int64_t>(element_type->Size());
+  }
+
+  return size;
+}
+
+// Compute the node of a candidate. This doesn't access the graph so candidates can be computed concurrently.
+Status ComputeCandidate(FoldingCandidate& candidate, const logging::Logger& logger) {
+  OptimizerExecutionFrame frame(*candidate.info, candidate.fetch_mlvalue_idxs);
+  OpKernelContext op_kernel_context(&frame, candidate.kernel.get(), nullptr, logger);
+  ORT_RETURN_IF_ERROR(candidate.kernel->Compute(&op_kernel_context));
+  return frame.GetOutputs(candidate.fetches);
+}
+
+}  // namespace
+
+bool ConstantFolding::ExceedsSizeLimits(size_t input_bytes, size_t output_bytes) const {
+  if (size_limits_.max_output_size_in_bytes > 0 && output_bytes > size_limits_.max_output_size_in_bytes) {
+    return true;
+  }
+
+  return size_limits_.max_output_to_input_size_ratio > 0.0f &&
+         static_cast<double>(output_bytes) >
+             static_cast<double>(size_limits_.max_output_to_input_size_ratio) * static_cast<double>(input_bytes);
+}
+
 // We need to handle a Shape node separately as the input doesn't need to be a constant initializer for
 // Shape to be able to be constant folded.
 static bool ConstantFoldShapeNode(Graph& graph, Node& node) {
@@ -90,41 +174,137 @@ static bool ConstantFoldShapeNode(Graph& graph, Node& node) {
 }
 
 Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  const auto start_time = std::chrono::steady_clock::now();
   bool have_updated_nodes = false;
   GraphViewer graph_viewer(graph);
   auto& order = graph_viewer.GetNodesInTopologicalOrder();
 
+  // With a thread pool, the candidates found in a pass over the nodes are computed in parallel once the pass is
+  // done. As they are only computed then, the candidates of a pass don't depend on each other, and the nodes
+  // consuming their outputs are folded in the next pass.
+  // Without one, each candidate is computed and folded when the pass reaches it, so a single pass is needed.
+  const bool parallel = thread_pool_ != nullptr && concurrency::ThreadPool::DegreeOfParallelism(thread_pool_) > 1;
+
+  std::map<std::string, FoldingStats> stats;
+  // nodes with constant inputs which can't be folded, so that later passes don't compute them again
+  InlinedHashSet<NodeIndex> rejected_nodes;
+
 #if !defined(DISABLE_SPARSE_TENSORS)
   std::function<bool(const std::string&)> is_sparse_initializer_check = [&graph](const std::string& name) -> bool {
     return graph.IsSparseInitializer(name);
   };
+#else
+  std::function<bool(const std::string&)> is_sparse_initializer_check = [](const std::string&) { return false; };
 #endif
 
-  for (NodeIndex i : order) {
-    auto* node = graph.GetNode(i);
-    if (!node) {
-      continue;
+  auto remove_folded_node = [&graph, &modified, &have_updated_nodes](Node& node) {
+    // Remove single-output node chain for inputs of the node
+    auto p_ip_node = node.InputNodesBegin();
+    const auto p_ip_node_end = node.InputNodesEnd();
+    while (p_ip_node != p_ip_node_end) {
+      const auto& input_node = *p_ip_node;
+      // Update the node iterator before removing the corresponding node because removing
+      // the node will invalidate the node iterator
+      ++p_ip_node;
+      graph_utils::RemoveNodesWithOneOutputBottomUp(graph, input_node);
     }
 
-    // avoid to constant fold DequantizeLinear for QDQ format
-    if (skip_dequantize_linear_ && node->OpType().compare("DequantizeLinear") == 0) {
-      continue;
+    // Remove the output edges of the constant node and then remove the node itself.
+    graph_utils::RemoveNodeOutputEdges(graph, node);
+    graph.RemoveNode(node.Index());
+    modified = true;
+    have_updated_nodes = true;
+  };
+
+  // Replace the outputs of a computed candidate with initializers and remove its node.
+  // Returns false if the outputs can't be converted to initializers or are too large.
+  auto fold_candidate = [&](FoldingCandidate& candidate) -> bool {
+    Node& node = *graph.GetNode(candidate.node_index);
+    auto& op_stats = stats[node.OpType()];
+    auto& fetches = candidate.fetches;
+
+    // Go over all output node args and substitute them with the newly computed tensors, which will be
+    // added to the graph as initializers.
+    ORT_ENFORCE(fetches.size() == node.OutputDefs().size());
+    size_t output_bytes = 0;
+    for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
+      const auto& constant_arg_out = *node.OutputDefs()[fetch_idx];
+      // XXX: Add support for SparseTensors outputs when we have sparse outputs
+      if (!utils::HasTensorType(*constant_arg_out.TypeAsProto())) {
+        LOGS(logger, INFO) << "Unsupported output type of " << constant_arg_out.Type()
+                           << ". Can't constant fold " << node.OpType() << " node '" << node.Name() << "'";
+        return false;
+      }
+      output_bytes += fetches[fetch_idx].Get<Tensor>().SizeInBytes();
+    }
+
+    if (ExceedsSizeLimits(candidate.input_bytes, output_bytes)) {
+      LOGS(logger, VERBOSE) << "Not constant folding " << node.OpType() << " node '" << node.Name() << "' as its "
+                            << output_bytes << " bytes of outputs exceed the size limits";
+      ++op_stats.num_skipped_for_size;
+      return false;
     }
 
-    ORT_RETURN_IF_ERROR(Recurse(*node, modified, graph_level, logger));
+    for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
+      OrtValue& ort_value = fetches[fetch_idx];
+      // Build the TensorProto that corresponds to the computed OrtValue and add it as initializer to the graph.
+      auto* constant_arg_out = node.MutableOutputDefs()[fetch_idx];
+      const Tensor& out_tensor = ort_value.Get<Tensor>();
+      ONNX_NAMESPACE::TensorProto out_tensorproto = utils::TensorToTensorProto(out_tensor, constant_arg_out->Name());
+
+      ONNX_NAMESPACE::TensorShapeProto result_shape;
+      for (auto& dim : out_tensor.Shape().GetDims()) {
+        result_shape.add_dim()->set_dim_value(dim);
+      }
 
-    // Updating a node may allow shape inferencing to infer output shapes of following nodes,
-    // so re-run the shape inferencing. use have_updated_nodes as that only applies to this Graph
-    // (vs. 'modified' which is passed into subgraphs and applies to the main graph and all subgraphs)
-    // Ignore any control flow node containing subgraphs as UpdateShapeInference is not intended to be used on it.
-    if (have_updated_nodes && !node->ContainsSubgraph()) {
-      ORT_RETURN_IF_ERROR(graph.UpdateShapeInference(*node));
+      constant_arg_out->SetShape(result_shape);
+      graph.AddInitializedTensor(out_tensorproto);
     }
 
-    bool converted_to_constant = false;
-    if (node->OpType().compare("Shape") == 0) {
-      converted_to_constant = ConstantFoldShapeNode(graph, *node);
-    } else {
+    ++op_stats.num_folded;
+    op_stats.input_bytes += candidate.input_bytes;
+    op_stats.output_bytes += output_bytes;
+    remove_folded_node(node);
+    return true;
+  };
+
+  bool first_pass = true;
+  bool folded_candidates = true;
+  while (folded_candidates) {
+    folded_candidates = false;
+    std::vector<FoldingCandidate> candidates;
+
+    for (NodeIndex i : order) {
+      auto* node = graph.GetNode(i);
+      if (!node || rejected_nodes.count(i) > 0) {
+        continue;
+      }
+
+      // avoid to constant fold DequantizeLinear for QDQ format
+      if (skip_dequantize_linear_ && node->OpType().compare("DequantizeLinear") == 0) {
+        continue;
+      }
+
+      if (first_pass) {
+        ORT_RETURN_IF_ERROR(Recurse(*node, modified, graph_level, logger));
+      }
+
+      // Updating a node may allow shape inferencing to infer output shapes of following nodes,
+      // so re-run the shape inferencing. use have_updated_nodes as that only applies to this Graph
+      // (vs. 'modified' which is passed into subgraphs and applies to the main graph and all subgraphs)
+      // Ignore any control flow node containing subgraphs as UpdateShapeInference is not intended to be used on it.
+      if (have_updated_nodes && !node->ContainsSubgraph()) {
+        ORT_RETURN_IF_ERROR(graph.UpdateShapeInference(*node));
+      }
+
+      if (node->OpType().compare("Shape") == 0) {
+        if (ConstantFoldShapeNode(graph, *node)) {
+          ++stats[node->OpType()].num_folded;
+          remove_folded_node(*node);
+        }
+        continue;
+      }
+
       InitializedTensorSet constant_inputs;
 
       // we currently constant fold using the CPU EP only.
@@ -148,19 +328,32 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         continue;
       }
 
-#if !defined(DISABLE_SPARSE_TENSORS)
-      // Create execution frame for executing constant nodes.
-      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_,
-                                         is_sparse_initializer_check);
-#else
+      FoldingCandidate candidate;
+      candidate.node_index = i;
+      for (const auto& constant_input : constant_inputs) {
+        size_t input_bytes = 0;
+        ORT_RETURN_IF_ERROR(utils::GetSizeInBytesFromTensorProto<0>(*constant_input.second, &input_bytes));
+        candidate.input_bytes += input_bytes;
+      }
+
+      // skip the nodes known to be too large from their inferred shapes without computing them
+      const int64_t inferred_output_bytes = InferredOutputSizeInBytes(*node);
+      if (inferred_output_bytes >= 0 &&
+          ExceedsSizeLimits(candidate.input_bytes, static_cast<size_t>(inferred_output_bytes))) {
+        LOGS(logger, VERBOSE) << "Not constant folding " << node->OpType() << " node '" << node->Name()
+                              << "' as its " << inferred_output_bytes << " bytes of outputs exceed the size limits";
+        ++stats[node->OpType()].num_skipped_for_size;
+        rejected_nodes.insert(i);
+        continue;
+      }
+
       // Create execution frame for executing constant nodes.
-      OptimizerExecutionFrame::Info info({node}, constant_inputs, graph.ModelPath(), execution_provider_,
-                                         [](std::string const&) { return false; });
-#endif
+      candidate.info = std::make_unique<OptimizerExecutionFrame::Info>(
+          std::vector<const Node*>{node}, constant_inputs, graph.ModelPath(), execution_provider_,
+          is_sparse_initializer_check);
 
-      std::vector<int> fetch_mlvalue_idxs;
       for (const auto* node_out : node->OutputDefs()) {
-        fetch_mlvalue_idxs.push_back(info.GetMLValueIndex(node_out->Name()));
+        candidate.fetch_mlvalue_idxs.push_back(candidate.info->GetMLValueIndex(node_out->Name()));
       }
 
       // override the EP assigned to the node so that it will use the CPU kernel for Compute.
@@ -168,80 +361,69 @@ Status ConstantFolding::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         node->SetExecutionProviderType(kCpuExecutionProvider);
       }
 
-      auto kernel = info.CreateKernel(node);
+      candidate.kernel = candidate.info->CreateKernel(node);
 
       // undo the EP change to the value that was assigned at graph partitioning time
       if (!cpu_ep) {
         node->SetExecutionProviderType(ep_type);
       }
 
-      if (kernel == nullptr) {
+      if (candidate.kernel == nullptr) {
         LOGS(logger, WARNING) << "Could not find a CPU kernel and hence "
                               << "can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
 
         // Move on to the next candidate node
+        rejected_nodes.insert(i);
         continue;
       }
 
-      OptimizerExecutionFrame frame(info, fetch_mlvalue_idxs);
-
-      OpKernelContext op_kernel_context(&frame, kernel.get(), nullptr, logger);
-      ORT_RETURN_IF_ERROR(kernel->Compute(&op_kernel_context));
-
-      std::vector<OrtValue> fetches;
-      ORT_RETURN_IF_ERROR(frame.GetOutputs(fetches));
-
-      // Go over all output node args and substitute them with the newly computed tensors, which will be
-      // added to the graph as initializers.
-      ORT_ENFORCE(fetches.size() == node->OutputDefs().size());
-      converted_to_constant = true;
-      for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
-        const auto& constant_arg_out = *node->OutputDefs()[fetch_idx];
-        // XXX: Add support for SparseTensors outputs when we have sparse outputs
-        if (!utils::HasTensorType(*constant_arg_out.TypeAsProto())) {
-          LOGS(logger, INFO) << "Unsupported output type of " << constant_arg_out.Type()
-                             << ". Can't constant fold " << node->OpType() << " node '" << node->Name() << "'";
-          converted_to_constant = false;
-          break;
+      if (parallel) {
+        candidates.push_back(std::move(candidate));
+      } else {
+        ORT_RETURN_IF_ERROR(ComputeCandidate(candidate, logger));
+        if (!fold_candidate(candidate)) {
+          rejected_nodes.insert(i);
         }
       }
+    }
 
-      if (converted_to_constant) {
-        for (size_t fetch_idx = 0; fetch_idx < fetches.size(); ++fetch_idx) {
-          OrtValue& ort_value = fetches[fetch_idx];
-          // Build the TensorProto that corresponds to the computed OrtValue and add it as initializer to the graph.
-          auto* constant_arg_out = node->MutableOutputDefs()[fetch_idx];
-          const Tensor& out_tensor = ort_value.Get<Tensor>();
-          ONNX_NAMESPACE::TensorProto out_tensorproto = utils::TensorToTensorProto(out_tensor, constant_arg_out->Name());
-
-          ONNX_NAMESPACE::TensorShapeProto result_shape;
-          for (auto& dim : out_tensor.Shape().GetDims()) {
-            result_shape.add_dim()->set_dim_value(dim);
-          }
-
-          constant_arg_out->SetShape(result_shape);
-          graph.AddInitializedTensor(out_tensorproto);
+    // a candidate producing the input of a Shape node folded later in the pass may have been removed with it
+    candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                    [&graph](const FoldingCandidate& candidate) {
+                                      return graph.GetNode(candidate.node_index) == nullptr;
+                                    }),
+                     candidates.end());
+
+    if (!candidates.empty()) {
+      std::vector<Status> statuses(candidates.size());
+      concurrency::ThreadPool::TrySimpleParallelFor(
+          thread_pool_, static_cast<std::ptrdiff_t>(candidates.size()),
+          [&candidates, &statuses, &logger](std::ptrdiff_t idx) {
+            statuses[idx] = ComputeCandidate(candidates[idx], logger);
+          });
+
+      for (size_t idx = 0; idx < candidates.size(); ++idx) {
+        ORT_RETURN_IF_ERROR(statuses[idx]);
+        if (fold_candidate(candidates[idx])) {
+          folded_candidates = true;
+        } else {
+          rejected_nodes.insert(candidates[idx].node_index);
         }
       }
     }
 
-    if (converted_to_constant) {
-      // Remove single-output node chain for inputs of the node
-      auto p_ip_node = node->InputNodesBegin();
-      const auto p_ip_node_end = node->InputNodesEnd();
-      while (p_ip_node != p_ip_node_end) {
-        const auto& input_node = *p_ip_node;
-        // Update the node iterator before removing the corresponding node because removing
-        // the node will invalidate the node iterator
-        ++p_ip_node;
-        graph_utils::RemoveNodesWithOneOutputBottomUp(graph, input_node);
-      }
-
-      // Remove the output edges of the constant node and then remove the node itself.
-      graph_utils::RemoveNodeOutputEdges(graph, *node);
-      graph.RemoveNode(node->Index());
-      modified = true;
-      have_updated_nodes = true;
+    first_pass = false;
+  }
+
+  if (!stats.empty()) {
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_time);
+    LOGS(logger, INFO) << "Constant folding of graph '" << graph.Name() << "' took " << elapsed.count() << " us";
+    for (const auto& entry : stats) {
+      const FoldingStats& op_stats = entry.second;
+      LOGS(logger, INFO) << "  " << entry.first << ": folded " << op_stats.num_folded << " nodes, skipped "
+                         << op_stats.num_skipped_for_size << " exceeding the size limits, initializer bytes "
+                         << op_stats.output_bytes << " added for " << op_stats.input_bytes << " of constant inputs";
     }
   }
 
@@ -10,6 +10,22 @@
 
 namespace onnxruntime {
 
+namespace concurrency {
+class ThreadPool;
+}
+
+/**
+Limits on the size of the initializers created by constant folding, so that folding doesn't replace a small
+constant and the node expanding it (e.g. Expand or Tile) with a much larger initializer. A node is not folded if the
+size of its outputs exceeds one of the limits. A limit of 0 is not enforced.
+*/
+struct ConstantFoldingSizeLimits {
+  // maximum ratio of the size of the outputs of a node to the size of its constant inputs
+  float max_output_to_input_size_ratio{0.0f};
+  // maximum size in bytes of the outputs of a node
+  size_t max_output_size_in_bytes{0};
+};
+
 /**
 @class ConstantFolding
 
@@ -27,10 +43,25 @@ class ConstantFolding : public GraphTransformer {
                   const InlinedHashSet<std::string_view>& compatible_execution_providers = {},
                   const InlinedHashSet<std::string>& excluded_initializers = {}) noexcept;
 
+  /*! \param size_limits Limits on the size of the outputs of the nodes to fold.
+      \param thread_pool If not null, the nodes which only depend on initializers are evaluated in parallel on it,
+      and the nodes depending on them in the following passes.
+  */
+  ConstantFolding(const IExecutionProvider& execution_provider,
+                  bool skip_dequantize_linear,
+                  const ConstantFoldingSizeLimits& size_limits,
+                  concurrency::ThreadPool* thread_pool,
+                  const InlinedHashSet<std::string_view>& compatible_execution_providers = {},
+                  const InlinedHashSet<std::string>& excluded_initializers = {}) noexcept;
+
  private:
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
 
+  bool ExceedsSizeLimits(size_t input_bytes, size_t output_bytes) const;
+
   bool skip_dequantize_linear_;
+  const ConstantFoldingSizeLimits size_limits_;
+  concurrency::ThreadPool* const thread_pool_;
   const InlinedHashSet<std::string> excluded_initializers_;
   const IExecutionProvider& execution_provider_;
 };
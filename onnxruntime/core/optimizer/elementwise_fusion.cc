@@ -0,0 +1,239 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/elementwise_fusion.h"
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// The FusedElementwise kernel only supports float.
+constexpr std::array supported_data_types{"tensor(float)"};
+
+bool IsUnaryElementwise(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Abs", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Ceil", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Erf", {9, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Exp", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Floor", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Log", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Neg", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Reciprocal", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Relu", {6, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sigmoid", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sqrt", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Tanh", {6, 13});
+}
+
+bool IsBinaryElementwise(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Add", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sub", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7, 13, 14}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Div", {7, 13, 14});
+}
+
+bool IsCandidate(const Node& node, const InlinedHashSet<std::string_view>& compatible_providers) {
+  if (!(IsUnaryElementwise(node) || IsBinaryElementwise(node)) ||
+      !graph_utils::IsSupportedProvider(node, compatible_providers) ||
+      !optimizer_utils::IsSupportedDataType(node, supported_data_types)) {
+    return false;
+  }
+
+  // leave the outputs of convolutions to the Conv fusions of the higher optimization levels, which fold activations
+  // and residual Adds into the Conv itself
+  for (auto it = node.InputNodesBegin(), end = node.InputNodesEnd(); it != end; ++it) {
+    if (it->OpType() == "Conv" || it->OpType() == "FusedConv") {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Check that broadcasting 'operand' to 'shape' repeats it along the leading dimensions only, i.e. that it is a scalar
+// or that it has the same shape as the trailing dimensions of 'shape' once its leading dimensions of size 1 are
+// removed. The result of the binary operator then has 'shape' and 'operand' is indexed by the flat offset modulo its
+// size, which is what FusedElementwise supports.
+bool IsSuffixBroadcast(const TensorShapeProto& shape, const NodeArg& operand) {
+  const TensorShapeProto* operand_shape = operand.Shape();
+  if (operand_shape == nullptr || operand_shape->dim_size() > shape.dim_size()) {
+    return false;
+  }
+
+  const int rank = shape.dim_size();
+  const int operand_rank = operand_shape->dim_size();
+  int first = 0;
+  while (first < operand_rank && utils::HasDimValue(operand_shape->dim(first)) &&
+         operand_shape->dim(first).dim_value() == 1) {
+    ++first;
+  }
+
+  for (int i = first; i < operand_rank; ++i) {
+    const auto& operand_dim = operand_shape->dim(i);
+    const auto& dim = shape.dim(rank - operand_rank + i);
+    const bool same_value = utils::HasDimValue(operand_dim) && utils::HasDimValue(dim) &&
+                            operand_dim.dim_value() == dim.dim_value();
+    const bool same_param = utils::HasDimParam(operand_dim) && utils::HasDimParam(dim) &&
+                            operand_dim.dim_param() == dim.dim_param();
+    if (!same_value && !same_param) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+struct ChainStep {
+  Node* node;
+  int chain_input_index;  // input of the node that is the chain value
+};
+
+// Name of the FusedElementwise step for a node, which is swapped for the non-commutative binary operators when the
+// chain value is their second argument.
+std::string StepOp(const ChainStep& step) {
+  const auto& op_type = step.node->OpType();
+  if (step.chain_input_index == 1) {
+    if (op_type == "Sub") {
+      return "RSub";
+    }
+    if (op_type == "Div") {
+      return "RDiv";
+    }
+  }
+
+  return op_type;
+}
+
+}  // namespace
+
+Status ElementwiseFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!IsCandidate(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    // the chain value starts as the input of a unary operator, or the argument of a binary operator the other
+    // argument broadcasts to
+    const auto& input_defs = node.InputDefs();
+    int chain_input_index = -1;
+    for (int i = 0, end = static_cast<int>(input_defs.size()); i < end && chain_input_index < 0; ++i) {
+      const TensorShapeProto* shape = input_defs[i]->Shape();
+      if (shape != nullptr && (end == 1 || IsSuffixBroadcast(*shape, *input_defs[1 - i]))) {
+        chain_input_index = i;
+      }
+    }
+
+    if (chain_input_index < 0) {
+      continue;
+    }
+
+    NodeArg* chain_input = node.MutableInputDefs()[chain_input_index];
+    const TensorShapeProto& shape = *chain_input->Shape();
+
+    // extend the chain while the chain value is only consumed by the next element-wise operator
+    InlinedVector<ChainStep> steps{{&node, chain_input_index}};
+    Node* last = &node;
+    while (optimizer_utils::CheckOutputEdges(graph, *last, 1)) {
+      Node& next = *graph.GetNode(last->OutputNodesBegin()->Index());
+      if (next.GetExecutionProviderType() != node.GetExecutionProviderType() ||
+          !IsCandidate(next, GetCompatibleExecutionProviders())) {
+        break;
+      }
+
+      const NodeArg* chain_value = last->OutputDefs()[0];
+      const int next_chain_input_index = optimizer_utils::IndexOfNodeInput(next, *chain_value);
+      if (next.InputDefs().size() == 2) {
+        const NodeArg* operand = next.InputDefs()[1 - next_chain_input_index];
+        if (operand == chain_value || !IsSuffixBroadcast(shape, *operand)) {
+          break;
+        }
+      }
+
+      steps.push_back({&next, next_chain_input_index});
+      last = &next;
+    }
+
+    if (steps.size() < 2) {
+      continue;
+    }
+
+    // the other arguments of the binary steps become the inputs following the chain input, each one only once
+    InlinedVector<NodeArg*> fused_inputs{chain_input};
+    std::vector<std::string> ops;
+    std::vector<int64_t> operands;
+    for (const auto& step : steps) {
+      ops.push_back(StepOp(step));
+      if (step.node->InputDefs().size() == 1) {
+        operands.push_back(-1);
+        continue;
+      }
+
+      NodeArg* operand = step.node->MutableInputDefs()[1 - step.chain_input_index];
+      auto it = std::find(fused_inputs.begin(), fused_inputs.end(), operand);
+      if (it == fused_inputs.end()) {
+        it = fused_inputs.insert(fused_inputs.end(), operand);
+      }
+
+      operands.push_back(static_cast<int64_t>(it - fused_inputs.begin()));
+    }
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("FusedElementwise"),
+                                     "FusedElementwise",
+                                     "fused element-wise chain",
+                                     fused_inputs,
+                                     {},
+                                     nullptr,
+                                     kMSDomain);
+    fused_node.AddAttribute("ops", ops);
+    fused_node.AddAttribute("operands", operands);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    fused_node.SetExecutionProviderType(node.GetExecutionProviderType());
+
+    // FinalizeNodeFusion only moves the input edges of the first node, so connect the producers of the other
+    // arguments of the later steps here
+    InlinedVector<std::reference_wrapper<Node>> nodes_to_fuse;
+    for (const auto& step : steps) {
+      nodes_to_fuse.push_back(*step.node);
+      if (step.node == &node) {
+        continue;
+      }
+
+      for (auto it = step.node->InputEdgesBegin(), end = step.node->InputEdgesEnd(); it != end; ++it) {
+        const auto& src_arg = it->GetNode().OutputDefs()[it->GetSrcArgIndex()];
+        if (it->GetDstArgIndex() != step.chain_input_index) {
+          graph.AddEdge(it->GetNode().Index(), fused_node.Index(), it->GetSrcArgIndex(),
+                        graph_utils::GetNodeInputIndexFromInputName(fused_node, src_arg->Name()));
+        }
+      }
+    }
+
+    graph_utils::FinalizeNodeFusion(graph, nodes_to_fuse, fused_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/embedding_bag_fusion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// Gather of the rows of a 2-D float table with 2-D integer indices, so that each row of indices is a bag.
+bool IsSupportedGather(const Node& gather) {
+  if (!graph_utils::IsSupportedOptypeVersionAndDomain(gather, "Gather", {1, 11, 13})) {
+    return false;
+  }
+
+  const auto* axis = graph_utils::GetNodeAttribute(gather, "axis");
+  if (axis != nullptr && axis->i() != 0) {
+    return false;
+  }
+
+  const NodeArg& data = *gather.InputDefs()[0];
+  const NodeArg& indices = *gather.InputDefs()[1];
+  if (data.Type() == nullptr || *data.Type() != "tensor(float)" || indices.Type() == nullptr ||
+      (*indices.Type() != "tensor(int32)" && *indices.Type() != "tensor(int64)")) {
+    return false;
+  }
+
+  return data.Shape() != nullptr && data.Shape()->dim_size() == 2 &&
+         indices.Shape() != nullptr && indices.Shape()->dim_size() == 2;
+}
+
+// ReduceSum or ReduceMean of axis 1 of the [num_bags, bag_size, embedding_dim] gathered rows, without keeping it.
+// Returns the mode of the EmbeddingBag, or nullptr.
+const char* GetReductionMode(const Graph& graph, const Node& reduction) {
+  const char* mode = nullptr;
+  if (graph_utils::IsSupportedOptypeVersionAndDomain(reduction, "ReduceSum", {1, 11, 13})) {
+    mode = "sum";
+  } else if (graph_utils::IsSupportedOptypeVersionAndDomain(reduction, "ReduceMean", {1, 11, 13})) {
+    mode = "mean";
+  } else {
+    return nullptr;
+  }
+
+  // keepdims is 1 by default
+  if (!optimizer_utils::IsAttributeWithExpectedValue(reduction, "keepdims", static_cast<int64_t>(0))) {
+    return nullptr;
+  }
+
+  // the axes of ReduceSum are an input since opset 13
+  InlinedVector<int64_t> axes;
+  const auto& input_defs = reduction.InputDefs();
+  if (input_defs.size() > 1 && input_defs[1]->Exists()) {
+    if (!optimizer_utils::AppendTensorFromInitializer(graph, *input_defs[1], axes)) {
+      return nullptr;
+    }
+  } else if (const auto* axes_attr = graph_utils::GetNodeAttribute(reduction, "axes"); axes_attr != nullptr) {
+    axes.assign(axes_attr->ints().begin(), axes_attr->ints().end());
+  }
+
+  return axes.size() == 1 && (axes[0] == 1 || axes[0] == -2) ? mode : nullptr;
+}
+
+}  // namespace
+
+Status EmbeddingBagFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                     const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& gather = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(gather, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedProvider(gather, GetCompatibleExecutionProviders()) ||
+        !IsSupportedGather(gather) ||
+        !optimizer_utils::CheckOutputEdges(graph, gather, 1)) {
+      continue;
+    }
+
+    Node& reduction = *graph.GetNode(gather.OutputNodesBegin()->Index());
+    if (reduction.GetExecutionProviderType() != gather.GetExecutionProviderType() ||
+        reduction.InputDefs()[0] != gather.OutputDefs()[0]) {
+      continue;
+    }
+
+    const char* mode = GetReductionMode(graph, reduction);
+    if (mode == nullptr) {
+      continue;
+    }
+
+    const auto& gather_inputs = gather.MutableInputDefs();
+    Node& embedding_bag = graph.AddNode(graph.GenerateNodeName("EmbeddingBag"),
+                                        "EmbeddingBag",
+                                        "fused embedding bag",
+                                        {gather_inputs[0], gather_inputs[1]},
+                                        {},
+                                        nullptr,
+                                        kMSDomain);
+    embedding_bag.AddAttribute("mode", std::string(mode));
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    embedding_bag.SetExecutionProviderType(gather.GetExecutionProviderType());
+
+    graph_utils::FinalizeNodeFusion(graph, {gather, reduction}, embedding_bag);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
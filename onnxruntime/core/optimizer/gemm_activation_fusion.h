@@ -13,6 +13,8 @@ class GemmActivationFusion : public GraphTransformer {
       : GraphTransformer("GemmActivationFusion", compatible_execution_providers) {}
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  std::vector<std::string> TargetOpTypes() const override { return {"Gemm"}; }
 };
 
 }  // namespace onnxruntime
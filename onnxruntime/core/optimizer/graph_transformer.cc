@@ -25,4 +25,17 @@ Status GraphTransformer::Apply(Graph& graph, bool& modified, const logging::Logg
   return status;
 }
 
+Status GraphTransformer::ApplyToNodes(Graph& graph, const InlinedHashSet<NodeIndex>& nodes, bool& modified,
+                                      const logging::Logger& logger) const {
+  ORT_RETURN_IF_ERROR(ApplyToNodesImpl(graph, nodes, modified, logger));
+
+#if !defined(ORT_MINIMAL_BUILD)
+  if (modified) {
+    ORT_RETURN_IF_ERROR(graph.Resolve());
+  }
+#endif
+
+  return Status::OK();
+}
+
 }  // namespace onnxruntime
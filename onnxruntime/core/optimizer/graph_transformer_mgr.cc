@@ -2,6 +2,9 @@
 // Licensed under the MIT License.
 
 #include "core/optimizer/graph_transformer_mgr.h"
+
+#include <algorithm>
+
 #include "core/optimizer/rule_based_graph_transformer.h"
 
 using namespace onnxruntime;
@@ -9,6 +12,39 @@ using namespace ::onnxruntime::common;
 
 namespace onnxruntime {
 
+namespace {
+
+void CollectOpTypes(const Graph& graph, InlinedHashSet<std::string>& op_types) {
+  for (const auto& node : graph.Nodes()) {
+    op_types.insert(node.OpType());
+    for (const auto& subgraph : node.GetSubgraphs()) {
+      CollectOpTypes(*subgraph, op_types);
+    }
+  }
+}
+
+#if !defined(ORT_MINIMAL_BUILD)
+// Collect the nodes which changed, or whose inputs changed, since the given Resolve of the graph, and their producers
+// and consumers.
+void CollectNodesChangedSince(const Graph& graph, int resolve, InlinedHashSet<NodeIndex>& nodes) {
+  for (const auto& node : graph.Nodes()) {
+    if (node.LastInferencingResolve() <= resolve) {
+      continue;
+    }
+
+    nodes.insert(node.Index());
+    for (auto it = node.InputNodesBegin(), end = node.InputNodesEnd(); it != end; ++it) {
+      nodes.insert(it->Index());
+    }
+    for (auto it = node.OutputNodesBegin(), end = node.OutputNodesEnd(); it != end; ++it) {
+      nodes.insert(it->Index());
+    }
+  }
+}
+#endif
+
+}  // namespace
+
 common::Status GraphTransformerManager::SetSteps(unsigned steps) {
   steps_ = steps;
   return Status::OK();
@@ -25,14 +61,83 @@ common::Status GraphTransformerManager::ApplyTransformers(Graph& graph, Transfor
     return Status::OK();
   }
 
+  struct TransformerState {
+    std::vector<std::string> target_op_types;
+    // number of modifications of the graph when the transformer was last applied without modifying it, or -1
+    int64_t unmodified_at = -1;
+    // Graph::NumResolves before the transformer was last applied, or -1
+    int applied_at_resolve = -1;
+  };
+
+  InlinedVector<TransformerState> states(transformers->second.size());
+  for (size_t i = 0; i < states.size(); ++i) {
+    states[i].target_op_types = transformers->second[i]->TargetOpTypes();
+  }
+
+#if !defined(ORT_MINIMAL_BUILD)
+  if (incremental_) {
+    // the nodes around the changes are found from the nodes the Resolve calls re-inferred
+    graph.SetIncrementalResolve(true);
+  }
+#endif
+
+  int64_t num_modifications = 0;
+  // op types of the graph and its subgraphs, collected when needed after the last modification
+  InlinedHashSet<std::string> op_types;
+  bool op_types_valid = false;
+
   for (unsigned step = 0; step < steps_; ++step) {
     bool graph_changed = false;
-    for (const auto& transformer : transformers->second) {
+    for (size_t i = 0; i < states.size(); ++i) {
+      const auto& transformer = transformers->second[i];
+      auto& state = states[i];
       if (step > 0 && transformer->ShouldOnlyApplyOnce())
         continue;
 
+      if (incremental_) {
+        // applying it again to the same graph would not modify it either
+        if (state.unmodified_at == num_modifications) {
+          continue;
+        }
+
+        if (!state.target_op_types.empty()) {
+          if (!op_types_valid) {
+            op_types.clear();
+            CollectOpTypes(graph, op_types);
+            op_types_valid = true;
+          }
+
+          if (std::none_of(state.target_op_types.cbegin(), state.target_op_types.cend(),
+                           [&op_types](const std::string& op_type) { return op_types.count(op_type) > 0; })) {
+            state.unmodified_at = num_modifications;
+            continue;
+          }
+        }
+      }
+
       bool modified = false;
+#if !defined(ORT_MINIMAL_BUILD)
+      const int resolves_before = graph.NumResolves();
+      if (incremental_ && state.applied_at_resolve >= 0 && transformer->SupportsApplyToNodes()) {
+        InlinedHashSet<NodeIndex> nodes;
+        CollectNodesChangedSince(graph, state.applied_at_resolve, nodes);
+        ORT_RETURN_IF_ERROR(transformer->ApplyToNodes(graph, nodes, modified, logger));
+      } else {
+        ORT_RETURN_IF_ERROR(transformer->Apply(graph, modified, logger));
+      }
+      state.applied_at_resolve = resolves_before;
+#else
       ORT_RETURN_IF_ERROR(transformer->Apply(graph, modified, logger));
+#endif
+
+      if (modified) {
+        ++num_modifications;
+        op_types_valid = false;
+        state.unmodified_at = -1;
+      } else {
+        state.unmodified_at = num_modifications;
+      }
+
       graph_changed = graph_changed || modified;
     }
     if (!graph_changed) {
@@ -24,6 +24,13 @@ class GraphTransformerManager {
   // Get the maximum number of graph transformation steps
   common::Status GetSteps(unsigned& steps) const;
 
+  // Enable or disable the incremental application of the transformers, disabled by default. When enabled, a
+  // transformer is skipped if the graph hasn't changed since it was last applied without modifying it, or if the graph
+  // has none of its target op types, and the transformers supporting it are only applied to the nodes around the
+  // changes made since they were last applied. The graphs it's applied to are switched to the incremental Resolve
+  // (see Graph::SetIncrementalResolve) and stay so afterwards.
+  void SetIncremental(bool incremental) noexcept { incremental_ = incremental; }
+
   // Register a transformer with a level.
   common::Status Register(std::unique_ptr<GraphTransformer> transformer, TransformerLevel level);
 
@@ -36,6 +43,8 @@ class GraphTransformerManager {
   // maximum number of graph transformation steps
   unsigned steps_;
 
+  bool incremental_ = false;
+
   InlinedHashMap<TransformerLevel, InlinedVector<std::unique_ptr<GraphTransformer>>> level_to_transformer_map_;
   InlinedHashMap<std::string, GraphTransformer*> transformers_info_;
 };
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <variant>
 
+#include "core/common/parse_string.h"
 #include "core/optimizer/conv_activation_fusion.h"
 #include "core/optimizer/nhwc_transformer.h"
 #include "core/optimizer/qdq_transformer/qdq_final_cleanup.h"
@@ -30,7 +31,9 @@
 #include "core/optimizer/div_mul_fusion.h"
 #include "core/optimizer/dropout_elimination.h"
 #include "core/optimizer/dynamic_quantize_matmul_fusion.h"
+#include "core/optimizer/elementwise_fusion.h"
 #include "core/optimizer/embed_layer_norm_fusion.h"
+#include "core/optimizer/embedding_bag_fusion.h"
 #include "core/optimizer/expand_elimination.h"
 #include "core/optimizer/fast_gelu_fusion.h"
 #include "core/optimizer/free_dim_override_transformer.h"
@@ -45,6 +48,7 @@
 #include "core/optimizer/matmul_integer_to_float.h"
 #include "core/optimizer/matmul_scale_fusion.h"
 #include "core/optimizer/matmul_transpose_fusion.h"
+#include "core/optimizer/mel_spectrogram_fusion.h"
 #include "core/optimizer/nchwc_transformer.h"
 #include "core/optimizer/noop_elimination.h"
 #include "core/optimizer/not_where_fusion.h"
@@ -53,6 +57,7 @@
 #include "core/optimizer/qdq_transformer/qdq_s8_to_u8.h"
 #include "core/optimizer/qdq_transformer/relu_quantizelinear.h"
 #include "core/optimizer/relu_clip_fusion.h"
+#include "core/optimizer/rematerialization.h"
 #include "core/optimizer/reshape_fusion.h"
 #include "core/optimizer/rule_based_graph_transformer.h"
 #include "core/optimizer/skip_layer_norm_fusion.h"
@@ -161,7 +166,8 @@ InlinedVector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
     TransformerLevel level,
     const SessionOptions& session_options,
     const IExecutionProvider& cpu_execution_provider, /*required by constant folding*/
-    const InlinedHashSet<std::string>& rules_and_transformers_to_disable) {
+    const InlinedHashSet<std::string>& rules_and_transformers_to_disable,
+    concurrency::ThreadPool* intra_op_thread_pool) {
   InlinedVector<std::unique_ptr<GraphTransformer>> transformers;
   const bool disable_quant_qdq =
       session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsDisableQuantQDQ, "0") == "1";
@@ -180,7 +186,19 @@ InlinedVector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
 
       // no filtering on execution provider for L1 optimizations as they only use official ONNX operators
       transformers.emplace_back(std::make_unique<CommonSubexpressionElimination>());
-      transformers.emplace_back(std::make_unique<ConstantFolding>(cpu_execution_provider, !disable_quant_qdq));
+      ConstantFoldingSizeLimits constant_folding_size_limits;
+      ORT_THROW_IF_ERROR(ParseStringWithClassicLocale(
+          session_options.config_options.GetConfigOrDefault(
+              kOrtSessionOptionsConstantFoldingMaxOutputToInputSizeRatio, "0"),
+          constant_folding_size_limits.max_output_to_input_size_ratio));
+      ORT_THROW_IF_ERROR(ParseStringWithClassicLocale(
+          session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConstantFoldingMaxOutputSizeInBytes, "0"),
+          constant_folding_size_limits.max_output_size_in_bytes));
+      const bool constant_folding_parallel =
+          session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConstantFoldingParallel, "0") == "1";
+      transformers.emplace_back(std::make_unique<ConstantFolding>(
+          cpu_execution_provider, !disable_quant_qdq, constant_folding_size_limits,
+          constant_folding_parallel ? intra_op_thread_pool : nullptr));
       transformers.emplace_back(std::make_unique<MatMulAddFusion>());
       transformers.emplace_back(std::make_unique<ReshapeFusion>());
       transformers.emplace_back(std::make_unique<FreeDimensionOverrideTransformer>(
@@ -205,6 +223,8 @@ InlinedVector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
                                                             QDQIsInt8Allowed() ? "1" : "0") == "1";
       const bool enable_gelu_approximation =
           session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableGeluApproximation, "0") == "1";
+      const bool enable_elementwise_fusion =
+          session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableElementwiseFusion, "0") == "1";
 
       const InlinedHashSet<std::string_view> cuda_rocm_eps = {onnxruntime::kCudaExecutionProvider,
                                                               onnxruntime::kRocmExecutionProvider};
@@ -259,6 +279,14 @@ InlinedVector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
         transformers.emplace_back(std::make_unique<GeluApproximation>(cpu_cuda_rocm_eps));
       }
 
+      transformers.emplace_back(std::make_unique<MelSpectrogramFusion>(cpu_ep));
+      transformers.emplace_back(std::make_unique<EmbeddingBagFusion>(cpu_ep));
+
+      // ElementwiseFusion must run after the fusions above so it only fuses the element-wise chains they leave.
+      if (enable_elementwise_fusion) {
+        transformers.emplace_back(std::make_unique<ElementwiseFusion>(cpu_ep));
+      }
+
 #endif
       // The QDQFinalCleanupTransformer must run AFTER other transformers that fuse Q/DQ nodes. Otherwise, their
       // fusions might be prevented if this one removes a Q/DQ node too early.
@@ -267,12 +295,15 @@ InlinedVector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
 
     case TransformerLevel::Level3: {
 #ifndef DISABLE_CONTRIB_OPS
+      // The float convolutions use either the NCHWc layout or, if enabled, the NHWC layout.
+      const bool enable_nhwc_float_layout =
+          session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsEnableNhwcFloatLayout, "0") == "1";
       // Register the NCHWc layout transformer if supported by the platform.
-      if (MlasNchwcGetBlockSize() > 1) {
+      if (!enable_nhwc_float_layout && MlasNchwcGetBlockSize() > 1) {
         transformers.emplace_back(std::make_unique<NchwcTransformer>());
       }
       auto cpu_allocator = cpu_execution_provider.GetAllocator(0, OrtMemTypeDefault);
-      transformers.emplace_back(std::make_unique<NhwcTransformer>(std::move(cpu_allocator)));
+      transformers.emplace_back(std::make_unique<NhwcTransformer>(std::move(cpu_allocator), enable_nhwc_float_layout));
       // NCHWCtransformer should have a higher priority versus this. Because NCHWCtransformer also do the similiar things
       // of fusion patterns and target on CPU. However, NCHWCtransformer will reorder the layout to nchwc which is only available for
       // x86-64 cpu, not edge cpu like arm. But This tranformer could be used by opencl-ep/cpu-ep. So
@@ -280,6 +311,15 @@ InlinedVector<std::unique_ptr<GraphTransformer>> GenerateTransformers(
       // this PR #6351 implemented similiar fusion-pattern but only for CUDA, and can only fuse conv-add-relu, while we can fuse more activation.
       transformers.emplace_back(std::make_unique<ConvAddActivationFusion>(cpu_ep));
 #endif
+      // The rematerialization estimates the lifetimes for the final graph, so it must run after the other transformers.
+      size_t rematerialization_memory_budget = 0;
+      ORT_THROW_IF_ERROR(ParseStringWithClassicLocale(
+          session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsRematerializationMemoryBudget, "0"),
+          rematerialization_memory_budget));
+      if (rematerialization_memory_budget > 0) {
+        transformers.emplace_back(std::make_unique<Rematerialization>(
+            rematerialization_memory_budget, session_options.execution_order, cpu_ep));
+      }
     } break;
 
     default:
@@ -13,6 +13,8 @@ class MatMulAddFusion : public GraphTransformer {
       : GraphTransformer("MatMulAddFusion", compatible_execution_providers) {}
 
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  std::vector<std::string> TargetOpTypes() const override { return {"MatMul"}; }
 };
 
 }  // namespace onnxruntime
@@ -0,0 +1,195 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/mel_spectrogram_fusion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/initializer.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+namespace {
+
+// The only consumer of the output of 'node', if it runs on the same execution provider.
+Node* GetOnlyConsumer(Graph& graph, const Node& node) {
+  if (!optimizer_utils::CheckOutputEdges(graph, node, 1)) {
+    return nullptr;
+  }
+
+  Node* consumer = graph.GetNode(node.OutputNodesBegin()->Index());
+  if (consumer->GetExecutionProviderType() != node.GetExecutionProviderType()) {
+    return nullptr;
+  }
+
+  return consumer;
+}
+
+// STFT of a real float signal with a window and onesided output. The fused node takes the frame length from the
+// window so a frame_length input must be a constant equal to the window length.
+bool IsSupportedSTFT(const Graph& graph, const Node& stft) {
+  const auto& input_defs = stft.InputDefs();
+  if (input_defs.size() < 3 || !input_defs[2]->Exists() ||
+      *input_defs[0]->Type() != "tensor(float)" || *input_defs[1]->Type() != "tensor(int64)") {
+    return false;
+  }
+
+  const auto* onesided = graph_utils::GetNodeAttribute(stft, "onesided");
+  if (onesided != nullptr && onesided->i() != 1) {
+    return false;
+  }
+
+  const TensorShapeProto* signal_shape = input_defs[0]->Shape();
+  if (signal_shape == nullptr ||
+      !(signal_shape->dim_size() == 2 ||
+        (signal_shape->dim_size() == 3 && utils::HasDimValue(signal_shape->dim(2)) &&
+         signal_shape->dim(2).dim_value() == 1))) {
+    return false;
+  }
+
+  if (input_defs.size() > 3 && input_defs[3]->Exists()) {
+    const TensorShapeProto* window_shape = input_defs[2]->Shape();
+    if (window_shape == nullptr || window_shape->dim_size() != 1 || !utils::HasDimValue(window_shape->dim(0)) ||
+        !graph_utils::IsConstantInitializer(graph, input_defs[3]->Name()) ||
+        !optimizer_utils::IsInitializerWithExpectedValue(graph, *input_defs[3], window_shape->dim(0).dim_value(),
+                                                         true)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Reduction of the (real, imaginary) axis of the STFT output, without keeping it.
+bool IsComplexAxisReduction(const Node& node) {
+  if (!(graph_utils::IsSupportedOptypeVersionAndDomain(node, "ReduceL2", {1, 11, 13}) ||
+        graph_utils::IsSupportedOptypeVersionAndDomain(node, "ReduceSumSquare", {1, 11, 13})) ||
+      !optimizer_utils::IsAttributeWithExpectedValue(node, "keepdims", static_cast<int64_t>(0))) {
+    return false;
+  }
+
+  const auto* axes = graph_utils::GetNodeAttribute(node, "axes");
+  return axes != nullptr && axes->ints_size() == 1 && (axes->ints(0) == -1 || axes->ints(0) == 3);
+}
+
+// Scalar float constant, returned in 'value'.
+bool GetScalarConstant(const Graph& graph, const NodeArg& node_arg, float& value) {
+  if (!optimizer_utils::IsScalar(node_arg)) {
+    return false;
+  }
+
+  const TensorProto* tensor_proto = graph_utils::GetConstantInitializer(graph, node_arg.Name());
+  if (tensor_proto == nullptr || tensor_proto->data_type() != TensorProto_DataType_FLOAT) {
+    return false;
+  }
+
+  Initializer initializer{*tensor_proto, graph.ModelPath()};
+  value = *initializer.data<float>();
+  return true;
+}
+
+}  // namespace
+
+Status MelSpectrogramFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                       const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& stft = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(stft, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(stft, "STFT", {17}) ||
+        !graph_utils::IsSupportedProvider(stft, GetCompatibleExecutionProviders()) ||
+        !IsSupportedSTFT(graph, stft)) {
+      continue;
+    }
+
+    Node* reduction = GetOnlyConsumer(graph, stft);
+    if (reduction == nullptr || !IsComplexAxisReduction(*reduction)) {
+      continue;
+    }
+
+    InlinedVector<std::reference_wrapper<Node>> nodes_to_fuse{stft, *reduction};
+
+    // the magnitude of the frequency bins is ReduceL2, or the square root of their power
+    int64_t power = reduction->OpType() == "ReduceL2" ? 1 : 2;
+    Node* next = GetOnlyConsumer(graph, *reduction);
+    if (next != nullptr && power == 2 && graph_utils::IsSupportedOptypeVersionAndDomain(*next, "Sqrt", {6, 13})) {
+      nodes_to_fuse.push_back(*next);
+      power = 1;
+      next = GetOnlyConsumer(graph, *next);
+    }
+
+    // the spectrogram is the first input of the MatMul with the mel weight matrix
+    if (next == nullptr || !graph_utils::IsSupportedOptypeVersionAndDomain(*next, "MatMul", {1, 9, 13}) ||
+        next->InputDefs()[0] != nodes_to_fuse.back().get().OutputDefs()[0]) {
+      continue;
+    }
+
+    Node& matmul = *next;
+    NodeArg* mel_weight_matrix = matmul.MutableInputDefs()[1];
+    const TensorShapeProto* mel_weight_shape = mel_weight_matrix->Shape();
+    if (mel_weight_shape == nullptr || mel_weight_shape->dim_size() != 2) {
+      continue;
+    }
+
+    nodes_to_fuse.push_back(matmul);
+
+    // log(mel) or log(mel + offset)
+    bool apply_log = false;
+    float log_offset = 0.0f;
+    next = GetOnlyConsumer(graph, matmul);
+    if (next != nullptr && graph_utils::IsSupportedOptypeVersionAndDomain(*next, "Log", {6, 13})) {
+      nodes_to_fuse.push_back(*next);
+      apply_log = true;
+    } else if (next != nullptr && graph_utils::IsSupportedOptypeVersionAndDomain(*next, "Add", {7, 13, 14})) {
+      Node& add = *next;
+      const NodeArg* offset = add.InputDefs()[0] == matmul.OutputDefs()[0] ? add.InputDefs()[1] : add.InputDefs()[0];
+      Node* log = GetOnlyConsumer(graph, add);
+      if (log != nullptr && graph_utils::IsSupportedOptypeVersionAndDomain(*log, "Log", {6, 13}) &&
+          GetScalarConstant(graph, *offset, log_offset)) {
+        nodes_to_fuse.push_back(add);
+        nodes_to_fuse.push_back(*log);
+        apply_log = true;
+      }
+    }
+
+    const auto& stft_inputs = stft.MutableInputDefs();
+    Node& mel_spectrogram = graph.AddNode(graph.GenerateNodeName("MelSpectrogram"),
+                                          "MelSpectrogram",
+                                          "fused mel spectrogram",
+                                          {stft_inputs[0], stft_inputs[1], stft_inputs[2], mel_weight_matrix},
+                                          {},
+                                          nullptr,
+                                          kMSDomain);
+    mel_spectrogram.AddAttribute("power", power);
+    mel_spectrogram.AddAttribute("apply_log", static_cast<int64_t>(apply_log));
+    mel_spectrogram.AddAttribute("log_offset", log_offset);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    mel_spectrogram.SetExecutionProviderType(stft.GetExecutionProviderType());
+
+    // FinalizeNodeFusion only moves the input edges of the STFT, so connect the producer of the mel weight matrix,
+    // e.g. a MelWeightMatrix node that was not constant folded
+    const Node* mel_weight_producer = graph_utils::GetInputNode(matmul, 1);
+    if (mel_weight_producer != nullptr) {
+      const auto* edge = graph_utils::GetInputEdge(matmul, 1);
+      graph.AddEdge(mel_weight_producer->Index(), mel_spectrogram.Index(), edge->GetSrcArgIndex(), 3);
+    }
+
+    graph_utils::FinalizeNodeFusion(graph, nodes_to_fuse, mel_spectrogram);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
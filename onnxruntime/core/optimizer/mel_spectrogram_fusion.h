@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class MelSpectrogramFusion
+Fuse the mel spectrogram front end of speech models into a single MelSpectrogram node:
+STFT -> ReduceL2 or ReduceSumSquare [-> Sqrt] over the last axis -> MatMul with the mel weight matrix
+[-> Add of a scalar constant] [-> Log].
+The STFT must have a real signal, a window and onesided output.
+*/
+class MelSpectrogramFusion : public GraphTransformer {
+ public:
+  MelSpectrogramFusion(const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("MelSpectrogramFusion", compatible_execution_providers) {
+  }
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
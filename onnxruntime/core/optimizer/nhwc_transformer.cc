@@ -14,6 +14,53 @@ using namespace onnx_layout_transformation;
 
 namespace onnxruntime {
 
+// Returns the since version of the kMSInternalNHWCDomain kernel a float node of the CPU execution provider is
+// converted to, or 0 if the node isn't converted.
+static int GetFloatNhwcSinceVersion(api::GraphRef& graph, api::NodeRef& node) {
+  if (node.GetExecutionProviderType() != kCpuExecutionProvider) {
+    return 0;
+  }
+
+  auto value_info = graph.GetValueInfo(node.Inputs()[0]);
+  auto shape = value_info->Shape();
+  if (value_info->DType() != api::DataType::FLOAT || !shape.has_value() || shape->size() != 4) {
+    return 0;
+  }
+
+  const int since_version = node.SinceVersion();
+  if (node.IsOp("Conv")) {
+    return since_version == 11 ? 11 : 0;
+  }
+
+  if (node.IsOp("FusedConv", kMSDomain)) {
+    // the optional Z input added to the output isn't supported
+    return node.Inputs().size() <= 3 ? 11 : 0;
+  }
+
+  if (node.IsOp("MaxPool")) {
+    // the optional Indices output isn't supported
+    auto outputs = node.Outputs();
+    if (outputs.size() > 1 && outputs[1] != "") {
+      return 0;
+    }
+    return (since_version == 11 || since_version == 12) ? since_version : 0;
+  }
+
+  if (node.IsOp("AveragePool")) {
+    // with ceil_mode the kernel counts the whole window beyond the padding when count_include_pad is set
+    if (node.GetAttributeIntDefault("ceil_mode", 0) != 0 && node.GetAttributeIntDefault("count_include_pad", 0) != 0) {
+      return 0;
+    }
+    return since_version == 11 ? 11 : 0;
+  }
+
+  if (node.IsOp("GlobalAveragePool")) {
+    return 1;
+  }
+
+  return 0;
+}
+
 Status NhwcTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
 #if defined(ORT_MINIMAL_BUILD)
   // update the producer/consumer info as previous optimizations may have invalidated it.
@@ -64,10 +111,32 @@ Status NhwcTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         SwapNodeOpTypeAndDomain(*api_graph, *node, "QLinearConv", kMSDomain);
       }
 
+      modified = true;
+      continue;
+    }
+
+    if (enable_float_layout_) {
+      const int since_version = GetFloatNhwcSinceVersion(*api_graph, *node);
+      if (since_version == 0) {
+        continue;
+      }
+
+      // The weights of Conv keep the NCHW layout, only the first input and the output are transposed.
+      std::vector<int64_t> input_perm = ChannelFirstToLastPerm(4);
+      std::vector<int64_t> output_perm = ChannelLastToFirstPerm(4);
+      WrapTransposesAroundNode(*api_graph, *node, {&input_perm}, {&output_perm});
+
+      // FusedConv becomes Conv, whose NHWC version has the activation attributes.
+      const std::string op_type = node->OpType() == "FusedConv" ? "Conv" : node->OpType();
+      auto nhwc_node = SwapNodeOpTypeAndDomain(*api_graph, *node, op_type, kMSInternalNHWCDomain);
+      NodeFromApiNode(*nhwc_node).SetSinceVersion(since_version);
+
       modified = true;
     }
   }
 
+  // The transpose optimizer moves the Transpose nodes through the element-wise and other layout agnostic operators
+  // between the NHWC nodes, where they cancel out.
   if (modified) {
     Optimize(*api_graph, /*allow_extended_ops*/ true, kCpuExecutionProvider);
   }
@@ -14,14 +14,19 @@ namespace onnxruntime {
 
 Transformer that optimizes the graph by using NHWC nodes instead of NCHW nodes
 and inserts nodes to transpose tensors as needed.
+If enable_float_layout is true, the float Conv, FusedConv, MaxPool, AveragePool and GlobalAveragePool nodes of the
+CPU execution provider are also converted, to their versions in the kMSInternalNHWCDomain domain.
 */
 class NhwcTransformer : public GraphTransformer {
  private:
   AllocatorPtr cpu_allocator_;
+  bool enable_float_layout_;
 
  public:
-  explicit NhwcTransformer(AllocatorPtr cpu_allocator) noexcept 
-    : GraphTransformer("NhwcTransformer"), cpu_allocator_(std::move(cpu_allocator)){};
+  explicit NhwcTransformer(AllocatorPtr cpu_allocator, bool enable_float_layout = false) noexcept
+      : GraphTransformer("NhwcTransformer"),
+        cpu_allocator_(std::move(cpu_allocator)),
+        enable_float_layout_(enable_float_layout){};
 
  private:
   Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
@@ -0,0 +1,299 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/rematerialization.h"
+
+#include <algorithm>
+
+#include "core/framework/data_types.h"
+#include "core/framework/tensorprotoutils.h"
+#include "core/graph/graph_utils.h"
+#include "core/graph/graph_viewer.h"
+
+namespace onnxruntime {
+
+namespace {
+
+// Number of candidates evaluated at each peak. Each evaluation estimates the lifetimes for the whole graph, so this
+// bounds the cost of an iteration to that of a few topological sorts rather than one per value live at the peak.
+constexpr size_t kMaxCandidatesPerIteration = 4;
+
+// Operators which are cheap to recompute, with an estimate of their number of operations per output element.
+const InlinedHashMap<std::string_view, int64_t>& RecomputableOps() {
+  static const InlinedHashMap<std::string_view, int64_t> recomputable_ops = {
+      {"Abs", 1}, {"Add", 1}, {"And", 1}, {"Cast", 1}, {"Clip", 1}, {"Div", 1}, {"Equal", 1}, {"Erf", 4},
+      {"Exp", 4}, {"Expand", 1}, {"Greater", 1}, {"LeakyRelu", 1}, {"Less", 1}, {"Log", 4}, {"Max", 1},
+      {"Min", 1}, {"Mul", 1}, {"Neg", 1}, {"Not", 1}, {"Or", 1}, {"Pow", 4}, {"Reciprocal", 1}, {"Relu", 1},
+      {"Resize", 4}, {"Sigmoid", 4}, {"Sqrt", 1}, {"Sub", 1}, {"Tanh", 4}, {"Tile", 1}, {"Transpose", 1},
+      {"Upsample", 4}, {"Where", 1}};
+  return recomputable_ops;
+}
+
+// Number of elements of a value according to its inferred shape, or -1 if the shape isn't fully known.
+int64_t NumElements(const NodeArg& value) {
+  const auto* shape = value.Shape();
+  return shape == nullptr ? -1 : utils::GetTensorShapeFromTensorShapeProto(*shape).Size();
+}
+
+// Size in bytes of a tensor value according to its inferred shape, or 0 if it isn't fully known.
+size_t ValueSize(const NodeArg& value) {
+  const auto* type = value.TypeAsProto();
+  if (type == nullptr || !utils::HasTensorType(*type) || !utils::HasElemType(type->tensor_type())) {
+    return 0;
+  }
+
+  const int64_t num_elements = NumElements(value);
+  if (num_elements < 0) {
+    return 0;
+  }
+
+  const auto* element_type = DataTypeImpl::TensorTypeFromONNXEnum(type->tensor_type().elem_type())->GetElementType();
+  return static_cast<size_t>(num_elements) * element_type->Size();
+}
+
+struct ValueLifetime {
+  NodeIndex producer;
+  // first and last execution steps during which the value is allocated
+  size_t start;
+  size_t end;
+  size_t size;
+};
+
+struct MemoryProfile {
+  // execution step of each node, indexed by NodeIndex
+  std::vector<size_t> node_steps;
+  InlinedHashMap<const NodeArg*, ValueLifetime> lifetimes;
+  // size in bytes of the values allocated at each execution step
+  std::vector<size_t> live_sizes;
+};
+
+// Lifetimes of the values produced by the nodes as the allocation planner computes them, without the reuse of buffers.
+MemoryProfile ComputeMemoryProfile(const Graph& graph, ExecutionOrder execution_order) {
+  MemoryProfile profile;
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder(execution_order);
+  const size_t num_steps = order.size();
+
+  profile.node_steps.resize(graph.MaxNodeIndex(), 0);
+  for (size_t step = 0; step < num_steps; ++step) {
+    const Node& node = *graph.GetNode(order[step]);
+    profile.node_steps[node.Index()] = step;
+
+    for (const auto* output : node.OutputDefs()) {
+      const size_t size = output->Exists() ? ValueSize(*output) : 0;
+      if (size == 0) {
+        continue;
+      }
+
+      // graph outputs are kept until the end of the execution
+      const size_t end = graph.IsOutput(output) ? num_steps - 1 : step;
+      profile.lifetimes.insert({output, ValueLifetime{node.Index(), step, end, size}});
+    }
+
+    auto extend_lifetime = [&profile, step](const NodeArg* input) {
+      auto lifetime = profile.lifetimes.find(input);
+      if (lifetime != profile.lifetimes.end()) {
+        lifetime->second.end = std::max(lifetime->second.end, step);
+      }
+    };
+    std::for_each(node.InputDefs().begin(), node.InputDefs().end(), extend_lifetime);
+    std::for_each(node.ImplicitInputDefs().begin(), node.ImplicitInputDefs().end(), extend_lifetime);
+  }
+
+  std::vector<size_t> allocated(num_steps, 0);
+  std::vector<size_t> freed(num_steps, 0);
+  for (const auto& entry : profile.lifetimes) {
+    allocated[entry.second.start] += entry.second.size;
+    freed[entry.second.end] += entry.second.size;
+  }
+
+  profile.live_sizes.resize(num_steps);
+  size_t live_size = 0;
+  for (size_t step = 0; step < num_steps; ++step) {
+    live_size += allocated[step];
+    profile.live_sizes[step] = live_size;
+    live_size -= freed[step];
+  }
+
+  return profile;
+}
+
+size_t PeakSize(const MemoryProfile& profile) {
+  return profile.live_sizes.empty() ? 0 : *std::max_element(profile.live_sizes.cbegin(), profile.live_sizes.cend());
+}
+
+// Sum over the execution steps of the size in bytes allocated above the budget.
+size_t ExcessSize(const MemoryProfile& profile, size_t memory_budget) {
+  size_t excess = 0;
+  for (size_t live_size : profile.live_sizes) {
+    excess += live_size > memory_budget ? live_size - memory_budget : 0;
+  }
+
+  return excess;
+}
+
+struct RecomputeCandidate {
+  Node* producer;
+  const NodeArg* value;
+  // consumer and input index of the uses of the value after the peak
+  InlinedVector<std::pair<NodeIndex, int>> late_uses;
+  size_t size;
+  int64_t operations;
+};
+
+// The values allocated at the peak step which are produced by a cheap node and used both before and after the peak,
+// with the values of the largest size for the fewest operations first.
+std::vector<RecomputeCandidate> GetCandidates(Graph& graph, const MemoryProfile& profile, size_t peak_step,
+                                              const InlinedHashSet<std::string_view>& compatible_providers) {
+  std::vector<RecomputeCandidate> candidates;
+  for (const auto& entry : profile.lifetimes) {
+    const NodeArg* value = entry.first;
+    const ValueLifetime& lifetime = entry.second;
+    if (lifetime.start >= peak_step || lifetime.end < peak_step || graph.IsOutput(value)) {
+      continue;
+    }
+
+    Node& producer = *graph.GetNode(lifetime.producer);
+    const auto recomputable_op = RecomputableOps().find(producer.OpType());
+    if (recomputable_op == RecomputableOps().end() || producer.Domain() != kOnnxDomain ||
+        producer.OutputDefs().size() != 1 ||
+        !graph_utils::IsSupportedProvider(producer, compatible_providers)) {
+      continue;
+    }
+
+    bool used_before_peak = false;
+    bool used_implicitly = false;
+    RecomputeCandidate candidate{&producer, value, {}, lifetime.size,
+                                 NumElements(*value) * recomputable_op->second};
+    for (auto edge = producer.OutputEdgesBegin(), end = producer.OutputEdgesEnd(); edge != end; ++edge) {
+      const Node& consumer = edge->GetNode();
+      if (static_cast<size_t>(edge->GetDstArgIndex()) >= consumer.InputDefs().size()) {
+        used_implicitly = true;
+      } else if (profile.node_steps[consumer.Index()] <= peak_step) {
+        used_before_peak = true;
+      } else {
+        candidate.late_uses.push_back({consumer.Index(), edge->GetDstArgIndex()});
+      }
+    }
+
+    if (used_before_peak && !used_implicitly && !candidate.late_uses.empty()) {
+      candidates.push_back(std::move(candidate));
+    }
+  }
+
+  std::sort(candidates.begin(), candidates.end(), [](const RecomputeCandidate& a, const RecomputeCandidate& b) {
+    const double a_cost = static_cast<double>(a.operations) / static_cast<double>(a.size);
+    const double b_cost = static_cast<double>(b.operations) / static_cast<double>(b.size);
+    if (a_cost != b_cost) {
+      return a_cost < b_cost;
+    }
+    return a.producer->Index() < b.producer->Index();
+  });
+
+  return candidates;
+}
+
+// Add a copy of the producer of the value for its uses after the peak.
+Node& AddRecomputeNode(Graph& graph, const RecomputeCandidate& candidate) {
+  Node& producer = *candidate.producer;
+  NodeArg& recomputed_value = graph_utils::CreateNodeArg(graph, *candidate.value);
+  Node& recompute_node = graph.AddNode(graph.GenerateNodeName(producer.Name() + "_recompute"),
+                                       producer.OpType(),
+                                       "Recompute of " + producer.Name(),
+                                       producer.MutableInputDefs(),
+                                       {&recomputed_value},
+                                       &producer.GetAttributes(),
+                                       producer.Domain());
+  recompute_node.SetExecutionProviderType(producer.GetExecutionProviderType());
+  recompute_node.SetSinceVersion(producer.SinceVersion());
+  // executed after the other inputs of its consumers, i.e. as late as possible
+  recompute_node.SetPriority(static_cast<int>(ExecutionPriority::LOCAL_LOW));
+
+  for (auto edge = producer.InputEdgesBegin(), end = producer.InputEdgesEnd(); edge != end; ++edge) {
+    graph.AddEdge(edge->GetNode().Index(), recompute_node.Index(), edge->GetSrcArgIndex(), edge->GetDstArgIndex());
+  }
+
+  for (const auto& late_use : candidate.late_uses) {
+    graph.RemoveEdge(producer.Index(), late_use.first, 0, late_use.second);
+    graph.AddEdge(recompute_node.Index(), late_use.first, 0, late_use.second);
+  }
+
+  return recompute_node;
+}
+
+void RemoveRecomputeNode(Graph& graph, const RecomputeCandidate& candidate, Node& recompute_node) {
+  for (const auto& late_use : candidate.late_uses) {
+    graph.RemoveEdge(recompute_node.Index(), late_use.first, 0, late_use.second);
+    graph.AddEdge(candidate.producer->Index(), late_use.first, 0, late_use.second);
+  }
+
+  const std::string recomputed_value_name = recompute_node.OutputDefs()[0]->Name();
+  graph.RemoveNode(recompute_node.Index());
+  graph.RemoveNodeArg(recomputed_value_name);
+}
+
+}  // namespace
+
+size_t Rematerialization::EstimatePeakActivationSize(const Graph& graph, ExecutionOrder execution_order) {
+  return PeakSize(ComputeMemoryProfile(graph, execution_order));
+}
+
+Status Rematerialization::ApplyImpl(Graph& graph, bool& modified, int /*graph_level*/,
+                                    const logging::Logger& logger) const {
+  // The budget applies to the main graph only. The values of a subgraph are released after each execution of it.
+  MemoryProfile profile = ComputeMemoryProfile(graph, execution_order_);
+  const size_t initial_peak = PeakSize(profile);
+  size_t excess = ExcessSize(profile, memory_budget_);
+  if (excess == 0) {
+    return Status::OK();
+  }
+
+  size_t num_recomputed = 0;
+  int64_t extra_operations = 0;
+  const int max_iterations = graph.NumberOfNodes();
+  for (int iteration = 0; excess > 0 && iteration < max_iterations; ++iteration) {
+    const size_t peak_step = static_cast<size_t>(
+        std::max_element(profile.live_sizes.cbegin(), profile.live_sizes.cend()) - profile.live_sizes.cbegin());
+
+    bool recomputed = false;
+    auto candidates = GetCandidates(graph, profile, peak_step, GetCompatibleExecutionProviders());
+    if (candidates.size() > kMaxCandidatesPerIteration) {
+      candidates.resize(kMaxCandidatesPerIteration);
+    }
+
+    for (const auto& candidate : candidates) {
+      Node& recompute_node = AddRecomputeNode(graph, candidate);
+      MemoryProfile new_profile = ComputeMemoryProfile(graph, execution_order_);
+      const size_t new_excess = ExcessSize(new_profile, memory_budget_);
+      if (new_excess < excess) {
+        profile = std::move(new_profile);
+        excess = new_excess;
+        extra_operations += candidate.operations;
+        ++num_recomputed;
+        recomputed = true;
+        break;
+      }
+
+      RemoveRecomputeNode(graph, candidate, recompute_node);
+    }
+
+    if (!recomputed) {
+      break;
+    }
+  }
+
+  modified = num_recomputed > 0;
+  const size_t peak = PeakSize(profile);
+  LOGS(logger, INFO) << "Rematerialization: estimated peak size of the activations " << initial_peak << " -> "
+                     << peak << " bytes with a budget of " << memory_budget_ << " bytes, " << num_recomputed
+                     << " values recomputed for " << extra_operations << " extra operations.";
+  if (excess > 0) {
+    LOGS(logger, WARNING) << "Rematerialization: the memory budget of " << memory_budget_
+                          << " bytes could not be reached, the estimated peak size of the activations is " << peak
+                          << " bytes.";
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
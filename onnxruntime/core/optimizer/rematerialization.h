@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/framework/session_options.h"
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@class Rematerialization
+
+Transformer that trades compute for memory at inference time. The lifetimes of the values are estimated as the
+allocation planner computes them for the execution order of the session: a value is allocated when its producer runs
+and freed after its last consumer, graph outputs are kept until the end. While the peak of the activations exceeds
+the memory budget, a value live at the peak which is produced by a cheap operator (element-wise, Cast, Expand, Tile,
+Transpose, Resize) and consumed both before and after the peak is recomputed by a copy of its producer for the
+consumers after the peak. The copy has a low priority so it's executed right before these consumers, and is kept
+only if it lowers the memory above the budget. The values with the largest size for the fewest extra operations are
+tried first, and only the first few at each peak as each try estimates the lifetimes again. Only the values with
+static shapes are considered.
+*/
+class Rematerialization : public GraphTransformer {
+ public:
+  /*! \param memory_budget Peak size in bytes of the activations to reach.
+      \param execution_order The execution order of the session, which determines the lifetimes.
+  */
+  Rematerialization(size_t memory_budget, ExecutionOrder execution_order,
+                    const InlinedHashSet<std::string_view>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("Rematerialization", compatible_execution_providers),
+        memory_budget_(memory_budget),
+        execution_order_(execution_order) {}
+
+  bool ShouldOnlyApplyOnce() const override { return true; }
+
+  // Estimated peak size in bytes of the values produced by the nodes of the graph, for the given execution order.
+  static size_t EstimatePeakActivationSize(const Graph& graph, ExecutionOrder execution_order);
+
+ private:
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  const size_t memory_budget_;
+  const ExecutionOrder execution_order_;
+};
+
+}  // namespace onnxruntime
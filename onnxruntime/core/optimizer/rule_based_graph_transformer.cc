@@ -40,10 +40,25 @@ Status RuleBasedGraphTransformer::ApplyRulesOnNode(Graph& graph, Node& node,
 }
 
 Status RuleBasedGraphTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  return ApplyInTopologicalOrder(graph, nullptr, modified, graph_level, logger);
+}
+
+Status RuleBasedGraphTransformer::ApplyToNodesImpl(Graph& graph, const InlinedHashSet<NodeIndex>& nodes, bool& modified,
+                                                   const logging::Logger& logger) const {
+  return ApplyInTopologicalOrder(graph, &nodes, modified, 0, logger);
+}
+
+Status RuleBasedGraphTransformer::ApplyInTopologicalOrder(Graph& graph, const InlinedHashSet<NodeIndex>* nodes,
+                                                          bool& modified, int graph_level,
+                                                          const logging::Logger& logger) const {
   GraphViewer graph_viewer(graph);
   auto& order = graph_viewer.GetNodesInTopologicalOrder();
 
   for (NodeIndex i : order) {
+    if (nodes != nullptr && nodes->count(i) == 0) {
+      continue;
+    }
+
     auto* node = graph.GetNode(i);
     // A node might not be found as it might have already been deleted from one of the rules.
     if (!node) {
@@ -92,4 +107,15 @@ size_t RuleBasedGraphTransformer::RulesCount() const {
   return rules_.size();
 }
 
+std::vector<std::string> RuleBasedGraphTransformer::TargetOpTypes() const {
+  std::vector<std::string> op_types;
+  if (any_op_type_rules_.empty()) {
+    op_types.reserve(op_type_to_rules_.size());
+    for (const auto& entry : op_type_to_rules_) {
+      op_types.push_back(entry.first);
+    }
+  }
+  return op_types;
+}
+
 }  // namespace onnxruntime
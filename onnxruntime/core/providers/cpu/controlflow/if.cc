@@ -2,10 +2,14 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/controlflow/if.h"
+
+#include <algorithm>
+
 #include "core/providers/cpu/controlflow/utils.h"
 
 #include "core/framework/framework_common.h"
 #include "core/framework/op_kernel_context_internal.h"
+#include "core/framework/sequential_execution_plan.h"
 #include "core/framework/session_state.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
@@ -161,6 +165,150 @@ class IfImpl {
 #endif
 };
 
+// Returns true if the allocation plan lets another value use the buffer of the value. Such a value can't be aliased
+// as the other value could overwrite the buffer while the alias is still in use.
+static bool BufferMayBeShared(const SequentialExecutionPlan& plan, int ort_value_idx) {
+  const auto& allocation_plan = plan.allocation_plan;
+  auto reuses_buffer = [](const AllocPlanPerValue& value_plan) {
+    return value_plan.alloc_kind == AllocKind::kReuse || value_plan.alloc_kind == AllocKind::kShare;
+  };
+
+  const auto& value_plan = allocation_plan[ort_value_idx];
+  const int buffer = reuses_buffer(value_plan) ? value_plan.reused_buffer : ort_value_idx;
+  for (size_t i = 0, end = allocation_plan.size(); i < end; ++i) {
+    if (static_cast<int>(i) != ort_value_idx && reuses_buffer(allocation_plan[i]) &&
+        allocation_plan[i].reused_buffer == buffer) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// Returns true if the value stays valid for the whole Run: an initializer, or an input of the main graph which the
+// caller owns. An activation can't be aliased: with the memory pattern it is a view of the pattern buffer, and its
+// block is given to other values after its last consumer, the If node, while the If output may still be in use.
+static bool IsValidForRun(const SessionState& session_state, const std::string& name, int ort_value_idx) {
+  if (session_state.GetInitializedTensors().count(ort_value_idx) > 0) {
+    return true;
+  }
+
+  const auto& graph_viewer = session_state.GetGraphViewer();
+  const auto& graph_inputs = graph_viewer.GetInputs();
+  return !graph_viewer.IsSubgraph() &&
+         std::any_of(graph_inputs.cbegin(), graph_inputs.cend(),
+                     [&name](const NodeArg* input) { return input->Name() == name; });
+}
+
+// Find the source value of each output of a trivial branch. See If::Info::output_aliases.
+// info.output_aliases is left empty if any output can't be aliased.
+static void FindOutputAliases(const Node& node, const SessionState& session_state,
+                              const SessionState& subgraph_session_state,
+                              const std::vector<const OrtMemoryInfo*>& fetch_locations,
+                              If::Info& info) {
+  const auto* plan = session_state.GetExecutionPlan();
+  if (plan == nullptr) {
+    return;
+  }
+
+  const auto& value_map = session_state.GetOrtValueNameIdxMap();
+  const auto& subgraph_map = subgraph_session_state.GetOrtValueNameIdxMap();
+  const auto& subgraph_initializers = subgraph_session_state.GetInitializedTensors();
+  const auto& parent_graph_outputs = session_state.GetGraphViewer().GetOutputs();
+  const auto& implicit_input_defs = node.ImplicitInputDefs();
+  const auto& if_outputs = node.OutputDefs();
+  const auto& subgraph_outputs = info.subgraph.GetOutputs();
+
+  std::vector<If::Info::OutputAlias> aliases;
+  aliases.reserve(info.num_outputs);
+
+  for (int i = 0; i < info.num_outputs; ++i) {
+    const auto* subgraph_output = subgraph_outputs[i];
+    const auto* type = subgraph_output->TypeAsProto();
+    if (type == nullptr || !type->has_tensor_type()) {
+      return;
+    }
+
+    // an output of the parent graph is returned to the caller of the parent, so it must own its buffer
+    const auto& if_output_name = if_outputs[i]->Name();
+    int if_output_idx = -1;
+    if (!if_outputs[i]->Exists() ||
+        !value_map.GetIdx(if_output_name, if_output_idx).IsOK() ||
+        BufferMayBeShared(*plan, if_output_idx) ||
+        std::any_of(parent_graph_outputs.cbegin(), parent_graph_outputs.cend(),
+                    [&if_output_name](const NodeArg* output) { return output->Name() == if_output_name; })) {
+      return;
+    }
+
+    const std::string* source_name = &subgraph_output->Name();
+    const auto* producer = info.subgraph.GetProducerNode(*source_name);
+    if (producer != nullptr) {
+      if (producer->OpType() != "Identity" ||
+          !(producer->Domain().empty() || producer->Domain() == kOnnxDomain)) {
+        return;
+      }
+
+      source_name = &producer->InputDefs()[0]->Name();
+    }
+
+    const OrtDevice& output_device = fetch_locations[i]->device;
+    If::Info::OutputAlias alias;
+
+    int subgraph_idx = -1;
+    if (subgraph_map.GetIdx(*source_name, subgraph_idx).IsOK() &&
+        subgraph_initializers.find(subgraph_idx) != subgraph_initializers.cend()) {
+      const auto& initializer = subgraph_initializers.at(subgraph_idx);
+#if !defined(DISABLE_SPARSE_TENSORS)
+      if (subgraph_session_state.IsSparseInitializer(subgraph_idx)) {
+        return;
+      }
+#endif
+      if (!initializer.IsTensor() || initializer.Get<Tensor>().Location().device != output_device) {
+        return;
+      }
+
+      alias.initializer_idx = subgraph_idx;
+    } else {
+      auto implicit_input = std::find_if(implicit_input_defs.cbegin(), implicit_input_defs.cend(),
+                                         [source_name](const NodeArg* def) { return def->Name() == *source_name; });
+      int source_idx = -1;
+      if (implicit_input == implicit_input_defs.cend() ||
+          !value_map.GetIdx(*source_name, source_idx).IsOK() ||
+          !IsValidForRun(session_state, *source_name, source_idx) ||
+          utils::FindMemoryInfoForValue(session_state, *source_name).device != output_device) {
+        return;
+      }
+
+      alias.implicit_input_index = static_cast<int>(implicit_input - implicit_input_defs.cbegin());
+    }
+
+    aliases.push_back(alias);
+  }
+
+  info.output_aliases = std::move(aliases);
+}
+
+// Set the If outputs to the values returned by a trivial branch without executing it.
+static Status SetAliasedOutputs(OpKernelContextInternal& context, const SessionState& subgraph_session_state,
+                                const If::Info& info) {
+  const auto& implicit_inputs = context.GetImplicitInputs();
+  const auto& subgraph_initializers = subgraph_session_state.GetInitializedTensors();
+
+  for (int i = 0; i < info.num_outputs; ++i) {
+    const auto& alias = info.output_aliases[i];
+    if (alias.implicit_input_index >= 0) {
+      ORT_RETURN_IF_ERROR(context.SetOutputMLValue(i, *implicit_inputs[alias.implicit_input_index]));
+    } else {
+      auto initializer = subgraph_initializers.find(alias.initializer_idx);
+      ORT_RETURN_IF(initializer == subgraph_initializers.cend(),
+                    "Initializer providing If output ", i, " was not found.");
+      ORT_RETURN_IF_ERROR(context.SetOutputMLValue(i, initializer->second));
+    }
+  }
+
+  return Status::OK();
+}
+
 void If::Init(const OpKernelInfo& info) {
   // make sure the required attributes are present even though we don't need it here.
   // The GraphProto attributes are loaded as a Graph instance by main Graph::Resolve,
@@ -226,6 +374,8 @@ common::Status If::SetupSubgraphExecutionInfo(const SessionState& session_state,
 
   utils::FinalizeFeedFetchCopyInfo(*ffm, feed_locations, fetch_locations);
 
+  FindOutputAliases(node, session_state, subgraph_session_state, fetch_locations, *info);
+
   if (attribute_name == "then_branch")
     then_feeds_fetches_manager_ = std::move(ffm);
   else
@@ -247,6 +397,10 @@ Status If::Compute(OpKernelContext* ctx) const {
   ORT_ENFORCE(session_state, "Subgraph SessionState was not found for '", attribute, "' attribute.");
 
   const auto& info = condition ? then_info_ : else_info_;
+  if (!info->output_aliases.empty()) {
+    return SetAliasedOutputs(*ctx_internal, *session_state, *info);
+  }
+
   IfImpl impl{*ctx_internal, *session_state, *info};
 
   auto status = impl.Initialize();
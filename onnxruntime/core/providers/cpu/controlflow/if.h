@@ -30,6 +30,20 @@ class If : public controlflow::IControlFlowKernel {
     int num_outputs;
 
     std::vector<std::string> subgraph_output_names;
+
+    // Source of an output of a trivial branch, which is either an implicit input of the If node (index into
+    // Node::ImplicitInputDefs) or an initializer of the subgraph (OrtValue index in the subgraph).
+    // Only main graph inputs and initializers are aliased as implicit inputs, activations of the parent graph
+    // may be overwritten while the If output is in use.
+    struct OutputAlias {
+      int implicit_input_index{-1};
+      int initializer_idx{-1};
+    };
+
+    // Populated if every output of the subgraph is an implicit input or an initializer, optionally passed
+    // through an Identity node, and can safely share the buffer of that value. The subgraph isn't executed and
+    // the If outputs are set to the source values directly.
+    std::vector<OutputAlias> output_aliases;
   };
 
  private:
@@ -104,6 +104,17 @@ class ElementWiseKernel final : public OpKernel {
     return Status::OK();
   }
 
+  // One operation per element, as for the binary element-wise kernels. The functor's Cost() is the thread pool's
+  // cycle estimate for partitioning the work, not an operation count.
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override {
+    using T = typename F::DataType;
+    const auto input_size = static_cast<double>(context.Input<Tensor>(0)->Shape().Size());
+    cost.flops = input_size;
+    cost.bytes_read = input_size * sizeof(T);
+    cost.bytes_written = input_size * sizeof(T);
+    return true;
+  }
+
  private:
   F f_;
 };
@@ -0,0 +1,72 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+
+#include "core/framework/op_kernel.h"
+
+namespace onnxruntime {
+namespace kernel_cost_utils {
+
+// Size in bytes of a tensor. 0 for a missing optional input.
+inline double TensorBytes(const Tensor* tensor) {
+  return tensor != nullptr ? static_cast<double>(tensor->SizeInBytes()) : 0.0;
+}
+
+inline double ShapeBytes(const TensorShape& shape, size_t element_size) {
+  return static_cast<double>(shape.Size()) * static_cast<double>(element_size);
+}
+
+// Total size in bytes of the tensor inputs of the invocation.
+inline double InputBytes(const OpKernelContext& context) {
+  double bytes = 0.0;
+  for (int i = 0, end = context.InputCount(); i < end; ++i) {
+    bytes += TensorBytes(context.Input<Tensor>(i));
+  }
+  return bytes;
+}
+
+// Number of elements in the multidirectional broadcast of the shapes of the tensor inputs, i.e. the size of the
+// output of a variadic element-wise operator.
+inline int64_t BroadcastOutputSize(const OpKernelContext& context) {
+  TensorShapeVector output_dims;
+  for (int i = 0, end = context.InputCount(); i < end; ++i) {
+    const Tensor* input = context.Input<Tensor>(i);
+    if (input == nullptr) {
+      continue;
+    }
+
+    const auto dims = input->Shape().GetDims();
+    if (dims.size() > output_dims.size()) {
+      output_dims.insert(output_dims.begin(), dims.size() - output_dims.size(), 1);
+    }
+
+    // align from the innermost dimension
+    const size_t offset = output_dims.size() - dims.size();
+    for (size_t d = 0; d < dims.size(); ++d) {
+      auto& output_dim = output_dims[offset + d];
+      if (output_dim == 1) {
+        output_dim = dims[d];
+      } else if (dims[d] != 1) {
+        output_dim = std::min(output_dim, dims[d]);
+      }
+    }
+  }
+
+  return TensorShape(output_dims).Size();
+}
+
+// Cost of an element-wise operator that performs flops_per_element operations for each output element and reads
+// each of its inputs once.
+inline void ElementwiseCost(const OpKernelContext& context, double flops_per_element, size_t output_element_size,
+                            KernelCost& cost) {
+  const auto output_size = static_cast<double>(BroadcastOutputSize(context));
+  cost.flops = output_size * flops_per_element;
+  cost.bytes_read = InputBytes(context);
+  cost.bytes_written = output_size * static_cast<double>(output_element_size);
+}
+
+}  // namespace kernel_cost_utils
+}  // namespace onnxruntime
@@ -8,6 +8,7 @@
 #include "core/framework/op_kernel.h"
 #include "core/util/math_cpuonly.h"
 #include "core/providers/cpu/element_wise_ranged_transform.h"
+#include "core/providers/cpu/kernel_cost_utils.h"
 
 namespace onnxruntime {
 namespace functors {
@@ -218,6 +219,10 @@ class Add final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override {
+    kernel_cost_utils::ElementwiseCost(context, 1.0, sizeof(T), cost);
+    return true;
+  }
 };
 
 template <typename T>
@@ -227,6 +232,10 @@ class Sub final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override {
+    kernel_cost_utils::ElementwiseCost(context, 1.0, sizeof(T), cost);
+    return true;
+  }
 };
 
 template <typename T>
@@ -236,6 +245,10 @@ class Mul final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override {
+    kernel_cost_utils::ElementwiseCost(context, 1.0, sizeof(T), cost);
+    return true;
+  }
 };
 
 template <typename T>
@@ -245,6 +258,10 @@ class Div final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override {
+    kernel_cost_utils::ElementwiseCost(context, 1.0, sizeof(T), cost);
+    return true;
+  }
 };
 
 class Pow final : public OpKernel {
@@ -271,6 +288,10 @@ class Sum_8 final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override {
+    kernel_cost_utils::ElementwiseCost(context, static_cast<double>(context.InputCount() - 1), sizeof(T), cost);
+    return true;
+  }
 };
 
 template <typename T>
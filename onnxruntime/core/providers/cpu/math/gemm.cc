@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/math/gemm.h"
+#include "core/providers/cpu/kernel_cost_utils.h"
 #include "core/providers/cpu/math/gemm_matmul_common.h"
 #include "core/util/math_cpuonly.h"
 #include "gemm_helper.h"
@@ -301,4 +302,29 @@ Status Gemm<float>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+template <typename T>
+bool Gemm<T>::GetCost(const OpKernelContext& context, KernelCost& cost) const {
+  const auto* A = context.Input<Tensor>(0);
+  const auto* B = packed_b_ ? nullptr : context.Input<Tensor>(1);
+  const auto* C = context.Input<Tensor>(2);
+  const auto& b_shape = B ? B->Shape() : b_shape_;
+
+  GemmHelper helper(A->Shape(), trans_A_ != CblasNoTrans, b_shape, trans_B_ != CblasNoTrans,
+                    C != nullptr ? C->Shape() : TensorShape({}));
+  if (!helper.State().IsOK()) {
+    return false;
+  }
+
+  const auto M = static_cast<double>(helper.M());
+  const auto N = static_cast<double>(helper.N());
+  const auto K = static_cast<double>(helper.K());
+
+  // 2 * M * N * K for A * B, plus scaling and adding the broadcast bias
+  cost.flops = 2.0 * M * N * K + (C != nullptr ? 2.0 * M * N : 0.0);
+  cost.bytes_read = kernel_cost_utils::TensorBytes(A) + kernel_cost_utils::ShapeBytes(b_shape, sizeof(T)) +
+                    kernel_cost_utils::TensorBytes(C);
+  cost.bytes_written = M * N * sizeof(T);
+  return true;
+}
+
 }  // namespace onnxruntime
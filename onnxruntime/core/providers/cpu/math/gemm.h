@@ -20,6 +20,8 @@ class Gemm : protected GemmBase, public OpKernel {
 
   Status Compute(OpKernelContext* context) const override;
 
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override;
+
   Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
                  /*out*/ bool& is_packed,
                  /*out*/ PrePackedWeights* prepacked_weights) override;
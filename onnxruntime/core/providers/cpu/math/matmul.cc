@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/math/matmul.h"
+#include "core/providers/cpu/kernel_cost_utils.h"
 #include "core/providers/cpu/math/gemm_matmul_common.h"
 #include "core/providers/cpu/math/matmul_helper.h"
 #include "core/util/math.h"
@@ -89,6 +90,21 @@ ONNX_CPU_OPERATOR_TYPED_KERNEL(
         .TypeConstraint("T", BuildKernelDefConstraints<int64_t, uint64_t>()),
     MatMul<int64_t>);
 
+namespace {
+
+// 2 * M * N * K FLOPs for each matrix multiplication in the batch. A and B are read once and Y is written once.
+void MatMulCost(const MatMulComputeHelper& helper, const TensorShape& a_shape, const TensorShape& b_shape,
+                size_t element_size, KernelCost& cost) {
+  const auto batch = static_cast<double>(helper.OutputOffsets().size());
+  cost.flops = 2.0 * batch * static_cast<double>(helper.M()) * static_cast<double>(helper.N()) *
+               static_cast<double>(helper.K());
+  cost.bytes_read = kernel_cost_utils::ShapeBytes(a_shape, element_size) +
+                    kernel_cost_utils::ShapeBytes(b_shape, element_size);
+  cost.bytes_written = kernel_cost_utils::ShapeBytes(helper.OutputShape(), element_size);
+}
+
+}  // namespace
+
 template <typename T>
 Status MatMul<T>::Compute(OpKernelContext* ctx) const {
   concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
@@ -126,6 +142,20 @@ Status MatMul<T>::Compute(OpKernelContext* ctx) const {
   return Status::OK();
 }
 
+template <typename T>
+bool MatMul<T>::GetCost(const OpKernelContext& ctx, KernelCost& cost) const {
+  const auto* a = ctx.Input<Tensor>(0);
+  const auto* b = ctx.Input<Tensor>(1);
+
+  MatMulComputeHelper helper;
+  if (!helper.Compute(a->Shape(), b->Shape()).IsOK()) {
+    return false;
+  }
+
+  MatMulCost(helper, a->Shape(), b->Shape(), sizeof(T), cost);
+  return true;
+}
+
 Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, /*out*/ AllocatorPtr alloc,
                               /*out*/ bool& is_packed,
                               /*out*/ PrePackedWeights* prepacked_weights) {
@@ -205,4 +235,21 @@ Status MatMul<float>::Compute(OpKernelContext* ctx) const {
   return Status::OK();
 }
 
+bool MatMul<float>::GetCost(const OpKernelContext& ctx, KernelCost& cost) const {
+  const Tensor* a = ctx.Input<Tensor>(0);
+  const Tensor* b = packed_b_ ? nullptr : ctx.Input<Tensor>(1);
+  const auto& b_shape = b ? b->Shape() : b_shape_;
+
+  const bool trans_a = trans_a_attr_ && a->Shape().NumDimensions() != 1;
+  const bool trans_b = trans_b_attr_ && b_shape.NumDimensions() != 1;
+
+  MatMulComputeHelper helper;
+  if (!helper.Compute(a->Shape(), b_shape, trans_a, trans_b, trans_batch_a_, trans_batch_b_).IsOK()) {
+    return false;
+  }
+
+  MatMulCost(helper, a->Shape(), b_shape, sizeof(float), cost);
+  return true;
+}
+
 }  // namespace onnxruntime
@@ -13,6 +13,8 @@ class MatMul final : public OpKernel {
   MatMul(const OpKernelInfo& info) : OpKernel(info) {}
 
   Status Compute(OpKernelContext* context) const override;
+
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override;
 };
 
 template <>
@@ -38,6 +40,8 @@ class MatMul<float> final : public OpKernel {
 
   Status Compute(OpKernelContext* context) const override;
 
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override;
+
  private:
   TensorShape b_shape_;
   BufferUniquePtr packed_b_;
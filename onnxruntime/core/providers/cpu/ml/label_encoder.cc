@@ -36,13 +36,10 @@ Status LabelEncoder::Compute(OpKernelContext* context) const {
     auto output = gsl::make_span(Y.template MutableData<int64_t>(), shape.Size());
     auto out = output.begin();
 
-    // map isn't going to change so get end() once instead of calling inside the for_each loop
-    const auto map_end = string_to_int_map_.end();
-
     std::for_each(input.cbegin(), input.cend(),
-                  [&out, &map_end, this](const std::string& value) {
-                    auto map_to = string_to_int_map_.find(value);
-                    *out = map_to == map_end ? default_int_ : map_to->second;
+                  [&out, this](const std::string& value) {
+                    const int64_t* map_to = string_to_int_map_.Find(value);
+                    *out = map_to == nullptr ? default_int_ : *map_to;
                     ++out;
                   });
   } else {
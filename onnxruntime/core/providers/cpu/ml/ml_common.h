@@ -10,6 +10,7 @@
 #include "core/mlas/inc/mlas.h"
 #include "core/platform/threadpool.h"
 #include "core/common/inlined_containers.h"
+#include "core/common/string_dictionary.h"
 
 namespace onnxruntime {
 namespace ml {  // name space for onnx.ml operators
@@ -522,5 +523,56 @@ void batched_update_scores_inplace(gsl::span<T> scores, int64_t num_batches_in,
     }
   }
 }
+
+// Map of the keys of the encoders (LabelEncoder, CategoryMapper) to their values. The last value of a key given more
+// than once is kept.
+// String keys are stored in a StringDictionary with the values in an array indexed by the string ids.
+template <typename TKey, typename TValue>
+class KeyValueMap {
+ public:
+  void Reserve(size_t count) { map_.reserve(count); }
+  void Insert(const TKey& key, const TValue& value) { map_[key] = value; }
+
+  // value of 'key', or nullptr
+  const TValue* Find(const TKey& key) const {
+    auto found = map_.find(key);
+    return found == map_.end() ? nullptr : &found->second;
+  }
+
+ private:
+  std::unordered_map<TKey, TValue> map_;
+};
+
+template <typename TValue>
+class KeyValueMap<std::string, TValue> {
+ public:
+  void Reserve(size_t count) {
+    keys_.Reserve(count);
+    values_.reserve(count);
+  }
+
+  void Insert(const std::string& key, const TValue& value) {
+    bool inserted;
+    const auto id = keys_.Insert(key, inserted);
+    if (inserted) {
+      values_.push_back(value);
+    } else {
+      values_[id] = value;
+    }
+  }
+
+  const TValue* Find(const std::string& key) const {
+    const auto id = keys_.Find(key);
+    return id == StringDictionary::kNotFound ? nullptr : &values_[id];
+  }
+
+ private:
+  StringDictionary keys_;
+  std::vector<TValue> values_;
+};
+
+template <typename TValue>
+using StringMap = KeyValueMap<std::string, TValue>;
+
 }  // namespace ml
 }  // namespace onnxruntime
@@ -2,6 +2,11 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/ml/svmclassifier.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "core/mlas/inc/mlas.h"
 #include "core/platform/threadpool.h"
 //TODO: fix the warnings
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -12,6 +17,168 @@
 namespace onnxruntime {
 namespace ml {
 
+namespace {
+
+// number of outputs of a row the kernel function is applied to at a time
+constexpr int64_t kKernelBlockSize = 1024;
+
+// The squared distance computed as ||a||^2 + ||b||^2 - 2 a.b loses its precision when it is small compared to the
+// norms, e.g. for an input close to a support vector. It is computed again from the vectors below this ratio.
+constexpr float kCancellationRatio = 1e-3f;
+
+float SquaredNorm(const float* x, int64_t k) {
+  float sum = 0.f;
+  for (int64_t i = 0; i < k; ++i) {
+    sum += x[i] * x[i];
+  }
+  return sum;
+}
+
+float SquaredDistance(const float* x, const float* y, int64_t k) {
+  float sum = 0.f;
+  for (int64_t i = 0; i < k; ++i) {
+    const float diff = x[i] - y[i];
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+}  // namespace
+
+void SVMCommon::PrepackSupportVectors(const OpKernelInfo& info, gsl::span<const float> support_vectors,
+                                      int64_t vector_count, int64_t feature_count) {
+  if (vector_count == 0 || feature_count == 0) {
+    return;
+  }
+
+  packed_source_ = support_vectors.data();
+
+  if (kernel_type_ == KERNEL::RBF) {
+    support_vector_norms_.resize(vector_count);
+    for (int64_t i = 0; i < vector_count; ++i) {
+      support_vector_norms_[i] = SquaredNorm(support_vectors.data() + i * feature_count, feature_count);
+    }
+  }
+
+  const size_t N = static_cast<size_t>(vector_count);
+  const size_t K = static_cast<size_t>(feature_count);
+  const size_t packed_size = MlasGemmPackBSize(N, K);
+  if (packed_size == 0) {
+    return;
+  }
+
+  auto alloc = info.GetAllocator(0, OrtMemTypeDefault);
+  void* packed_data = alloc->Alloc(packed_size);
+  memset(packed_data, 0, packed_size);
+  packed_support_vectors_ = BufferUniquePtr(packed_data, BufferDeleter(alloc));
+  MlasGemmPackB(CblasTrans, N, K, support_vectors.data(), K, packed_data);
+}
+
+void SVMCommon::batched_kernel_dot(gsl::span<const float> a, gsl::span<const float> b,
+                                   int64_t m, int64_t n, int64_t k,
+                                   float scalar_C,
+                                   gsl::span<float> out,
+                                   concurrency::ThreadPool* threadpool) const {
+  assert(a.size() == size_t(m * k) && b.size() == size_t(k * n) && out.size() == size_t(m * n));
+
+  const bool is_prepacked = packed_source_ != nullptr && b.data() == packed_source_;
+
+  // RBF: -2 a.b, POLY and SIGMOID: gamma a.b, LINEAR: a.b
+  MLAS_SGEMM_DATA_PARAMS data;
+  data.A = a.data();
+  data.lda = static_cast<size_t>(k);
+  data.C = out.data();
+  data.ldc = static_cast<size_t>(n);
+  data.alpha = kernel_type_ == KERNEL::RBF ? -2.f : kernel_type_ == KERNEL::LINEAR ? 1.f : gamma_;
+  data.beta = 0.f;
+  if (is_prepacked && packed_support_vectors_ != nullptr) {
+    data.B = static_cast<const float*>(packed_support_vectors_.get());
+    data.BIsPacked = true;
+  } else {
+    data.B = b.data();
+    data.ldb = static_cast<size_t>(k);
+  }
+
+  MlasGemm(CblasNoTrans, CblasTrans, static_cast<size_t>(m), static_cast<size_t>(n), static_cast<size_t>(k), data,
+           threadpool);
+
+  std::vector<float> b_norms_storage;
+  std::vector<float> a_norms;
+  const float* b_norms = nullptr;
+  if (kernel_type_ == KERNEL::RBF) {
+    if (is_prepacked) {
+      b_norms = support_vector_norms_.data();
+    } else {
+      b_norms_storage.resize(n);
+      for (int64_t j = 0; j < n; ++j) {
+        b_norms_storage[j] = SquaredNorm(b.data() + j * k, k);
+      }
+      b_norms = b_norms_storage.data();
+    }
+
+    a_norms.resize(m);
+    for (int64_t i = 0; i < m; ++i) {
+      a_norms[i] = SquaredNorm(a.data() + i * k, k);
+    }
+  } else if (kernel_type_ == KERNEL::LINEAR && scalar_C == 0.f) {
+    return;
+  }
+
+  const float c = kernel_type_ == KERNEL::LINEAR ? scalar_C : coef0_;
+
+  // apply the kernel function to blocks of each row of the output
+  const int64_t blocks_per_row = (n + kKernelBlockSize - 1) / kKernelBlockSize;
+  const double block_size = static_cast<double>(std::min(n, kKernelBlockSize));
+  const TensorOpCost cost{block_size * sizeof(float), block_size * sizeof(float),
+                          block_size * (kernel_type_ == KERNEL::LINEAR ? 1.0 : 16.0)};
+  concurrency::ThreadPool::TryParallelFor(
+      threadpool, static_cast<std::ptrdiff_t>(m * blocks_per_row), cost,
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t block = first; block < last; ++block) {
+          const int64_t row = block / blocks_per_row;
+          const int64_t begin = (block % blocks_per_row) * kKernelBlockSize;
+          const int64_t end = std::min(n, begin + kKernelBlockSize);
+          float* cur_out = out.data() + row * n + begin;
+          const size_t count = static_cast<size_t>(end - begin);
+
+          switch (kernel_type_) {
+            case KERNEL::RBF: {
+              const float* cur_a = a.data() + row * k;
+              for (int64_t j = begin; j < end; ++j) {
+                float distance = a_norms[row] + b_norms[j] + cur_out[j - begin];
+                if (distance < kCancellationRatio * (a_norms[row] + b_norms[j])) {
+                  distance = SquaredDistance(cur_a, b.data() + j * k, k);
+                }
+                cur_out[j - begin] = -gamma_ * distance;
+              }
+              MlasComputeExp(cur_out, cur_out, count);
+              break;
+            }
+            case KERNEL::POLY: {
+              auto map_out = EigenVectorArrayMap<float>(cur_out, count);
+              map_out += c;
+              if (degree_ == 2)
+                map_out = map_out.square();
+              else if (degree_ == 3)
+                map_out = map_out.cube();
+              else
+                map_out = map_out.pow(degree_);
+              break;
+            }
+            case KERNEL::SIGMOID: {
+              auto map_out = EigenVectorArrayMap<float>(cur_out, count);
+              map_out += c;
+              MlasComputeTanh(cur_out, cur_out, count);
+              break;
+            }
+            default:
+              EigenVectorArrayMap<float>(cur_out, count) += c;
+              break;
+          }
+        }
+      });
+}
+
 ONNX_CPU_OPERATOR_ML_KERNEL(
     SVMClassifier,
     1,
@@ -63,6 +230,7 @@ SVMClassifier::SVMClassifier(const OpKernelInfo& info)
   if (vector_count_ > 0) {
     feature_count_ = support_vectors_.size() / vector_count_;  //length of each support vector
     mode_ = SVM_TYPE::SVM_SVC;
+    PrepackSupportVectors(info, support_vectors_, vector_count_, feature_count_);
   } else {
     feature_count_ = coefficients_.size() / class_count_;  //liblinear mode
     mode_ = SVM_TYPE::SVM_LINEAR;
@@ -213,8 +381,8 @@ Status SVMClassifier::ComputeImpl(OpKernelContext& ctx,
     // auto out = gsl::make_span<float>(scores_data.data(), scores_data.size());
 
     // combine the coefficients with the input data and apply the kernel type
-    batched_kernel_dot<float>(x_data, coefficients_, num_batches, class_count_, feature_count_, rho_[0], final_scores,
-                              threadpool);
+    batched_kernel_dot(x_data, coefficients_, num_batches, class_count_, feature_count_, rho_[0], final_scores,
+                       threadpool);
 
   } else {
     gsl::span<float> classifier_scores;
@@ -244,67 +412,74 @@ Status SVMClassifier::ComputeImpl(OpKernelContext& ctx,
 
     // combine the input data with the support vectors and apply the kernel type
     // output is {num_batches, vector_count_}
-    batched_kernel_dot<float>(x_data, support_vectors_, num_batches, vector_count_, feature_count_, 0.f, kernels_span,
-                              threadpool);
-
-    for (int64_t n = 0; n < num_batches; n++) {
-      // reduce scores from kernels using coefficients, taking into account the varying number of support vectors
-      // per class.
-      // coefficients: [num_classes - 1, vector_count_]
-      //
-      // e.g. say you have 3 classes, with 3 x 3 coefficients
-      //
-      // AA AB AC
-      // BA BB BC
-      // CA CB CC
-      //
-      // you can remove the diagonal line of items comparing a class with itself leaving one less row.
-      //
-      // BA AB AC
-      // CA CB BC
-      //
-      // for each class there is a coefficient per support vector, and a class has one or more support vectors.
-      //
-      // Combine the scores for the two combinations for two classes with their coefficient.
-      // e.g. AB combines with BA.
-      // If A has 3 support vectors and B has 2, there's a 3x2 block for AB and a 2x3 block for BA to combine
-
-      auto cur_kernels = kernels_span.subspan(n * vector_count_, vector_count_);
-      auto cur_scores = classifier_scores.subspan(n * num_slots_per_iteration, num_classifiers);
-      auto cur_votes = votes_span.subspan(n * class_count_, class_count_);
-      auto scores_iter = cur_scores.begin();
-
-      int64_t classifier_idx = 0;
-      for (int64_t i = 0; i < class_count_ - 1; i++) {
-        int64_t start_index_i = starting_vector_[i];  // start of support vectors for class i
-        int64_t class_i_support_count = vectors_per_class_[i];
-        int64_t i_coeff_row_offset = vector_count_ * i;
-
-        for (int64_t j = i + 1; j < class_count_; j++) {
-          int64_t start_index_j = starting_vector_[j];  // start of support vectors for class j
-          int64_t class_j_support_count = vectors_per_class_[j];
-          int64_t j_coeff_row_offset = vector_count_ * (j - 1);
-
-          double sum = 0;
-
-          const float* val1 = &(coefficients_[j_coeff_row_offset + start_index_i]);
-          const float* val2 = &(cur_kernels[start_index_i]);
-          for (int64_t m = 0; m < class_i_support_count; ++m, ++val1, ++val2)
-            sum += *val1 * *val2;
-
-          val1 = &(coefficients_[i_coeff_row_offset + start_index_j]);
-          val2 = &(cur_kernels[start_index_j]);
-
-          for (int64_t m = 0; m < class_j_support_count; ++m, ++val1, ++val2)
-            sum += *val1 * *val2;
-
-          sum += rho_[classifier_idx++];
-
-          *scores_iter++ = static_cast<float>(sum);
-          ++(cur_votes[sum > 0 ? i : j]);
-        }
-      }
-    }
+    batched_kernel_dot(x_data, support_vectors_, num_batches, vector_count_, feature_count_, 0.f, kernels_span,
+                       threadpool);
+
+    // the batches write to separate scores and votes
+    const double vector_count = static_cast<double>(vector_count_);
+    const TensorOpCost cost{vector_count * sizeof(float), static_cast<double>(num_classifiers * sizeof(float)),
+                            vector_count * static_cast<double>(class_count_ - 1) * 2.0};
+    concurrency::ThreadPool::TryParallelFor(
+        threadpool, static_cast<std::ptrdiff_t>(num_batches), cost, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+          for (std::ptrdiff_t n = first; n < last; ++n) {
+            // reduce scores from kernels using coefficients, taking into account the varying number of support vectors
+            // per class.
+            // coefficients: [num_classes - 1, vector_count_]
+            //
+            // e.g. say you have 3 classes, with 3 x 3 coefficients
+            //
+            // AA AB AC
+            // BA BB BC
+            // CA CB CC
+            //
+            // you can remove the diagonal line of items comparing a class with itself leaving one less row.
+            //
+            // BA AB AC
+            // CA CB BC
+            //
+            // for each class there is a coefficient per support vector, and a class has one or more support vectors.
+            //
+            // Combine the scores for the two combinations for two classes with their coefficient.
+            // e.g. AB combines with BA.
+            // If A has 3 support vectors and B has 2, there's a 3x2 block for AB and a 2x3 block for BA to combine
+
+            auto cur_kernels = kernels_span.subspan(n * vector_count_, vector_count_);
+            auto cur_scores = classifier_scores.subspan(n * num_slots_per_iteration, num_classifiers);
+            auto cur_votes = votes_span.subspan(n * class_count_, class_count_);
+            auto scores_iter = cur_scores.begin();
+
+            int64_t classifier_idx = 0;
+            for (int64_t i = 0; i < class_count_ - 1; i++) {
+              int64_t start_index_i = starting_vector_[i];  // start of support vectors for class i
+              int64_t class_i_support_count = vectors_per_class_[i];
+              int64_t i_coeff_row_offset = vector_count_ * i;
+
+              for (int64_t j = i + 1; j < class_count_; j++) {
+                int64_t start_index_j = starting_vector_[j];  // start of support vectors for class j
+                int64_t class_j_support_count = vectors_per_class_[j];
+                int64_t j_coeff_row_offset = vector_count_ * (j - 1);
+
+                double sum = 0;
+
+                const float* val1 = &(coefficients_[j_coeff_row_offset + start_index_i]);
+                const float* val2 = &(cur_kernels[start_index_i]);
+                for (int64_t m = 0; m < class_i_support_count; ++m, ++val1, ++val2)
+                  sum += *val1 * *val2;
+
+                val1 = &(coefficients_[i_coeff_row_offset + start_index_j]);
+                val2 = &(cur_kernels[start_index_j]);
+
+                for (int64_t m = 0; m < class_j_support_count; ++m, ++val1, ++val2)
+                  sum += *val1 * *val2;
+
+                sum += rho_[classifier_idx++];
+
+                *scores_iter++ = static_cast<float>(sum);
+                ++(cur_votes[sum > 0 ? i : j]);
+              }
+            }
+          }
+        });
   }
 
   auto finalize_batch = [this, &final_scores, final_scores_per_batch,
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/common/common.h"
+#include "core/framework/buffer_deleter.h"
 #include "core/framework/op_kernel.h"
 #include "core/util/math_cpuonly.h"
 #include "ml_common.h"
@@ -30,76 +31,32 @@ class SVMCommon {
   void set_kernel_type(KERNEL new_kernel_type) { kernel_type_ = new_kernel_type; }
   KERNEL get_kernel_type() const { return kernel_type_; }
 
-  template <typename T>
-  void batched_kernel_dot(const gsl::span<const T> a, const gsl::span<const T> b,
+  // Pack the support vectors [vector_count, feature_count] as the B matrix of the MLAS SGEMM once, when the kernel is
+  // created, and compute their squared norms for the RBF kernel.
+  void PrepackSupportVectors(const OpKernelInfo& info, gsl::span<const float> support_vectors,
+                             int64_t vector_count, int64_t feature_count);
+
+  // Apply the kernel to each row of 'a' [m, k] and each row of 'b' [n, k]. The output is [m, n].
+  // 'b' are the support vectors given to PrepackSupportVectors, or the coefficients of the linear mode in which case
+  // scalar_C is added to the dot products.
+  // The dot products are computed with a GEMM, and the squared distances of the RBF kernel from
+  // ||a||^2 + ||b||^2 - 2 a.b. The kernel function is then applied to blocks of the output in parallel.
+  void batched_kernel_dot(gsl::span<const float> a, gsl::span<const float> b,
                           int64_t m, int64_t n, int64_t k,
                           float scalar_C,
-                          const gsl::span<T> out,
-                          concurrency::ThreadPool* threadpool) const {
-    assert(a.size() == size_t(m * k) && b.size() == size_t(k * n) && out.size() == size_t(m * n));
-
-    if (kernel_type_ == KERNEL::RBF) {
-      T* cur_out = out.data();
-      const T* cur_batch = a.data();
-
-      // each batch has 'k' features
-      for (int64_t batch = 0; batch < m; ++batch) {
-        const T* cur_support_vector = b.data();
-
-        // broadcast the support vectors against the k features in each batch. output is one value per support vector
-        for (int64_t support_vector = 0; support_vector < n; ++support_vector) {
-          T sum = 0.f;
-          const T* cur_input = cur_batch;
-
-          for (int64_t feature = 0; feature < k; ++feature) {
-            T val = *cur_input++ - *cur_support_vector++;
-            sum += val * val;
-          }
-
-          *cur_out++ = std::exp(-gamma_ * sum);
-        }
-
-        cur_batch += k;  // move to start of next batch
-      }
-    } else {
-      float alpha = 1.f;
-      float beta = 1.f;
-      static const TensorShape shape_C({1});
-      float c = scalar_C;  // scalar_C is used for LINEAR in the GEMM
-
-      if (kernel_type_ != KERNEL::LINEAR) {
-        // kernel_type_ == POLY or SIGMOID
-        alpha = gamma_;
-        c = coef0_;
-      }
-
-      onnxruntime::Gemm<T>::ComputeGemm(CBLAS_TRANSPOSE::CblasNoTrans, CBLAS_TRANSPOSE::CblasTrans,
-                                        m, n, k,
-                                        alpha, a.data(), b.data(), beta,
-                                        c != 0.f ? &c : nullptr, &shape_C,
-                                        out.data(),
-                                        threadpool);
-
-      if (kernel_type_ == KERNEL::POLY) {
-        auto map_out = EigenVectorArrayMap<T>(out.data(), out.size());
-        if (degree_ == 2)
-          map_out = map_out.square();
-        else if (degree_ == 3)
-          map_out = map_out.cube();
-        else
-          map_out = map_out.pow(degree_);
-
-      } else if (kernel_type_ == KERNEL::SIGMOID) {
-        MlasComputeTanh(out.data(), out.data(), out.size());
-      }
-    }
-  }
+                          gsl::span<float> out,
+                          concurrency::ThreadPool* threadpool) const;
 
  private:
   KERNEL kernel_type_;
   float gamma_{0.f};
   float coef0_{0.f};
   float degree_{0.f};
+
+  // set by PrepackSupportVectors
+  const float* packed_source_{nullptr};
+  BufferUniquePtr packed_support_vectors_;
+  std::vector<float> support_vector_norms_;
 };
 
 class SVMClassifier final : public OpKernel, private SVMCommon {
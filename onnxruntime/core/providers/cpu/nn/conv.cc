@@ -18,11 +18,59 @@
 #include "core/providers/cpu/nn/conv.h"
 
 #include "core/common/safeint.h"
+#include "core/providers/cpu/kernel_cost_utils.h"
 #include "core/util/math_cpuonly.h"
 
 namespace onnxruntime {
 using ConvPadVector = ConvAttributes::ConvPadVector;
 
+namespace {
+
+// Each output element is a dot product of length C / group * kernel_size, i.e. 2 FLOPs per multiply-accumulate.
+// The inputs are read once and the output is written once, ignoring the im2col buffer.
+bool ConvCost(const ConvAttributes& conv_attrs, const OpKernelContext& context, size_t element_size,
+              KernelCost& cost) {
+  const auto* X = context.Input<Tensor>(0);
+  const auto* W = context.Input<Tensor>(1);
+  if (!conv_attrs.ValidateInputShape(X, W).IsOK()) {
+    return false;
+  }
+
+  TensorShapeVector kernel_shape;
+  if (!conv_attrs.ComputeKernelShape(W->Shape(), kernel_shape).IsOK()) {
+    return false;
+  }
+
+  ConvPadVector pads(conv_attrs.pads);
+  if (pads.empty()) {
+    pads.resize(kernel_shape.size() * 2, 0);
+  }
+  TensorShapeVector dilations(conv_attrs.dilations);
+  if (dilations.empty()) {
+    dilations.resize(kernel_shape.size(), 1);
+  }
+  TensorShapeVector strides(conv_attrs.strides);
+  if (strides.empty()) {
+    strides.resize(kernel_shape.size(), 1);
+  }
+
+  const int64_t C = X->Shape()[1];
+  TensorShapeVector Y_dims({X->Shape()[0], W->Shape()[0]});
+  if (!conv_attrs.InferPadsAndOutputShape(X->Shape().Slice(2), kernel_shape, strides, dilations, pads, Y_dims)
+           .IsOK()) {
+    return false;
+  }
+
+  const auto output_size = static_cast<double>(TensorShape(Y_dims).Size());
+  const auto kernel_dim = static_cast<double>(C / conv_attrs.group * TensorShape(kernel_shape).Size());
+  cost.flops = 2.0 * output_size * kernel_dim;
+  cost.bytes_read = kernel_cost_utils::InputBytes(context);
+  cost.bytes_written = output_size * static_cast<double>(element_size);
+  return true;
+}
+
+}  // namespace
+
 template <typename T>
 Status Conv<T>::Compute(OpKernelContext* context) const {
   const auto* X = context->Input<Tensor>(0);
@@ -152,6 +200,11 @@ Status Conv<T>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+template <typename T>
+bool Conv<T>::GetCost(const OpKernelContext& context, KernelCost& cost) const {
+  return ConvCost(conv_attrs_, context, sizeof(T), cost);
+}
+
 Status Conv<float>::Compute(OpKernelContext* context) const {
   size_t num_inputs = OpKernel::Node().InputDefs().size();
   const Tensor* X = context->Input<Tensor>(0);
@@ -295,6 +348,10 @@ Status Conv<float>::Compute(OpKernelContext* context) const {
   return Status::OK();
 }
 
+bool Conv<float>::GetCost(const OpKernelContext& context, KernelCost& cost) const {
+  return ConvCost(conv_attrs_, context, sizeof(float), cost);
+}
+
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Conv,
     1, 10,
@@ -17,6 +17,8 @@ class Conv : public OpKernel {
 
   Status Compute(OpKernelContext* context) const override;
 
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override;
+
  private:
   ConvAttributes conv_attrs_;
 };
@@ -29,7 +31,9 @@ class Conv<float> : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
-  
+
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override;
+
  protected:
   MLAS_ACTIVATION activation_;
 
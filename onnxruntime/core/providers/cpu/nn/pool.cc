@@ -149,6 +149,29 @@ Status PoolBase::Compute(OpKernelContext* context, MLAS_POOLING_KIND kind) const
   return Status::OK();
 }
 
+bool PoolBase::ComputeCost(const OpKernelContext& context, KernelCost& cost) const {
+  const auto* X = context.Input<Tensor>(0);
+  const TensorShape& x_shape = X->Shape();
+  if (x_shape.NumDimensions() < 3 || x_shape.Size() == 0) {
+    return false;
+  }
+
+  const int64_t kernel_size = pool_attrs_.global_pooling ? x_shape.SizeFromDimension(2)
+                                                         : TensorShape(pool_attrs_.kernel_shape).Size();
+
+  auto pads = pool_attrs_.pads;
+  const auto output_size = static_cast<double>(TensorShape(pool_attrs_.SetOutputSize(x_shape, x_shape[1], &pads)).Size());
+
+  cost.flops = output_size * static_cast<double>(kernel_size);
+  cost.bytes_read = static_cast<double>(X->SizeInBytes());
+  cost.bytes_written = output_size * static_cast<double>(X->DataType()->Size());
+  if (context.OutputCount() > 1) {
+    // MaxPool indices
+    cost.bytes_written += output_size * sizeof(int64_t);
+  }
+  return true;
+}
+
 template <>
 Status Pool<float, MaxPool<1 /*VERSION*/>>::Compute(OpKernelContext* context) const {
   return PoolBase::Compute(context, MlasMaximumPooling);
@@ -21,6 +21,10 @@ class Pool : public OpKernel, public PoolBase {
 
   Status Compute(OpKernelContext* context) const override;
 
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override {
+    return ComputeCost(context, cost);
+  }
+
  private:
   PoolProcessContext pool_context_;
 };
@@ -42,6 +46,9 @@ class MaxPoolV8 : public OpKernel, public PoolBase {
  public:
   MaxPoolV8(const OpKernelInfo& info) : OpKernel(info), PoolBase(info) {}
   Status Compute(OpKernelContext* context) const override;
+  bool GetCost(const OpKernelContext& context, KernelCost& cost) const override {
+    return ComputeCost(context, cost);
+  }
  private:
   template <typename T>
   Status ComputeImpl(OpKernelContext* context) const;
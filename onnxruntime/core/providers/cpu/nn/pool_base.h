@@ -116,6 +116,9 @@ class PoolBase {
 
   Status Compute(OpKernelContext* context, MLAS_POOLING_KIND kind) const;
 
+  // Cost model shared by the pooling kernels: one operation per element of the pooling window of each output.
+  bool ComputeCost(const OpKernelContext& context, KernelCost& cost) const;
+
  protected:
   const std::string op_name_;
 
@@ -3,7 +3,9 @@
 
 #include "string_normalizer.h"
 #include "core/common/common.h"
+#include "core/common/utf8_util.h"
 #include "core/framework/tensor.h"
+#include "core/platform/threadpool.h"
 
 #ifdef _MSC_VER
 #include <codecvt>
@@ -15,9 +17,9 @@
 #include <iconv.h>
 #endif  // _MSC_VER
 
+#include <atomic>
+#include <cstring>
 #include <locale>
-#include <functional>
-#include <unordered_set>
 
 namespace onnxruntime {
 
@@ -192,56 +194,57 @@ const std::string default_locale("en_US.UTF-8");  // All non-MS
 
 #endif  // MS_VER
 
-template <class ForwardIter>
-Status CopyCaseAction(ForwardIter first, ForwardIter end, OpKernelContext* ctx,
-                      const Locale& loc,
-                      Utf8Converter& converter,
-                      size_t N, size_t C,
-                      StringNormalizer::CaseAction caseaction) {
-  std::vector<int64_t> output_dims;
-  if (N == 1) {
-    output_dims.push_back(1);
+// Changes the case of the ASCII letters of 'str' in place, 8 characters at a time.
+// All the characters must be ASCII.
+void ChangeAsciiCase(StringNormalizer::CaseAction caseaction, std::string& str) {
+  assert(caseaction != StringNormalizer::NONE);
+  const char first = caseaction == StringNormalizer::LOWER ? 'A' : 'a';
+  const char last = caseaction == StringNormalizer::LOWER ? 'Z' : 'z';
+
+  // The high bit of each byte of (byte + 0x80 - c) is set if byte >= c. The bytes are below 0x80 so the sums
+  // do not carry into the next byte. The case of a letter is its 0x20 bit.
+  constexpr uint64_t ones = 0x0101010101010101ULL;
+  constexpr uint64_t high_bits = 0x8080808080808080ULL;
+  const uint64_t ge_first = (0x80 - static_cast<uint64_t>(first)) * ones;
+  const uint64_t gt_last = (0x80 - static_cast<uint64_t>(last) - 1) * ones;
+
+  char* data = str.data();
+  const size_t len = str.size();
+  size_t idx = 0;
+  for (; idx + 8 <= len; idx += 8) {
+    uint64_t word;
+    memcpy(&word, data + idx, sizeof(word));
+    const uint64_t letters = (word + ge_first) & ~(word + gt_last) & high_bits;
+    word ^= letters >> 2;
+    memcpy(data + idx, &word, sizeof(word));
   }
-
-  // Empty output case
-  if (C == 0) {
-    output_dims.push_back(1);
-    TensorShape output_shape(output_dims);
-    // This will create one empty string
-    ctx->Output(0, output_shape);
-    return Status::OK();
+  for (; idx < len; ++idx) {
+    if (data[idx] >= first && data[idx] <= last) {
+      data[idx] ^= 0x20;
+    }
   }
+}
 
-  output_dims.push_back(C);
-
-  TensorShape output_shape(output_dims);
-  auto output_tensor = ctx->Output(0, output_shape);
-  auto const output_data = output_tensor->template MutableData<std::string>();
+// Changes the case of the utf8 string 'str' into 'result'. Returns false if 'str' is not valid utf8.
+bool ChangeCase(StringNormalizer::CaseAction caseaction, const std::string& str,
+                const Locale& loc, bool ascii_case_mapping, Utf8Converter& converter,
+                std::string& result) {
+  if (ascii_case_mapping && utf8_util::is_ascii(reinterpret_cast<const unsigned char*>(str.data()), str.size())) {
+    result = str;
+    ChangeAsciiCase(caseaction, result);
+    return true;
+  }
 
-  size_t output_idx = 0;
-  while (first != end) {
-    auto& s = *first;
-    if (caseaction == StringNormalizer::LOWER || caseaction == StringNormalizer::UPPER) {
-      std::wstring wstr = converter.from_bytes(s);
-      if (wstr == wconv_error) {
-        // Please do not include the input text in the error message as it could
-        // be deemed as a compliance violation by teams using this operator
-        return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
-                      "Input contains invalid utf8 chars");
-      }
-      // In place transform
-      loc.ChangeCase(caseaction, wstr);
-      *(output_data + output_idx) = converter.to_bytes(wstr);
-    } else {
-      assert(caseaction == StringNormalizer::NONE);
-      // Simple copy or move if the iterator points to a non-const string
-      *(output_data + output_idx) = std::move(s);
-    }
-    ++output_idx;
-    ++first;
+  std::wstring wstr = converter.from_bytes(str);
+  if (wstr == wconv_error) {
+    return false;
   }
-  return Status::OK();
+  // In place transform
+  loc.ChangeCase(caseaction, wstr);
+  result = converter.to_bytes(wstr);
+  return true;
 }
+
 }  // namespace string_normalizer
 
 using namespace string_normalizer;
@@ -274,7 +277,8 @@ StringNormalizer::StringNormalizer(const OpKernelInfo& info) : OpKernel(info),
   }
 
   locale_name_ = info.GetAttrOrDefault("locale", default_locale);
-  Locale locale(locale_name_);
+  locale_ = std::make_unique<Locale>(locale_name_);
+  ascii_case_mapping_ = locale_name_.compare(0, 2, "tr") != 0 && locale_name_.compare(0, 2, "az") != 0;
   Utf8Converter converter(conv_error, wconv_error);
 
   std::vector<std::string> swords = info.GetAttrsOrDefault<std::string>("stopwords");
@@ -284,15 +288,17 @@ StringNormalizer::StringNormalizer(const OpKernelInfo& info) : OpKernel(info),
       auto p = stopwords_.insert(std::move(sw));
       ORT_ENFORCE(p.second, "Duplicate stopwords not allowed");
     } else {
-      std::wstring wstr = converter.from_bytes(sw);
-      ORT_ENFORCE(wstr != wconv_error, "Stopword contains invalid utf8 chars");
-      locale.ChangeCase(compare_caseaction_, wstr);
-      auto p = wstopwords_.insert(std::move(wstr));
+      std::string cased;
+      ORT_ENFORCE(ChangeCase(compare_caseaction_, sw, *locale_, ascii_case_mapping_, converter, cased),
+                  "Stopword contains invalid utf8 chars");
+      auto p = stopwords_.insert(std::move(cased));
       ORT_ENFORCE(p.second, "Duplicate stopwords not allowed");
     }
   }
 }
 
+StringNormalizer::~StringNormalizer() = default;
+
 Status StringNormalizer::Compute(OpKernelContext* ctx) const {
   using namespace string_normalizer;
 
@@ -320,72 +326,87 @@ Status StringNormalizer::Compute(OpKernelContext* ctx) const {
                   "Input dimensions are either[C > 0] or [1][C > 0] allowed");
   }
 
-  Status status;
-  Locale locale(locale_name_);
-  Utf8Converter converter(conv_error, wconv_error);
+  // The strings are cased once: the case-insensitive comparison with the stop words uses the output case
+  // when there is one
+  const CaseAction filter_action = (!stopwords_.empty() && !is_case_sensitive_) ? compare_caseaction_ : NONE;
+  const CaseAction cased_action = case_change_action_ != NONE ? case_change_action_ : filter_action;
+
   auto* const input_data = X->template Data<std::string>();
-  using StrRef = std::reference_wrapper<const std::string>;
-  if (is_case_sensitive_) {
-    if (!stopwords_.empty()) {
-      InlinedVector<StrRef> filtered_strings;
-      filtered_strings.reserve(C);
-      auto first = input_data;
-      auto const last = input_data + C;
-      while (first != last) {
-        const std::string& s = *first;
-        if (0 == stopwords_.count(s)) {
-          filtered_strings.push_back(std::cref(s));
-        }
-        ++first;
-      }
-      status = CopyCaseAction(filtered_strings.cbegin(), filtered_strings.cend(), ctx, locale, converter,
-                              N, filtered_strings.size(), case_change_action_);
-    } else {
-      // Nothing to filter. Copy input to output and change case if needed
-      status = CopyCaseAction(input_data, input_data + C, ctx, locale, converter, N, C, case_change_action_);
+  std::vector<std::string> cased_strings(cased_action != NONE ? C : 0);
+  std::vector<uint8_t> keep(C, 1);
+  std::atomic<bool> invalid_utf8{false};
+
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
+  if (cased_action != NONE || !stopwords_.empty()) {
+    concurrency::ThreadPool::TryParallelFor(
+        tp, static_cast<std::ptrdiff_t>(C), TensorOpCost{64.0, 64.0, 256.0},
+        [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+          // the converter is not shared as std::wstring_convert is not thread safe
+          Utf8Converter converter(conv_error, wconv_error);
+          for (std::ptrdiff_t i = first; i < last; ++i) {
+            if (cased_action != NONE &&
+                !ChangeCase(cased_action, input_data[i], *locale_, ascii_case_mapping_, converter,
+                            cased_strings[i])) {
+              invalid_utf8 = true;
+              return;
+            }
+            if (!stopwords_.empty()) {
+              const std::string& key = filter_action != NONE ? cased_strings[i] : input_data[i];
+              keep[i] = stopwords_.count(key) == 0;
+            }
+          }
+        });
+  }
+
+  if (invalid_utf8) {
+    // Please do not include the input text in the error message as it could
+    // be deemed as a compliance violation by teams using this operator
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                  "Input contains invalid utf8 chars");
+  }
+
+  std::vector<size_t> output_indices;
+  output_indices.reserve(C);
+  for (size_t i = 0; i < C; ++i) {
+    if (keep[i]) {
+      output_indices.push_back(i);
     }
-  } else {
-    if (!wstopwords_.empty()) {
-      // Filter input. When no case action is required
-      // we simply store original string references.
-      // Otherwise, we store converted strings.
-      InlinedVector<StrRef> filtered_orignal_strings;
-      InlinedVector<std::string> filtered_cased_strings;
-      filtered_orignal_strings.reserve(C);
-      filtered_cased_strings.reserve(C);
-      auto first = input_data;
-      auto const last = input_data + C;
-      while (first != last) {
-        const std::string& s = *first;
-        std::wstring wstr = converter.from_bytes(s);
-        if (wstr == wconv_error) {
-          // Please do not include the input text in the error message as it could
-          // be deemed as a compliance violation by teams using this operator
-          return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
-                        "Input contains invalid utf8 chars");
-        }
-        locale.ChangeCase(compare_caseaction_, wstr);
-        if (0 == wstopwords_.count(wstr)) {
-          if (case_change_action_ == NONE) {
-            filtered_orignal_strings.push_back(std::cref(s));
+  }
+
+  std::vector<int64_t> output_dims;
+  if (N == 1) {
+    output_dims.push_back(1);
+  }
+
+  // Empty output case
+  if (output_indices.empty()) {
+    output_dims.push_back(1);
+    TensorShape output_shape(output_dims);
+    // This will create one empty string
+    ctx->Output(0, output_shape);
+    return Status::OK();
+  }
+
+  output_dims.push_back(static_cast<int64_t>(output_indices.size()));
+  TensorShape output_shape(output_dims);
+  auto output_tensor = ctx->Output(0, output_shape);
+  auto const output_data = output_tensor->template MutableData<std::string>();
+
+  // The cased strings were only needed for the comparison if the output keeps the input case
+  const bool output_cased = case_change_action_ != NONE;
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(output_indices.size()), TensorOpCost{64.0, 64.0, 64.0},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          const size_t input_idx = output_indices[i];
+          if (output_cased) {
+            output_data[i] = std::move(cased_strings[input_idx]);
           } else {
-            filtered_cased_strings.push_back(converter.to_bytes(wstr));
+            output_data[i] = input_data[input_idx];
           }
         }
-        ++first;
-      }
-      if (case_change_action_ == NONE) {
-        status = CopyCaseAction(filtered_orignal_strings.cbegin(), filtered_orignal_strings.cend(), ctx, locale, converter,
-                                N, filtered_orignal_strings.size(), NONE);
-      } else {
-        status = CopyCaseAction(filtered_cased_strings.begin(), filtered_cased_strings.end(), ctx, locale, converter,
-                                N, filtered_cased_strings.size(), NONE);
-      }
-    } else {
-      // Nothing to filter. Copy input to output and change case if needed
-      status = CopyCaseAction(input_data, input_data + C, ctx, locale, converter, N, C, case_change_action_);
-    }
-  }
-  return status;
+      });
+
+  return Status::OK();
 }
 }  // namespace onnxruntime
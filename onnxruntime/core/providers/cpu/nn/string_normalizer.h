@@ -7,10 +7,15 @@
 #include "core/framework/op_kernel.h"
 
 #include <locale>
+#include <memory>
 #include <string>
 
 namespace onnxruntime {
 
+namespace string_normalizer {
+class Locale;
+}  // namespace string_normalizer
+
 class StringNormalizer : public OpKernel {
  public:
   enum CaseAction {
@@ -20,7 +25,7 @@ class StringNormalizer : public OpKernel {
   };
 
   explicit StringNormalizer(const OpKernelInfo& info);
-  ~StringNormalizer() override = default;
+  ~StringNormalizer() override;
 
   Status Compute(OpKernelContext* ctx) const override;
 
@@ -29,9 +34,12 @@ class StringNormalizer : public OpKernel {
   CaseAction case_change_action_;
   CaseAction compare_caseaction_;  // used for case-insensitive compare
   std::string locale_name_;
-  // Either if these are populated but not both
+  std::unique_ptr<string_normalizer::Locale> locale_;
+  // ASCII characters are cased the same way in every locale but Turkish and Azerbaijani (dotted and dotless i),
+  // so ASCII strings skip the conversion to wide characters
+  bool ascii_case_mapping_;
+  // utf8 stop words, converted to compare_caseaction_ if the comparison is case-insensitive
   InlinedHashSet<std::string> stopwords_;
-  InlinedHashSet<std::wstring> wstopwords_;
 };
 
 }  // namespace onnxruntime
@@ -3,11 +3,13 @@
 
 #include "tfidfvectorizer.h"
 #include "core/common/common.h"
+#include "core/common/string_dictionary.h"
 #include "core/framework/tensor.h"
 #include "core/platform/threadpool.h"
 
+#include <algorithm>
 #include <functional>
-#include <unordered_map>
+#include <limits>
 
 namespace onnxruntime {
 
@@ -23,61 +25,103 @@ ONNX_CPU_OPERATOR_KERNEL(
 
 namespace ngram_details {
 
-// NgrampPart implements a Trie like structure
-// for a unigram (1) it would insert into a root map with a valid id.
-// for (1,2,3) node 2 would be a child of 1 but have id == 0
-// because (1,2) does not exists. Node 3 would have a valid id.
-template <class T>
-struct NgramPart;
+// The n-grams of the pool as a trie stored in arrays instead of a tree of maps.
+// Node 0 is the root and every other node is an item of one or more n-grams, e.g. for the n-gram (1,2,3)
+// node 2 would be a child of 1 but have an n-gram id of 0 because (1,2) does not exist. Node 3 would have a
+// valid id. An item is the value of pool_int64s or the id of the string of pool_strings in the pool dictionary.
+// The children of all the nodes are in a single open addressing hash table keyed by the parent node and the item.
+class NgramTrie {
+ public:
+  static constexpr uint32_t kRoot = 0;
+  static constexpr uint32_t kNoNode = std::numeric_limits<uint32_t>::max();
+
+  bool Empty() const { return ngram_ids_.size() == 1; }
+
+  // 0 - means no n-gram ends at this node, search for a bigger N
+  size_t NgramId(uint32_t node) const { return ngram_ids_[node]; }
+  void SetNgramId(uint32_t node, size_t ngram_id) { ngram_ids_[node] = ngram_id; }
+
+  // Child of 'node' for 'item', or kNoNode.
+  uint32_t Child(uint32_t node, int64_t item) const {
+    if (edges_.empty()) {
+      return kNoNode;
+    }
+    return edges_[FindEdge(node, item)].child;
+  }
 
-template <>
-struct NgramPart<int64_t>;
+  // Child of 'node' for 'item', which is added if it does not exist.
+  uint32_t AddChild(uint32_t node, int64_t item) {
+    // keep the table at most half full
+    if (2 * ngram_ids_.size() > edges_.size()) {
+      Rehash(std::max<size_t>(16, 2 * edges_.size()));
+    }
 
-template <>
-struct NgramPart<std::string>;
+    Edge& edge = edges_[FindEdge(node, item)];
+    if (edge.child == kNoNode) {
+      ORT_ENFORCE(ngram_ids_.size() < kNoNode, "Too many items in the n-gram pool.");
+      edge = Edge{item, node, static_cast<uint32_t>(ngram_ids_.size())};
+      ngram_ids_.push_back(0);
+    }
+    return edge.child;
+  }
 
-using NgramPartInt = NgramPart<int64_t>;
-using NgramPartString = NgramPart<std::string>;
+ private:
+  struct Edge {
+    int64_t item;
+    uint32_t parent;
+    uint32_t child;  // kNoNode for an empty slot
+  };
 
-// Avoid recursive class definitions using unique_ptr + forward declaration
-using IntMap = std::unordered_map<int64_t, std::unique_ptr<NgramPartInt>>;
+  static size_t Hash(uint32_t node, int64_t item) {
+    uint64_t h = static_cast<uint64_t>(item) * 0x9e3779b97f4a7c15ULL ^ node;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return static_cast<size_t>(h);
+  }
 
-using StrMap = std::unordered_map<std::reference_wrapper<const std::string>, std::unique_ptr<NgramPartString>,
-                                  std::hash<std::string>, std::equal_to<std::string>>;
+  // index of the edge of (node, item), or of the empty slot where it would be inserted
+  size_t FindEdge(uint32_t node, int64_t item) const {
+    const size_t mask = edges_.size() - 1;
+    for (size_t i = Hash(node, item) & mask;; i = (i + 1) & mask) {
+      const Edge& edge = edges_[i];
+      if (edge.child == kNoNode || (edge.parent == node && edge.item == item)) {
+        return i;
+      }
+    }
+  }
 
-template <>
-struct NgramPart<int64_t> {
-  size_t id_;  // 0 - means no entry, search for a bigger N
-  IntMap leafs_;
-  explicit NgramPart(size_t id) : id_(id) {}
-};
+  void Rehash(size_t num_edges) {
+    std::vector<Edge> edges(num_edges, Edge{0, 0, kNoNode});
+    const size_t mask = num_edges - 1;
+    for (const Edge& edge : edges_) {
+      if (edge.child != kNoNode) {
+        size_t i = Hash(edge.parent, edge.item) & mask;
+        while (edges[i].child != kNoNode) {
+          i = (i + 1) & mask;
+        }
+        edges[i] = edge;
+      }
+    }
+    edges_ = std::move(edges);
+  }
 
-template <>
-struct NgramPart<std::string> {
-  size_t id_;  // 0 - means no entry, search for a bigger N
-  StrMap leafs_;
-  explicit NgramPart(size_t id) : id_(id) {}
+  std::vector<size_t> ngram_ids_{0};
+  std::vector<Edge> edges_;
 };
 
 // Returns next ngram_id
-template <class K, class ForwardIter, class Map>
+template <class ForwardIter, class ToItem>
 inline size_t PopulateGrams(ForwardIter first, size_t ngrams, size_t ngram_size, size_t ngram_id,
-                            Map& c) {
+                            NgramTrie& trie, ToItem to_item) {
   for (; ngrams > 0; --ngrams) {
-    size_t n = 1;
-    Map* m = &c;
-    while (true) {
-      auto p = m->emplace(*first, std::make_unique<NgramPart<K>>(0));
-      ++first;
-      if (n == ngram_size) {
-        ORT_ENFORCE(p.first->second->id_ == 0, "Duplicate ngram detected, size: ", ngram_size, " id: ", ngram_id);
-        p.first->second->id_ = ngram_id;
-        ++ngram_id;
-        break;
-      }
-      ++n;
-      m = &p.first->second->leafs_;
+    uint32_t node = NgramTrie::kRoot;
+    for (size_t n = 0; n < ngram_size; ++n, ++first) {
+      node = trie.AddChild(node, to_item(*first));
     }
+    ORT_ENFORCE(trie.NgramId(node) == 0, "Duplicate ngram detected, size: ", ngram_size, " id: ", ngram_id);
+    trie.SetNgramId(node, ngram_id);
+    ++ngram_id;
   }
   return ngram_id;
 }
@@ -89,10 +133,6 @@ using namespace onnxruntime::ngram_details;
 
 namespace onnxruntime {
 
-inline const void* AdvanceElementPtr(const void* p, size_t elements, size_t element_size) {
-  return reinterpret_cast<const uint8_t*>(p) + elements * element_size;
-}
-
 // The weighting criteria.
 // "TF"(term frequency),
 //    the counts are propagated to output
@@ -127,11 +167,10 @@ struct TfIdfVectorizer::Impl {
   gsl::span<const int64_t> ngram_indexes_;
   gsl::span<const float> weights_;
 
-  // This map contains references to pool_string_ entries
-  // of pool_strings attribute
-  StrMap str_map_;
-  // This map contains pool_int64s entries
-  IntMap int64_map_;
+  // Ids of the strings of pool_strings attribute, which are the items of the trie when the pool has strings
+  StringDictionary pool_strings_;
+  // n-grams of pool_strings or pool_int64s attribute
+  NgramTrie trie_;
 
   size_t output_size_ = 0;
 
@@ -237,9 +276,14 @@ TfIdfVectorizer::TfIdfVectorizer(const OpKernelInfo& info) : OpKernel(info), imp
       // Skip loading into hash_set ngrams that are not in the range of [min_gram_length-max_gram_length]
       if (ngram_size >= min_gram_length && ngram_size <= max_gram_length) {
         if (pool_strings.empty()) {
-          ngram_id = PopulateGrams<int64_t>(pool_int64s.begin() + start_idx, ngrams, ngram_size, ngram_id, impl_->int64_map_);
+          ngram_id = PopulateGrams(pool_int64s.begin() + start_idx, ngrams, ngram_size, ngram_id, impl_->trie_,
+                                   [](int64_t value) { return value; });
         } else {
-          ngram_id = PopulateGrams<std::string>(pool_strings.begin() + start_idx, ngrams, ngram_size, ngram_id, impl_->str_map_);
+          auto& dictionary = impl_->pool_strings_;
+          ngram_id = PopulateGrams(pool_strings.begin() + start_idx, ngrams, ngram_size, ngram_id, impl_->trie_,
+                                   [&dictionary](const std::string& str) {
+                                     return static_cast<int64_t>(dictionary.Insert(str));
+                                   });
         }
       } else {
         ngram_id += ngrams;
@@ -313,65 +357,51 @@ void TfIdfVectorizer::OutputResult(OpKernelContext* ctx, size_t B, const std::ve
 void TfIdfVectorizer::ComputeImpl(OpKernelContext* ctx, ptrdiff_t row_num, size_t row_size,
                                   std::vector<uint32_t>& frequencies) const {
   auto X = ctx->Input<Tensor>(0);
-  const auto elem_size = X->DataType()->Size();
+  const auto& impl = *impl_;
 
-  const void* const row_begin = AdvanceElementPtr(X->DataRaw(), row_num * row_size, elem_size);
-  const void* const row_end = AdvanceElementPtr(row_begin, row_size, elem_size);
+  // Items of the row, looked up once in the pool dictionary for the strings. A string that is not in the pool is
+  // -1, which is not an item of the trie.
+  std::vector<int64_t> row(row_size);
+  const auto row_offset = static_cast<size_t>(row_num) * row_size;
+  if (X->IsDataTypeString()) {
+    const std::string* input = X->Data<std::string>() + row_offset;
+    for (size_t i = 0; i < row_size; ++i) {
+      const auto id = impl.pool_strings_.Find(input[i]);
+      row[i] = id == StringDictionary::kNotFound ? -1 : static_cast<int64_t>(id);
+    }
+  } else if (X->IsDataType<int32_t>()) {
+    const int32_t* input = X->Data<int32_t>() + row_offset;
+    std::copy(input, input + row_size, row.begin());
+  } else {
+    const int64_t* input = X->Data<int64_t>() + row_offset;
+    std::copy(input, input + row_size, row.begin());
+  }
 
-  const auto& impl = *impl_;
+  const auto& trie = impl.trie_;
   const auto max_gram_length = impl.max_gram_length_;
   const auto max_skip_distance = impl.max_skip_count_ + 1;  // Convert to distance
   auto start_ngram_size = impl.min_gram_length_;
+  const int64_t row_end = static_cast<int64_t>(row_size);
 
   for (auto skip_distance = 1; skip_distance <= max_skip_distance; ++skip_distance) {
-    auto ngram_start = row_begin;
-    auto const ngram_row_end = row_end;
-
-    while (ngram_start < ngram_row_end) {
+    for (int64_t ngram_start = 0; ngram_start < row_end; ++ngram_start) {
       // We went far enough so no n-grams of any size can be gathered
-      auto at_least_this = AdvanceElementPtr(ngram_start, skip_distance * (start_ngram_size - 1), elem_size);
-      if (at_least_this >= ngram_row_end) {
+      if (ngram_start + skip_distance * (start_ngram_size - 1) >= row_end) {
         break;
       }
 
-      auto ngram_item = ngram_start;
-      if (X->IsDataTypeString()) {
-        const std::string* str_item = reinterpret_cast<const std::string*>(ngram_item);
-        const StrMap* str_map = &impl.str_map_;
-        for (auto ngram_size = 1;
-             !str_map->empty() &&
-             ngram_size <= max_gram_length &&
-             str_item < ngram_row_end;
-             ++ngram_size, str_item += skip_distance) {
-          auto hit = str_map->find(*str_item);
-          if (hit == str_map->end()) {
-            break;
-          }
-          if (ngram_size >= start_ngram_size && hit->second->id_ != 0) {
-            impl.IncrementCount(hit->second->id_, row_num, frequencies);
-          }
-          str_map = &hit->second->leafs_;
+      uint32_t node = NgramTrie::kRoot;
+      for (int64_t ngram_size = 1, item = ngram_start;
+           ngram_size <= max_gram_length && item < row_end;
+           ++ngram_size, item += skip_distance) {
+        node = trie.Child(node, row[item]);
+        if (node == NgramTrie::kNoNode) {
+          break;
         }
-      } else {
-        const IntMap* int_map = &impl.int64_map_;
-        for (auto ngram_size = 1;
-             !int_map->empty() &&
-             ngram_size <= max_gram_length &&
-             ngram_item < ngram_row_end;
-             ++ngram_size, ngram_item = AdvanceElementPtr(ngram_item, skip_distance, elem_size)) {
-          int64_t val = (X->IsDataType<int32_t>()) ? int64_t{*reinterpret_cast<const int32_t*>(ngram_item)} : *reinterpret_cast<const int64_t*>(ngram_item);
-          auto hit = int_map->find(val);
-          if (hit == int_map->end()) {
-            break;
-          }
-          if (ngram_size >= start_ngram_size && hit->second->id_ != 0) {
-            impl.IncrementCount(hit->second->id_, row_num, frequencies);
-          }
-          int_map = &hit->second->leafs_;
+        if (ngram_size >= start_ngram_size && trie.NgramId(node) != 0) {
+          impl.IncrementCount(trie.NgramId(node), row_num, frequencies);
         }
       }
-      // Sliding window shift
-      ngram_start = AdvanceElementPtr(ngram_start, 1, elem_size);
     }
     // We count UniGrams only once since they are not affected
     // by skip distance
@@ -417,8 +447,8 @@ Status TfIdfVectorizer::Compute(OpKernelContext* ctx) const {
   frequencies.resize(num_rows * impl_->output_size_, 0);
 
   if (total_items == 0 ||
-      (X->IsDataTypeString() && impl_->str_map_.empty()) ||
-      ((X->IsDataType<int32_t>() || X->IsDataType<int64_t>()) && impl_->int64_map_.empty())) {
+      impl_->trie_.Empty() ||
+      X->IsDataTypeString() == impl_->pool_strings_.Empty()) {  // the input and the pool have different types
     // TfidfVectorizer may receive an empty input when it follows a Tokenizer
     // (for example for a string containing only stopwords).
     // TfidfVectorizer returns a zero tensor of shape
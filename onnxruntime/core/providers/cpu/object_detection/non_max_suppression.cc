@@ -13,7 +13,8 @@ limitations under the License.
 
 #include "non_max_suppression.h"
 #include "non_max_suppression_helper.h"
-#include <queue>
+#include "core/platform/threadpool.h"
+#include <algorithm>
 #include <utility>
 //TODO:fix the warnings
 #ifdef _MSC_VER
@@ -114,6 +115,107 @@ Status NonMaxSuppressionBase::GetThresholdsFromInputs(const PrepareContext& pc,
   return Status::OK();
 }
 
+namespace {
+
+// Boxes of one batch as [x_min, x_max] x [y_min, y_max] corners, one array per coordinate, so that the IOU of a box
+// with a block of boxes is computed with the same arithmetic as SuppressByIOU in a loop the compiler vectorizes.
+struct BoxCorners {
+  std::vector<float> x_min;
+  std::vector<float> y_min;
+  std::vector<float> x_max;
+  std::vector<float> y_max;
+  std::vector<float> area;
+
+  void Resize(size_t size) {
+    x_min.resize(size);
+    y_min.resize(size);
+    x_max.resize(size);
+    y_max.resize(size);
+    area.resize(size);
+  }
+
+  void Set(size_t i, float x1, float y1, float x2, float y2) {
+    x_min[i] = x1;
+    y_min[i] = y1;
+    x_max[i] = x2;
+    y_max[i] = y2;
+    area[i] = (x2 - x1) * (y2 - y1);
+  }
+
+  void Init(const float* boxes, int64_t num_boxes, int64_t center_point_box) {
+    Resize(static_cast<size_t>(num_boxes));
+    for (size_t i = 0; i < static_cast<size_t>(num_boxes); ++i) {
+      const float* box = boxes + 4 * i;
+      float x1, y1, x2, y2;
+      // center_point_box_ only support 0 or 1
+      if (0 == center_point_box) {
+        // boxes data format [y1, x1, y2, x2]
+        MaxMin(box[1], box[3], x1, x2);
+        MaxMin(box[0], box[2], y1, y2);
+      } else {
+        // 1 == center_point_box_ => boxes data format [x_center, y_center, width, height]
+        const float width_half = box[2] / 2;
+        const float height_half = box[3] / 2;
+        x1 = box[0] - width_half;
+        x2 = box[0] + width_half;
+        y1 = box[1] - height_half;
+        y2 = box[1] + height_half;
+      }
+      Set(i, x1, y1, x2, y2);
+    }
+  }
+};
+
+// Number of selected boxes checked together before testing whether one of them suppresses the candidate
+constexpr size_t kIOUBlockSize = 16;
+
+// Returns true if one of the selected boxes overlaps box 'index' of 'boxes' by more than 'iou_threshold'.
+bool SuppressedBySelected(const BoxCorners& boxes, size_t index, const BoxCorners& selected, size_t num_selected,
+                          float iou_threshold) {
+  const float x1_min = boxes.x_min[index];
+  const float y1_min = boxes.y_min[index];
+  const float x1_max = boxes.x_max[index];
+  const float y1_max = boxes.y_max[index];
+  const float area1 = boxes.area[index];
+  if (area1 <= .0f) {
+    return false;
+  }
+
+  const float* x2_min = selected.x_min.data();
+  const float* y2_min = selected.y_min.data();
+  const float* x2_max = selected.x_max.data();
+  const float* y2_max = selected.y_max.data();
+  const float* area2 = selected.area.data();
+
+  for (size_t block_start = 0; block_start < num_selected; block_start += kIOUBlockSize) {
+    const size_t block_end = std::min(num_selected, block_start + kIOUBlockSize);
+    // no early exit inside the block, so the loop has no branches
+    int suppressed = 0;
+    for (size_t j = block_start; j < block_end; ++j) {
+      const float intersection_x_min = std::max(x1_min, x2_min[j]);
+      const float intersection_x_max = std::min(x1_max, x2_max[j]);
+      const float intersection_y_min = std::max(y1_min, y2_min[j]);
+      const float intersection_y_max = std::min(y1_max, y2_max[j]);
+      const float intersection_area = (intersection_x_max - intersection_x_min) *
+                                      (intersection_y_max - intersection_y_min);
+      const float union_area = area1 + area2[j] - intersection_area;
+      suppressed |= static_cast<int>(intersection_x_max > intersection_x_min) &
+                    static_cast<int>(intersection_y_max > intersection_y_min) &
+                    static_cast<int>(intersection_area > .0f) &
+                    static_cast<int>(area2[j] > .0f) &
+                    static_cast<int>(union_area > .0f) &
+                    static_cast<int>(intersection_area / union_area > iou_threshold);
+    }
+    if (suppressed != 0) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace
+
 Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
   PrepareContext pc;
   ORT_RETURN_IF_ERROR(PrepareCompute(ctx, pc));
@@ -138,68 +240,100 @@ Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
 
     BoxInfoPtr() = default;
     explicit BoxInfoPtr(float score, int64_t idx) : score_(score), index_(idx) {}
+    // Higher scores first, the lower index first for equal scores
     inline bool operator<(const BoxInfoPtr& rhs) const {
-      return score_ < rhs.score_ || (score_ == rhs.score_ && index_ > rhs.index_);
+      return score_ > rhs.score_ || (score_ == rhs.score_ && index_ < rhs.index_);
     }
   };
 
   const auto center_point_box = GetCenterPointBox();
-
-  std::vector<SelectedIndex> selected_indices;
-  std::vector<BoxInfoPtr> selected_boxes_inside_class;
-  selected_boxes_inside_class.reserve(std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_));
-
-  for (int64_t batch_index = 0; batch_index < pc.num_batches_; ++batch_index) {
-    for (int64_t class_index = 0; class_index < pc.num_classes_; ++class_index) {
-      int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
-      const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
-      std::vector<BoxInfoPtr> candidate_boxes;
-      candidate_boxes.reserve(pc.num_boxes_);
-
-      // Filter by score_threshold_
-      const auto* class_scores = scores_data + box_score_offset;
-      if (pc.score_threshold_ != nullptr) {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          if (*class_scores > score_threshold) {
-            candidate_boxes.emplace_back(*class_scores, box_index);
-          }
-        }
-      } else {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          candidate_boxes.emplace_back(*class_scores, box_index);
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
+
+  // The corners of the boxes are shared by all the classes of a batch
+  std::vector<BoxCorners> batch_corners(static_cast<size_t>(pc.num_batches_));
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(pc.num_batches_),
+      TensorOpCost{static_cast<double>(pc.num_boxes_) * 16.0, static_cast<double>(pc.num_boxes_) * 20.0,
+                   static_cast<double>(pc.num_boxes_) * 8.0},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t batch_index = first; batch_index < last; ++batch_index) {
+          batch_corners[batch_index].Init(boxes_data + (batch_index * pc.num_boxes_ * 4), pc.num_boxes_,
+                                          center_point_box);
         }
-      }
-      std::priority_queue<BoxInfoPtr, std::vector<BoxInfoPtr>> sorted_boxes(std::less<BoxInfoPtr>(), std::move(candidate_boxes));
-
-      selected_boxes_inside_class.clear();
-      // Get the next box with top score, filter by iou_threshold
-      while (!sorted_boxes.empty() && static_cast<int64_t>(selected_boxes_inside_class.size()) < max_output_boxes_per_class) {
-        const BoxInfoPtr& next_top_score = sorted_boxes.top();
-
-        bool selected = true;
-        // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold
-        for (const auto& selected_index : selected_boxes_inside_class) {
-          if (SuppressByIOU(batch_boxes, next_top_score.index_, selected_index.index_, center_point_box, iou_threshold)) {
-            selected = false;
-            break;
+      });
+
+  // Every (batch, class) pair is processed independently, its selected boxes are kept in its own vector and
+  // concatenated in order afterwards so the output does not depend on the scheduling
+  const size_t num_pairs = static_cast<size_t>(pc.num_batches_ * pc.num_classes_);
+  const size_t max_selected = std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_);
+  std::vector<std::vector<int64_t>> selected_per_pair(num_pairs);
+
+  const double num_boxes = static_cast<double>(pc.num_boxes_);
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_pairs),
+      TensorOpCost{num_boxes * 4.0, static_cast<double>(max_selected) * 8.0, num_boxes * 32.0},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        std::vector<BoxInfoPtr> candidate_boxes;
+        candidate_boxes.reserve(pc.num_boxes_);
+        BoxCorners selected_corners;
+        selected_corners.Resize(max_selected);
+
+        for (std::ptrdiff_t pair = first; pair < last; ++pair) {
+          const int64_t batch_index = pair / pc.num_classes_;
+          const BoxCorners& corners = batch_corners[batch_index];
+          candidate_boxes.clear();
+
+          // Filter by score_threshold_ before sorting, most boxes of a detection model are below it
+          const auto* class_scores = scores_data + pair * pc.num_boxes_;
+          if (pc.score_threshold_ != nullptr) {
+            for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index) {
+              if (class_scores[box_index] > score_threshold) {
+                candidate_boxes.emplace_back(class_scores[box_index], box_index);
+              }
+            }
+          } else {
+            for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index) {
+              candidate_boxes.emplace_back(class_scores[box_index], box_index);
+            }
           }
-        }
 
-        if (selected) {
-          selected_boxes_inside_class.push_back(next_top_score);
-          selected_indices.emplace_back(batch_index, class_index, next_top_score.index_);
+          // Get the next box with top score, filter by iou_threshold
+          std::stable_sort(candidate_boxes.begin(), candidate_boxes.end());
+          auto& selected_indices = selected_per_pair[pair];
+          for (const auto& candidate : candidate_boxes) {
+            if (selected_indices.size() == max_selected) {
+              break;
+            }
+
+            // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union)
+            // threshold
+            const size_t index = static_cast<size_t>(candidate.index_);
+            if (!SuppressedBySelected(corners, index, selected_corners, selected_indices.size(), iou_threshold)) {
+              selected_corners.Set(selected_indices.size(), corners.x_min[index], corners.y_min[index],
+                                   corners.x_max[index], corners.y_max[index]);
+              selected_indices.push_back(candidate.index_);
+            }
+          }
         }
-        sorted_boxes.pop();
-      }  //while
-    }    //for class_index
-  }      //for batch_index
+      });
+
+  size_t num_selected = 0;
+  for (const auto& selected_indices : selected_per_pair) {
+    num_selected += selected_indices.size();
+  }
 
   constexpr auto last_dim = 3;
-  const auto num_selected = selected_indices.size();
   Tensor* output = ctx->Output(0, {static_cast<int64_t>(num_selected), last_dim});
   ORT_ENFORCE(output != nullptr);
   static_assert(last_dim * sizeof(int64_t) == sizeof(SelectedIndex), "Possible modification of SelectedIndex");
-  memcpy(output->MutableData<int64_t>(), selected_indices.data(), num_selected * sizeof(SelectedIndex));
+  auto* output_data = reinterpret_cast<SelectedIndex*>(output->MutableData<int64_t>());
+  for (size_t pair = 0; pair < num_pairs; ++pair) {
+    const int64_t batch_index = static_cast<int64_t>(pair) / pc.num_classes_;
+    const int64_t class_index = static_cast<int64_t>(pair) % pc.num_classes_;
+    for (int64_t box_index : selected_per_pair[pair]) {
+      *output_data++ = SelectedIndex(batch_index, class_index, box_index);
+    }
+  }
 
   return Status::OK();
 }
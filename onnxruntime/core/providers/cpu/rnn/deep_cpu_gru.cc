@@ -161,6 +161,72 @@ ONNX_CPU_OPERATOR_KERNEL(
 
 using namespace rnn::detail;
 
+bool DeepCpuGruOp::TryPackWeights(const Tensor& weights, size_t row_offset, size_t N,
+                                  PackedWeights& packed_weights, AllocatorPtr& alloc) {
+  // weights: [num_directions, 3*hidden_size, input_size]
+  // recurrence weights: [num_directions, 3*hidden_size, hidden_size]
+  const auto& shape = weights.Shape();
+  if (shape.NumDimensions() != 3 || shape[0] != num_directions_ || shape[1] != static_cast<int64_t>(hidden_size_) * 3) {
+    return false;
+  }
+
+  return PackWeights(weights, row_offset, N, packed_weights, alloc);
+}
+
+Status DeepCpuGruOp::PrePack(const Tensor& tensor, int input_idx,
+                             AllocatorPtr alloc, /*out*/ bool& is_packed,
+                             /*out*/ PrePackedWeights* prepacked_weights) {
+  is_packed = false;
+
+  if (!tensor.IsDataType<float>()) {
+    return Status::OK();
+  }
+
+  const size_t hidden_size = static_cast<size_t>(hidden_size_);
+  bool share_prepacked_weights = (prepacked_weights != nullptr);
+
+  if (input_idx == 1) {
+    is_packed = TryPackWeights(tensor, 0, 3 * hidden_size, packed_W_, alloc);
+
+    if (is_packed && share_prepacked_weights) {
+      prepacked_weights->buffers_.push_back(std::move(packed_W_.buffer_));
+      prepacked_weights->buffer_sizes_.push_back(packed_W_.buffer_size_);
+    }
+  } else if (input_idx == 2) {
+    // Ht-1*(R[zr]^T) and (rt (.) Ht-1)*(Rh^T) are separate GEMMs, so R[zr] and R[h] are packed separately
+    is_packed = TryPackWeights(tensor, 0, 2 * hidden_size, packed_R_zr_, alloc) &&
+                TryPackWeights(tensor, 2 * hidden_size, hidden_size, packed_R_h_, alloc);
+
+    if (!is_packed) {
+      packed_R_zr_.buffer_.reset();
+    } else if (share_prepacked_weights) {
+      prepacked_weights->buffers_.push_back(std::move(packed_R_zr_.buffer_));
+      prepacked_weights->buffer_sizes_.push_back(packed_R_zr_.buffer_size_);
+      prepacked_weights->buffers_.push_back(std::move(packed_R_h_.buffer_));
+      prepacked_weights->buffer_sizes_.push_back(packed_R_h_.buffer_size_);
+    }
+  }
+
+  return Status::OK();
+}
+
+Status DeepCpuGruOp::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                               int input_idx,
+                                               /*out*/ bool& used_shared_buffers) {
+  used_shared_buffers = false;
+
+  if (input_idx == 1) {
+    used_shared_buffers = true;
+    packed_W_.buffer_ = std::move(prepacked_buffers[0]);
+  } else if (input_idx == 2) {
+    used_shared_buffers = true;
+    packed_R_zr_.buffer_ = std::move(prepacked_buffers[0]);
+    packed_R_h_.buffer_ = std::move(prepacked_buffers[1]);
+  }
+
+  return Status::OK();
+}
+
 // internal helper code
 namespace detail {
 
@@ -174,8 +240,8 @@ class UniDirectionalGru {
                     onnxruntime::concurrency::ThreadPool* ttp);
 
   void Compute(const gsl::span<const T>& inputs, const gsl::span<const int>& sequence_lengths, int num_directions,
-               const gsl::span<const T>& input_weights, const gsl::span<const T>& recurrent_weights,
-               gsl::span<T>& outputs, gsl::span<T>& final_hidden_state);
+               const GemmWeights<T>& input_weights, const GemmWeights<T>& recurrent_weights_ZR,
+               const GemmWeights<T>& recurrent_weights_H, gsl::span<T>& outputs, gsl::span<T>& final_hidden_state);
 
   ~UniDirectionalGru() = default;
 
@@ -236,6 +302,9 @@ class UniDirectionalGru {
   deepcpu::ActivationFuncPtr update_gate_{};
   deepcpu::GruOutputGateFuncPtr output_gate_{};
 
+  // the default activations use the fused gate functions
+  bool use_fused_gates_{};
+
   void AllocateBuffers();
 
   onnxruntime::concurrency::ThreadPool* ttp_;
@@ -271,8 +340,13 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   concurrency::ThreadPool* thread_pool = context.GetOperatorThreadPool();
 
   const Tensor& X = *context.Input<Tensor>(0);  // inputs. [seq_length, batch_size, input_size]
-  const Tensor& W = *context.Input<Tensor>(1);  // weights. [num_directions, 3*hidden_size, input_size]
-  const Tensor& R = *context.Input<Tensor>(2);  // recurrence weights. [num_directions, 3*hidden_size, hidden_size]
+  // weights. [num_directions, 3*hidden_size, input_size]
+  const Tensor* W = packed_W_.buffer_ ? nullptr : context.Input<Tensor>(1);
+  // recurrence weights. [num_directions, 3*hidden_size, hidden_size]
+  const Tensor* R = packed_R_zr_.buffer_ ? nullptr : context.Input<Tensor>(2);
+
+  const auto& W_shape = (W != nullptr) ? W->Shape() : packed_W_.shape_;
+  const auto& R_shape = (R != nullptr) ? R->Shape() : packed_R_zr_.shape_;
 
   // optional
   const auto* B = context.Input<Tensor>(3);              // bias. [num_directions, 6*hidden_size]
@@ -285,7 +359,7 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   int batch_size = gsl::narrow<int>(X_shape[1]);
   int input_size = gsl::narrow<int>(X_shape[2]);
 
-  auto status = ValidateCommonRnnInputs(X, W.Shape(), R.Shape(), B, 3, sequence_lens, initial_h, num_directions_, hidden_size_);
+  auto status = ValidateCommonRnnInputs(X, W_shape, R_shape, B, 3, sequence_lens, initial_h, num_directions_, hidden_size_);
   ORT_RETURN_IF_ERROR(status);
 
   // GRU outputs are optional but must be in the same order
@@ -308,8 +382,9 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   AllocatorPtr alloc;
   status = context.GetTempSpaceAllocator(&alloc);
   ORT_RETURN_IF_ERROR(status);
-  gsl::span<const T> input_weights = W.DataAsSpan<T>();
-  gsl::span<const T> recurrent_weights = R.DataAsSpan<T>();
+  const T* input_weights = (W != nullptr) ? W->Data<T>() : nullptr;
+  const T* recurrent_weights_ZR = (R != nullptr) ? R->Data<T>() : nullptr;
+  const T* recurrent_weights_H = (R != nullptr) ? recurrent_weights_ZR + 2 * hidden_size_ * hidden_size_ : nullptr;
   gsl::span<const T> bias = B != nullptr ? B->DataAsSpan<T>() : gsl::span<const T>();
 
   // spans for first direction
@@ -317,8 +392,9 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
   const size_t recurrent_weights_size_per_direction = 3 * hidden_size_ * hidden_size_;
   const size_t bias_size_per_direction = 6 * hidden_size_;
 
-  gsl::span<const T> input_weights_1 = input_weights.subspan(0, input_weights_size_per_direction);
-  gsl::span<const T> recurrent_weights_1 = recurrent_weights.subspan(0, recurrent_weights_size_per_direction);
+  GemmWeights<T> input_weights_1(0, input_weights, input_weights_size_per_direction, packed_W_);
+  GemmWeights<T> recurrent_weights_ZR_1(0, recurrent_weights_ZR, recurrent_weights_size_per_direction, packed_R_zr_);
+  GemmWeights<T> recurrent_weights_H_1(0, recurrent_weights_H, recurrent_weights_size_per_direction, packed_R_h_);
   gsl::span<const T> bias_1 = bias.empty() ? bias : bias.subspan(0, bias_size_per_direction);
 
   gsl::span<const T> input = X.DataAsSpan<T>();
@@ -353,10 +429,10 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
 
   if (direction_ == Direction::kBidirectional) {
     // spans for second direction
-    gsl::span<const T> input_weights_2 = input_weights.subspan(input_weights_size_per_direction,
-                                                               input_weights_size_per_direction);
-    gsl::span<const T> recurrent_weights_2 = recurrent_weights.subspan(recurrent_weights_size_per_direction,
-                                                                       recurrent_weights_size_per_direction);
+    GemmWeights<T> input_weights_2(1, input_weights, input_weights_size_per_direction, packed_W_);
+    GemmWeights<T> recurrent_weights_ZR_2(1, recurrent_weights_ZR, recurrent_weights_size_per_direction,
+                                          packed_R_zr_);
+    GemmWeights<T> recurrent_weights_H_2(1, recurrent_weights_H, recurrent_weights_size_per_direction, packed_R_h_);
     gsl::span<const T> bias_2 = bias.empty() ? bias : bias.subspan(bias_size_per_direction, bias_size_per_direction);
 
     gsl::span<const T> initial_hidden_2 = initial_hidden.empty()
@@ -375,24 +451,24 @@ Status DeepCpuGruOp::ComputeImpl(OpKernelContext& context) const {
                                     activation_funcs_.Entries()[0],
                                     activation_funcs_.Entries()[1],
                                     clip_, thread_pool);
-    fw.Compute(input, sequence_lens_span, num_directions_, input_weights_1, recurrent_weights_1,
-               output_1, hidden_output_1);
+    fw.Compute(input, sequence_lens_span, num_directions_, input_weights_1, recurrent_weights_ZR_1,
+               recurrent_weights_H_1, output_1, hidden_output_1);
 
     detail::UniDirectionalGru<T> bw(alloc, seq_length, batch_size, input_size, hidden_size_,
                                     linear_before_reset_ != 0, Direction::kReverse, bias_2, initial_hidden_2,
                                     activation_funcs_.Entries()[2],
                                     activation_funcs_.Entries()[3],
                                     clip_, thread_pool);
-    bw.Compute(input, sequence_lens_span, num_directions_, input_weights_2, recurrent_weights_2,
-               output_2, hidden_output_2);
+    bw.Compute(input, sequence_lens_span, num_directions_, input_weights_2, recurrent_weights_ZR_2,
+               recurrent_weights_H_2, output_2, hidden_output_2);
   } else {
     detail::UniDirectionalGru<T> gru_p(alloc, seq_length, batch_size, input_size, hidden_size_,
                                        linear_before_reset_ != 0, direction_, bias_1, initial_hidden_1,
                                        activation_funcs_.Entries()[0],
                                        activation_funcs_.Entries()[1],
                                        clip_, thread_pool);
-    gru_p.Compute(input, sequence_lens_span, num_directions_, input_weights_1, recurrent_weights_1,
-                  output_1, hidden_output_1);
+    gru_p.Compute(input, sequence_lens_span, num_directions_, input_weights_1, recurrent_weights_ZR_1,
+                  recurrent_weights_H_1, output_1, hidden_output_1);
   }
 
   if (!output.empty())
@@ -437,6 +513,8 @@ UniDirectionalGru<T>::UniDirectionalGru(AllocatorPtr allocator,
   update_gate_ = deepcpu::ActivationFuncByName(activation_func_f.name);
   output_gate_ = deepcpu::GruOutputGateFuncByName(activation_func_g.name);
 
+  use_fused_gates_ = activation_func_f.name == "sigmoid" && activation_func_g.name == "tanh";
+
   zr_alpha_ = activation_func_f.alpha;
   zr_beta_ = activation_func_f.beta;
   h_alpha_ = activation_func_g.alpha;
@@ -491,8 +569,9 @@ template <typename T>
 void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
                                    const gsl::span<const int>& sequence_lengths_arg,
                                    const int num_directions,
-                                   const gsl::span<const T>& input_weights,
-                                   const gsl::span<const T>& recurrent_weights,
+                                   const GemmWeights<T>& input_weights,
+                                   const GemmWeights<T>& recurrent_weights_ZR,
+                                   const GemmWeights<T>& recurrent_weights_H,
                                    gsl::span<T>& outputs,
                                    gsl::span<T>& final_hidden_state) {
   using span_T_const_iter = typename gsl::span<T>::const_iterator;
@@ -509,11 +588,6 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
   }
 
   DumpMatrix("Inputs", inputs.data(), seq_length_ * batch_size_, input_size_);
-  DumpMatrix("input_weights", input_weights.data(), 3 * hidden_size_, input_size_);
-  DumpMatrix("recurrent_weights", recurrent_weights.data(), 3 * hidden_size_, hidden_size_);
-
-  gsl::span<const T> recurrent_weightsZR = recurrent_weights.subspan(0, 2 * hidden_size_ * hidden_size_);
-  gsl::span<const T> recurrent_weightsH = recurrent_weights.subspan(2 * hidden_size_ * hidden_size_, hidden_size_ * hidden_size_);
 
   gsl::span<T> original_outputs = outputs;
   const bool output_sequence = !outputs.empty();
@@ -540,14 +614,14 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
 
   float alpha = 1.0f;
 
+  T* outputZRH_end = outputZRH_.data() + outputZRH_.size();
+
   // apply weights to all the inputs
   ComputeGemm(total_rows, hidden_size_x3, input_size_, alpha,
-              inputs.cbegin(), inputs.cend(),
-              input_size_,
-              input_weights.cbegin(), input_weights.cend(),
-              input_size_, 0.f,
-              outputZRH_.begin(), outputZRH_.end(),
-              hidden_size_x3, ttp_);
+              inputs.data(), inputs.data() + inputs.size(),
+              input_weights, 0.f,
+              outputZRH_.data(), outputZRH_end,
+              hidden_size_x3, nullptr, nullptr, ttp_);
 
   DumpMatrix("inputs with weights applied", outputZRH_.data(), seq_length_ * batch_size_ * 3, hidden_size_);
 
@@ -609,15 +683,16 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
 
       out_added_offset = (step * batch_size_) * hidden_size_x3;
 
+      const T* p_prev_Ht_begin = &*prev_Ht;
+      const T* p_prev_Ht_end = p_prev_Ht_begin + (prev_Ht_end - prev_Ht);
+
       // calculate Ht-1*R[zr], and add to the weighted inputs that are in outputZRH_
       // Ht-1 * R[zr] + Xt*(W[zr]^T)
       ComputeGemm(batch_size_, hidden_size_x2, hidden_size_, alpha,
-                  prev_Ht, prev_Ht_end,
-                  hidden_size_,
-                  recurrent_weightsZR.cbegin(), recurrent_weightsZR.cend(),
-                  hidden_size_, 1.f,  // beta == 1 so we add existing values in outputZRH_
-                  outputZRH_.begin() + out_added_offset, outputZRH_.end(),
-                  hidden_size_x3, ttp_);
+                  p_prev_Ht_begin, p_prev_Ht_end,
+                  recurrent_weights_ZR, 1.f,  // beta == 1 so we add existing values in outputZRH_
+                  outputZRH_.data() + out_added_offset, outputZRH_end,
+                  hidden_size_x3, nullptr, nullptr, ttp_);
 
       DumpMatrix("Ht-1 * R[zr] + Xt*(W[zr]^T)" + seqno_str,
                  outputZRH_.data() + out_added_offset, batch_size_, hidden_size_x2, 0, hidden_size_x3);
@@ -632,14 +707,12 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
 
         // compute Ht-1 * (Rh^T) + Rbh
         ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
-                    prev_Ht, prev_Ht_end,  // Ht-1
-                    hidden_size_,
-                    recurrent_weightsH.cbegin(), recurrent_weightsH.cend(),  // Rh^T
-                    hidden_size_,
-                    use_bias_ ? 1.f : 0.f,  // don't add values in linear_output_ if no bias input
-                    linear_output_.begin(),
-                    linear_output_.end(),  // pre: Rbh if use_bias_, post:output
-                    hidden_size_, ttp_);
+                    p_prev_Ht_begin, p_prev_Ht_end,  // Ht-1
+                    recurrent_weights_H,             // Rh^T
+                    use_bias_ ? 1.f : 0.f,           // don't add values in linear_output_ if no bias input
+                    linear_output_.data(),
+                    linear_output_.data() + linear_output_.size(),  // pre: Rbh if use_bias_, post:output
+                    hidden_size_, nullptr, nullptr, ttp_);
 
         DumpMatrix("Ht-1 * (Rh^T) + Rbh " + seqno_str, linear_output_.data(), batch_size_, hidden_size_);
       }
@@ -652,26 +725,24 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
 
         // initialize p_rt with input to calculate rt. outputZRH_ has Xt*(Wr^T) + Ht-1*(Rr^T).
         T* p_rt = SafeRawPointer(outputZRH_, out_added_offset + r * hidden_size_x3 + hidden_size_, hidden_size_);
+        T* p_cur_h = SafeRawPointer<T>(cur_h_local + r * hidden_size_, cur_h_local_end, hidden_size_);
 
-        // add the bias and clip. post: p_rt == Xt*(Wr^T) + Ht-1*(Rr^T) + Wbr + Rbr
-        clip_with_bias_ptr_(clip_, p_bias_r, p_rt, hidden_size_);
-
-        if (linear_before_reset_) {
-          // p_linear_output = Ht-1 * (Rh^T) + Rbh
-          T* p_linear_output = SafeRawPointer<T>(linear_output_, r * hidden_size_, hidden_size_);
-          T* p_cur_h = SafeRawPointer<T>(cur_h_local + r * hidden_size_, cur_h_local_end, hidden_size_);
-
-          // calculate rt in-place [p_rt = f(p_rt)]
-          // calculate rt (.) (Ht-1 * (Rh^T) + Rbh) using p_linear_output. write to p_cur_h
-          reset_gate_(p_linear_output, p_rt, p_cur_h, hidden_size_, zr_alpha_, zr_beta_);
+        // p_reset_input = Ht-1 * (Rh^T) + Rbh   #  linear_before_reset_ == true
+        //               = Ht-1                  #  linear_before_reset_ == false
+        const T* p_reset_input = linear_before_reset_
+                                     ? SafeRawPointer<T>(linear_output_, r * hidden_size_, hidden_size_)
+                                     : SafeRawConstPointer<T>(prev_Ht + r * hidden_size_, prev_Ht_end, hidden_size_);
 
+        if (use_fused_gates_) {
+          // calculate rt (.) p_reset_input with the bias and clip applied in the same pass, and write to p_cur_h
+          deepcpu::gru_reset_gate_sigmoid_fused(clip_, p_bias_r, p_rt, p_reset_input, p_cur_h, hidden_size_);
         } else {
-          const T* p_prev_Ht = SafeRawConstPointer<T>(prev_Ht + r * hidden_size_, prev_Ht_end, hidden_size_);
-          T* p_cur_h = SafeRawPointer<T>(cur_h_local + r * hidden_size_, cur_h_local_end, hidden_size_);
+          // add the bias and clip. post: p_rt == Xt*(Wr^T) + Ht-1*(Rr^T) + Wbr + Rbr
+          clip_with_bias_ptr_(clip_, p_bias_r, p_rt, hidden_size_);
 
           // calculate rt in-place [p_rt = f(p_rt)]
-          // calculate rt (.) Ht-1 using p_prev_Ht, and write to p_cur_h
-          reset_gate_(p_prev_Ht, p_rt, p_cur_h, hidden_size_, zr_alpha_, zr_beta_);
+          // calculate rt (.) p_reset_input, and write to p_cur_h
+          reset_gate_(p_reset_input, p_rt, p_cur_h, hidden_size_, zr_alpha_, zr_beta_);
         }
       }
 
@@ -681,18 +752,21 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
       DumpMatrix(label + seqno_str, &*cur_h_local, batch_size_, hidden_size_);
 
       if (linear_before_reset_) {
-        // input contains rt (.) (Ht-1*(Rh^T) + Rbh)
-        auto input = cur_h_local;
-        // out_H currently contains Xt*(W[zrh]^T).
-        auto out_H = outputZRH_.begin() + out_added_offset;
-
-        for (int r = 0; r < batch_size_; r++) {
-          // skip over the inputs with Z and R weights
-          out_H += hidden_size_x2;
-          for (int h = 0; h < hidden_size_; ++h) {
-            *out_H += *input;
-            ++out_H;
-            ++input;
+        // the fused gates add rt (.) (Ht-1*(Rh^T) + Rbh) to the input to g() when calculating ht
+        if (!use_fused_gates_) {
+          // input contains rt (.) (Ht-1*(Rh^T) + Rbh)
+          auto input = cur_h_local;
+          // out_H currently contains Xt*(W[zrh]^T).
+          auto out_H = outputZRH_.begin() + out_added_offset;
+
+          for (int r = 0; r < batch_size_; r++) {
+            // skip over the inputs with Z and R weights
+            out_H += hidden_size_x2;
+            for (int h = 0; h < hidden_size_; ++h) {
+              *out_H += *input;
+              ++out_H;
+              ++input;
+            }
           }
         }
       } else {
@@ -701,16 +775,15 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
 #endif
 
         // out_H currently contains Xt*(Wh^T).
-        auto out_H = outputZRH_.begin() + out_added_offset + hidden_size_x2;
+        T* out_H = outputZRH_.data() + out_added_offset + hidden_size_x2;
 
         // Calculate Xt*(Wh^T) + rt (.) Ht-1 * Rh
         ComputeGemm(batch_size_, hidden_size_, hidden_size_, alpha,
-                    cur_h_local, cur_h_local_end,  // rt (.) Ht-1
-                    hidden_size_,
-                    recurrent_weightsH.cbegin(), recurrent_weightsH.cend(),  // Rh^T
-                    hidden_size_, 1.f,                                       // beta == 1 to add Xt*(Wh^T) from out_H
-                    out_H, outputZRH_.end(),
-                    hidden_size_x3, ttp_);
+                    cur_h_.data(), cur_h_.data() + cur_h_.size(),  // rt (.) Ht-1
+                    recurrent_weights_H,                           // Rh^T
+                    1.f,                                           // beta == 1 to add Xt*(Wh^T) from out_H
+                    out_H, outputZRH_end,
+                    hidden_size_x3, nullptr, nullptr, ttp_);
       }
 
       DumpMatrix("Xt*(Wh^T) + (" + label + ")" + seqno_str, outputZRH_.data() + out_added_offset,
@@ -747,14 +820,6 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
         // initialize p_zt with Xt*(Wz^T) + Ht-1*(Rz^T), which is most of the input to calculate zt:
         T* p_zt = SafeRawPointer<T>(outputZRH_, out_added_offset + r * hidden_size_x3, hidden_size_);
 
-        // using p_zt, add bias and clip in-place
-        clip_with_bias_ptr_(clip_, p_bias_z, p_zt, hidden_size_);
-
-        // calculate zt in-place. p_zt = f(p_zt)
-        update_gate_(p_zt, hidden_size_, zr_alpha_, zr_beta_);
-
-        DumpMatrix("zt[" + std::to_string(r) + "]" + seqno_str, p_zt, 1, hidden_size_);
-
         const T* p_bias_h = nullptr;
         if (use_bias_) {
           if (linear_before_reset_) {
@@ -772,16 +837,38 @@ void UniDirectionalGru<T>::Compute(const gsl::span<const T>& inputs_arg,
         // setup p_ht with input to calculate ht
         // p_ht = Xt*(Wh^T) + (rt (.) Ht-1 * Rh^T)          #  linear_before_reset_ == false
         //      = Xt*(Wh^T) + (rt (.) (Ht-1*(Rh^T) + Rbh))  #  linear_before_reset_ == true
+        // (with the fused gates and linear_before_reset_, p_ht is Xt*(Wh^T) and the second term is still in cur_h_)
         T* p_ht = SafeRawPointer<T>(outputZRH_, out_added_offset + r * hidden_size_x3 + hidden_size_x2, hidden_size_);
 
+        const T* p_prev_Ht = SafeRawConstPointer<T>(prev_Ht + r * hidden_size_, prev_Ht_end, hidden_size_);
+        T* p_Ht = SafeRawPointer<T>(output + r * hidden_size_, output_end, hidden_size_);
+
+        if (use_fused_gates_) {
+          const T* p_reset_output = linear_before_reset_
+                                        ? SafeRawPointer<T>(cur_h_local + r * hidden_size_, cur_h_local_end,
+                                                            hidden_size_)
+                                        : nullptr;
+
+          // calculate zt in-place and ht from their inputs, biases and clip, and Ht = (1 - zt) (.) ht + zt (.) Ht-1,
+          // without writing ht back to p_ht
+          deepcpu::gru_output_gate_sigmoid_tanh_fused(clip_, p_bias_z, p_zt, p_bias_h, p_ht, p_reset_output,
+                                                      p_prev_Ht, p_Ht, hidden_size_);
+          continue;
+        }
+
+        // using p_zt, add bias and clip in-place
+        clip_with_bias_ptr_(clip_, p_bias_z, p_zt, hidden_size_);
+
+        // calculate zt in-place. p_zt = f(p_zt)
+        update_gate_(p_zt, hidden_size_, zr_alpha_, zr_beta_);
+
+        DumpMatrix("zt[" + std::to_string(r) + "]" + seqno_str, p_zt, 1, hidden_size_);
+
         // add Wbh [and Wrh] and clip
         clip_with_bias_ptr_(clip_, p_bias_h, p_ht, hidden_size_);  // post: p_ht == input to g() for calculating ht
 
         DumpMatrix("ht input [" + std::to_string(r) + "]" + seqno_str, p_ht, 1, hidden_size_);
 
-        const T* p_prev_Ht = SafeRawConstPointer<T>(prev_Ht + r * hidden_size_, prev_Ht_end, hidden_size_);
-        T* p_Ht = SafeRawPointer<T>(output + r * hidden_size_, output_end, hidden_size_);
-
         // calculate ht = g(p_ht) and write in-place to p_ht
         // calculate Ht = (1 - zt) (.) ht + zt (.) Ht-1 and write to p_Ht
         output_gate_(p_ht, p_zt, p_prev_Ht, p_Ht, hidden_size_, h_alpha_, h_beta_);  // calculate ht and Ht
@@ -5,7 +5,6 @@
 
 #include "core/common/safeint.h"
 #include "core/framework/op_kernel_context_internal.h"
-#include "core/providers/cpu/rnn/rnn_activation_functors.h"
 #include "core/providers/cpu/rnn/rnn_helpers.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
@@ -39,36 +38,40 @@ ONNX_CPU_OPERATOR_KERNEL(
 #define DumpMatrix(...) ((void)0)
 #endif
 
-template <typename T>
-T Clip(const T& x, T clip) {
-  if (clip < 0)
-    return x;
-
-  return std::max(std::min(x, clip), -clip);
-}
-
-template <typename T>
-void ApplyActivationToBatches(const Tensor* sequence_lens, const T* h_prev, T* Y_buffer_data_current_frame,
-                              int64_t time_step, int64_t batch_size, int64_t hidden_size,
-                              T alpha, T beta, T clip, std::function<T(T, T, T)> activation_func) {
+// Clip and apply the activation to each row of the current frame. The rows of the batches whose sequence has ended
+// are copied from the previous time step, or zeroed.
+static void ApplyActivationToBatches(const Tensor* sequence_lens, const float* h_prev,
+                                     float* Y_buffer_data_current_frame,
+                                     int64_t time_step, int64_t batch_size, int64_t hidden_size,
+                                     float alpha, float beta, float clip,
+                                     rnn::detail::deepcpu::ActivationFuncPtr activation_func) {
   const int* seq_len_data = sequence_lens ? sequence_lens->template Data<int>() : nullptr;
 
-  for (int batch = 0; batch < batch_size; batch++) {
-    bool valid = true;
-    if (nullptr != seq_len_data) {
-      // sequence_lens is already validated to have batch_size entries
-      valid = time_step < seq_len_data[batch];
+  auto apply_activation = [&](float* y, int64_t size) {
+    const int count = gsl::narrow<int>(size);
+    if (clip >= 0) {
+      rnn::detail::deepcpu::clip(clip, y, count);
     }
+    activation_func(y, count, alpha, beta);
+  };
+
+  // sequence_lens is already validated to have batch_size entries
+  if (nullptr == seq_len_data ||
+      std::all_of(seq_len_data, seq_len_data + batch_size, [&](int len) { return time_step < len; })) {
+    // the rows are contiguous, so process the frame at once
+    apply_activation(Y_buffer_data_current_frame, batch_size * hidden_size);
+    return;
+  }
 
-    for (int feature = 0; feature < hidden_size; ++feature) {
-      int64_t y_index = batch * hidden_size + feature;
-      if (!valid) {
-        // copy from previous time_step if available
-        Y_buffer_data_current_frame[y_index] = h_prev ? h_prev[batch * hidden_size + feature] : 0.f;
-      } else {
-        Y_buffer_data_current_frame[y_index] = activation_func(
-            Clip(Y_buffer_data_current_frame[y_index], clip), alpha, beta);
-      }
+  for (int batch = 0; batch < batch_size; batch++) {
+    float* y = Y_buffer_data_current_frame + batch * hidden_size;
+    if (time_step < seq_len_data[batch]) {
+      apply_activation(y, hidden_size);
+    } else if (h_prev != nullptr) {
+      // copy from previous time_step if available
+      std::copy_n(h_prev + batch * hidden_size, hidden_size, y);
+    } else {
+      std::fill_n(y, hidden_size, 0.f);
     }
   }
 }
@@ -112,6 +115,53 @@ template <typename T>
 using EigenMatrixMapRowMajor = Eigen::Map<
     Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
 
+template <>
+Status RNN<float>::PrePack(const Tensor& tensor, int input_idx,
+                           AllocatorPtr alloc, /*out*/ bool& is_packed,
+                           /*out*/ PrePackedWeights* prepacked_weights) {
+  is_packed = false;
+
+  if (input_idx != 1 && input_idx != 2) {
+    return Status::OK();
+  }
+
+  // weights: [num_directions, hidden_size, input_size]
+  // recurrence weights: [num_directions, hidden_size, hidden_size]
+  const auto& shape = tensor.Shape();
+  const int64_t num_directions = direction_ == "bidirectional" ? 2 : 1;
+  if (!tensor.IsDataType<float>() || shape.NumDimensions() != 3 ||
+      shape[0] != num_directions || shape[1] != hidden_size_) {
+    return Status::OK();
+  }
+
+  rnn::detail::PackedWeights& packed_weights = input_idx == 1 ? packed_W_ : packed_R_;
+  is_packed = rnn::detail::PackWeights(tensor, 0, static_cast<size_t>(hidden_size_), packed_weights, alloc);
+
+  if (is_packed && prepacked_weights != nullptr) {
+    prepacked_weights->buffers_.push_back(std::move(packed_weights.buffer_));
+    prepacked_weights->buffer_sizes_.push_back(packed_weights.buffer_size_);
+  }
+
+  return Status::OK();
+}
+
+template <>
+Status RNN<float>::UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                             int input_idx,
+                                             /*out*/ bool& used_shared_buffers) {
+  used_shared_buffers = false;
+
+  if (input_idx == 1) {
+    used_shared_buffers = true;
+    packed_W_.buffer_ = std::move(prepacked_buffers[0]);
+  } else if (input_idx == 2) {
+    used_shared_buffers = true;
+    packed_R_.buffer_ = std::move(prepacked_buffers[0]);
+  }
+
+  return Status::OK();
+}
+
 template <>
 Status RNN<float>::Compute(OpKernelContext* ctx) const {
   using namespace rnn::detail;
@@ -119,8 +169,10 @@ Status RNN<float>::Compute(OpKernelContext* ctx) const {
 
   // inputs
   const Tensor& X = *ctx->Input<Tensor>(0);
-  const Tensor& W = *ctx->Input<Tensor>(1);
-  const Tensor& R = *ctx->Input<Tensor>(2);
+  const Tensor* W = packed_W_.buffer_ ? nullptr : ctx->Input<Tensor>(1);
+  const Tensor* R = packed_R_.buffer_ ? nullptr : ctx->Input<Tensor>(2);
+  const auto& W_shape = (W != nullptr) ? W->Shape() : packed_W_.shape_;
+  const auto& R_shape = (R != nullptr) ? R->Shape() : packed_R_.shape_;
 
   // optional inputs
   const auto* B = ctx->Input<Tensor>(3);
@@ -132,7 +184,7 @@ Status RNN<float>::Compute(OpKernelContext* ctx) const {
   int64_t batch_size = X.Shape()[1];
   int64_t input_size = X.Shape()[2];
 
-  auto status = rnn::detail::ValidateCommonRnnInputs(X, W.Shape(), R.Shape(), B, 1, sequence_lens, initial_h,
+  auto status = rnn::detail::ValidateCommonRnnInputs(X, W_shape, R_shape, B, 1, sequence_lens, initial_h,
                                                      num_directions, hidden_size_);
   ORT_RETURN_IF_ERROR(status);
 
@@ -163,38 +215,44 @@ Status RNN<float>::Compute(OpKernelContext* ctx) const {
   }
 
   int64_t Y_frame_size = batch_size * hidden_size_;
+  const int64_t x_matmul_w_size = seq_length * Y_frame_size;
+
+  const float* input_weights = (W != nullptr) ? W->template Data<float>() : nullptr;
+  const float* recurrent_weights = (R != nullptr) ? R->template Data<float>() : nullptr;
 
   for (int direction = 0; direction < num_directions; direction++) {
-    auto activation_func = GetFuncByName<float>(activations_[direction], "Tanh");
     bool isReverse = direction_ == "reverse" || direction == 1;
 
+    GemmWeights<float> W_weights(direction, input_weights, hidden_size_ * input_size, packed_W_);
+    GemmWeights<float> R_weights(direction, recurrent_weights, hidden_size_ * hidden_size_, packed_R_);
+
     if (B != nullptr) {
       EigenMatrixMapRowMajor<float>(x_matmul_w_buffer_data, seq_length * batch_size, hidden_size_).rowwise() =
           ConstEigenVectorMap<float>(B->template Data<float>() + direction * 2 * hidden_size_, hidden_size_).transpose() +
           ConstEigenVectorMap<float>(B->template Data<float>() + direction * 2 * hidden_size_ + hidden_size_, hidden_size_).transpose();
-    } else {
-      math::Set<float, CPUMathUtil>(seq_length * batch_size * hidden_size_, 0, x_matmul_w_buffer_data, &CPUMathUtil::Instance());
     }
 
     // X * W[direction]^t + B
-    math::Gemm<float>(
-        CblasNoTrans,
-        CblasTrans,
-        static_cast<int>(seq_length * batch_size),
-        static_cast<int>(hidden_size_),
-        static_cast<int>(input_size),
-        1,
-        X.template Data<float>(),
-        W.template Data<float>() + direction * hidden_size_ * input_size,
-        1,
-        x_matmul_w_buffer_data,
-        tp);
+    ComputeGemm(static_cast<int>(seq_length * batch_size),
+                static_cast<int>(hidden_size_),
+                static_cast<int>(input_size),
+                1.f,
+                X.template Data<float>(),
+                X.template Data<float>() + X.Shape().Size(),
+                W_weights,
+                B != nullptr ? 1.f : 0.f,
+                x_matmul_w_buffer_data,
+                x_matmul_w_buffer_data + x_matmul_w_size,
+                static_cast<int>(hidden_size_),
+                nullptr, nullptr, tp);
 
     for (int64_t t = 0; t < seq_length; t++) {
       int64_t time_step = isReverse ? (seq_length - t - 1) : t;
       int64_t Y_frame_offset = (time_step * num_directions + direction) * Y_frame_size;
       float* Y_buffer_data_current_frame = Y_buffer_data + Y_frame_offset;
-      auto y_frame_mat = EigenMatrixMapRowMajor<float>(Y_buffer_data_current_frame, batch_size, hidden_size_);
+
+      // start from X[time_step] * W^t + B so that H_t_1 * R^t is accumulated by the GEMM
+      std::copy_n(x_matmul_w_buffer_data + time_step * Y_frame_size, Y_frame_size, Y_buffer_data_current_frame);
 
       const float* h_prev = nullptr;
       if (t == 0) {
@@ -212,30 +270,26 @@ Status RNN<float>::Compute(OpKernelContext* ctx) const {
       }
 
       if (h_prev != nullptr) {
-        // H_t_1 * R[direction]^t
-        math::Gemm<float>(
-            CblasNoTrans,
-            CblasTrans,
-            static_cast<int>(batch_size),
-            static_cast<int>(hidden_size_),
-            static_cast<int>(hidden_size_),
-            1,
-            h_prev,
-            R.template Data<float>() + direction * hidden_size_ * hidden_size_,
-            0,
-            Y_buffer_data_current_frame,
-            tp);
-      } else {
-        math::Set<float, CPUMathUtil>(batch_size * hidden_size_, 0, Y_buffer_data_current_frame, &CPUMathUtil::Instance());
+        // X[time_step] * W^t + B + H_t_1 * R[direction]^t
+        ComputeGemm(static_cast<int>(batch_size),
+                    static_cast<int>(hidden_size_),
+                    static_cast<int>(hidden_size_),
+                    1.f,
+                    h_prev,
+                    h_prev + Y_frame_size,
+                    R_weights,
+                    1.f,
+                    Y_buffer_data_current_frame,
+                    Y_buffer_data_current_frame + Y_frame_size,
+                    static_cast<int>(hidden_size_),
+                    nullptr, nullptr, tp);
       }
 
-      // X[time_step] * W^t + H_t_1 * R^t
-      y_frame_mat += EigenMatrixMapRowMajor<float>(&x_matmul_w_buffer_data[time_step * Y_frame_size], batch_size, hidden_size_);
-
       // apply activation
-      ApplyActivationToBatches<float>(sequence_lens, h_prev, Y_buffer_data_current_frame,
-                                      time_step, batch_size, hidden_size_,
-                                      activation_alpha_[direction], activation_beta_[direction], clip_, activation_func);
+      ApplyActivationToBatches(sequence_lens, h_prev, Y_buffer_data_current_frame,
+                               time_step, batch_size, hidden_size_,
+                               activation_alpha_[direction], activation_beta_[direction], clip_,
+                               activation_funcs_[direction]);
     }  // close sequence loop
 
     if (Y_h)
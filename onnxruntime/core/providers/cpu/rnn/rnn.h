@@ -3,11 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <set>
 #include <string>
 #include "core/common/common.h"
 #include "core/common/exceptions.h"
 #include "core/framework/op_kernel.h"
+#include "core/providers/cpu/rnn/rnn_helpers.h"
 
 namespace onnxruntime {
 template <typename T>
@@ -39,12 +41,25 @@ class RNN : public OpKernel {
     for (int direction = 0; direction < num_directions; direction++) {
       ORT_ENFORCE(allowed_activations.find(activations_[direction]) != allowed_activations.end(),
                   "RNN op: Invalid activation attribute - ", activations_[direction]);
+
+      std::string name(activations_[direction]);
+      std::transform(name.begin(), name.end(), name.begin(),
+                     [](const unsigned char c) { return static_cast<char>(::tolower(c)); });
+      activation_funcs_.push_back(rnn::detail::deepcpu::ActivationFuncByName(name));
     }
 
     ORT_ENFORCE(layout_ == 0,
                 "Batchwise recurrent operations (layout == 1) are not supported. If you need support create a github issue with justification.");
   }
 
+  Status PrePack(const Tensor& tensor, int input_idx, AllocatorPtr alloc,
+                 /*out*/ bool& is_packed,
+                 /*out*/ PrePackedWeights* prepacked_weights) override;
+
+  Status UseSharedPrePackedBuffers(std::vector<BufferUniquePtr>& prepacked_buffers,
+                                   int input_idx,
+                                   /*out*/ bool& used_shared_buffers) override;
+
   Status Compute(OpKernelContext* context) const override;
 
  private:
@@ -57,6 +72,9 @@ class RNN : public OpKernel {
   // optional, default = "Tanh"
   std::vector<std::string> activations_;
 
+  // vectorized implementations of activations_, applied to a whole row at a time
+  std::vector<rnn::detail::deepcpu::ActivationFuncPtr> activation_funcs_;
+
   // optional, default no clip_
   float clip_;
 
@@ -70,6 +88,9 @@ class RNN : public OpKernel {
 
   // added since opset 14. Default value 0 matches the behavior prior to opset14
   int64_t layout_;
+
+  rnn::detail::PackedWeights packed_W_;
+  rnn::detail::PackedWeights packed_R_;
 };
 
 }  // namespace onnxruntime
@@ -3,6 +3,7 @@
 
 #include "core/providers/cpu/rnn/rnn_helpers.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 #include <iomanip>
@@ -243,6 +244,41 @@ void ComputeGemm(const int M,
   }
 }
 
+bool PackWeights(const Tensor& weights, size_t row_offset, size_t N,
+                 PackedWeights& packed_weights, AllocatorPtr& alloc) {
+  const auto& shape = weights.Shape();
+  const size_t num_directions = static_cast<size_t>(shape[0]);
+  const size_t rows = static_cast<size_t>(shape[1]);
+  const size_t K = static_cast<size_t>(shape[2]);
+
+  const size_t packed_weights_size = MlasGemmPackBSize(N, K);
+  if (packed_weights_size == 0) {
+    return false;
+  }
+
+  size_t packed_weights_data_size = SafeInt<size_t>(packed_weights_size) * num_directions;
+  auto* packed_weights_data = alloc->Alloc(packed_weights_data_size);
+
+  // Initialize memory to 0 as there could be some padding associated with pre-packed
+  // buffer memory and we don not want it uninitialized and generate different hashes
+  // if and when we try to cache this pre-packed buffer for sharing between sessions.
+  memset(packed_weights_data, 0, packed_weights_data_size);
+
+  packed_weights.buffer_ = BufferUniquePtr(packed_weights_data, BufferDeleter(alloc));
+  packed_weights.buffer_size_ = packed_weights_data_size;
+  packed_weights.weights_size_ = packed_weights_size;
+  packed_weights.shape_ = shape;
+
+  const auto* weights_data = weights.Data<float>() + row_offset * K;
+  for (size_t i = 0; i < num_directions; i++) {
+    MlasGemmPackB(CblasTrans, N, K, weights_data, K, packed_weights_data);
+    packed_weights_data = static_cast<uint8_t*>(packed_weights_data) + packed_weights_size;
+    weights_data += rows * K;
+  }
+
+  return true;
+}
+
 void ComputeGemm(const int M,
                  const int N,
                  const int K,
@@ -680,6 +716,86 @@ void gru_output_gate_sigmoid(float* ph, const float* pz, const float* ps, float*
   }
 }
 
+// The rational approximation of tanh of the unfused gates. The fused gates evaluate the same expressions in the same
+// order as gru_reset_gate_sigmoid and gru_output_gate_tanh so the results don't depend on whether they are fused.
+inline float tanh_rational(float x) {
+  float x2 = x * x;
+  float p = x2 * alpha_13 + alpha_11;
+  p = x2 * p + alpha_9;
+  p = x2 * p + alpha_7;
+  p = x2 * p + alpha_5;
+  p = x2 * p + alpha_3;
+  p = x2 * p + alpha_1;
+  p = x * p;
+  float q = x2 * beta_6 + beta_4;
+  q = x2 * q + beta_2;
+  q = x2 * q + beta_0;
+  return p / q;
+}
+
+template <bool use_bias>
+static void gru_reset_gate_sigmoid_fused_impl(const float b, const float* restrict pb, const float* restrict pr,
+                                              const float* restrict ps, float* restrict pd, int c) {
+  for (int i = 0; i < c; i++) {
+    float x = use_bias ? pr[i] + pb[i] : pr[i];
+    x = std::max(-b, std::min(b, x));
+    x = 0.5f * std::min(sigmoid_bound, std::max(-sigmoid_bound, x));
+    pd[i] = ps[i] * 0.5f * (1 + tanh_rational(x));
+  }
+}
+
+void gru_reset_gate_sigmoid_fused(const float b, const float* pb, const float* pr, const float* ps, float* pd,
+                                  int c) {
+  if (pb != nullptr) {
+    gru_reset_gate_sigmoid_fused_impl<true>(b, pb, pr, ps, pd, c);
+  } else {
+    gru_reset_gate_sigmoid_fused_impl<false>(b, pb, pr, ps, pd, c);
+  }
+}
+
+// po is not restrict as it is the same as pprev when only the final hidden state is output.
+// zt is computed in place with MlasComputeLogistic, as by the update gate of the unfused path, so that the results
+// don't depend on whether the gates are fused.
+template <bool use_bias, bool use_addend>
+static void gru_output_gate_sigmoid_tanh_fused_impl(const float b, const float* restrict pbz, float* restrict pz,
+                                                    const float* restrict pbh, const float* restrict ph,
+                                                    const float* restrict pa, const float* pprev, float* po, int c) {
+  for (int i = 0; i < c; i++) {
+    const float z = use_bias ? pz[i] + pbz[i] : pz[i];
+    pz[i] = std::max(-b, std::min(b, z));
+  }
+
+  MlasComputeLogistic(pz, pz, c);
+
+  for (int i = 0; i < c; i++) {
+    float h = use_addend ? ph[i] + pa[i] : ph[i];
+    if (use_bias) {
+      h += pbh[i];
+    }
+    h = std::max(-b, std::min(b, h));
+    h = tanh_rational(std::min(tanh_bound, std::max(-tanh_bound, h)));
+
+    po[i] = (1 - pz[i]) * h + pz[i] * pprev[i];
+  }
+}
+
+void gru_output_gate_sigmoid_tanh_fused(const float b, const float* pbz, float* pz, const float* pbh,
+                                        const float* ph, const float* pa, const float* pprev, float* po, int c) {
+  if (pbz != nullptr) {
+    if (pa != nullptr) {
+      gru_output_gate_sigmoid_tanh_fused_impl<true, true>(b, pbz, pz, pbh, ph, pa, pprev, po, c);
+    } else {
+      gru_output_gate_sigmoid_tanh_fused_impl<true, false>(b, pbz, pz, pbh, ph, pa, pprev, po, c);
+    }
+  } else {
+    if (pa != nullptr) {
+      gru_output_gate_sigmoid_tanh_fused_impl<false, true>(b, pbz, pz, pbh, ph, pa, pprev, po, c);
+    } else {
+      gru_output_gate_sigmoid_tanh_fused_impl<false, false>(b, pbz, pz, pbh, ph, pa, pprev, po, c);
+    }
+  }
+}
+
 void composed_activation_func(float* ps, int c, std::function<float(float, float, float)> func, float alpha,
                               float beta) {
   for (int i = 0; i < c; i++) {
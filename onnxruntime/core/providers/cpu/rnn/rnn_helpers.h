@@ -169,6 +169,12 @@ struct PackedWeights {
   TensorShape shape_;
 };
 
+// Pack rows [row_offset, row_offset + N) of each direction of 'weights', which has shape [num_directions, rows, K],
+// for MlasGemm with B transposed. 'shape_' is set to the shape of 'weights'.
+// Returns false without allocating if MLAS does not pack the weights on this platform.
+bool PackWeights(const Tensor& weights, size_t row_offset, size_t N,
+                 PackedWeights& packed_weights, AllocatorPtr& alloc);
+
 struct QuantizationParameter {
   QuantizationParameter(const float* scale,
                         const uint8_t* zero_point,
@@ -351,6 +357,15 @@ void gru_output_gate_tanh(float* ph, const float* pz, const float* ps, float* po
 void gru_output_gate_sigmoid(float* ph, const float* pz, const float* ps, float* po, int c, float alpha, float beta);
 void gru_output_gate_relu(const float* ph, const float* pz, const float* ps, float* po, int c, float alpha, float beta);
 
+// GRU gates for the default activations (f = sigmoid, g = tanh), with the bias, clip, activation and state update
+// of a row computed in a single pass. The biases may be nullptr.
+// pd = ps (.) sigmoid(clip(pr + pb))
+void gru_reset_gate_sigmoid_fused(float clip, const float* pb, const float* pr, const float* ps, float* pd, int c);
+// zt = sigmoid(clip(pz + pbz)), ht = tanh(clip(ph [+ pa] + pbh)), po = (1 - zt) (.) ht + zt (.) pprev
+// zt is written to pz. pa is added to ph if it is not nullptr, and po may be pprev.
+void gru_output_gate_sigmoid_tanh_fused(float clip, const float* pbz, float* pz, const float* pbh,
+                                        const float* ph, const float* pa, const float* pprev, float* po, int c);
+
 inline void elementwise_product(const float* op1, const float* op2, float* dest, int size) {
   for (int i = 0; i < size; i++)
     dest[i] += op1[i] * op2[i];
@@ -0,0 +1,340 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cpu/signal/fft.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+namespace onnxruntime {
+namespace signal {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// exp(i * angle), computed in double precision so that the twiddles of float plans are correctly rounded.
+template <typename T>
+std::complex<T> Exponential(double angle) {
+  return std::complex<T>(static_cast<T>(std::cos(angle)), static_cast<T>(std::sin(angle)));
+}
+
+// Butterflies of the mixed-radix decomposition. 'output' holds 'radix' sub-transforms of length m, which are combined
+// in place into a transform of length radix * m. The twiddle of index k is exp(+-2 * pi * i * k * twiddle_stride / N)
+// where N is the length of the plan.
+template <typename T>
+void Butterfly2(std::complex<T>* output, const std::complex<T>* twiddles, size_t twiddle_stride, size_t m) {
+  std::complex<T>* output1 = output + m;
+  for (size_t k = 0; k < m; ++k) {
+    const std::complex<T> t = output1[k] * twiddles[k * twiddle_stride];
+    output1[k] = output[k] - t;
+    output[k] += t;
+  }
+}
+
+template <typename T>
+void Butterfly3(std::complex<T>* output, const std::complex<T>* twiddles, size_t twiddle_stride, size_t m) {
+  // imaginary part of exp(+-2 * pi * i / 3)
+  const T epi3 = twiddles[twiddle_stride * m].imag();
+  for (size_t k = 0; k < m; ++k) {
+    const std::complex<T> s1 = output[k + m] * twiddles[k * twiddle_stride];
+    const std::complex<T> s2 = output[k + 2 * m] * twiddles[2 * k * twiddle_stride];
+    const std::complex<T> s3 = s1 + s2;
+    const std::complex<T> s0 = (s1 - s2) * epi3;
+
+    const std::complex<T> middle = output[k] - s3 * static_cast<T>(0.5);
+    output[k] += s3;
+    output[k + m] = std::complex<T>(middle.real() - s0.imag(), middle.imag() + s0.real());
+    output[k + 2 * m] = std::complex<T>(middle.real() + s0.imag(), middle.imag() - s0.real());
+  }
+}
+
+template <typename T>
+void Butterfly4(std::complex<T>* output, const std::complex<T>* twiddles, size_t twiddle_stride, size_t m,
+                bool inverse) {
+  for (size_t k = 0; k < m; ++k) {
+    const std::complex<T> s0 = output[k + m] * twiddles[k * twiddle_stride];
+    const std::complex<T> s1 = output[k + 2 * m] * twiddles[2 * k * twiddle_stride];
+    const std::complex<T> s2 = output[k + 3 * m] * twiddles[3 * k * twiddle_stride];
+
+    const std::complex<T> s5 = output[k] - s1;
+    const std::complex<T> s6 = output[k] + s1;
+    const std::complex<T> s3 = s0 + s2;
+    const std::complex<T> s4 = s0 - s2;
+
+    output[k] = s6 + s3;
+    output[k + 2 * m] = s6 - s3;
+    // s4 rotated by -+pi / 2
+    if (inverse) {
+      output[k + m] = std::complex<T>(s5.real() - s4.imag(), s5.imag() + s4.real());
+      output[k + 3 * m] = std::complex<T>(s5.real() + s4.imag(), s5.imag() - s4.real());
+    } else {
+      output[k + m] = std::complex<T>(s5.real() + s4.imag(), s5.imag() - s4.real());
+      output[k + 3 * m] = std::complex<T>(s5.real() - s4.imag(), s5.imag() + s4.real());
+    }
+  }
+}
+
+template <typename T>
+void Butterfly5(std::complex<T>* output, const std::complex<T>* twiddles, size_t twiddle_stride, size_t m) {
+  // exp(+-2 * pi * i / 5) and exp(+-4 * pi * i / 5)
+  const std::complex<T> ya = twiddles[twiddle_stride * m];
+  const std::complex<T> yb = twiddles[2 * twiddle_stride * m];
+  for (size_t k = 0; k < m; ++k) {
+    const std::complex<T> s0 = output[k];
+    const std::complex<T> s1 = output[k + m] * twiddles[k * twiddle_stride];
+    const std::complex<T> s2 = output[k + 2 * m] * twiddles[2 * k * twiddle_stride];
+    const std::complex<T> s3 = output[k + 3 * m] * twiddles[3 * k * twiddle_stride];
+    const std::complex<T> s4 = output[k + 4 * m] * twiddles[4 * k * twiddle_stride];
+
+    const std::complex<T> s7 = s1 + s4;
+    const std::complex<T> s10 = s1 - s4;
+    const std::complex<T> s8 = s2 + s3;
+    const std::complex<T> s9 = s2 - s3;
+
+    output[k] = s0 + s7 + s8;
+
+    const std::complex<T> s5(s0.real() + s7.real() * ya.real() + s8.real() * yb.real(),
+                             s0.imag() + s7.imag() * ya.real() + s8.imag() * yb.real());
+    const std::complex<T> s6(s10.imag() * ya.imag() + s9.imag() * yb.imag(),
+                             -s10.real() * ya.imag() - s9.real() * yb.imag());
+    output[k + m] = s5 - s6;
+    output[k + 4 * m] = s5 + s6;
+
+    const std::complex<T> s11(s0.real() + s7.real() * yb.real() + s8.real() * ya.real(),
+                              s0.imag() + s7.imag() * yb.real() + s8.imag() * ya.real());
+    const std::complex<T> s12(-s10.imag() * yb.imag() + s9.imag() * ya.imag(),
+                              s10.real() * yb.imag() - s9.real() * ya.imag());
+    output[k + 2 * m] = s11 + s12;
+    output[k + 3 * m] = s11 - s12;
+  }
+}
+
+// Radices of the mixed-radix decomposition of 'length', largest stages first. Returns false if 'length' has a prime
+// factor other than 2, 3 and 5.
+bool FactorizeLength(size_t length, InlinedVector<size_t>& radices) {
+  for (size_t radix : {4, 2, 3, 5}) {
+    while (length % radix == 0) {
+      radices.push_back(radix);
+      length /= radix;
+    }
+  }
+
+  return length == 1;
+}
+
+}  // namespace
+
+template <typename T>
+FftPlan<T>::FftPlan(size_t length, bool inverse) : FftPlan(length, inverse, true) {
+}
+
+template <typename T>
+FftPlan<T>::FftPlan(size_t length, bool inverse, bool real_transform)
+    : length_(length), inverse_(inverse) {
+  ORT_ENFORCE(length > 0, "The length of the transform must be greater than zero.");
+  const double sign = inverse ? 1.0 : -1.0;
+
+  size_t complex_scratch_size = 0;
+  if (FactorizeLength(length, radices_)) {
+    twiddles_.resize(length);
+    for (size_t k = 0; k < length; ++k) {
+      twiddles_[k] = Exponential<T>(sign * 2.0 * kPi * static_cast<double>(k) / static_cast<double>(length));
+    }
+  } else {
+    radices_.clear();
+
+    size_t convolution_length = 1;
+    while (convolution_length < 2 * length - 1) {
+      convolution_length <<= 1;
+    }
+
+    // k^2 is reduced modulo 2 * length, the period of the chirp, to keep the angles accurate for large k
+    chirp_.resize(length);
+    for (size_t k = 0; k < length; ++k) {
+      const size_t k2 = static_cast<size_t>((static_cast<uint64_t>(k) * k) % (2 * static_cast<uint64_t>(length)));
+      chirp_[k] = Exponential<T>(sign * kPi * static_cast<double>(k2) / static_cast<double>(length));
+    }
+
+    convolution_plan_.reset(new FftPlan<T>(convolution_length, false, false));
+
+    std::vector<std::complex<T>> filter(convolution_length);
+    filter[0] = std::conj(chirp_[0]);
+    for (size_t k = 1; k < length; ++k) {
+      filter[k] = std::conj(chirp_[k]);
+      filter[convolution_length - k] = std::conj(chirp_[k]);
+    }
+
+    filter_transform_.resize(convolution_length);
+    convolution_plan_->Transform(filter.data(), filter_transform_.data(), nullptr);
+    const T scale = static_cast<T>(1.0 / static_cast<double>(convolution_length));
+    for (auto& value : filter_transform_) {
+      value *= scale;
+    }
+
+    complex_scratch_size = 2 * convolution_length;
+  }
+
+  size_t real_scratch_size = 2 * length + complex_scratch_size;
+  if (real_transform && length % 2 == 0) {
+    const size_t half_length = length / 2;
+    half_plan_.reset(new FftPlan<T>(half_length, inverse, false));
+
+    real_twiddles_.resize(half_length + 1);
+    for (size_t k = 0; k <= half_length; ++k) {
+      real_twiddles_[k] = Exponential<T>(sign * 2.0 * kPi * static_cast<double>(k) / static_cast<double>(length));
+    }
+
+    real_scratch_size = length + half_plan_->ScratchSize();
+  }
+
+  scratch_size_ = std::max(complex_scratch_size, real_scratch_size);
+}
+
+template <typename T>
+void FftPlan<T>::MixedRadix(std::complex<T>* output, const std::complex<T>* input, size_t input_stride,
+                            size_t factor_index, size_t twiddle_stride) const {
+  const size_t radix = radices_[factor_index];
+  const size_t m = length_ / (twiddle_stride * radix);
+
+  // decimation in time: sub-transform k of length m reads the inputs k, k + radix, ... of the current stage
+  if (m == 1) {
+    for (size_t k = 0; k < radix; ++k) {
+      output[k] = input[k * twiddle_stride * input_stride];
+    }
+  } else {
+    for (size_t k = 0; k < radix; ++k) {
+      MixedRadix(output + k * m, input + k * twiddle_stride * input_stride, input_stride, factor_index + 1,
+                 twiddle_stride * radix);
+    }
+  }
+
+  switch (radix) {
+    case 2:
+      Butterfly2(output, twiddles_.data(), twiddle_stride, m);
+      break;
+    case 3:
+      Butterfly3(output, twiddles_.data(), twiddle_stride, m);
+      break;
+    case 4:
+      Butterfly4(output, twiddles_.data(), twiddle_stride, m, inverse_);
+      break;
+    case 5:
+      Butterfly5(output, twiddles_.data(), twiddle_stride, m);
+      break;
+    default:
+      ORT_THROW("Unsupported radix ", radix);
+  }
+}
+
+template <typename T>
+void FftPlan<T>::Bluestein(const std::complex<T>* input, std::complex<T>* output, std::complex<T>* scratch) const {
+  // X[k] = chirp[k] * sum_j (x[j] * chirp[j]) * conj(chirp[k - j]), a convolution computed with transforms of
+  // power of 2 length
+  const size_t convolution_length = filter_transform_.size();
+  std::complex<T>* a = scratch;
+  std::complex<T>* a_transform = scratch + convolution_length;
+
+  for (size_t j = 0; j < length_; ++j) {
+    a[j] = input[j] * chirp_[j];
+  }
+  std::fill(a + length_, a + convolution_length, std::complex<T>());
+
+  convolution_plan_->Transform(a, a_transform, nullptr);
+
+  // the inverse transform of the product is computed as conj(forward(conj(product))), the filter transform is
+  // already scaled by the inverse of the convolution length
+  for (size_t k = 0; k < convolution_length; ++k) {
+    a_transform[k] = std::conj(a_transform[k] * filter_transform_[k]);
+  }
+
+  convolution_plan_->Transform(a_transform, a, nullptr);
+
+  for (size_t k = 0; k < length_; ++k) {
+    output[k] = chirp_[k] * std::conj(a[k]);
+  }
+}
+
+template <typename T>
+void FftPlan<T>::Transform(const std::complex<T>* input, std::complex<T>* output, std::complex<T>* scratch) const {
+  if (convolution_plan_) {
+    Bluestein(input, output, scratch);
+  } else if (radices_.empty()) {
+    output[0] = input[0];
+  } else {
+    MixedRadix(output, input, 1, 0, 1);
+  }
+}
+
+template <typename T>
+void FftPlan<T>::TransformReal(const T* input, std::complex<T>* output, std::complex<T>* scratch) const {
+  if (!half_plan_) {
+    // odd length: transform the full complex signal and keep the first half of the outputs
+    std::complex<T>* complex_input = scratch;
+    for (size_t j = 0; j < length_; ++j) {
+      complex_input[j] = std::complex<T>(input[j], 0);
+    }
+
+    Transform(complex_input, scratch + length_, scratch + 2 * length_);
+    std::copy(scratch + length_, scratch + length_ + length_ / 2 + 1, output);
+    return;
+  }
+
+  // the even and odd inputs are the real and imaginary parts of a complex signal of half the length. Its transform
+  // Z gives the transforms of the even inputs E[k] = (Z[k] + conj(Z[-k])) / 2 and of the odd inputs
+  // O[k] = (Z[k] - conj(Z[-k])) / 2i, which are combined with X[k] = E[k] + w^k * O[k].
+  const size_t half_length = length_ / 2;
+  std::complex<T>* z = scratch;
+  std::complex<T>* z_transform = scratch + half_length;
+  for (size_t j = 0; j < half_length; ++j) {
+    z[j] = std::complex<T>(input[2 * j], input[2 * j + 1]);
+  }
+
+  half_plan_->Transform(z, z_transform, scratch + length_);
+
+  const T half = static_cast<T>(0.5);
+  for (size_t k = 0; k <= half_length; ++k) {
+    const std::complex<T> zk = z_transform[k % half_length];
+    const std::complex<T> zc = std::conj(z_transform[(half_length - k) % half_length]);
+    const std::complex<T> even = (zk + zc) * half;
+    const std::complex<T> diff = (zk - zc) * half;
+    const std::complex<T> odd(diff.imag(), -diff.real());
+    output[k] = even + real_twiddles_[k] * odd;
+  }
+}
+
+template <typename T>
+std::shared_ptr<const FftPlan<T>> FftPlanCache::Get(size_t length, bool inverse) {
+  auto get = [length, inverse](auto& plans) {
+    const auto key = std::make_pair(length, inverse);
+    auto it = plans.find(key);
+    if (it != plans.end()) {
+      return it->second;
+    }
+
+    if (plans.size() >= kMaxPlans) {
+      plans.clear();
+    }
+
+    auto plan = std::make_shared<const FftPlan<T>>(length, inverse);
+    plans.emplace(key, plan);
+    return plan;
+  };
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+  if constexpr (std::is_same_v<T, float>) {
+    return get(float_plans_);
+  } else {
+    return get(double_plans_);
+  }
+}
+
+template class FftPlan<float>;
+template class FftPlan<double>;
+template std::shared_ptr<const FftPlan<float>> FftPlanCache::Get<float>(size_t, bool);
+template std::shared_ptr<const FftPlan<double>> FftPlanCache::Get<double>(size_t, bool);
+
+}  // namespace signal
+}  // namespace onnxruntime
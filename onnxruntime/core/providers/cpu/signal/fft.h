@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <complex>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/inlined_containers.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+namespace signal {
+
+// Precomputed transform of a given length and direction. The transforms are not normalized.
+// Lengths whose prime factors are 2, 3 and 5 use a mixed-radix Cooley-Tukey decomposition with radix 4, 2, 3 and 5
+// butterflies. Other lengths are computed with Bluestein's algorithm, as a circular convolution of power of 2 length.
+// Real inputs of even length are transformed as complex inputs of half the length.
+// A plan is immutable once created and may be used by several threads at once, each with its own scratch buffer.
+template <typename T>
+class FftPlan {
+ public:
+  FftPlan(size_t length, bool inverse);
+
+  size_t Length() const { return length_; }
+
+  // Number of complex values of the scratch buffer Transform and TransformReal need.
+  size_t ScratchSize() const { return scratch_size_; }
+
+  // Transform 'length' complex values. 'input' and 'output' must not overlap.
+  void Transform(const std::complex<T>* input, std::complex<T>* output, std::complex<T>* scratch) const;
+
+  // Transform 'length' real values, writing the 'length / 2 + 1' first outputs. The other outputs are the conjugates
+  // of these.
+  void TransformReal(const T* input, std::complex<T>* output, std::complex<T>* scratch) const;
+
+ private:
+  // 'real_transform' is false for the internal plans, which only transform complex signals.
+  FftPlan(size_t length, bool inverse, bool real_transform);
+
+  void MixedRadix(std::complex<T>* output, const std::complex<T>* input, size_t input_stride, size_t factor_index,
+                  size_t twiddle_stride) const;
+
+  void Bluestein(const std::complex<T>* input, std::complex<T>* output, std::complex<T>* scratch) const;
+
+  size_t length_;
+  bool inverse_;
+  size_t scratch_size_ = 0;
+
+  // radix of each stage of the mixed-radix decomposition, empty when Bluestein's algorithm is used
+  InlinedVector<size_t> radices_;
+  std::vector<std::complex<T>> twiddles_;
+
+  // Bluestein's algorithm: the chirp exp(+-i * pi * k^2 / length), the transform of the convolution filter scaled
+  // by the inverse of the convolution length and the forward plan of the convolution
+  std::vector<std::complex<T>> chirp_;
+  std::vector<std::complex<T>> filter_transform_;
+  std::unique_ptr<FftPlan<T>> convolution_plan_;
+
+  // real inputs of even length: the plan of half the length and the twiddles that combine its outputs
+  std::unique_ptr<FftPlan<T>> half_plan_;
+  std::vector<std::complex<T>> real_twiddles_;
+};
+
+// Plans of a kernel, created the first time a length and direction is seen so that the twiddle factors are not
+// computed again for every signal and every Run.
+class FftPlanCache {
+ public:
+  template <typename T>
+  std::shared_ptr<const FftPlan<T>> Get(size_t length, bool inverse);
+
+ private:
+  // the cache is cleared when it holds more plans than this, the lengths are usually the same from one Run to the next
+  static constexpr size_t kMaxPlans = 16;
+
+  OrtMutex mutex_;
+  std::map<std::pair<size_t, bool>, std::shared_ptr<const FftPlan<float>>> float_plans_;
+  std::map<std::pair<size_t, bool>, std::shared_ptr<const FftPlan<double>>> double_plans_;
+};
+
+}  // namespace signal
+}  // namespace onnxruntime
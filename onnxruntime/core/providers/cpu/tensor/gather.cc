@@ -3,6 +3,12 @@
 
 //https://github.com/onnx/onnx/blob/master/docs/Operators.md#Gather
 #include "core/providers/cpu/tensor/gather.h"
+
+#include <algorithm>
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#endif
+
 #include "core/common/common.h"
 #include "core/framework/op_kernel_type_control_utils.h"
 #include "core/platform/threadpool.h"
@@ -83,6 +89,61 @@ Status GatherBase::PrepareForCompute(OpKernelContext* context, Prepare& p) const
   return Status::OK();
 }
 
+namespace {
+
+// Rows of at least this many bytes are copied with the source of a following row being prefetched,
+// as the rows of embedding tables are spread over a table much larger than the caches.
+constexpr int64_t kPrefetchRowBytes = 256;
+
+// Number of rows ahead of the current one that are prefetched.
+constexpr int64_t kPrefetchDistance = 4;
+
+inline void PrefetchRead(const void* address) {
+#if defined(__GNUC__)
+  __builtin_prefetch(address, 0, 0);
+#elif defined(_M_AMD64) || defined(_M_IX86)
+  _mm_prefetch(static_cast<const char*>(address), _MM_HINT_NTA);
+#else
+  ORT_UNUSED_PARAMETER(address);
+#endif
+}
+
+// Calls fn(batch, first, last) for the indices [first, last) of each batch covered by the range [begin, end) of
+// the M * N gathered rows, so that the division by N happens once per batch and not once per row.
+template <typename Fn>
+inline void ForEachBatchRange(ptrdiff_t begin, ptrdiff_t end, int64_t N, Fn&& fn) {
+  int64_t batch = begin / N;
+  int64_t i = begin % N;
+  for (int64_t remaining = end - begin; remaining > 0; ++batch, i = 0) {
+    const int64_t count = std::min(remaining, N - i);
+    fn(batch, i, i + count);
+    remaining -= count;
+  }
+}
+
+// Gather of single elements, e.g. along the last axis, with a typed load and store instead of a memcpy per element.
+template <typename T, typename Tin>
+void GatherElementsOfType(const Tin* indices_data, const uint8_t* src_base, uint8_t* dst_base, const int64_t M,
+                          const int64_t N, const int64_t axis_dim_limit, concurrency::ThreadPool* tp) {
+  const T* src = reinterpret_cast<const T*>(src_base);
+  T* dst = reinterpret_cast<T*>(dst_base);
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, M * N, static_cast<double>(sizeof(T)),
+      [&](ptrdiff_t begin, ptrdiff_t end) {
+        ForEachBatchRange(begin, end, N, [&](int64_t batch, int64_t first, int64_t last) {
+          const T* src_batch = src + batch * axis_dim_limit;
+          T* dst_batch = dst + batch * N;
+          for (int64_t i = first; i < last; ++i) {
+            const int64_t idx = static_cast<int64_t>(indices_data[i]);
+            dst_batch[i] = src_batch[idx < 0 ? idx + axis_dim_limit : idx];
+          }
+        });
+      });
+}
+
+}  // namespace
+
 template <typename Tin>
 Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uint8_t* dst_base, bool is_string_type,
                       const size_t element_bytes, const int64_t block_size, const int64_t M,
@@ -102,30 +163,67 @@ Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uin
     }
   }
 
-  auto lambda = [&](int64_t index) {
-    int64_t batch = index / N;
-    int64_t i = index % N;
+  if (M * N == 0) {
+    return Status::OK();
+  }
 
-    const int64_t src_offset_batch = batch * data_batch_bytes;
-    const int64_t dst_offset_batch = batch * gathered_batch_bytes;
-    Tin idx = indices_data[i];
-    idx = idx < 0 ? idx + static_cast<Tin>(axis_dim_limit) : idx;
-    const int64_t src_offset = src_offset_batch + idx * block_size;
-    const int64_t dst_offset = dst_offset_batch + i * block_size;
-
-    if (is_string_type) {
-      reinterpret_cast<std::string*>(dst_base)[dst_offset / element_bytes] =
-          reinterpret_cast<const std::string*>(src_base)[src_offset / element_bytes];
-    } else {
-      memcpy(dst_base + dst_offset, src_base + src_offset, block_size);
+  if (is_string_type) {
+    const auto* src = reinterpret_cast<const std::string*>(src_base);
+    auto* dst = reinterpret_cast<std::string*>(dst_base);
+    const int64_t block = block_size / static_cast<int64_t>(element_bytes);
+
+    concurrency::ThreadPool::TryParallelFor(
+        tp, M * N, static_cast<double>(block_size),
+        [&](ptrdiff_t begin, ptrdiff_t end) {
+          ForEachBatchRange(begin, end, N, [&](int64_t batch, int64_t first, int64_t last) {
+            for (int64_t i = first; i < last; ++i) {
+              const int64_t idx = static_cast<int64_t>(indices_data[i]);
+              const auto* src_block = src + (batch * axis_dim_limit + (idx < 0 ? idx + axis_dim_limit : idx)) * block;
+              std::copy(src_block, src_block + block, dst + (batch * N + i) * block);
+            }
+          });
+        });
+    return Status::OK();
+  }
+
+  if (block_size == static_cast<int64_t>(element_bytes)) {
+    switch (element_bytes) {
+      case sizeof(uint8_t):
+        GatherElementsOfType<uint8_t>(indices_data, src_base, dst_base, M, N, axis_dim_limit, tp);
+        return Status::OK();
+      case sizeof(uint16_t):
+        GatherElementsOfType<uint16_t>(indices_data, src_base, dst_base, M, N, axis_dim_limit, tp);
+        return Status::OK();
+      case sizeof(uint32_t):
+        GatherElementsOfType<uint32_t>(indices_data, src_base, dst_base, M, N, axis_dim_limit, tp);
+        return Status::OK();
+      case sizeof(uint64_t):
+        GatherElementsOfType<uint64_t>(indices_data, src_base, dst_base, M, N, axis_dim_limit, tp);
+        return Status::OK();
+      default:
+        break;
     }
-  };
-  concurrency::ThreadPool::TryParallelFor(tp, M * N, static_cast<double>(block_size),
-                                          [&lambda](ptrdiff_t first, ptrdiff_t last) {
-                                            for (int index = static_cast<int>(first), end = static_cast<int>(last); index < end; ++index) {
-                                              lambda(index);
-                                            }
-                                          });
+  }
+
+  const bool prefetch = block_size >= kPrefetchRowBytes;
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, M * N, static_cast<double>(block_size),
+      [&](ptrdiff_t begin, ptrdiff_t end) {
+        ForEachBatchRange(begin, end, N, [&](int64_t batch, int64_t first, int64_t last) {
+          const uint8_t* src_batch = src_base + batch * data_batch_bytes;
+          uint8_t* dst_batch = dst_base + batch * gathered_batch_bytes;
+          for (int64_t i = first; i < last; ++i) {
+            if (prefetch && i + kPrefetchDistance < last) {
+              const int64_t next = static_cast<int64_t>(indices_data[i + kPrefetchDistance]);
+              PrefetchRead(src_batch + (next < 0 ? next + axis_dim_limit : next) * block_size);
+            }
+            const int64_t idx = static_cast<int64_t>(indices_data[i]);
+            memcpy(dst_batch + i * block_size, src_batch + (idx < 0 ? idx + axis_dim_limit : idx) * block_size,
+                   block_size);
+          }
+        });
+      });
 
   return Status::OK();
 }
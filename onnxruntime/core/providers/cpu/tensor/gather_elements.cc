@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
+#include <atomic>
 #include <string>
 #include "gather_elements.h"
 #include "onnxruntime_config.h"
@@ -66,6 +68,9 @@ static inline size_t CalculateOffset(size_t inner_dim, const TensorPitches& inpu
   return base_offset;
 }
 
+// Number of elements of a row of 'indices' processed by one task of the thread pool.
+static constexpr size_t kChunkSize = 4096;
+
 #if defined(_MSC_VER)
 #define FORCEINLINE __forceinline
 #else
@@ -110,20 +115,29 @@ static void core_impl(const Tensor* input_tensor, const Tensor* indices_tensor,
   int64_t axis_size = input_tensor->Shape()[axis];
 
   bool innermost_axis = axis == input_rank - 1;
-  bool index_error = false;
+  std::atomic<bool> index_error{false};
+
+  // Long rows are split in chunks so that inputs with few rows, e.g. a single row of a 1-D input, still run
+  // in parallel.
+  const size_t chunk_size = std::min(inner_dim_size, kChunkSize);
+  const size_t num_chunks_per_row = chunk_size == 0 ? 0 : (inner_dim_size + chunk_size - 1) / chunk_size;
 
   auto MainLoop = [&](auto* output_data, auto* input_data) {
-    auto BatchWork = [&](size_t inner_dim) {
+    auto ChunkWork = [&](size_t chunk) {
       ORT_TRY {
+        const size_t inner_dim = chunk / num_chunks_per_row;
+        const size_t begin = (chunk % num_chunks_per_row) * chunk_size;
+        const size_t end = std::min(inner_dim_size, begin + chunk_size);
+
         auto output = output_data + inner_dim_size * inner_dim;
         auto input = input_data + CalculateOffset(inner_dim, input_shape_pitches, axis, indices_shape);
         auto indices = indices_data + inner_dim_size * inner_dim;
 
         if (innermost_axis) {
-          for (size_t i = 0; i < inner_dim_size; i++)
+          for (size_t i = begin; i < end; i++)
             output[i] = input[GetIndex(i, indices, axis_size)];
         } else {
-          for (size_t i = 0; i < inner_dim_size; i++)
+          for (size_t i = begin; i < end; i++)
             output[i] = input[GetIndex(i, indices, axis_size) * axis_pitch + i];
         }
       }
@@ -132,7 +146,14 @@ static void core_impl(const Tensor* input_tensor, const Tensor* indices_tensor,
       }
     };
 
-    concurrency::ThreadPool::TryBatchParallelFor(ttp, num_inner_dim, BatchWork, 0);
+    concurrency::ThreadPool::TryParallelFor(
+        ttp, static_cast<std::ptrdiff_t>(num_inner_dim * num_chunks_per_row),
+        static_cast<double>(chunk_size * element_size),
+        [&ChunkWork](std::ptrdiff_t first, std::ptrdiff_t last) {
+          for (auto chunk = first; chunk < last; ++chunk) {
+            ChunkWork(static_cast<size_t>(chunk));
+          }
+        });
   };
 
   // Iterate over the elements based on the element size (or if it's a string). For everything but strings
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 //https://github.com/onnx/onnx/blob/master/docs/Operators.md#Scatter
+#include <algorithm>
 #include <type_traits>
 
 #include "gsl/gsl"
@@ -10,6 +11,7 @@
 #include "core/framework/element_type_lists.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/op_kernel_type_control_utils.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 #include "core/providers/op_kernel_type_control.h"
 #if defined(ENABLE_TRAINING) || defined(ENABLE_TRAINING_OPS)
@@ -174,6 +176,9 @@ struct Func_Mul<BFloat16> {
     }
 };
 
+// Number of inner positions of the updates handled by one task of ScatterData.
+constexpr int64_t kScatterInnerBlockSize = 1024;
+
 template <class TIndex>
 Status GetIndices(
     const Tensor& data_input, const Tensor& indices_input, int64_t axis,
@@ -207,7 +212,7 @@ template <class Tdata, typename FuncT>
 Status ScatterData(
     const FuncT& func,
     const Tensor* data_input, const std::vector<int64_t>& indices_data, const Tensor* updates_input, int64_t axis,
-    Tensor* data_output) {
+    Tensor* data_output, concurrency::ThreadPool* tp) {
   const TensorShape& input_data_shape = data_input->Shape();
 
   const auto input_elements = input_data_shape.Size();
@@ -231,35 +236,22 @@ Status ScatterData(
     }
   }
 
+  if (num_indices == 0) {
+    return Status::OK();
+  }
+
   // Now poke updates
 
   const auto& upd_shape = updates_input->Shape();
   const auto num_dims = input_data_shape.NumDimensions();
   assert(num_dims > 0);
 
-  // Allocate and zero out counts. The input/output is of the same rank as
-  // indices/updates but the actual dimensions of indices/updates must be less or equal
-  // than that of input/output because we can update no more elements than
-  // the input contains. As we walk through the indices/updates
-  // we maintain dimension count as we will need to use it
-  // to compute output offset but using input/output dim values.
-  // We treat the whole array as a number where each element having
-  // different cardinality according to the upd_shape dimensions.
-  // As each counter reaches its max (upd_shape) it resets to zero
-  // and we carry to the more significant dim (right to left)
-  std::vector<int64_t> dim_counters(num_dims);
-
-  // This vector contains number of elements under the dimension.
+  // This vector contains number of elements under the dimension of the input/output.
   // For example, for the dimensions of [4, 2, 3] the vector
   // would contain [6, 3, 1] since for each count of dim 1 it
   // contains 3 elements of dim 2.
   // For each count of dim 0 we would have 2x3=6 elements.
   // The last value is always 1.
-  // We use it to compute output element offset. For a given value of
-  // counters we multiple each counter value per corresponding entry of dim_block_size value
-  // and add up resulting the output element offset. However, for dimensions
-  // that are equal to the specified axis value we take indices_data[index]
-  // instead of the counter value.
   // E.g. for 3-dim and axis=0
   //    output[indices[i][j][k]][j][k] = updates[i][j][k]
   // for axis 1
@@ -276,58 +268,86 @@ Status ScatterData(
     }
   }
 
-  const auto* update_data = static_cast<const Tdata*>(updates_input->DataRaw());
-  // For every update we compute the destination offset and copy it there
-  for (int64_t index = 0; index < num_indices;) {
-    const auto axis_idx = indices_data[index];
-
-    // Compute the offset
-    // See comments above for dim_block_size
-    size_t dst_offset = 0;
-    for (size_t i = 0; i < num_dims; ++i) {
-      if (i == size_t(axis)) {
-        // replace the counter with the update index for this dim
-        dst_offset += axis_idx * dim_block_size[i];
-      } else {
-        dst_offset += dim_counters[i] * dim_block_size[i];
-      }
+  // The updates are viewed as [outer, axis_dim, inner]. The dimensions of the updates may be smaller than those of
+  // the output, so the output offsets of the outer and inner positions are computed from the updates' coordinates.
+  const int64_t outer = upd_shape.SizeToDimension(gsl::narrow<size_t>(axis));
+  const int64_t axis_dim = upd_shape[gsl::narrow<size_t>(axis)];
+  const int64_t inner = upd_shape.SizeFromDimension(gsl::narrow<size_t>(axis) + 1);
+  const int64_t axis_block_size = dim_block_size[gsl::narrow<size_t>(axis)];
+
+  std::vector<int64_t> inner_offsets(gsl::narrow<size_t>(inner));
+  for (int64_t i = 0; i < inner; ++i) {
+    int64_t remaining = i;
+    int64_t offset = 0;
+    for (auto dim = int64_t(num_dims - 1); dim > axis; --dim) {
+      offset += (remaining % upd_shape[dim]) * dim_block_size[dim];
+      remaining /= upd_shape[dim];
     }
+    inner_offsets[i] = offset;
+  }
 
-    func(dst_base + dst_offset, update_data + index);
-
-    if (++index == num_indices) {
-      break;
+  auto outer_offset = [&](int64_t o) {
+    int64_t offset = 0;
+    for (auto dim = axis - 1; dim >= 0; --dim) {
+      offset += (o % upd_shape[dim]) * dim_block_size[dim];
+      o /= upd_shape[dim];
     }
-    // Increment counters
-    // See comments for dim_counters above
-    for (auto i = int64_t(num_dims - 1); i >= 0; --i) {
-      auto v = ++dim_counters[i];
-      assert(v <= upd_shape[i]);
-      if (v < upd_shape[i]) {
-        // No carry, done
-        break;
+    return offset;
+  };
+
+  // The updates with the same outer and inner position only differ by their index along the axis, so they are
+  // the only ones that can write to the same output elements. Each task takes one outer position and a range of
+  // inner positions, so the tasks write to disjoint output elements, and applies their updates in the same order
+  // as a serial walk over the updates, which keeps the result of the reductions deterministic.
+  const int64_t inner_block_size = std::min<int64_t>(inner, kScatterInnerBlockSize);
+  const int64_t num_inner_blocks = (inner + inner_block_size - 1) / inner_block_size;
+  const auto* update_data = static_cast<const Tdata*>(updates_input->DataRaw());
+
+  auto scatter_block = [&](int64_t block) {
+    const int64_t o = block / num_inner_blocks;
+    const int64_t inner_begin = (block % num_inner_blocks) * inner_block_size;
+    const int64_t inner_end = std::min(inner, inner_begin + inner_block_size);
+    Tdata* dst = dst_base + outer_offset(o);
+
+    for (int64_t a = 0; a < axis_dim; ++a) {
+      const int64_t update_offset = (o * axis_dim + a) * inner;
+      const int64_t* indices = indices_data.data() + update_offset;
+      const Tdata* updates = update_data + update_offset;
+      for (int64_t i = inner_begin; i < inner_end; ++i) {
+        func(dst + indices[i] * axis_block_size + inner_offsets[i], updates + i);
       }
-      // No carry for the most significant dim
-      assert(i > 0);
-      dim_counters[i] = 0;
     }
-  }
+  };
+
+  // The first block runs on this thread so that a reduction which is not implemented for the data type throws here
+  // and not on a thread of the pool.
+  scatter_block(0);
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(outer * num_inner_blocks - 1),
+      static_cast<double>(axis_dim * inner_block_size * static_cast<int64_t>(sizeof(Tdata))),
+      [&scatter_block](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (auto block = first; block < last; ++block) {
+          scatter_block(block + 1);
+        }
+      });
+
   return Status::OK();
 }
 
 template <typename TData>
 struct ScatterDataDispatchTarget {
   Status operator()(const Tensor* data_input, const std::vector<int64_t>& indices_data, const Tensor* updates_input, int64_t axis,
-                    const std::string &reduction, Tensor* data_output) const {
+                    const std::string &reduction, Tensor* data_output, concurrency::ThreadPool* tp) const {
     if(reduction == "add")
       return ScatterData<TData>(
-          Func_Add<TData>(), data_input, indices_data, updates_input, axis, data_output);
+          Func_Add<TData>(), data_input, indices_data, updates_input, axis, data_output, tp);
     else if(reduction == "mul")
       return ScatterData<TData>(
-          Func_Mul<TData>(), data_input, indices_data, updates_input, axis, data_output);
+          Func_Mul<TData>(), data_input, indices_data, updates_input, axis, data_output, tp);
     else // if (reduction == "none")
       return ScatterData<TData>(
-          Func_Assignment<TData>(), data_input, indices_data, updates_input, axis, data_output);
+          Func_Assignment<TData>(), data_input, indices_data, updates_input, axis, data_output, tp);
   }
 };
 
@@ -397,7 +417,8 @@ Status Scatter<EnabledDataTypes>::Compute(OpKernelContext* context) const {
 
   utils::MLTypeCallDispatcherFromTypeList<EnabledDataTypes> dispatcher{data_type};
   status = dispatcher.template InvokeRet<Status, ScatterDataDispatchTarget>(
-      data_input, indices_data, updates_input, axis, this->reduction_, data_output);
+      data_input, indices_data, updates_input, axis, this->reduction_, data_output,
+      context->GetOperatorThreadPool());
 
   return status;
 }
@@ -418,7 +439,7 @@ Status GatherElementsGradImpl(const Tensor* indices_input, const Tensor* updates
                               const int64_t axis, Tensor* data_output) {
   std::vector<int64_t> indices_data{};
   ORT_RETURN_IF_ERROR(GetIndices<Tin>(*data_output, *indices_input, axis, indices_data));
-  return ScatterData<Tdata>(Func_Add<Tdata>(), data_output, indices_data, updates_input, axis, data_output);
+  return ScatterData<Tdata>(Func_Add<Tdata>(), data_output, indices_data, updates_input, axis, data_output, nullptr);
 }
 
 #define GATHER_ELEMENTS_GRAD_IMPL_SPECIALIZED(Tin, Tdata)         \
@@ -35,25 +35,27 @@ void UpsampleNearest2x(int64_t batch_size,
                        int64_t input_height,
                        int64_t input_width,
                        const T* input,
-                       T* output) {
+                       T* output,
+                       concurrency::ThreadPool* tp) {
   const int64_t output_height = input_height * 2;
   const int64_t output_width = input_width * 2;
-  for (int64_t n = 0; n < batch_size; ++n) {
-    for (int64_t c = 0; c < num_channels; ++c) {
-      for (int64_t y = 0; y < output_height; ++y) {
-        const int64_t in_y = y / 2;
-        for (int64_t x = 0; x < input_width; ++x) {
-          const T v = input[in_y * input_width + x];
-          const int64_t oidx = output_width * y + x * 2;
-          output[oidx + 0] = v;
-          output[oidx + 1] = v;
+  // Every input row is written to two consecutive output rows
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(batch_size * num_channels * input_height),
+      TensorOpCost{static_cast<double>(input_width * sizeof(T)), static_cast<double>(2 * output_width * sizeof(T)),
+                   static_cast<double>(output_width * 2)},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t in_row = first; in_row < last; ++in_row) {
+          const T* input_row = input + in_row * input_width;
+          T* output_row = output + in_row * 2 * output_width;
+          for (int64_t x = 0; x < input_width; ++x) {
+            const T v = input_row[x];
+            output_row[x * 2 + 0] = v;
+            output_row[x * 2 + 1] = v;
+          }
+          std::copy_n(output_row, output_width, output_row + output_width);
         }
-      }
-
-      input += input_height * input_width;
-      output += output_height * output_width;
-    }
-  }
+      });
 }
 
 static std::vector<int64_t> UpsampleNearestSetupRank1InputMapping(
@@ -145,19 +147,16 @@ static Status UpsampleNearestImpl(const T* input,
                                   bool extrapolation_enabled,
                                   const T extrapolation_value,
                                   const GetOriginalCoordinateFunc& get_original_coordinate,
-                                  const GetNearestPixelFunc& get_nearest_pixel) {
+                                  const GetNearestPixelFunc& get_nearest_pixel,
+                                  concurrency::ThreadPool* tp) {
   int64_t n_dim = static_cast<int64_t>(input_shape.NumDimensions());
 
-  std::vector<int64_t> input_dim_counters(n_dim);
   std::vector<int64_t> input_dim_factor(n_dim);
   input_dim_factor[n_dim - 1] = 1;  // initialize dimension factor
   for (int64_t dim_idx = n_dim - 2; dim_idx >= 0; dim_idx--) {
     input_dim_factor[dim_idx] = input_dim_factor[dim_idx + 1] * input_shape[dim_idx + 1];
   }
 
-  int64_t output_idx = 0;
-  int64_t input_idx = 0;
-
   if (n_dim == 1) {
     std::vector<int64_t> input_mapping = UpsampleNearestSetupRank1InputMapping(input_shape[0],
                                                                                output_shape[0],
@@ -179,78 +178,54 @@ static Status UpsampleNearestImpl(const T* input,
       UpsampleNearestSetupInputMappings(n_dim, input_shape, output_shape, input_dim_factor, scales, roi,
                                         extrapolation_enabled, get_original_coordinate, get_nearest_pixel);
 
-  if (n_dim == 2) {
-    const std::vector<int64_t>& input_mapping_0 = input_mappings[0];
-    const std::vector<int64_t>& input_mapping_1 = input_mappings[1];
-
-    for (int64_t output_dim0_inx = 0; output_dim0_inx < output_shape[0]; output_dim0_inx++) {
-      int64_t input_idx_0 = input_mapping_0[output_dim0_inx];
-      for (int64_t output_dim1_inx = 0; output_dim1_inx < output_shape[1]; output_dim1_inx++) {
-        int64_t input_idx_1 = input_idx_0 + input_mapping_1[output_dim1_inx];
-        output[output_idx++] = (input_idx_1 < 0) ? extrapolation_value : input[input_idx_1];
-      }
-    }
-    return Status::OK();
-  }
-
-  if (n_dim == 3) {
-    const std::vector<int64_t>& input_mapping_0 = input_mappings[0];
-    const std::vector<int64_t>& input_mapping_1 = input_mappings[1];
-    const std::vector<int64_t>& input_mapping_2 = input_mappings[2];
-
-    for (int64_t output_dim0_inx = 0; output_dim0_inx < output_shape[0]; output_dim0_inx++) {
-      int64_t input_idx_0 = input_mapping_0[output_dim0_inx];
-      for (int64_t output_dim1_inx = 0; output_dim1_inx < output_shape[1]; output_dim1_inx++) {
-        int64_t input_idx_1 = input_idx_0 + input_mapping_1[output_dim1_inx];
-        for (int64_t output_dim2_inx = 0; output_dim2_inx < output_shape[2]; output_dim2_inx++) {
-          int64_t input_idx_2 = input_idx_1 + input_mapping_2[output_dim2_inx];
-          output[output_idx++] = (input_idx_2 < 0) ? extrapolation_value : input[input_idx_2];
-        }
-      }
-    }
-    return Status::OK();
+  // The output is split in rows which are computed in parallel. The input offset of an output element is the sum of
+  // the mappings of its indexes, which is negative if one of them needs extrapolation.
+  // When the innermost axis is not resized, e.g. the channels of NHWC, its elements are contiguous in both the
+  // input and the output and a row covers the two innermost axes so that they are copied in blocks.
+  const bool copy_inner_axis = n_dim > 2 && scales[n_dim - 1] == 1.0f;
+  const int64_t num_outer_axes = copy_inner_axis ? n_dim - 2 : n_dim - 1;
+  int64_t num_rows = 1;
+  for (int64_t axis = 0; axis < num_outer_axes; ++axis) {
+    num_rows *= output_shape[axis];
   }
+  const int64_t row_size = output_shape.Size() / num_rows;
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_rows),
+      TensorOpCost{static_cast<double>(row_size * sizeof(T)), static_cast<double>(row_size * sizeof(T)),
+                   static_cast<double>(row_size * 2)},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          int64_t row_input_idx = 0;
+          int64_t outer_idx = row;
+          for (int64_t axis = num_outer_axes - 1; axis >= 0; --axis) {
+            row_input_idx += input_mappings[axis][outer_idx % output_shape[axis]];
+            outer_idx /= output_shape[axis];
+          }
 
-  if (n_dim == 4) {
-    const std::vector<int64_t>& input_mapping_0 = input_mappings[0];
-    const std::vector<int64_t>& input_mapping_1 = input_mappings[1];
-    const std::vector<int64_t>& input_mapping_2 = input_mappings[2];
-    const std::vector<int64_t>& input_mapping_3 = input_mappings[3];
-
-    for (int64_t output_dim0_inx = 0; output_dim0_inx < output_shape[0]; output_dim0_inx++) {
-      int64_t input_idx_0 = input_mapping_0[output_dim0_inx];
-      for (int64_t output_dim1_inx = 0; output_dim1_inx < output_shape[1]; output_dim1_inx++) {
-        int64_t input_idx_1 = input_idx_0 + input_mapping_1[output_dim1_inx];
-        for (int64_t output_dim2_inx = 0; output_dim2_inx < output_shape[2]; output_dim2_inx++) {
-          int64_t input_idx_2 = input_idx_1 + input_mapping_2[output_dim2_inx];
-          for (int64_t output_dim3_inx = 0; output_dim3_inx < output_shape[3]; output_dim3_inx++) {
-            int64_t input_idx_3 = input_idx_2 + input_mapping_3[output_dim3_inx];
-            output[output_idx++] = (input_idx_3 < 0) ? static_cast<T>(extrapolation_value) : input[input_idx_3];
+          T* output_row = output + row * row_size;
+          if (row_input_idx < 0) {
+            std::fill_n(output_row, row_size, extrapolation_value);
+          } else if (copy_inner_axis) {
+            const std::vector<int64_t>& input_mapping = input_mappings[n_dim - 2];
+            const int64_t inner_size = output_shape[n_dim - 1];
+            for (int64_t dim = 0; dim < output_shape[n_dim - 2]; ++dim, output_row += inner_size) {
+              const int64_t input_idx = row_input_idx + input_mapping[dim];
+              if (input_idx < 0) {
+                std::fill_n(output_row, inner_size, extrapolation_value);
+              } else {
+                std::copy_n(input + input_idx, inner_size, output_row);
+              }
+            }
+          } else {
+            const std::vector<int64_t>& input_mapping = input_mappings[n_dim - 1];
+            for (int64_t dim = 0; dim < row_size; ++dim) {
+              const int64_t input_idx = row_input_idx + input_mapping[dim];
+              output_row[dim] = input_idx < 0 ? extrapolation_value : input[input_idx];
+            }
           }
         }
-      }
-    }
-    return Status::OK();
-  }
-
-  std::vector<int64_t> output_dim_counter(n_dim);
-  for (int64_t dim_idx = 0; dim_idx < n_dim; dim_idx++) {
-    input_idx += input_mappings[dim_idx][0 /* output_dim_counter[dim_idx] */];
-  }
-
-  for (int64_t output_size = output_shape.Size(); output_idx < output_size; output_idx++) {
-    output[output_idx] = (input_idx < 0) ? extrapolation_value : input[input_idx];
-
-    for (int64_t dim_idx = n_dim - 1; dim_idx >= 0; dim_idx--) {
-      input_idx -= input_mappings[dim_idx][output_dim_counter[dim_idx]];
-      if (++output_dim_counter[dim_idx] < output_shape[dim_idx]) {
-        input_idx += input_mappings[dim_idx][output_dim_counter[dim_idx]];
-        break;
-      }
-      output_dim_counter[dim_idx] = 0;
-      input_idx += input_mappings[dim_idx][0 /* output_dim_counter[dim_idx] */];
-    }
-  }
+      });
 
   return Status::OK();
 }
@@ -291,19 +266,20 @@ static Status UpsampleNearest(const T* input,
                               T extrapolation_value,
                               bool use_nearest2x_optimization,
                               const GetOriginalCoordinateFunc& get_original_coordinate,
-                              const GetNearestPixelFunc& get_nearest_pixel) {
+                              const GetNearestPixelFunc& get_nearest_pixel,
+                              concurrency::ThreadPool* tp) {
   ORT_RETURN_IF_ERROR(ValidateUpsampleInput(input, output, input_shape, output_shape, is_resize));
 
   // special case with fast path
   if (use_nearest2x_optimization && input_shape.NumDimensions() == 4 &&
       scales[0] == 1 && scales[1] == 1 && scales[2] == 2 && scales[3] == 2) {
-    UpsampleNearest2x<T>(input_shape[0], input_shape[1], input_shape[2], input_shape[3], input, output);
+    UpsampleNearest2x<T>(input_shape[0], input_shape[1], input_shape[2], input_shape[3], input, output, tp);
     return Status::OK();
   }
 
   return UpsampleNearestImpl(input, output, input_shape, output_shape, scales, roi,
                              extrapolation_enabled, extrapolation_value,
-                             get_original_coordinate, get_nearest_pixel);
+                             get_original_coordinate, get_nearest_pixel, tp);
 }
 
 /*
@@ -806,54 +782,55 @@ void UpsampleTrilinear(int64_t batch_size,
                                              depth_scale, height_scale, width_scale, roi,
                                              alloc, get_original_coordinate);
 
-  for (int64_t n = 0; n < batch_size; ++n) {
-    concurrency::ThreadPool::TrySimpleParallelFor(
-        tp, num_channels,
-        [&](std::ptrdiff_t c) {
-          const T* Xdata = XdataBase + (n * num_channels + c) * (input_depth * input_height * input_width);
-          T* Ydata = YdataBase + (n * num_channels + c) * (output_depth * output_height * output_width);
-          for (int64_t z = 0; z < output_depth; ++z) {
-            for (int64_t y = 0; y < output_height; ++y) {
-              for (int64_t x = 0; x < output_width; ++x) {
-                // when use_extrapolation is set and original index of x or y is out of the dim range
-                // then use extrapolation_value as the output value.
-                if (use_extrapolation &&
-                    ((p.z_original[z] < 0 || p.z_original[z] > static_cast<float>(input_depth - 1)) ||
-                     (p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1)) ||
-                     (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)))) {
-                  Ydata[output_width * output_height * z + output_width * y + x] =
-                      static_cast<T>(extrapolation_value);
-                  continue;
-                }
-
-                // subscript ordering in the variable - (xyz)
-                T X111 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y1[y] + p.in_x1[x]];
-                T X211 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y1[y] + p.in_x2[x]];
-                T X121 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y2[y] + p.in_x1[x]];
-                T X221 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y2[y] + p.in_x2[x]];
-
-                T X112 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y1[y] + p.in_x1[x]];
-                T X212 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y1[y] + p.in_x2[x]];
-                T X122 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y2[y] + p.in_x1[x]];
-                T X222 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y2[y] + p.in_x2[x]];
-
-                Ydata[output_width * output_height * z + output_width * y + x] =
-                    static_cast<T>(p.dx2[x] * p.dy2[y] * p.dz2[z] * X111 +
-                                   p.dx1[x] * p.dy2[y] * p.dz2[z] * X211 +
-                                   p.dx2[x] * p.dy1[y] * p.dz2[z] * X121 +
-                                   p.dx1[x] * p.dy1[y] * p.dz2[z] * X221 +
-
-                                   p.dx2[x] * p.dy2[y] * p.dz1[z] * X112 +
-                                   p.dx1[x] * p.dy2[y] * p.dz1[z] * X212 +
-                                   p.dx2[x] * p.dy1[y] * p.dz1[z] * X122 +
-                                   p.dx1[x] * p.dy1[y] * p.dz1[z] * X222);
-              }
+  // The output rows of all the volumes are computed in parallel
+  const int64_t rows_per_volume = output_depth * output_height;
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(batch_size * num_channels * rows_per_volume),
+      TensorOpCost{static_cast<double>(output_width * 8 * sizeof(T)), static_cast<double>(output_width * sizeof(T)),
+                   static_cast<double>(output_width * 24)},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          const int64_t volume = row / rows_per_volume;
+          const int64_t z = (row % rows_per_volume) / output_height;
+          const int64_t y = row % output_height;
+          const T* Xdata = XdataBase + volume * (input_depth * input_height * input_width);
+          T* Ydata = YdataBase + volume * (output_depth * output_height * output_width) +
+                     output_width * output_height * z + output_width * y;
+
+          for (int64_t x = 0; x < output_width; ++x) {
+            // when use_extrapolation is set and original index of x or y is out of the dim range
+            // then use extrapolation_value as the output value.
+            if (use_extrapolation &&
+                ((p.z_original[z] < 0 || p.z_original[z] > static_cast<float>(input_depth - 1)) ||
+                 (p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1)) ||
+                 (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)))) {
+              Ydata[x] = static_cast<T>(extrapolation_value);
+              continue;
             }
+
+            // subscript ordering in the variable - (xyz)
+            T X111 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y1[y] + p.in_x1[x]];
+            T X211 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y1[y] + p.in_x2[x]];
+            T X121 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y2[y] + p.in_x1[x]];
+            T X221 = Xdata[p.input_height_width_mul_z1[z] + p.input_width_mul_y2[y] + p.in_x2[x]];
+
+            T X112 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y1[y] + p.in_x1[x]];
+            T X212 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y1[y] + p.in_x2[x]];
+            T X122 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y2[y] + p.in_x1[x]];
+            T X222 = Xdata[p.input_height_width_mul_z2[z] + p.input_width_mul_y2[y] + p.in_x2[x]];
+
+            Ydata[x] = static_cast<T>(p.dx2[x] * p.dy2[y] * p.dz2[z] * X111 +
+                                      p.dx1[x] * p.dy2[y] * p.dz2[z] * X211 +
+                                      p.dx2[x] * p.dy1[y] * p.dz2[z] * X121 +
+                                      p.dx1[x] * p.dy1[y] * p.dz2[z] * X221 +
+
+                                      p.dx2[x] * p.dy2[y] * p.dz1[z] * X112 +
+                                      p.dx1[x] * p.dy2[y] * p.dz1[z] * X212 +
+                                      p.dx2[x] * p.dy1[y] * p.dz1[z] * X122 +
+                                      p.dx1[x] * p.dy1[y] * p.dz1[z] * X222);
           }
-          Xdata += input_depth * input_height * input_width;
-          Ydata += output_depth * output_width * output_height;
-        });
-  }
+        }
+      });
 }
 
 // Calculates cubic coeff based on Robert Keys approach
@@ -870,49 +847,61 @@ std::array<float, CubicModeGridLength> GetCubicCoeffs(float s, float cubic_coeff
   return coeffs;
 }
 
-// Get the tensor data at the requested coordinate
-template <typename T>
-T GetDataForCoordinate(const T* Xdata,
-                       int64_t x, int64_t y,
-                       int64_t input_height, int64_t input_width) {
-  x = std::max(static_cast<int64_t>(0), std::min(x, input_width - 1));
-  y = std::max(static_cast<int64_t>(0), std::min(y, input_height - 1));
-  return Xdata[y * input_width + x];
-}
-
-// Computes cubic convolution interpolation in 1D
-template <typename T>
-float CubicInterpolation1D(const T* Xdata,
-                           int64_t x,
-                           int64_t y,
-                           int64_t input_height,
-                           int64_t input_width,
-                           std::array<float, CubicModeGridLength>& coeff_array,
-                           float coeff_sum,
-                           std::unordered_map<int64_t, float>& cache) {
-  // When calculating cubic interpolation we move the 4*4 grid across the original data and therefore there is
-  // opportunity to cache the results for previously seen combinations.
-  // Check if the result is already available in the cache
-  auto grid_start_pos = (y)*input_width + (x - 1);
-  if (cache.find(grid_start_pos) != cache.end()) {
-    return cache[grid_start_pos];
-  }
+// Input indexes and weights of the 4 samples of cubic interpolation for every output index of one axis,
+// computed once per Compute instead of for every output pixel
+struct CubicAxisParams {
+  std::vector<float> original;
+  // 4 input indexes per output index, clamped to the input
+  std::vector<int64_t> indexes;
+  // 4 weights per output index, the weights of the samples outside of the input are 0 when exclude_outside is set
+  std::vector<float> weights;
+  // sum of the weights of each output index, by which they are normalized
+  std::vector<float> weight_sums;
+};
 
-  // get the neighbors in 1D and find interpolation for this dimension
-  // for 1D cubic interpolation 4 samples are used. 2 on the left and 2 on the right of x
-  float result = 0;
-  for (int i = 0, j = -1; i < static_cast<int>(CubicModeGridLength); i++, j++) {
-    auto orig_data = GetDataForCoordinate(Xdata, x + j, y, input_height, input_width);
-    result += coeff_array[i] / coeff_sum * orig_data;
+static CubicAxisParams SetupCubicAxis(int64_t input_size,
+                                      int64_t output_size,
+                                      float scale,
+                                      float roi_start,
+                                      float roi_end,
+                                      float cubic_coeff_a,
+                                      bool exclude_outside,
+                                      const GetOriginalCoordinateFunc& get_original_coordinate) {
+  CubicAxisParams p;
+  p.original.resize(output_size);
+  p.indexes.resize(output_size * CubicModeGridLength);
+  p.weights.resize(output_size * CubicModeGridLength);
+  p.weight_sums.resize(output_size);
+
+  for (int64_t i = 0; i < output_size; ++i) {
+    const float in = scale == 1 ? static_cast<float>(i)
+                                : get_original_coordinate(static_cast<float>(i), scale,
+                                                          static_cast<float>(output_size),
+                                                          static_cast<float>(input_size),
+                                                          roi_start, roi_end);
+    p.original[i] = in;
+    const auto in_int = static_cast<int64_t>(std::floor(in));
+    const auto coeffs = GetCubicCoeffs(in - in_int, cubic_coeff_a);
+
+    // When exclude_outside is set, the weight of sampling locations outside the grid will be set to 0
+    // and the weight will be renormalized so that their sum is 1.0
+    float weight_sum = exclude_outside ? 0.0f : 1.0f;
+    for (int64_t k = 0; k < static_cast<int64_t>(CubicModeGridLength); ++k) {
+      const int64_t in_k = in_int - 1 + k;
+      float weight = coeffs[k];
+      if (exclude_outside) {
+        weight = (in_k < 0 || in_k >= input_size) ? 0.0f : coeffs[k];
+        weight_sum += weight;
+      }
+      p.weights[i * CubicModeGridLength + k] = weight;
+      p.indexes[i * CubicModeGridLength + k] = std::max<int64_t>(0, std::min(in_k, input_size - 1));
+    }
+    p.weight_sums[i] = weight_sum;
   }
-  cache[grid_start_pos] = result;
 
-  return result;
+  return p;
 }
-#if defined(_MSC_VER)
-#pragma warning(push)
-#pragma warning(disable : 6001)
-#endif
+
 template <typename T>
 void ResizeBiCubic(int64_t batch_size,
                    int64_t num_channels,
@@ -927,140 +916,82 @@ void ResizeBiCubic(int64_t batch_size,
                    float extrapolation_value,
                    bool exclude_outside,
                    const std::vector<float>& roi,
-                   const T* Xdata,
-                   T* Ydata,
-                   const GetOriginalCoordinateFunc& get_original_coordinate) {
-  std::vector<float> y_original;
-  y_original.reserve(output_height);
-
-  std::vector<float> x_original;
-  x_original.reserve(output_width);
-
-  std::unordered_map<float, std::array<float, CubicModeGridLength>> cubic_coeffs;
-  std::unordered_map<float, std::unordered_map<int64_t, float>> coeff_to_1Dinterpolation_map;
+                   const T* XdataBase,
+                   T* YdataBase,
+                   const GetOriginalCoordinateFunc& get_original_coordinate,
+                   concurrency::ThreadPool* tp) {
   auto roi_y_start = roi.size() / 2 - 2;
   auto roi_y_end = roi.size() - 2;
   auto roi_x_start = roi.size() / 2 - 1;
   auto roi_x_end = roi.size() - 1;
 
-  // generate coefficients in y direction
-  for (int64_t y = 0; y < output_height; ++y) {
-    float in_y = height_scale == 1 ? static_cast<float>(y)
-                                   : get_original_coordinate(static_cast<float>(y), height_scale,
-                                                             static_cast<float>(output_height),
-                                                             static_cast<float>(input_height),
-                                                             roi[roi_y_start], roi[roi_y_end]);
-    y_original.emplace_back(in_y);
-    auto s = y_original[y] - std::floor(y_original[y]);
-    if (cubic_coeffs.find(s) == cubic_coeffs.end()) {
-      cubic_coeffs[s] = GetCubicCoeffs(s, cubic_coeff_a);
-      coeff_to_1Dinterpolation_map[s] = {};
-    }
-  }
-
-  // generate coefficients in x direction
-  for (int64_t x = 0; x < output_width; ++x) {
-    float in_x = width_scale == 1 ? static_cast<float>(x)
-                                  : get_original_coordinate(static_cast<float>(x),
-                                                            width_scale,
-                                                            static_cast<float>(output_width),
-                                                            static_cast<float>(input_width),
-                                                            roi[roi_x_start], roi[roi_x_end]);
-    x_original.emplace_back(in_x);
-    auto s = x_original[x] - std::floor(x_original[x]);
-    if (cubic_coeffs.find(s) == cubic_coeffs.end()) {
-      cubic_coeffs[s] = GetCubicCoeffs(s, cubic_coeff_a);
-      coeff_to_1Dinterpolation_map[s] = {};
-    }
+  const CubicAxisParams py = SetupCubicAxis(input_height, output_height, height_scale,
+                                            roi[roi_y_start], roi[roi_y_end], cubic_coeff_a, exclude_outside,
+                                            get_original_coordinate);
+  const CubicAxisParams px = SetupCubicAxis(input_width, output_width, width_scale,
+                                            roi[roi_x_start], roi[roi_x_end], cubic_coeff_a, exclude_outside,
+                                            get_original_coordinate);
+
+  // The x weights are divided by their sum once, the interpolation in x dimension of each of the 4 rows
+  // is then interpolated in y dimension
+  std::vector<float> x_weights(px.weights.size());
+  for (size_t i = 0; i < x_weights.size(); ++i) {
+    x_weights[i] = px.weights[i] / px.weight_sums[i / CubicModeGridLength];
   }
 
-  // setup up temp arrays to hold coefficients when exclude_outside is set to true
-  std::array<float, CubicModeGridLength> y_coeff_holder;
-  std::array<float, CubicModeGridLength> x_coeff_holder;
-  float y_coeff_sum = 1;
-  float x_coeff_sum = 1;
-
-  for (int64_t n = 0; n < batch_size; n++) {
-    for (int64_t c = 0; c < num_channels; c++) {
-      for (int64_t y = 0; y < output_height; ++y) {
-        auto in_y = y_original[y];
-
-        // when use_extrapolation is set and original index is out of the dim range
-        // then use extrapolation_value as the output value.
-        if (use_extrapolation && (in_y < 0 || in_y > static_cast<float>(input_height - 1))) {
-          for (int64_t x = 0; x < output_width; ++x) {
-            Ydata[y * output_width + x] = extrapolation_value;
-          }
-          continue;
-        }
-
-        auto y_int = static_cast<int64_t>(std::floor(in_y));
-        auto& coeff_y = exclude_outside ? y_coeff_holder : cubic_coeffs[in_y - y_int];
-        y_coeff_sum = 1;
-
-        if (exclude_outside) {
-          // When true, the weight of sampling locations outside the grid will be set to 0
-          // and the weight will be renormalized so that their sum is 1.0
-          y_coeff_sum = 0;
-          auto& orig_y_coeffs = cubic_coeffs[in_y - y_int];
-          for (int64_t i = 0, y_val = y_int - 1; y_val <= y_int + 2; y_val++, i++) {
-            y_coeff_holder[i] = (y_val < 0 || y_val >= static_cast<float>(input_height)) ? 0.0f : orig_y_coeffs[i];
-            y_coeff_sum += y_coeff_holder[i];
-          }
-        }
-
-        for (int64_t x = 0; x < output_width; ++x) {
-          auto in_x = x_original[x];
+  // The output rows of all the images are computed in parallel
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(batch_size * num_channels * output_height),
+      TensorOpCost{static_cast<double>(output_width * 16 * sizeof(T)), static_cast<double>(output_width * sizeof(T)),
+                   static_cast<double>(output_width * 48)},
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          const int64_t image = row / output_height;
+          const int64_t y = row % output_height;
+          const T* Xdata = XdataBase + image * (input_height * input_width);
+          T* Ydata = YdataBase + image * (output_height * output_width) + y * output_width;
 
           // when use_extrapolation is set and original index is out of the dim range
           // then use extrapolation_value as the output value.
-          if (use_extrapolation && (in_x < 0 || in_x > static_cast<float>(input_width - 1))) {
-            Ydata[y * output_width + x] = extrapolation_value;
+          const float in_y = py.original[y];
+          if (use_extrapolation && (in_y < 0 || in_y > static_cast<float>(input_height - 1))) {
+            std::fill_n(Ydata, output_width, static_cast<T>(extrapolation_value));
             continue;
           }
 
-          auto x_int = static_cast<int64_t>(std::floor(in_x));
-          auto s_x = static_cast<float>(in_x - x_int);
-          auto& coeff_x = exclude_outside ? x_coeff_holder : cubic_coeffs[s_x];
-          x_coeff_sum = 1;
-
-          if (exclude_outside) {
-            // When true, the weight of sampling locations outside the grid will be set to 0
-            // and the weight will be renormalized so that their sum is 1.0
-            x_coeff_sum = 0;
-            auto& orig_x_coeff = cubic_coeffs[s_x];
-            for (int64_t i = 0, x_val = x_int - 1; x_val <= x_int + 2; x_val++, i++) {
-              x_coeff_holder[i] = (x_val < 0 || x_val >= static_cast<float>(input_width)) ? 0.0f : orig_x_coeff[i];
-              x_coeff_sum += x_coeff_holder[i];
-            }
+          const int64_t* y_indexes = py.indexes.data() + y * CubicModeGridLength;
+          const float* coeff_y = py.weights.data() + y * CubicModeGridLength;
+          const float y_coeff_sum = py.weight_sums[y];
+          const T* Xrows[CubicModeGridLength];
+          for (size_t i = 0; i < CubicModeGridLength; ++i) {
+            Xrows[i] = Xdata + y_indexes[i] * input_width;
           }
 
-          // Compute cubic interpolation in x dimension using the x coefficients.
-          // From the result of cubic interpolation in x dim, compute cubic interpolation in y dimension
-          auto& interpolation_result_cache = coeff_to_1Dinterpolation_map[s_x];
-          float result = 0;
-          for (int64_t y_val = y_int - 1, i = 0; y_val <= y_int + 2; y_val++, i++) {
-            auto x_interpolation_result = CubicInterpolation1D(Xdata, x_int, y_val,
-                                                               input_height, input_width, coeff_x, x_coeff_sum,
-                                                               interpolation_result_cache);
-            result += x_interpolation_result * coeff_y[i] / y_coeff_sum;
-          }
-
-          Ydata[y * output_width + x] = static_cast<T>(result);
-        }
-      }
+          for (int64_t x = 0; x < output_width; ++x) {
+            const float in_x = px.original[x];
+            if (use_extrapolation && (in_x < 0 || in_x > static_cast<float>(input_width - 1))) {
+              Ydata[x] = static_cast<T>(extrapolation_value);
+              continue;
+            }
 
-      Xdata += input_height * input_width;
-      Ydata += output_height * output_width;
+            // Compute cubic interpolation in x dimension using the x coefficients.
+            // From the result of cubic interpolation in x dim, compute cubic interpolation in y dimension
+            const int64_t* x_indexes = px.indexes.data() + x * CubicModeGridLength;
+            const float* coeff_x = x_weights.data() + x * CubicModeGridLength;
+            float result = 0;
+            for (size_t i = 0; i < CubicModeGridLength; ++i) {
+              float x_interpolation_result = 0;
+              for (size_t j = 0; j < CubicModeGridLength; ++j) {
+                x_interpolation_result += coeff_x[j] * Xrows[i][x_indexes[j]];
+              }
+              result += x_interpolation_result * coeff_y[i] / y_coeff_sum;
+            }
 
-      // clear the cache when moving to the next channel
-      coeff_to_1Dinterpolation_map.clear();
-    }
-  }
+            Ydata[x] = static_cast<T>(result);
+          }
+        }
+      });
 }
-#if defined(_MSC_VER)
-#pragma warning(pop)
-#endif
 
 template <typename T>
 Status Upsample<T>::BaseCompute(OpKernelContext* context,
@@ -1102,7 +1033,8 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
     case UpsampleMode::NN:
       return UpsampleNearest<T>(X->Data<T>(), Y->MutableData<T>(), X->Shape(), Y->Shape(),
                                 scales, roi, is_resize_, use_extrapolation_, static_cast<T>(extrapolation_value_),
-                                use_nearest2x_optimization_, get_original_coordinate_, get_nearest_pixel_);
+                                use_nearest2x_optimization_, get_original_coordinate_, get_nearest_pixel_,
+                                context->GetOperatorThreadPool());
     case UpsampleMode::LINEAR: {
       // Supports 'bilinear' and 'trilinear' sampling only
 
@@ -1259,7 +1191,7 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
       ResizeBiCubic(batch_size, num_channels, input_height, input_width, output_height, output_width,
                     is_2D ? scales[0] : scales[2], is_2D ? scales[1] : scales[3], cubic_coeff_a_, use_extrapolation_,
                     extrapolation_value_, exclude_outside_, roi, X->Data<float>(),
-                    Y->MutableData<float>(), get_original_coordinate_);
+                    Y->MutableData<float>(), get_original_coordinate_, context->GetOperatorThreadPool());
       return Status::OK();
     }
     default:
@@ -25,6 +25,7 @@
 #include "core/framework/kernel_def_builder.h"
 #include "core/framework/kernel_registry.h"
 #include "core/framework/mldata_type_utils.h"
+#include "core/framework/node_stats_recorder.h"
 #include "core/framework/session_state_flatbuffers_utils.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/tensorprotoutils.h"
@@ -247,6 +248,8 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
 #if !defined(ORT_MINIMAL_BUILD)
   // Update the number of steps for the graph transformer manager using the "finalized" session options
   ORT_ENFORCE(graph_transformation_mgr_.SetSteps(session_options_.max_num_graph_transformation_steps).IsOK());
+  graph_transformation_mgr_.SetIncremental(session_options_.config_options.GetConfigOrDefault(
+                                               kOrtSessionOptionsEnableIncrementalGraphTransformation, "0") == "1");
 #endif
 
   bool set_denormal_as_zero =
@@ -924,9 +927,24 @@ common::Status InferenceSession::TransformGraph(onnxruntime::Graph& graph,
   // 4. insert cast nodes
   // 5. insert copy nodes
 
+  // record how long each phase takes in the profile, to tell where the session initialization time goes
+  TimePoint phase_tp;
+  auto start_phase = [this, &phase_tp]() {
+    if (session_profiler_.IsEnabled()) {
+      phase_tp = session_profiler_.Start();
+    }
+  };
+  auto end_phase = [this, &phase_tp](const char* phase) {
+    if (session_profiler_.IsEnabled()) {
+      session_profiler_.EndTimeAndRecordEvent(profiling::SESSION_EVENT, phase, phase_tp);
+    }
+  };
+
   // first apply execution provider independent level 1 graph optimizations.
+  start_phase();
   ORT_RETURN_IF_ERROR_SESSIONID_(
       graph_transformer_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *session_logger_));
+  end_phase("level1_graph_transformation");
 
 #ifdef USE_DML
   // TODO: this is a temporary workaround to apply the DML EP's custom graph transformer prior to partitioning. This
@@ -958,16 +976,20 @@ common::Status InferenceSession::TransformGraph(onnxruntime::Graph& graph,
                                                     : nullptr;
 
   // Do partitioning based on execution providers' capabilities.
+  start_phase();
   GraphPartitioner partitioner(kernel_registry_manager, providers);
   ORT_RETURN_IF_ERROR_SESSIONID_(partitioner.Partition(graph, session_state.GetMutableFuncMgr(), transform_layout_fn,
                                                        mode));
+  end_phase("graph_partitioning");
 
   // apply Level2 and higher transformers.
   // we do not run Level 1 again as those transformers assume partitioning will run later to do node assignment.
+  start_phase();
   for (int i = static_cast<int>(TransformerLevel::Level2); i <= static_cast<int>(TransformerLevel::MaxLevel); i++) {
     ORT_RETURN_IF_ERROR_SESSIONID_(
         graph_transformer_mgr.ApplyTransformers(graph, static_cast<TransformerLevel>(i), *session_logger_));
   }
+  end_phase("level2_graph_transformation");
 
   bool modified = false;
   // Insert cast node/s.
@@ -1465,6 +1487,11 @@ common::Status InferenceSession::Initialize() {
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
     }
 
+    TimePoint finalize_tp;
+    if (session_profiler_.IsEnabled()) {
+      finalize_tp = session_profiler_.Start();
+    }
+
     ORT_RETURN_IF_ERROR_SESSIONID_(
         session_state_->FinalizeSessionState(model_location_, kernel_registry_manager_,
                                              session_options_,
@@ -1473,6 +1500,10 @@ common::Status InferenceSession::Initialize() {
                                              !saving_model,
                                              saving_ort_format));
 
+    if (session_profiler_.IsEnabled()) {
+      session_profiler_.EndTimeAndRecordEvent(profiling::SESSION_EVENT, "session_state_finalization", finalize_tp);
+    }
+
 #if !defined(ORT_MINIMAL_BUILD)
     if (saving_model) {
       if (session_state_->GetFuncMgr().NumFuncs() > 0) {
@@ -2059,6 +2090,38 @@ common::Status InferenceSession::Run(const RunOptions& run_options, const NameML
   return Run(run_options, feed_names, feeds, output_names, p_fetches, nullptr);
 }
 
+common::Status InferenceSession::RunAsync(const RunOptions& run_options, std::vector<std::string> feed_names,
+                                          std::vector<OrtValue> feeds, std::vector<std::string> output_names,
+                                          std::vector<OrtValue> fetches, RunAsyncCallback callback) {
+  // the inter op thread pool is not used as the parallel executor blocks its caller until the nodes it schedules on
+  // that pool complete, which never happens once all the threads of the pool are running a model.
+  // the intra op thread pool runs the work of a parallel section on its caller if no other thread is available.
+  concurrency::ThreadPool* tp = GetIntraOpThreadPoolToUse();
+  ORT_RETURN_IF(tp == nullptr, "RunAsync requires a session with an intra op thread pool, set intra_op_num_threads ",
+                "in the session options to a value other than 1.");
+
+  struct AsyncRun {
+    RunOptions run_options;
+    std::vector<std::string> feed_names;
+    std::vector<OrtValue> feeds;
+    std::vector<std::string> output_names;
+    std::vector<OrtValue> fetches;
+    RunAsyncCallback callback;
+  };
+
+  // shared as the task must be copyable
+  auto async_run = std::make_shared<AsyncRun>(AsyncRun{run_options, std::move(feed_names), std::move(feeds),
+                                                       std::move(output_names), std::move(fetches),
+                                                       std::move(callback)});
+  concurrency::ThreadPool::Schedule(tp, [this, async_run]() {
+    const Status status = Run(async_run->run_options, async_run->feed_names, async_run->feeds,
+                              async_run->output_names, &async_run->fetches, nullptr);
+    async_run->callback(status, async_run->fetches);
+  });
+
+  return Status::OK();
+}
+
 std::pair<common::Status, const ModelMetadata*> InferenceSession::GetModelMetadata() const {
   {
     std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
@@ -2172,6 +2235,57 @@ const profiling::Profiler& InferenceSession::GetProfiling() const {
   return session_profiler_;
 }
 
+common::Status InferenceSession::GetNodeStats(std::string& node_stats_json) const {
+  if (!is_inited_) {
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "Session was not initialized");
+  }
+
+  if (session_state_->GetNodeStatsRecorder() == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Node statistics are not enabled. Set the '",
+                           kOrtSessionOptionsConfigEnableNodeStats, "' session option to '1' to enable them.");
+  }
+
+  node_stats_json = profiling::CollectNodeStats(*session_state_).ToJson();
+  return Status::OK();
+}
+
+common::Status InferenceSession::ResetNodeStats() {
+  if (!is_inited_) {
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "Session was not initialized");
+  }
+
+  profiling::ResetNodeStats(*session_state_);
+  return Status::OK();
+}
+
+common::Status InferenceSession::GetCalibrationStats(
+    std::map<std::string, CalibrationCollector::TensorStats>& stats) const {
+  if (!is_inited_) {
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "Session was not initialized");
+  }
+
+  const CalibrationCollector* collector = session_state_->GetCalibrationCollector();
+  if (collector == nullptr) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Calibration statistics are not collected. Set the '",
+                           kOrtSessionOptionsConfigCalibrationTensors, "' session option to collect them.");
+  }
+
+  stats = collector->GetStats();
+  return Status::OK();
+}
+
+common::Status InferenceSession::ResetCalibrationStats() {
+  if (!is_inited_) {
+    return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "Session was not initialized");
+  }
+
+  CalibrationCollector* collector = session_state_->GetCalibrationCollector();
+  if (collector != nullptr) {
+    collector->Reset();
+  }
+  return Status::OK();
+}
+
 AllocatorPtr InferenceSession::GetAllocator(const OrtMemoryInfo& mem_info) const {
   return session_state_->GetAllocator(mem_info);
 }
@@ -2394,7 +2508,7 @@ common::Status InferenceSession::AddPredefinedTransformers(
 
         if (use_full_build_optimizations) {
           return optimizer_utils::GenerateTransformers(level, session_options_, cpu_ep,
-                                                       optimizers_to_disable_);
+                                                       optimizers_to_disable_, GetIntraOpThreadPoolToUse());
         } else {
           const auto sat_context =
               minimal_build_optimization_handling ==
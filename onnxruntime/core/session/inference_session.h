@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <functional>
+#include <map>
 #include <string>
 #include <unordered_map>
 
@@ -337,6 +339,20 @@ class InferenceSession {
   virtual common::Status Run(const RunOptions& run_options, IOBinding& io_binding) ORT_MUST_USE_RESULT;
   common::Status Run(IOBinding& io_binding) ORT_MUST_USE_RESULT;
 
+  using RunAsyncCallback = std::function<void(const common::Status& status, std::vector<OrtValue>& fetches)>;
+
+  /**
+   * Schedule a run of the model on the intra op thread pool of the session and return without waiting for it.
+   * The run is the same as Run(run_options, feed_names, feeds, output_names, &fetches). 'callback' is called with
+   * its status and fetches on the thread that executed it, which is the calling thread if the pool could not
+   * enqueue the run. The session must not be released before 'callback' has been called.
+   * @param fetches preallocated fetches, or an empty vector.
+   * @return an error, without scheduling the run, if the session has no intra op thread pool.
+   */
+  common::Status RunAsync(const RunOptions& run_options, std::vector<std::string> feed_names,
+                          std::vector<OrtValue> feeds, std::vector<std::string> output_names,
+                          std::vector<OrtValue> fetches, RunAsyncCallback callback) ORT_MUST_USE_RESULT;
+
 #ifdef ENABLE_TRAINING
   /**
    * Partially run a pre-loaded and pre-intialized model.
@@ -443,6 +459,29 @@ class InferenceSession {
     */
   const profiling::Profiler& GetProfiling() const;
 
+  /**
+    * Get the cumulative per-node and per-op type latency statistics collected since the session was initialized
+    * or ResetNodeStats was last called. Requires kOrtSessionOptionsConfigEnableNodeStats to be set.
+    @return the statistics serialized as JSON.
+    */
+  common::Status GetNodeStats(std::string& node_stats_json) const;
+
+  /**
+    * Clear the per-node latency statistics.
+    */
+  common::Status ResetNodeStats();
+
+  /**
+    * Get the quantization calibration statistics of the tensors collected since the session was initialized or
+    * ResetCalibrationStats was last called. Requires kOrtSessionOptionsConfigCalibrationTensors to be set.
+    */
+  common::Status GetCalibrationStats(std::map<std::string, CalibrationCollector::TensorStats>& stats) const;
+
+  /**
+    * Clear the quantization calibration statistics.
+    */
+  common::Status ResetCalibrationStats();
+
   /**
    * Search registered execution providers for an allocator that has characteristics
    * specified within mem_info
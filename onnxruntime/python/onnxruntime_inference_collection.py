@@ -4,6 +4,8 @@
 # --------------------------------------------------------------------------
 import collections
 import collections.abc
+import concurrent.futures
+import json
 import os
 import warnings
 
@@ -183,7 +185,10 @@ class Session:
         :param input_feed: dictionary ``{ input_name: input_value }``
         :param run_options: See :class:`onnxruntime.RunOptions`.
         :return: list of results, every result is either a numpy array,
-            a sparse tensor, a list or a dictionary.
+            a sparse tensor, a list or a dictionary. If the session option
+            ``session.python_zero_copy_outputs`` is ``"1"``, the numpy arrays of
+            the CPU tensor outputs wrap the buffers of onnxruntime instead of
+            copies of them.
 
         ::
 
@@ -209,6 +214,51 @@ class Session:
             else:
                 raise
 
+    def run_async(self, output_names, input_feed, callback=None, run_options=None):
+        """
+        Compute the predictions asynchronously. The run is scheduled on the intra op thread pool
+        of the session, which requires ``intra_op_num_threads`` to be other than 1, and this method
+        returns without waiting for it.
+
+        :param output_names: name of the outputs
+        :param input_feed: dictionary ``{ input_name: input_value }``
+        :param callback: optional function called as ``callback(results, error_message)`` on the
+            thread that executed the run, with ``error_message`` None on success and ``results``
+            None on failure.
+        :param run_options: See :class:`onnxruntime.RunOptions`.
+        :return: a :class:`concurrent.futures.Future` of the list of results, which raises
+            :class:`onnxruntime.capi.onnxruntime_pybind11_state.Fail` if the run fails.
+            Use :func:`asyncio.wrap_future` to await it in a coroutine.
+
+        ::
+
+            results = await asyncio.wrap_future(sess.run_async([output_name], {input_name: x}))
+        """
+        num_required_inputs = len(self._inputs_meta)
+        num_inputs = len(input_feed)
+        # the graph may have optional inputs used to override initializers. allow for that.
+        if num_inputs < num_required_inputs:
+            raise ValueError("Model requires {} inputs. Input Feed contains {}".format(num_required_inputs, num_inputs))
+        if not output_names:
+            output_names = [output.name for output in self._outputs_meta]
+
+        future = concurrent.futures.Future()
+        future.set_running_or_notify_cancel()
+
+        # the default value of 'sess' keeps the session alive until the run completes
+        def on_completion(results, error_message, sess=self._sess):
+            try:
+                if callback is not None:
+                    callback(results, error_message)
+            finally:
+                if error_message is None:
+                    future.set_result(results)
+                else:
+                    future.set_exception(C.Fail(error_message))
+
+        self._sess.run_async(output_names, input_feed, on_completion, run_options)
+        return future
+
     def run_with_ort_values(self, output_names, input_dict_ort_values, run_options=None):
         """
         Compute the predictions.
@@ -273,6 +323,38 @@ class Session:
         """
         return self._sess.get_profiling_start_time_ns
 
+    def get_node_stats(self):
+        """
+        Return the cumulative per-node latency statistics collected since the session was created
+        or :meth:`reset_node_stats` was last called.
+
+        Collection must be enabled with the session config entry ``session.enable_node_stats`` set to ``1``.
+        The result is a dictionary with a ``nodes`` list containing an entry per node and an ``op_types`` list
+        with the entries aggregated per operator type. Latencies are in microseconds.
+        """
+        return json.loads(self._sess.get_node_stats())
+
+    def reset_node_stats(self):
+        "Clear the per-node latency statistics."
+        self._sess.reset_node_stats()
+
+    def get_calibration_stats(self):
+        """
+        Return the quantization calibration statistics collected since the session was created
+        or :meth:`reset_calibration_stats` was last called.
+
+        Collection must be enabled with the session config entry ``session.calibration_tensors``, set to ``*`` or
+        to a comma separated list of tensor names, and the histogram size is set with
+        ``session.calibration_histogram_bins``. The result is a dictionary mapping the name of each tensor
+        which had values to a tuple ``(min, max, histogram, threshold, count)``, where ``histogram`` is a numpy
+        array of counts over ``[-threshold, threshold]``, empty if no histogram is collected.
+        """
+        return self._sess.get_calibration_stats()
+
+    def reset_calibration_stats(self):
+        "Clear the quantization calibration statistics."
+        self._sess.reset_calibration_stats()
+
     def io_binding(self):
         "Return an onnxruntime.IOBinding object`."
         return IOBinding(self)
@@ -544,7 +626,11 @@ class IOBinding:
         return [OrtValue(ortvalue) for ortvalue in outputs]
 
     def copy_outputs_to_cpu(self):
-        """Copy output contents to CPU (if on another device). No-op if already on the CPU."""
+        """Copy output contents to CPU (if on another device). No-op if already on the CPU.
+
+        If the session option ``session.python_zero_copy_outputs`` is ``"1"``, the numpy arrays of the outputs
+        on the CPU share the memory of the bound outputs, which the next run with this binding may overwrite.
+        """
         return self._iobinding.copy_outputs_to_cpu()
 
     def clear_binding_inputs(self):
@@ -170,9 +170,13 @@ void addIoBindingMethods(pybind11::module& m) {
         rfetch.reserve(outputs.size());
         size_t pos = 0;
         const auto& dtm = io_binding->GetInferenceSession()->GetDataTransferManager();
+        const bool zero_copy_outputs = UseZeroCopyOutputs(io_binding->GetInferenceSession()->GetSessionOptions());
         for (const auto& ort_value : outputs) {
           if (ort_value.IsTensor()) {
-            rfetch.push_back(AddTensorAsPyObj(ort_value, &dtm, nullptr));
+            rfetch.push_back(zero_copy_outputs && !IsFetchDataShared(*io_binding->GetInferenceSession(),
+                                                                     io_binding->Get()->GetInputs(), ort_value)
+                                 ? AddTensorAsPyObjNoCopy(ort_value, &dtm, nullptr)
+                                 : AddTensorAsPyObj(ort_value, &dtm, nullptr));
           } else if (ort_value.IsSparseTensor()) {
             rfetch.push_back(GetPyObjectFromSparseTensor(pos, ort_value, &dtm));
           } else {
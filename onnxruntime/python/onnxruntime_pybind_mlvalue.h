@@ -48,6 +48,20 @@ void CopyDataToTensor(const pybind11::array& py_array, int npy_type, Tensor& ten
 pybind11::object AddTensorAsPyObj(const OrtValue& val, const DataTransferManager* data_transfer_manager,
                                   const std::unordered_map<OrtDevice::DeviceType, MemCpyFunc>* mem_cpy_to_host_functions);
 
+// Same as AddTensorAsPyObj for a tensor on the CPU, except that the numpy array wraps the data of the tensor instead of
+// a copy of it. A copy of 'val' is owned by a capsule set as the base object of the array, so the data stays valid as
+// long as the array or any view of it. String tensors and tensors on other devices are copied.
+pybind11::object AddTensorAsPyObjNoCopy(const OrtValue& val, const DataTransferManager* data_transfer_manager,
+                                        const std::unordered_map<OrtDevice::DeviceType, MemCpyFunc>* mem_cpy_to_host_functions);
+
+// Whether kOrtSessionOptionsConfigPythonZeroCopyOutputs is set in 'session_options'.
+bool UseZeroCopyOutputs(const SessionOptions& session_options);
+
+// Whether the data of the tensor 'fetch' is also the data of an initializer of 'session' or of one of 'feeds', e.g. for
+// an initializer or a graph input which is also a graph output. Such a fetch isn't owned by the caller alone, so it is
+// copied even with zero copy outputs.
+bool IsFetchDataShared(const InferenceSession& session, const std::vector<OrtValue>& feeds, const OrtValue& fetch);
+
 pybind11::object GetPyObjectFromSparseTensor(size_t pos, const OrtValue& ort_value, const DataTransferManager* data_transfer_manager);
 
 pybind11::object AddNonTensorAsPyObj(const OrtValue& val,
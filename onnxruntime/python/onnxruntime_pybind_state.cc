@@ -48,6 +48,7 @@ namespace onnxruntime {
 #pragma warning(disable : 4267 4996 4503 4003)
 #endif  // _MSC_VER
 
+#include <algorithm>
 #include <iterator>
 
 #if defined(_MSC_VER)
@@ -306,6 +307,102 @@ py::object AddTensorAsPyObj(const OrtValue& val, const DataTransferManager* data
   return obj;
 }
 
+py::object AddTensorAsPyObjNoCopy(const OrtValue& val, const DataTransferManager* data_transfer_manager,
+                                  const std::unordered_map<OrtDevice::DeviceType, MemCpyFunc>* mem_cpy_to_host_functions) {
+  const Tensor& rtensor = val.Get<Tensor>();
+  if (rtensor.Location().device.Type() != OrtDevice::CPU || rtensor.IsDataTypeString()) {
+    return AddTensorAsPyObj(val, data_transfer_manager, mem_cpy_to_host_functions);
+  }
+
+  std::vector<npy_intp> npy_dims;
+  const TensorShape& shape = rtensor.Shape();
+  for (size_t n = 0; n < shape.NumDimensions(); ++n) {
+    npy_dims.push_back(shape[n]);
+  }
+
+  const int numpy_type = OnnxRuntimeTensorToNumpyType(rtensor.DataType());
+  py::object obj = py::reinterpret_steal<py::object>(PyArray_SimpleNewFromData(
+      static_cast<int>(shape.NumDimensions()), npy_dims.data(), numpy_type, const_cast<void*>(rtensor.DataRaw())));
+  if (!obj) {
+    throw py::error_already_set();
+  }
+
+  // the OrtValue shares the ownership of the tensor, so the buffer is released with the last array using it
+  py::capsule owner(new OrtValue(val), [](void* ort_value) { delete static_cast<OrtValue*>(ort_value); });
+  if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(obj.ptr()), owner.release().ptr()) != 0) {
+    throw py::error_already_set();
+  }
+
+  return obj;
+}
+
+bool UseZeroCopyOutputs(const SessionOptions& session_options) {
+  return session_options.config_options.GetConfigOrDefault(kOrtSessionOptionsConfigPythonZeroCopyOutputs, "0") == "1";
+}
+
+bool IsFetchDataShared(const InferenceSession& session, const std::vector<OrtValue>& feeds, const OrtValue& fetch) {
+  const void* data = fetch.Get<Tensor>().DataRaw();
+  if (data == nullptr) {
+    return false;
+  }
+
+  auto has_data = [data](const OrtValue& value) {
+    return value.IsTensor() && value.Get<Tensor>().DataRaw() == data;
+  };
+
+  const auto& initializers = session.GetSessionState().GetInitializedTensors();
+  return std::any_of(feeds.cbegin(), feeds.cend(), has_data) ||
+         std::any_of(initializers.cbegin(), initializers.cend(),
+                     [&has_data](const std::pair<const int, OrtValue>& initializer) {
+                       return has_data(initializer.second);
+                     });
+}
+
+// Converts the python feeds of a run to OrtValues. 'None's sent in by the user to feed Optional inputs in the graph
+// are skipped, ORT handles such implicit 'None's internally.
+static NameMLValMap CreateFeeds(PyInferenceSession* sess, const std::map<std::string, py::object>& pyfeeds) {
+  NameMLValMap feeds;
+  for (const auto& feed : pyfeeds) {
+    if (!feed.second.is(py::none())) {
+      OrtValue ml_value;
+      auto px = sess->GetSessionHandle()->GetModelInputs();
+      if (!px.first.IsOK() || !px.second) {
+        throw std::runtime_error("Either failed to get model inputs from the session object or the input def list was null");
+      }
+      CreateGenericMLValue(px.second, GetAllocator(), feed.first, feed.second, &ml_value);
+      ThrowIfPyErrOccured();
+      feeds.insert(std::make_pair(feed.first, ml_value));
+    }
+  }
+  return feeds;
+}
+
+// Converts the fetches of a run to python objects, with None for the empty ones.
+static std::vector<py::object> FetchesToPyObjects(PyInferenceSession* sess, const std::vector<OrtValue>& feeds,
+                                                  const std::vector<OrtValue>& fetches) {
+  const bool zero_copy_outputs = UseZeroCopyOutputs(sess->GetSessionHandle()->GetSessionOptions());
+  std::vector<py::object> rfetch;
+  rfetch.reserve(fetches.size());
+  size_t pos = 0;
+  for (const auto& fet : fetches) {
+    if (fet.IsAllocated()) {
+      if (fet.IsTensor()) {
+        rfetch.push_back(zero_copy_outputs && !IsFetchDataShared(*sess->GetSessionHandle(), feeds, fet)
+                             ? AddTensorAsPyObjNoCopy(fet, nullptr, nullptr)
+                             : AddTensorAsPyObj(fet, nullptr, nullptr));
+      } else if (fet.IsSparseTensor()) {
+        rfetch.push_back(GetPyObjectFromSparseTensor(pos, fet, nullptr));
+      } else {
+        rfetch.push_back(AddNonTensorAsPyObj(fet, nullptr, nullptr));
+      }
+    } else {
+      rfetch.push_back(py::none());
+    }
+    ++pos;
+  }
+  return rfetch;
+}
+
 static std::unique_ptr<onnxruntime::IExecutionProvider> LoadExecutionProvider(
     const std::string& ep_shared_lib_path,
     const ProviderOptions& provider_options = {},
@@ -1455,23 +1552,7 @@ including arg name, arg type (contains both type and shape).)pbdoc")
            [](PyInferenceSession* sess, std::vector<std::string> output_names,
               std::map<std::string, py::object> pyfeeds, RunOptions* run_options = nullptr)
                -> std::vector<py::object> {
-             NameMLValMap feeds;
-             for (auto feed : pyfeeds) {
-               // No need to process 'None's sent in by the user
-               // to feed Optional inputs in the graph.
-               // We just won't include anything in the feed and ORT
-               // will handle such implicit 'None's internally.
-               if (!feed.second.is(py::none())) {
-                 OrtValue ml_value;
-                 auto px = sess->GetSessionHandle()->GetModelInputs();
-                 if (!px.first.IsOK() || !px.second) {
-                   throw std::runtime_error("Either failed to get model inputs from the session object or the input def list was null");
-                 }
-                 CreateGenericMLValue(px.second, GetAllocator(), feed.first, feed.second, &ml_value);
-                 ThrowIfPyErrOccured();
-                 feeds.insert(std::make_pair(feed.first, ml_value));
-               }
-             }
+             NameMLValMap feeds = CreateFeeds(sess, pyfeeds);
 
              std::vector<OrtValue> fetches;
              common::Status status;
@@ -1486,24 +1567,73 @@ including arg name, arg type (contains both type and shape).)pbdoc")
                }
              }
 
-             std::vector<py::object> rfetch;
-             rfetch.reserve(fetches.size());
-             size_t pos = 0;
-             for (auto fet : fetches) {
-               if (fet.IsAllocated()) {
-                 if (fet.IsTensor()) {
-                   rfetch.push_back(AddTensorAsPyObj(fet, nullptr, nullptr));
-                 } else if (fet.IsSparseTensor()) {
-                   rfetch.push_back(GetPyObjectFromSparseTensor(pos, fet, nullptr));
+             std::vector<OrtValue> feed_values;
+             feed_values.reserve(feeds.size());
+             for (const auto& feed : feeds) {
+               feed_values.push_back(feed.second);
+             }
+             return FetchesToPyObjects(sess, feed_values, fetches);
+           })
+      /// Schedules a run on the intra op thread pool of the session and returns without waiting for it.
+      /// callback(results, error_message) is called with the GIL held on the thread that executed the run,
+      /// with error_message set to None on success and results set to None on failure.
+      .def("run_async",
+           [](PyInferenceSession* sess, std::vector<std::string> output_names,
+              std::map<std::string, py::object> pyfeeds, py::object callback, RunOptions* run_options = nullptr) {
+             NameMLValMap feeds_map = CreateFeeds(sess, pyfeeds);
+             std::vector<std::string> feed_names;
+             std::vector<OrtValue> feeds;
+             feed_names.reserve(feeds_map.size());
+             feeds.reserve(feeds_map.size());
+             for (auto& feed : feeds_map) {
+               feed_names.push_back(feed.first);
+               feeds.push_back(feed.second);
+             }
+
+             // the callback and the inputs, whose data may be used by the feeds, are kept alive until the run
+             // completes and released with the GIL held. the feeds are kept to find the fetches sharing their data.
+             struct PyAsyncRun {
+               py::object callback;
+               std::map<std::string, py::object> pyfeeds;
+               std::vector<OrtValue> feeds;
+             };
+             auto* py_async_run = new PyAsyncRun{std::move(callback), std::move(pyfeeds), feeds};
+
+             auto on_completion = [sess, py_async_run](const Status& status, std::vector<OrtValue>& fetches) {
+               py::gil_scoped_acquire acquire;
+               std::unique_ptr<PyAsyncRun> owner(py_async_run);
+               try {
+                 if (status.IsOK()) {
+                   owner->callback(FetchesToPyObjects(sess, owner->feeds, fetches), py::none());
                  } else {
-                   rfetch.push_back(AddNonTensorAsPyObj(fet, nullptr, nullptr));
+                   owner->callback(py::none(), status.ErrorMessage());
+                 }
+               } catch (py::error_already_set& ex) {
+                 // there's no python caller to raise it to
+                 ex.discard_as_unraisable(__func__);
+               } catch (const std::exception& ex) {
+                 try {
+                   owner->callback(py::none(), ex.what());
+                 } catch (py::error_already_set& callback_ex) {
+                   callback_ex.discard_as_unraisable(__func__);
                  }
-               } else {  // Send back None because the corresponding OrtValue was empty
-                 rfetch.push_back(py::none());
                }
-               ++pos;
+             };
+
+             Status status;
+             {
+               // the callback acquires the GIL, it's called before RunAsync returns if the run can't be enqueued.
+               py::gil_scoped_release release;
+               status = sess->GetSessionHandle()->RunAsync(run_options != nullptr ? *run_options : RunOptions(),
+                                                           std::move(feed_names), std::move(feeds), output_names, {},
+                                                           std::move(on_completion));
+             }
+
+             if (!status.IsOK()) {
+               // the run wasn't scheduled so the callback won't be called
+               delete py_async_run;
+               OrtPybindThrowIfError(status);
              }
-             return rfetch;
            })
       /// This method accepts a dictionary of feeds (name -> OrtValue) and the list of output_names
       /// and returns a list of python objects representing OrtValues. Each name may represent either
@@ -1536,6 +1666,34 @@ including arg name, arg type (contains both type and shape).)pbdoc")
       .def_property_readonly("get_profiling_start_time_ns", [](const PyInferenceSession* sess) -> uint64_t {
         return sess->GetSessionHandle()->GetProfiling().GetStartTimeNs();
       })
+      .def("get_node_stats", [](const PyInferenceSession* sess) -> std::string {
+        std::string node_stats;
+        OrtPybindThrowIfError(sess->GetSessionHandle()->GetNodeStats(node_stats));
+        return node_stats;
+      })
+      .def("reset_node_stats", [](PyInferenceSession* sess) {
+        OrtPybindThrowIfError(sess->GetSessionHandle()->ResetNodeStats());
+      })
+      .def("get_calibration_stats", [](const PyInferenceSession* sess) -> py::dict {
+        std::map<std::string, CalibrationCollector::TensorStats> stats;
+        OrtPybindThrowIfError(sess->GetSessionHandle()->GetCalibrationStats(stats));
+        py::dict result;
+        for (const auto& it : stats) {
+          const auto& tensor_stats = it.second;
+          npy_intp num_bins = static_cast<npy_intp>(tensor_stats.histogram.size());
+          py::object histogram = py::reinterpret_steal<py::object>(PyArray_SimpleNew(1, &num_bins, NPY_UINT64));
+          if (num_bins > 0) {
+            memcpy(PyArray_DATA(reinterpret_cast<PyArrayObject*>(histogram.ptr())), tensor_stats.histogram.data(),
+                   tensor_stats.histogram.size() * sizeof(uint64_t));
+          }
+          result[py::str(it.first)] = py::make_tuple(tensor_stats.min, tensor_stats.max, histogram,
+                                                     tensor_stats.threshold, tensor_stats.count);
+        }
+        return result;
+      })
+      .def("reset_calibration_stats", [](PyInferenceSession* sess) {
+        OrtPybindThrowIfError(sess->GetSessionHandle()->ResetCalibrationStats());
+      })
       .def(
           "get_providers", [](const PyInferenceSession* sess) -> const std::vector<std::string>& {
             return sess->GetSessionHandle()->GetRegisteredProviderTypes();
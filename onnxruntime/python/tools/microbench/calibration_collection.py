@@ -0,0 +1,92 @@
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+# --------------------------------------------------------------------------
+
+"""
+Compares the time taken by the calibrators of the quantization tool to collect the statistics of a model when the
+tensors are added to the model outputs and fetched (the default) and when they are collected inside onnxruntime
+with the session option session.calibration_tensors (extra option use_native_collection).
+"""
+
+import argparse
+import tempfile
+import time
+from pathlib import Path
+
+import numpy as np
+import onnx
+from onnx import TensorProto, helper, numpy_helper
+
+from onnxruntime.quantization.calibrate import CalibrationDataReader, CalibrationMethod, create_calibrator
+
+
+def create_model(num_layers, size):
+    # a chain of MatMul -> Relu layers of size x size weights
+    nodes = []
+    initializers = []
+    previous = "X"
+    for i in range(num_layers):
+        weight = np.random.normal(0, 1 / np.sqrt(size), [size, size]).astype(np.float32)
+        initializers.append(numpy_helper.from_array(weight, f"W{i}"))
+        nodes.append(helper.make_node("MatMul", [previous, f"W{i}"], [f"M{i}"], name=f"MatMul{i}"))
+        nodes.append(helper.make_node("Relu", [f"M{i}"], [f"R{i}"], name=f"Relu{i}"))
+        previous = f"R{i}"
+    graph = helper.make_graph(
+        nodes,
+        "calibration_collection",
+        [helper.make_tensor_value_info("X", TensorProto.FLOAT, ["batch", size])],
+        [helper.make_tensor_value_info(previous, TensorProto.FLOAT, ["batch", size])],
+        initializers,
+    )
+    return helper.make_model(graph, opset_imports=[helper.make_operatorsetid("", 13)])
+
+
+class RandomDataReader(CalibrationDataReader):
+    def __init__(self, num_samples, batch, size):
+        self.samples = iter([{"X": np.random.rand(batch, size).astype(np.float32)} for _ in range(num_samples)])
+
+    def get_next(self):
+        return next(self.samples, None)
+
+
+def run_case(args, model_path, augmented_model_path, method, use_native_collection):
+    calibrator = create_calibrator(
+        model_path,
+        augmented_model_path=augmented_model_path,
+        calibrate_method=method,
+        extra_options={"use_native_collection": use_native_collection, "num_bins": args.num_bins},
+    )
+    data_reader = RandomDataReader(args.samples, args.batch, args.size)
+
+    start_time = time.perf_counter()
+    calibrator.collect_data(data_reader)
+    collect_ms = (time.perf_counter() - start_time) * 1000
+    calibrator.compute_range()
+
+    mode = "native" if use_native_collection else "augmented"
+    print(f"{method.name:10} {mode:9} (layers batch size samples) = "
+          f"({args.layers} {args.batch} {args.size} {args.samples}), collect_data {collect_ms:10.2f} ms")
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--layers", type=int, default=16)
+    parser.add_argument("--batch", type=int, default=32)
+    parser.add_argument("--size", type=int, default=1024)
+    parser.add_argument("--samples", type=int, default=32)
+    parser.add_argument("--num_bins", type=int, default=2048)
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        model_path = Path(temp_dir) / "model.onnx"
+        onnx.save(create_model(args.layers, args.size), model_path.as_posix())
+        augmented_model_path = (Path(temp_dir) / "augmented_model.onnx").as_posix()
+
+        for method in [CalibrationMethod.MinMax, CalibrationMethod.Percentile]:
+            for use_native_collection in [False, True]:
+                run_case(args, model_path, augmented_model_path, method, use_native_collection)
+
+
+if __name__ == "__main__":
+    main()
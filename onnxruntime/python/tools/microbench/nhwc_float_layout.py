@@ -0,0 +1,121 @@
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+# --------------------------------------------------------------------------
+
+"""
+Compares the latency of float CNN models on the CPU execution provider with the NCHWc layout (the default) and with
+the NHWC layout enabled by the session option optimization.enable_nhwc_float_layout.
+The models are given with --models, e.g. MobileNet, ResNet and EfficientNet from the ONNX model zoo, otherwise a
+synthetic model of MobileNet blocks is used. The inputs are random, with the symbolic dimensions set to 1.
+"""
+
+import argparse
+import tempfile
+import time
+from pathlib import Path
+
+import numpy as np
+import onnx
+from onnx import TensorProto, helper, numpy_helper
+
+import onnxruntime as ort
+
+
+def create_mobilenet_blocks(num_blocks, channels, size):
+    # pointwise expansion -> depthwise -> pointwise projection blocks with a residual Add, as in MobileNetV2
+    nodes = []
+    initializers = []
+
+    def add_conv(name, input_name, output_channels, input_channels, kernel, group, activation):
+        weight = np.random.normal(0, 0.1, [output_channels, input_channels // group, kernel, kernel])
+        initializers.append(numpy_helper.from_array(weight.astype(np.float32), f"{name}_W"))
+        initializers.append(numpy_helper.from_array(np.zeros(output_channels, np.float32), f"{name}_B"))
+        nodes.append(
+            helper.make_node(
+                "Conv",
+                [input_name, f"{name}_W", f"{name}_B"],
+                [f"{name}_conv"],
+                name=name,
+                group=group,
+                pads=[kernel // 2] * 4,
+            )
+        )
+        if not activation:
+            return f"{name}_conv"
+        nodes.append(helper.make_node("Clip", [f"{name}_conv", "min", "max"], [f"{name}_out"]))
+        return f"{name}_out"
+
+    initializers.append(numpy_helper.from_array(np.array(0.0, np.float32), "min"))
+    initializers.append(numpy_helper.from_array(np.array(6.0, np.float32), "max"))
+    previous = add_conv("stem", "X", channels, 3, 3, 1, True)
+    for i in range(num_blocks):
+        expanded = add_conv(f"expand{i}", previous, channels * 6, channels, 1, 1, True)
+        depthwise = add_conv(f"depthwise{i}", expanded, channels * 6, channels * 6, 3, channels * 6, True)
+        projected = add_conv(f"project{i}", depthwise, channels, channels * 6, 1, 1, False)
+        nodes.append(helper.make_node("Add", [previous, projected], [f"block{i}"]))
+        previous = f"block{i}"
+    nodes.append(helper.make_node("GlobalAveragePool", [previous], ["Y"]))
+
+    graph = helper.make_graph(
+        nodes,
+        "mobilenet_blocks",
+        [helper.make_tensor_value_info("X", TensorProto.FLOAT, [1, 3, size, size])],
+        [helper.make_tensor_value_info("Y", TensorProto.FLOAT, [1, channels, 1, 1])],
+        initializers,
+    )
+    return helper.make_model(graph, opset_imports=[helper.make_operatorsetid("", 13)])
+
+
+def create_feeds(session):
+    feeds = {}
+    for model_input in session.get_inputs():
+        shape = [dim if isinstance(dim, int) else 1 for dim in model_input.shape]
+        feeds[model_input.name] = np.random.rand(*shape).astype(np.float32)
+    return feeds
+
+
+def run_case(args, model_path, enable_nhwc):
+    sess_options = ort.SessionOptions()
+    sess_options.intra_op_num_threads = args.threads
+    sess_options.add_session_config_entry("optimization.enable_nhwc_float_layout", "1" if enable_nhwc else "0")
+    session = ort.InferenceSession(model_path, sess_options, providers=["CPUExecutionProvider"])
+    feeds = create_feeds(session)
+
+    for _ in range(args.warmup):
+        session.run(None, feeds)
+
+    start_time = time.perf_counter()
+    for _ in range(args.iterations):
+        session.run(None, feeds)
+    latency_ms = (time.perf_counter() - start_time) * 1000 / args.iterations
+
+    layout = "NHWC" if enable_nhwc else "NCHWc"
+    print(f"{Path(model_path).name:40} {layout:5} threads {args.threads:3}, latency {latency_ms:10.3f} ms")
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--models", nargs="*", default=[], help="float CNN models to compare")
+    parser.add_argument("--threads", type=int, default=1)
+    parser.add_argument("--warmup", type=int, default=5)
+    parser.add_argument("--iterations", type=int, default=50)
+    parser.add_argument("--blocks", type=int, default=8)
+    parser.add_argument("--channels", type=int, default=32)
+    parser.add_argument("--size", type=int, default=112)
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        model_paths = args.models
+        if not model_paths:
+            model_path = (Path(temp_dir) / "mobilenet_blocks.onnx").as_posix()
+            onnx.save(create_mobilenet_blocks(args.blocks, args.channels, args.size), model_path)
+            model_paths = [model_path]
+
+        for model_path in model_paths:
+            for enable_nhwc in [False, True]:
+                run_case(args, model_path, enable_nhwc)
+
+
+if __name__ == "__main__":
+    main()
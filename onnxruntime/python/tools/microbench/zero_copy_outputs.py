@@ -0,0 +1,117 @@
+# -------------------------------------------------------------------------
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+# --------------------------------------------------------------------------
+
+"""
+Compares the latency and the peak memory of InferenceSession.run and of IOBinding.copy_outputs_to_cpu with and
+without the session option session.python_zero_copy_outputs, on a model with large float outputs.
+Each configuration runs in its own process so that the peak resident set sizes can be compared.
+"""
+
+import argparse
+import resource
+import subprocess
+import sys
+import time
+
+import numpy as np
+from onnx import TensorProto, helper
+
+import onnxruntime as ort
+
+
+def create_model(num_outputs):
+    # Y_i = X + i, every output is as large as the input
+    nodes = []
+    initializers = []
+    outputs = []
+    for i in range(num_outputs):
+        initializers.append(helper.make_tensor(f"C{i}", TensorProto.FLOAT, [1], [float(i)]))
+        nodes.append(helper.make_node("Add", ["X", f"C{i}"], [f"Y{i}"]))
+        outputs.append(helper.make_tensor_value_info(f"Y{i}", TensorProto.FLOAT, ["batch", "size"]))
+    graph = helper.make_graph(
+        nodes,
+        "zero_copy_outputs",
+        [helper.make_tensor_value_info("X", TensorProto.FLOAT, ["batch", "size"])],
+        outputs,
+        initializers,
+    )
+    model = helper.make_model(graph, opset_imports=[helper.make_operatorsetid("", 13)])
+    return model.SerializeToString()
+
+
+def peak_rss_mb():
+    # ru_maxrss is in kilobytes on Linux and in bytes on macOS
+    maxrss = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    return maxrss / (1024 * 1024) if sys.platform == "darwin" else maxrss / 1024
+
+
+def run_case(args):
+    so = ort.SessionOptions()
+    so.add_session_config_entry("session.python_zero_copy_outputs", "1" if args.zero_copy else "0")
+    sess = ort.InferenceSession(create_model(args.outputs), sess_options=so, providers=["CPUExecutionProvider"])
+    x = np.random.rand(args.batch, args.size).astype(np.float32)
+
+    if args.iobinding:
+        io_binding = sess.io_binding()
+        io_binding.bind_cpu_input("X", x)
+        for output in sess.get_outputs():
+            io_binding.bind_output(output.name)
+
+        def run():
+            sess.run_with_iobinding(io_binding)
+            return io_binding.copy_outputs_to_cpu()
+
+    else:
+
+        def run():
+            return sess.run(None, {"X": x})
+
+    for _ in range(args.warmup):
+        run()
+
+    start_time = time.perf_counter()
+    for _ in range(args.iterations):
+        results = run()
+    elapsed_ms = (time.perf_counter() - start_time) * 1000 / args.iterations
+    assert np.allclose(results[-1], x + (args.outputs - 1))
+
+    mode = "zero copy" if args.zero_copy else "copy"
+    api = "run_with_iobinding" if args.iobinding else "run"
+    print(f"{api:18} {mode:9} (batch size outputs) = ({args.batch} {args.size} {args.outputs}), "
+          f"{elapsed_ms:8.4f} ms, peak RSS {peak_rss_mb():8.1f} MB")
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--batch", type=int, default=64)
+    parser.add_argument("--size", type=int, default=65536)
+    parser.add_argument("--outputs", type=int, default=4)
+    parser.add_argument("--warmup", type=int, default=5)
+    parser.add_argument("--iterations", type=int, default=50)
+    parser.add_argument("--zero_copy", action="store_true", help="Run a single case with zero copy outputs.")
+    parser.add_argument("--iobinding", action="store_true", help="Run a single case with run_with_iobinding.")
+    parser.add_argument("--single_case", action="store_true", help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    if args.single_case:
+        run_case(args)
+        return
+
+    common_args = [
+        f"--batch={args.batch}",
+        f"--size={args.size}",
+        f"--outputs={args.outputs}",
+        f"--warmup={args.warmup}",
+        f"--iterations={args.iterations}",
+        "--single_case",
+    ]
+    for iobinding in [False, True]:
+        for zero_copy in [False, True]:
+            case_args = common_args + (["--iobinding"] if iobinding else []) + (["--zero_copy"] if zero_copy else [])
+            subprocess.run([sys.executable, __file__] + case_args, check=True)
+
+
+if __name__ == "__main__":
+    main()
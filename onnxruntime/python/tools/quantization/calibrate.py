@@ -45,6 +45,7 @@ class CalibraterBase:
         augmented_model_path="augmented_model.onnx",
         symmetric=False,
         use_external_data_format=False,
+        use_native_collection=False,
     ):
         """
         :param model: ONNX model to calibrate. It can be a ModelProto or a model path
@@ -52,6 +53,9 @@ class CalibraterBase:
         :param augmented_model_path: save augmented model to this path.
         :param symmetric: make range of tensor symmetric (central point is 0).
         :param use_external_data_format: use external data format to store model which size is >= 2Gb
+        :param use_native_collection: collect the statistics of the tensors inside onnxruntime while the model runs,
+            with the session config entry session.calibration_tensors, instead of adding them to the model outputs.
+            Only the tensors in CPU memory are collected.
         """
         if isinstance(model, str):
             self.model = load_model(Path(model), False)
@@ -66,6 +70,10 @@ class CalibraterBase:
         self.augmented_model_path = augmented_model_path
         self.symmetric = symmetric
         self.use_external_data_format = use_external_data_format
+        self.use_native_collection = use_native_collection
+        # number of bins of the histograms collected natively, 0 for the minimum and maximum values only
+        self.native_histogram_bins = 0
+        self.tensors_to_calibrate = None
 
         self.augment_model = None
         self.infer_session = None
@@ -84,6 +92,13 @@ class CalibraterBase:
         """
         sess_options = onnxruntime.SessionOptions()
         sess_options.graph_optimization_level = onnxruntime.GraphOptimizationLevel.ORT_DISABLE_ALL
+        if self.use_native_collection and self.tensors_to_calibrate:
+            sess_options.add_session_config_entry(
+                "session.calibration_tensors", ",".join(sorted(self.tensors_to_calibrate))
+            )
+            sess_options.add_session_config_entry(
+                "session.calibration_histogram_bins", str(self.native_histogram_bins)
+            )
         self.infer_session = onnxruntime.InferenceSession(
             self.augmented_model_path,
             sess_options=sess_options,
@@ -125,6 +140,39 @@ class CalibraterBase:
         """
         return self.augment_model
 
+    def save_model_for_native_collection(self):
+        """
+        select the tensors to calibrate and save the model unchanged, as their statistics are collected by the session.
+        """
+        model = clone_model_with_shape_infer(self.model)
+        self.tensors_to_calibrate, _ = self.select_tensors_to_calibrate(model)
+        onnx.save(
+            model,
+            self.augmented_model_path,
+            save_as_external_data=self.use_external_data_format,
+        )
+        self.augment_model = model
+
+    def run_native_collection(self, data_reader: CalibrationDataReader):
+        """
+        run the model on the data and return the statistics collected by the session since it was created,
+        as a dictionary mapping: {tensor name: (min value, max value, histogram, threshold, count)}
+        """
+        num_runs = 0
+        while True:
+            inputs = data_reader.get_next()
+            if not inputs:
+                break
+            self.infer_session.run(None, inputs)
+            num_runs += 1
+
+        if num_runs == 0:
+            raise ValueError("No data is collected.")
+
+        if not self.tensors_to_calibrate:
+            return {}
+        return self.infer_session.get_calibration_stats()
+
     def augment_graph(self):
         """
         abstract method: augment the input model to prepare for collecting data. It will:
@@ -156,6 +204,7 @@ class MinMaxCalibrater(CalibraterBase):
         use_external_data_format=False,
         moving_average=False,
         averaging_constant=0.01,
+        use_native_collection=False,
     ):
         """
         :param model: ONNX model to calibrate. It can be a ModelProto or a model path
@@ -165,6 +214,8 @@ class MinMaxCalibrater(CalibraterBase):
         :param use_external_data_format: use external data format to store model which size is >= 2Gb
         :param moving_average: compute the moving average of the minimum and maximum values instead of the global minimum and maximum.
         :param averaging_constant: constant smoothing factor to use when computing the moving average.
+        :param use_native_collection: collect the minimum and maximum values inside onnxruntime instead of adding
+            ReduceMin and ReduceMax nodes to the model. Not supported with moving_average.
         """
         super(MinMaxCalibrater, self).__init__(
             model,
@@ -172,6 +223,7 @@ class MinMaxCalibrater(CalibraterBase):
             augmented_model_path,
             symmetric,
             use_external_data_format,
+            use_native_collection=use_native_collection,
         )
         self.intermediate_outputs = []
         self.calibrate_tensors_range = None
@@ -180,6 +232,8 @@ class MinMaxCalibrater(CalibraterBase):
         self.moving_average = moving_average
         if moving_average and (averaging_constant < 0 or averaging_constant > 1):
             raise ValueError("Invalid averaging constant, which should not be < 0 or > 1.")
+        if moving_average and use_native_collection:
+            raise ValueError("The moving average isn't supported with the native collection.")
         self.averaging_constant = averaging_constant
 
     def augment_graph(self):
@@ -188,6 +242,10 @@ class MinMaxCalibrater(CalibraterBase):
         model and ensures their outputs are stored as part of the graph output
         :return: augmented ONNX model
         """
+        if self.use_native_collection:
+            self.save_model_for_native_collection()
+            return
+
         model = clone_model_with_shape_infer(self.model)
 
         tensors, _ = self.select_tensors_to_calibrate(model)
@@ -232,6 +290,18 @@ class MinMaxCalibrater(CalibraterBase):
         self.intermediate_outputs = []
 
     def collect_data(self, data_reader: CalibrationDataReader):
+        if self.use_native_collection:
+            # the session accumulates the minimum and maximum values of all the runs
+            stats = self.run_native_collection(data_reader)
+            self.calibrate_tensors_range = {}
+            for tensor, (min_value, max_value, _, _, _) in stats.items():
+                if self.symmetric:
+                    max_absolute_value = max(abs(min_value), abs(max_value))
+                    self.calibrate_tensors_range[tensor] = (-max_absolute_value, max_absolute_value)
+                else:
+                    self.calibrate_tensors_range[tensor] = (min_value, max_value)
+            return
+
         while True:
             inputs = data_reader.get_next()
             if not inputs:
@@ -328,6 +398,7 @@ class HistogramCalibrater(CalibraterBase):
         num_bins=128,
         num_quantized_bins=2048,
         percentile=99.999,
+        use_native_collection=False,
     ):
         """
         :param model: ONNX model to calibrate. It can be a ModelProto or a model path
@@ -339,9 +410,15 @@ class HistogramCalibrater(CalibraterBase):
         :param num_bins: number of bins to create a new histogram for collecting tensor values.
         :param num_quantized_bins: number of quantized bins. Default 128.
         :param percentile: A float number between [0, 100]. Default 99.99.
+        :param use_native_collection: build the histograms inside onnxruntime instead of adding the tensors to the
+            model outputs.
         """
         super(HistogramCalibrater, self).__init__(
-            model, op_types_to_calibrate, augmented_model_path, use_external_data_format
+            model,
+            op_types_to_calibrate,
+            augmented_model_path,
+            use_external_data_format,
+            use_native_collection=use_native_collection,
         )
         self.intermediate_outputs = []
         self.calibrate_tensors_range = None
@@ -353,13 +430,19 @@ class HistogramCalibrater(CalibraterBase):
         self.num_bins = num_bins
         self.num_quantized_bins = num_quantized_bins
         self.percentile = percentile
-        self.tensors_to_calibrate = None
+        # the histogram of the absolute values is made by folding a histogram of the values with twice as many bins
+        self.fold_native_histogram = method == "percentile" and symmetric
+        self.native_histogram_bins = 2 * num_bins if self.fold_native_histogram else num_bins
 
     def augment_graph(self):
         """
         make all quantization_candidates op type nodes as part of the graph output.
         :return: augmented ONNX model
         """
+        if self.use_native_collection:
+            self.save_model_for_native_collection()
+            return
+
         model = clone_model_with_shape_infer(self.model)
 
         self.tensors_to_calibrate, value_infos = self.select_tensors_to_calibrate(model)
@@ -381,6 +464,10 @@ class HistogramCalibrater(CalibraterBase):
         """
         Entropy Calibrator collects operators' tensors as well as generates tensor histogram for each operator.
         """
+        if self.use_native_collection:
+            self.collect_native_histograms(data_reader)
+            return
+
         while True:
             inputs = data_reader.get_next()
             if not inputs:
@@ -414,6 +501,35 @@ class HistogramCalibrater(CalibraterBase):
 
         self.clear_collected_data()
 
+    def collect_native_histograms(self, data_reader: CalibrationDataReader):
+        """
+        Set the histograms of the collector to the ones built by the session, which accumulates the values of all
+        the runs. They have the layout of HistogramCollector.collect_value, or of collect_absolute_value over
+        [0, threshold] when they are folded.
+        """
+        stats = self.run_native_collection(data_reader)
+
+        if not self.collector:
+            self.collector = HistogramCollector(
+                method=self.method,
+                symmetric=self.symmetric,
+                num_bins=self.num_bins,
+                num_quantized_bins=self.num_quantized_bins,
+                percentile=self.percentile,
+            )
+
+        histogram_dict = {}
+        for tensor, (min_value, max_value, hist, threshold, _) in stats.items():
+            hist = hist.astype(np.int64)
+            if self.fold_native_histogram:
+                half = hist.size // 2
+                hist = hist[half:] + hist[half - 1 :: -1]
+                histogram_dict[tensor] = (hist, np.linspace(0, threshold, half + 1, dtype=np.float32))
+            else:
+                hist_edges = np.linspace(-threshold, threshold, hist.size + 1, dtype=np.float32)
+                histogram_dict[tensor] = (hist, hist_edges, min_value, max_value, threshold)
+        self.collector.histogram_dict = histogram_dict
+
     def compute_range(self):
         """
         Compute the min-max range of tensor
@@ -436,6 +552,7 @@ class EntropyCalibrater(HistogramCalibrater):
         symmetric=False,
         num_bins=128,
         num_quantized_bins=128,
+        use_native_collection=False,
     ):
         """
         :param model: ONNX model to calibrate. It can be a ModelProto or a model path
@@ -456,6 +573,7 @@ class EntropyCalibrater(HistogramCalibrater):
             symmetric=symmetric,
             num_bins=num_bins,
             num_quantized_bins=num_quantized_bins,
+            use_native_collection=use_native_collection,
         )
 
 
@@ -470,6 +588,7 @@ class PercentileCalibrater(HistogramCalibrater):
         symmetric=False,
         num_bins=2048,
         percentile=99.999,
+        use_native_collection=False,
     ):
         """
         :param model: ONNX model to calibrate. It can be a ModelProto or a model path
@@ -490,6 +609,7 @@ class PercentileCalibrater(HistogramCalibrater):
             symmetric=symmetric,
             num_bins=num_bins,
             percentile=percentile,
+            use_native_collection=use_native_collection,
         )
 
 
@@ -818,6 +938,7 @@ def create_calibrator(
 ):
 
     calibrator = None
+    use_native_collection = extra_options.get("use_native_collection", False)
     if calibrate_method == CalibrationMethod.MinMax:
         # default settings for min-max algorithm
         symmetric = False if "symmetric" not in extra_options else extra_options["symmetric"]
@@ -831,6 +952,7 @@ def create_calibrator(
             symmetric=symmetric,
             moving_average=moving_average,
             averaging_constant=averaging_constant,
+            use_native_collection=use_native_collection,
         )
     elif calibrate_method == CalibrationMethod.Entropy:
         # default settings for entropy algorithm
@@ -845,6 +967,7 @@ def create_calibrator(
             symmetric=symmetric,
             num_bins=num_bins,
             num_quantized_bins=num_quantized_bins,
+            use_native_collection=use_native_collection,
         )
     elif calibrate_method == CalibrationMethod.Percentile:
         # default settings for percentile algorithm
@@ -859,6 +982,7 @@ def create_calibrator(
             symmetric=symmetric,
             num_bins=num_bins,
             percentile=percentile,
+            use_native_collection=use_native_collection,
         )
 
     if calibrator:
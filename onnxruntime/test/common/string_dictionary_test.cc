@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/string_dictionary.h"
+
+#include <string>
+#include <unordered_map>
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(StringDictionaryTest, InsertAndFind) {
+  StringDictionary dictionary;
+  EXPECT_TRUE(dictionary.Empty());
+  EXPECT_EQ(dictionary.Find("a"), StringDictionary::kNotFound);
+
+  bool inserted = false;
+  EXPECT_EQ(dictionary.Insert("apple", inserted), 0u);
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(dictionary.Insert("", inserted), 1u);
+  EXPECT_TRUE(inserted);
+  EXPECT_EQ(dictionary.Insert("apple", inserted), 0u);
+  EXPECT_FALSE(inserted);
+
+  EXPECT_EQ(dictionary.Size(), 2u);
+  EXPECT_EQ(dictionary.Find("apple"), 0u);
+  EXPECT_EQ(dictionary.Find(""), 1u);
+  EXPECT_EQ(dictionary.Find("appl"), StringDictionary::kNotFound);
+  EXPECT_EQ(dictionary.Find("apples"), StringDictionary::kNotFound);
+  EXPECT_EQ(dictionary.Get(0), "apple");
+  EXPECT_EQ(dictionary.Get(1), "");
+}
+
+// Strings sharing long prefixes, inserted without reserving so the table grows several times.
+TEST(StringDictionaryTest, ManyStrings) {
+  StringDictionary dictionary;
+  std::unordered_map<std::string, StringDictionary::Id> expected;
+  for (int i = 0; i < 20000; ++i) {
+    std::string str = "a fairly long common prefix " + std::to_string(i % 7919);
+    const auto id = dictionary.Insert(str);
+    auto result = expected.emplace(str, id);
+    EXPECT_EQ(result.first->second, id);
+  }
+
+  ASSERT_EQ(dictionary.Size(), expected.size());
+  for (const auto& entry : expected) {
+    EXPECT_EQ(dictionary.Find(entry.first), entry.second);
+    EXPECT_EQ(dictionary.Get(entry.second), entry.first);
+  }
+  EXPECT_EQ(dictionary.Find("a fairly long common prefix 7919"), StringDictionary::kNotFound);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+// Table of 4 rows of 3 values, row r is {r, 10 * r, 100 * r}.
+const std::vector<float> kTable = {0.0f, 0.0f, 0.0f,
+                                   1.0f, 10.0f, 100.0f,
+                                   2.0f, 20.0f, 200.0f,
+                                   3.0f, 30.0f, 300.0f};
+
+}  // namespace
+
+TEST(EmbeddingBagTest, SumFixedSizeBags) {
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddInput<float>("weight", {4, 3}, kTable);
+  test.AddInput<int64_t>("indices", {2, 3}, {1, 2, 3, 3, -1, 0});
+  test.AddOutput<float>("output", {2, 3}, {6.0f, 60.0f, 600.0f, 6.0f, 60.0f, 600.0f});
+  test.Run();
+}
+
+// Bags of different sizes given by offsets, with an empty bag.
+TEST(EmbeddingBagTest, MeanWithOffsets) {
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<std::string>("mode", "mean");
+  test.AddInput<float>("weight", {4, 3}, kTable);
+  test.AddInput<int32_t>("indices", {5}, {1, 3, 2, 2, 0});
+  test.AddInput<int32_t>("offsets", {3}, {0, 2, 2});
+  test.AddOutput<float>("output", {3, 3}, {2.0f, 20.0f, 200.0f,
+                                           0.0f, 0.0f, 0.0f,
+                                           4.0f / 3.0f, 40.0f / 3.0f, 400.0f / 3.0f});
+  test.Run();
+}
+
+TEST(EmbeddingBagTest, SumWithPerSampleWeights) {
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddInput<float>("weight", {4, 3}, kTable);
+  test.AddInput<int64_t>("indices", {2, 2}, {1, 2, 3, 1});
+  test.AddOptionalInputEdge<int64_t>();
+  test.AddInput<float>("per_sample_weights", {2, 2}, {0.5f, 2.0f, -1.0f, 1.0f});
+  test.AddOutput<float>("output", {2, 3}, {4.5f, 45.0f, 450.0f, -2.0f, -20.0f, -200.0f});
+  test.Run();
+}
+
+// Row-wise quantized table, row r is dequantized as scale[r] * (weight[r] - zero_point[r]).
+TEST(EmbeddingBagTest, SumInt8RowWiseQuantized) {
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddInput<int8_t>("weight", {3, 2}, {10, -10,
+                                           4, 8,
+                                           -128, 127});
+  test.AddInput<int64_t>("indices", {2, 2}, {0, 1, 2, 0});
+  test.AddOptionalInputEdge<int64_t>();
+  test.AddInput<float>("per_sample_weights", {2, 2}, {1.0f, 1.0f, 2.0f, 1.0f});
+  test.AddInput<float>("scale", {3}, {0.5f, 0.25f, 0.01f});
+  test.AddInput<int8_t>("zero_point", {3}, {0, 4, -28});
+  test.AddOutput<float>("output", {2, 2}, {5.0f, -4.0f,
+                                          3.0f, -1.9f});
+  test.Run();
+}
+
+TEST(EmbeddingBagTest, MeanUInt8QuantizedWithoutZeroPoint) {
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<std::string>("mode", "mean");
+  test.AddInput<uint8_t>("weight", {2, 2}, {2, 4,
+                                            200, 100});
+  test.AddInput<int32_t>("indices", {1, 2}, {0, 1});
+  test.AddOptionalInputEdge<int32_t>();
+  test.AddOptionalInputEdge<float>();
+  test.AddInput<float>("scale", {2}, {1.0f, 0.5f});
+  test.AddOutput<float>("output", {1, 2}, {51.0f, 27.0f});
+  test.Run();
+}
+
+// Many bags of wide rows, processed in parallel.
+TEST(EmbeddingBagTest, SumLarge) {
+  constexpr int64_t kNumEmbeddings = 500;
+  constexpr int64_t kEmbeddingDim = 64;
+  constexpr int64_t kNumBags = 300;
+  constexpr int64_t kBagSize = 20;
+
+  std::vector<float> weight(kNumEmbeddings * kEmbeddingDim);
+  for (size_t i = 0; i < weight.size(); ++i) {
+    weight[i] = static_cast<float>(i % 13) * 0.25f;
+  }
+
+  std::vector<int64_t> indices(kNumBags * kBagSize);
+  std::vector<float> output(kNumBags * kEmbeddingDim, 0.0f);
+  for (int64_t b = 0; b < kNumBags; ++b) {
+    for (int64_t j = 0; j < kBagSize; ++j) {
+      const int64_t row = (b * 31 + j * 17) % kNumEmbeddings;
+      indices[b * kBagSize + j] = row;
+      for (int64_t k = 0; k < kEmbeddingDim; ++k) {
+        output[b * kEmbeddingDim + k] += weight[row * kEmbeddingDim + k];
+      }
+    }
+  }
+
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddInput<float>("weight", {kNumEmbeddings, kEmbeddingDim}, weight);
+  test.AddInput<int64_t>("indices", {kNumBags, kBagSize}, indices);
+  test.AddOutput<float>("output", {kNumBags, kEmbeddingDim}, output);
+  test.Run();
+}
+
+TEST(EmbeddingBagTest, InvalidIndex) {
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddInput<float>("weight", {4, 3}, kTable);
+  test.AddInput<int64_t>("indices", {1, 2}, {1, 4});
+  test.AddOutput<float>("output", {1, 3}, {0.0f, 0.0f, 0.0f});
+  test.Run(OpTester::ExpectResult::kExpectFailure, "indices element out of data bounds, idx=4");
+}
+
+TEST(EmbeddingBagTest, InvalidOffsets) {
+  OpTester test("EmbeddingBag", 1, onnxruntime::kMSDomain);
+  test.AddInput<float>("weight", {4, 3}, kTable);
+  test.AddInput<int64_t>("indices", {3}, {1, 2, 3});
+  test.AddInput<int64_t>("offsets", {2}, {2, 1});
+  test.AddOutput<float>("output", {2, 3}, std::vector<float>(6, 0.0f));
+  test.Run(OpTester::ExpectResult::kExpectFailure, "offsets must be non-decreasing");
+}
+
+}  // namespace test
+}  // namespace onnxruntime
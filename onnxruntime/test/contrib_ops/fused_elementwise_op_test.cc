@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+// The rows are not a multiple of the block size the kernel processes the input with, so the bias is split between
+// blocks.
+TEST(FusedElementwiseTest, BiasScaleTanhRSub) {
+  constexpr int64_t rows = 3;
+  constexpr int64_t cols = 700;
+
+  std::vector<float> X(rows * cols);
+  std::vector<float> bias(cols);
+  for (int64_t i = 0; i < rows * cols; ++i) {
+    X[i] = static_cast<float>(i % 37) / 18.0f - 1.0f;
+  }
+  for (int64_t i = 0; i < cols; ++i) {
+    bias[i] = static_cast<float>(i % 11) / 10.0f - 0.5f;
+  }
+
+  std::vector<float> Y(rows * cols);
+  for (int64_t i = 0; i < rows * cols; ++i) {
+    Y[i] = 1.0f - std::tanh((X[i] + bias[i % cols]) * 0.5f);
+  }
+
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"Add", "Mul", "Tanh", "RSub"});
+  test.AddAttribute<std::vector<int64_t>>("operands", {1, 2, -1, 3});
+  test.AddInput<float>("X", {rows, cols}, X);
+  test.AddInput<float>("bias", {cols}, bias);
+  test.AddInput<float>("scale", {}, {0.5f});
+  test.AddInput<float>("one", {1, 1}, {1.0f});
+  test.AddOutput<float>("Y", {rows, cols}, Y);
+  test.Run();
+}
+
+TEST(FusedElementwiseTest, InputAsOperand) {
+  std::vector<float> X{-3.0f, -1.0f, 0.0f, 0.5f, 2.0f, 4.0f};
+  std::vector<float> Y;
+  for (float x : X) {
+    Y.push_back(x / (1.0f + std::exp(-x)));
+  }
+
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"Sigmoid", "Mul"});
+  test.AddAttribute<std::vector<int64_t>>("operands", {-1, 0});
+  test.AddInput<float>("X", {2, 3}, X);
+  test.AddOutput<float>("Y", {2, 3}, Y);
+  test.Run();
+}
+
+TEST(FusedElementwiseTest, UnaryAndReversedBinarySteps) {
+  std::vector<float> X{0.25f, 1.0f, 2.0f, 4.0f};
+  std::vector<float> Y;
+  for (float x : X) {
+    Y.push_back(std::floor(8.0f / std::sqrt(std::abs(-x))));
+  }
+
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"Neg", "Abs", "Sqrt", "RDiv", "Floor"});
+  test.AddAttribute<std::vector<int64_t>>("operands", {-1, -1, -1, 1, -1});
+  test.AddInput<float>("X", {4}, X);
+  test.AddInput<float>("numerator", {1}, {8.0f});
+  test.AddOutput<float>("Y", {4}, Y);
+  test.Run();
+}
+
+TEST(FusedElementwiseTest, InvalidBroadcast) {
+  OpTester test("FusedElementwise", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<std::vector<std::string>>("ops", {"Add", "Relu"});
+  test.AddAttribute<std::vector<int64_t>>("operands", {1, -1});
+  test.AddInput<float>("X", {2, 3}, {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f});
+  test.AddInput<float>("operand", {2, 1}, {1.0f, 2.0f});
+  test.AddOutput<float>("Y", {2, 3}, std::vector<float>(6, 0.0f));
+  test.Run(OpTester::ExpectResult::kExpectFailure, "is not a suffix broadcast of input 0");
+}
+
+}  // namespace test
+}  // namespace onnxruntime
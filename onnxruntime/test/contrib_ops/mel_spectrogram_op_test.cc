@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "test/providers/provider_test_utils.h"
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Triangular filters spread evenly over the frequency bins, most of each column is zero.
+std::vector<float> TriangularFilterBank(int64_t num_bins, int64_t num_mel_bins) {
+  std::vector<float> weights(num_bins * num_mel_bins, 0.0f);
+  const double spacing = static_cast<double>(num_bins - 1) / static_cast<double>(num_mel_bins + 1);
+  for (int64_t m = 0; m < num_mel_bins; ++m) {
+    const double center = spacing * static_cast<double>(m + 1);
+    for (int64_t k = 0; k < num_bins; ++k) {
+      const double weight = 1.0 - std::abs(static_cast<double>(k) - center) / spacing;
+      if (weight > 0.0) {
+        weights[k * num_mel_bins + m] = static_cast<float>(weight);
+      }
+    }
+  }
+  return weights;
+}
+
+// Windowed DFT of each frame followed by a dense product with the mel weight matrix.
+std::vector<float> NaiveMelSpectrogram(const std::vector<float>& signal, int64_t batch_size, int64_t signal_length,
+                                       int64_t frame_step, const std::vector<float>& window,
+                                       const std::vector<float>& mel_weight_matrix, int64_t num_mel_bins,
+                                       int64_t power, bool apply_log, float log_offset) {
+  const int64_t frame_length = static_cast<int64_t>(window.size());
+  const int64_t num_bins = frame_length / 2 + 1;
+  const int64_t num_frames = (signal_length - frame_length) / frame_step + 1;
+
+  std::vector<float> output;
+  std::vector<double> magnitudes(num_bins);
+  for (int64_t b = 0; b < batch_size; ++b) {
+    for (int64_t f = 0; f < num_frames; ++f) {
+      const float* x = signal.data() + b * signal_length + f * frame_step;
+      for (int64_t k = 0; k < num_bins; ++k) {
+        double re = 0.0;
+        double im = 0.0;
+        for (int64_t n = 0; n < frame_length; ++n) {
+          const double angle = -2.0 * kPi * static_cast<double>(k * n) / static_cast<double>(frame_length);
+          const double value = static_cast<double>(x[n]) * window[n];
+          re += value * std::cos(angle);
+          im += value * std::sin(angle);
+        }
+        const double squared = re * re + im * im;
+        magnitudes[k] = power == 2 ? squared : std::sqrt(squared);
+      }
+
+      for (int64_t m = 0; m < num_mel_bins; ++m) {
+        double sum = 0.0;
+        for (int64_t k = 0; k < num_bins; ++k) {
+          sum += magnitudes[k] * mel_weight_matrix[k * num_mel_bins + m];
+        }
+        output.push_back(static_cast<float>(apply_log ? std::log(sum + log_offset) : sum));
+      }
+    }
+  }
+
+  return output;
+}
+
+void RunMelSpectrogramTest(int64_t batch_size, int64_t signal_length, int64_t frame_step, int64_t frame_length,
+                           int64_t num_mel_bins, int64_t power, bool apply_log, float log_offset,
+                           bool constant_mel_weight_matrix) {
+  std::vector<float> signal(batch_size * signal_length);
+  for (size_t i = 0; i < signal.size(); ++i) {
+    signal[i] = static_cast<float>(std::sin(0.37 * static_cast<double>(i)) + 0.25 * std::cos(1.3 * i));
+  }
+
+  // Hann window
+  std::vector<float> window(frame_length);
+  for (int64_t n = 0; n < frame_length; ++n) {
+    window[n] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * kPi * n / static_cast<double>(frame_length)));
+  }
+
+  const int64_t num_bins = frame_length / 2 + 1;
+  const int64_t num_frames = (signal_length - frame_length) / frame_step + 1;
+  std::vector<float> mel_weight_matrix = TriangularFilterBank(num_bins, num_mel_bins);
+  std::vector<float> expected = NaiveMelSpectrogram(signal, batch_size, signal_length, frame_step, window,
+                                                    mel_weight_matrix, num_mel_bins, power, apply_log, log_offset);
+
+  OpTester test("MelSpectrogram", 1, onnxruntime::kMSDomain);
+  test.AddAttribute<int64_t>("power", power);
+  test.AddAttribute<int64_t>("apply_log", apply_log ? 1 : 0);
+  test.AddAttribute<float>("log_offset", log_offset);
+  test.AddInput<float>("signal", {batch_size, signal_length, 1}, signal);
+  test.AddInput<int64_t>("frame_step", {}, {frame_step});
+  test.AddInput<float>("window", {frame_length}, window);
+  test.AddInput<float>("mel_weight_matrix", {num_bins, num_mel_bins}, mel_weight_matrix, constant_mel_weight_matrix);
+  test.AddOutput<float>("output", {batch_size, num_frames, num_mel_bins}, expected);
+  test.SetOutputRelErr("output", 1e-3f);
+  test.Run();
+}
+
+}  // namespace
+
+TEST(MelSpectrogramTest, PowerWithLog) {
+  RunMelSpectrogramTest(2, 1000, 160, 400, 20, 2, true, 1e-6f, true);
+}
+
+// The frame length is not a power of 2 and the filter bank is only known at run time.
+TEST(MelSpectrogramTest, MagnitudeNonConstantFilterBank) {
+  RunMelSpectrogramTest(1, 700, 75, 150, 12, 1, false, 0.0f, false);
+}
+
+// Odd frame length, which is not transformed as a half length complex signal.
+TEST(MelSpectrogramTest, OddFrameLength) {
+  RunMelSpectrogramTest(3, 300, 31, 63, 8, 2, false, 0.0f, true);
+}
+
+TEST(MelSpectrogramTest, InvalidMelWeightMatrix) {
+  OpTester test("MelSpectrogram", 1, onnxruntime::kMSDomain);
+  test.AddInput<float>("signal", {1, 16, 1}, std::vector<float>(16, 1.0f));
+  test.AddInput<int64_t>("frame_step", {}, {4});
+  test.AddInput<float>("window", {8}, std::vector<float>(8, 1.0f));
+  test.AddInput<float>("mel_weight_matrix", {4, 2}, std::vector<float>(8, 1.0f));
+  test.AddOutput<float>("output", {1, 3, 2}, std::vector<float>(6, 0.0f));
+  test.Run(OpTester::ExpectResult::kExpectFailure, "The mel weight matrix has 4 rows");
+}
+
+// As STFT, a window as long as the signal is rejected.
+TEST(MelSpectrogramTest, WindowAsLongAsSignal) {
+  OpTester test("MelSpectrogram", 1, onnxruntime::kMSDomain);
+  test.AddInput<float>("signal", {1, 8, 1}, std::vector<float>(8, 1.0f));
+  test.AddInput<int64_t>("frame_step", {}, {4});
+  test.AddInput<float>("window", {8}, std::vector<float>(8, 1.0f));
+  test.AddInput<float>("mel_weight_matrix", {5, 2}, std::vector<float>(10, 1.0f));
+  test.AddOutput<float>("output", {1, 1, 2}, std::vector<float>(2, 0.0f));
+  test.Run(OpTester::ExpectResult::kExpectFailure, "smaller than the signal length 8");
+}
+
+}  // namespace test
+}  // namespace onnxruntime
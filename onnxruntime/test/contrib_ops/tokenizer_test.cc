@@ -864,5 +864,55 @@ TEST(ContribOpTest, Tokenizer_EmptyInput) {
     test.Run(OpTester::ExpectResult::kExpectSuccess);
   }
 }
+
+// Enough strings for the rows to be tokenized in parallel, ASCII strings interleaved with Cyrillic ones
+TEST(ContribOpTest, TokenizerCharLevel_MixedCharsManyRows) {
+  constexpr int64_t num_rows = 256;
+  std::vector<std::string> input;
+  std::vector<std::vector<std::string>> rows;
+  size_t max_tokens = 0;
+  for (int64_t r = 0; r < num_rows; ++r) {
+    const std::string chars = (r % 2 == 0) ? std::string("ab") : std::string(u8"Пж");
+    const size_t char_len = chars.size() / 2;
+    std::string s;
+    std::vector<std::string> row;
+    for (int64_t i = 0; i < r % 5; ++i) {
+      s += chars;
+      row.push_back(chars.substr(0, char_len));
+      row.push_back(chars.substr(char_len));
+    }
+    max_tokens = std::max(max_tokens, row.size());
+    input.push_back(s);
+    rows.push_back(row);
+  }
+
+  std::vector<std::string> output;
+  for (const auto& row : rows) {
+    output.push_back(start_mark);
+    output.insert(output.end(), row.begin(), row.end());
+    output.push_back(end_mark);
+    output.insert(output.end(), max_tokens - row.size(), padval);
+  }
+
+  OpTester test("Tokenizer", opset_ver, domain);
+  InitTestAttr(test, true, {""}, 1);
+  test.AddInput<std::string>("T", {num_rows, 1}, input);
+  test.AddOutput<std::string>("Y", {num_rows, 1, static_cast<int64_t>(max_tokens) + 2}, output);
+  test.Run(OpTester::ExpectResult::kExpectSuccess);
+}
+
+// The error of an invalid string is reported when the strings are tokenized in parallel
+TEST(ContribOpTest, TokenizerSeparatorInvalidUtf8ManyRows) {
+  constexpr int64_t num_strings = 256;
+  std::vector<std::string> input(num_strings, std::string("hello world"));
+  input[200] = std::string("hello \xff world");
+
+  OpTester test("Tokenizer", opset_ver, domain);
+  InitTestAttr(test, false, {" "}, 1);
+  test.AddInput<std::string>("T", {num_strings}, input);
+  test.AddOutput<std::string>("Y", {num_strings, 2}, std::vector<std::string>(num_strings * 2, "hello"));
+  test.Run(OpTester::ExpectResult::kExpectFailure, "Input string contains invalid utf8 chars");
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <limits>
+#include <vector>
+
+#include "core/framework/calibration_collector.h"
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+using TensorStats = CalibrationCollector::TensorStats;
+
+TEST(CalibrationCollectorTest, MinMaxOnly) {
+  TensorStats stats;
+  const std::vector<float> values1 = {0.5f, -2.0f, 3.0f};
+  const std::vector<float> values2 = {-4.0f, 1.0f};
+  stats.Accumulate(values1.data(), values1.size(), 0);
+  stats.Accumulate(values2.data(), values2.size(), 0);
+
+  EXPECT_EQ(stats.count, 5u);
+  EXPECT_EQ(stats.min, -4.0f);
+  EXPECT_EQ(stats.max, 3.0f);
+  EXPECT_TRUE(stats.histogram.empty());
+}
+
+// The bins of [-threshold, threshold] match numpy.histogram, the maximum absolute value goes to the last bin.
+TEST(CalibrationCollectorTest, Histogram) {
+  TensorStats stats;
+  const std::vector<float> values = {-4.0f, -1.5f, -0.5f, 0.0f, 1.0f, 2.5f, 4.0f};
+  stats.Accumulate(values.data(), values.size(), 4);
+
+  EXPECT_EQ(stats.threshold, 4.0f);
+  EXPECT_EQ(stats.histogram, (std::vector<uint64_t>{1, 2, 2, 2}));
+}
+
+// A larger threshold adds bins of the same width on both sides, as HistogramCollector.merge_histogram.
+TEST(CalibrationCollectorTest, HistogramExpands) {
+  TensorStats stats;
+  const std::vector<float> values1 = {-1.0f, 1.0f};
+  const std::vector<float> values2 = {-2.5f};
+  stats.Accumulate(values1.data(), values1.size(), 4);
+  stats.Accumulate(values2.data(), values2.size(), 4);
+
+  // bins of width 0.5, (2.5 - 1) / 0.5 + 1 = 4 bins are added on each side
+  EXPECT_EQ(stats.threshold, 3.0f);
+  ASSERT_EQ(stats.histogram.size(), 12u);
+  EXPECT_EQ(stats.histogram, (std::vector<uint64_t>{0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0}));
+  EXPECT_EQ(stats.min, -2.5f);
+  EXPECT_EQ(stats.max, 1.0f);
+}
+
+TEST(CalibrationCollectorTest, HistogramOfZeros) {
+  TensorStats stats;
+  const std::vector<float> zeros(3, 0.0f);
+  const std::vector<float> values = {-2.0f, 2.0f};
+  stats.Accumulate(zeros.data(), zeros.size(), 4);
+  EXPECT_EQ(stats.histogram, (std::vector<uint64_t>{0, 0, 3, 0}));
+
+  // the zeros stay in the middle bin of the new range
+  stats.Accumulate(values.data(), values.size(), 4);
+  EXPECT_EQ(stats.threshold, 2.0f);
+  EXPECT_EQ(stats.histogram, (std::vector<uint64_t>{1, 0, 3, 1}));
+}
+
+// NaN and infinite values are only counted, the range and the histogram are those of the finite values.
+TEST(CalibrationCollectorTest, NonFiniteValues) {
+  constexpr float kNaN = std::numeric_limits<float>::quiet_NaN();
+  constexpr float kInf = std::numeric_limits<float>::infinity();
+
+  TensorStats stats;
+  const std::vector<float> non_finite = {kNaN, kInf, -kInf};
+  stats.Accumulate(non_finite.data(), non_finite.size(), 4);
+  EXPECT_EQ(stats.count, 0u);
+  EXPECT_EQ(stats.non_finite_count, 3u);
+  EXPECT_TRUE(stats.histogram.empty());
+
+  const std::vector<float> values = {1.0f, kNaN, -2.0f, kInf, -kInf, 0.5f};
+  stats.Accumulate(values.data(), values.size(), 4);
+  EXPECT_EQ(stats.count, 3u);
+  EXPECT_EQ(stats.non_finite_count, 6u);
+  EXPECT_EQ(stats.min, -2.0f);
+  EXPECT_EQ(stats.max, 1.0f);
+  EXPECT_EQ(stats.threshold, 2.0f);
+  EXPECT_EQ(stats.histogram, (std::vector<uint64_t>{1, 0, 1, 1}));
+
+  TensorStats min_max_stats;
+  min_max_stats.Accumulate(values.data(), values.size(), 0);
+  EXPECT_EQ(min_max_stats.count, 3u);
+  EXPECT_EQ(min_max_stats.non_finite_count, 3u);
+  EXPECT_EQ(min_max_stats.min, -2.0f);
+  EXPECT_EQ(min_max_stats.max, 1.0f);
+}
+
+// The largest finite values don't overflow the bin computation.
+TEST(CalibrationCollectorTest, HistogramOfLargestValues) {
+  constexpr float kMax = std::numeric_limits<float>::max();
+
+  TensorStats stats;
+  const std::vector<float> values = {-kMax, 0.0f, kMax};
+  stats.Accumulate(values.data(), values.size(), 4);
+  EXPECT_EQ(stats.threshold, kMax);
+  EXPECT_EQ(stats.histogram, (std::vector<uint64_t>{1, 0, 1, 1}));
+}
+
+// More values than a block of bins.
+TEST(CalibrationCollectorTest, LargeHistogram) {
+  TensorStats stats;
+  std::vector<float> values(5000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<float>(i % 10) - 4.5f;
+  }
+  stats.Accumulate(values.data(), values.size(), 10);
+
+  EXPECT_EQ(stats.threshold, 4.5f);
+  EXPECT_EQ(stats.histogram, std::vector<uint64_t>(10, 500));
+}
+
+}  // namespace test
+}  // namespace onnxruntime
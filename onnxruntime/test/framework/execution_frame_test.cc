@@ -205,6 +205,62 @@ TEST_F(ExecutionFrameTest, FeedInDataTest) {
   ASSERT_EQ(p_tensor_arg_0->MutableData<float>(), value.GetMutable<Tensor>()->MutableData<float>());
 }
 
+TEST_F(ExecutionFrameTest, ResetTest) {
+  onnxruntime::Model model("test", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                           std::unordered_map<std::string, int>{{"", 10}}, {},
+                           DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = model.MainGraph();
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  onnxruntime::NodeArg input_def("X", &tensor_float), output_def("Y", &tensor_float);
+
+  graph.AddNode("node1", "Clip", "Clip operator", ArgMap{&input_def}, ArgMap{&output_def})
+      .SetExecutionProviderType(kCpuExecutionProvider);
+  ASSERT_STATUS_OK(graph.Resolve());
+  auto element_type = DataTypeImpl::GetType<float>();
+  TensorShape shape({3, 2});
+  std::vector<float> fdata1(static_cast<size_t>(shape.Size()));
+  std::vector<float> fdata2(static_cast<size_t>(shape.Size()));
+  OrtMemoryInfo cpuinfo(kCpuExecutionProvider, OrtDeviceAllocator);
+  OrtValue value1, value2;
+  Tensor::InitOrtValue(element_type, shape, fdata1.data(), cpuinfo, value1);
+  Tensor::InitOrtValue(element_type, shape, fdata2.data(), cpuinfo, value2);
+
+  auto cpu_xp = CreateCPUExecutionProvider();
+  auto xp_typ = cpu_xp->Type();
+
+  KernelRegistryManager kernel_registry_manager;
+  ExecutionProviders execution_providers;
+  ASSERT_STATUS_OK(execution_providers.Add(xp_typ, std::move(cpu_xp)));
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  SessionState state(graph, execution_providers, false, &tp_, nullptr, dtm,
+                     DefaultLoggingManager().DefaultLogger(), profiler);
+
+  ASSERT_STATUS_OK(state.FinalizeSessionState(ORT_TSTR(""), kernel_registry_manager));
+
+  const OrtValueNameIdxMap& mlvalue_name_idx_map = state.GetOrtValueNameIdxMap();
+  int x_idx = -1, y_idx = -1;
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("X", x_idx).IsOK());
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("Y", y_idx).IsOK());
+
+  vector<OrtValue> outputs;
+  ExecutionFrame frame({x_idx}, {value1}, {y_idx}, outputs, {}, state);
+  ASSERT_TRUE(frame.CanReset());
+
+  OrtValue& y_value = *frame.GetMutableNodeInputOrOutputMLValue(1);
+  ASSERT_STATUS_OK(frame.AllocateMLValueTensorSelfOwnBuffer(y_value, y_idx, element_type, cpuinfo, shape));
+
+  // the feed is replaced and the output from the previous execution is released
+  frame.Reset(AsSpan({x_idx}), AsSpan({value2}), {});
+  const OrtValue* x_value = frame.GetNodeInputOrOutputMLValue(0);
+  ASSERT_TRUE(x_value != nullptr);
+  ASSERT_EQ(x_value->Get<Tensor>().Data<float>(), fdata2.data());
+  ASSERT_FALSE(frame.GetNodeInputOrOutputMLValue(1)->IsAllocated());
+}
+
 TEST_F(ExecutionFrameTest, MemPatternTest) {
   auto cpu_xp = CreateCPUExecutionProvider();
   auto xp_type = cpu_xp->Type();
@@ -656,6 +656,7 @@ TEST(InferenceSessionTests, CheckRunProfilerWithSessionOptions) {
   std::vector<std::string> tags = {"pid", "dur", "ts", "ph", "X", "name", "args"};
 
   bool has_kernel_info = false;
+  bool has_kernel_cost = false;
   for (size_t i = 1; i < size - 1; ++i) {
     for (auto& s : tags) {
       ASSERT_TRUE(lines[i].find(s) != string::npos);
@@ -663,13 +664,252 @@ TEST(InferenceSessionTests, CheckRunProfilerWithSessionOptions) {
                                                lines[i].find("stream") != string::npos &&
                                                lines[i].find("block_x") != string::npos;
     }
+
+    // the CPU Mul kernel provides a cost model
+    has_kernel_cost = has_kernel_cost || lines[i].find("mul_1_kernel_time") != string::npos &&
+                                             lines[i].find("\"flops\"") != string::npos &&
+                                             lines[i].find("\"gflops_per_sec\"") != string::npos;
   }
 
+#if !defined(USE_CUDA) && !defined(USE_ROCM)
+  ASSERT_TRUE(has_kernel_cost);
+#endif
+
 #if defined(USE_CUDA) && defined(ENABLE_CUDA_PROFILING)
   ASSERT_TRUE(has_kernel_info);
 #endif
 }
 
+// X[2,3] -> MatMul(B[3,4]) -> Relu -> Y[2,4] and CX[1,2,5,5] -> Conv(CW[3,2,3,3]) -> CY[1,3,3,3]
+static void CreateKernelCostModel(std::unique_ptr<onnxruntime::Model>& p_model) {
+  std::unordered_map<std::string, int> domain_to_version = {{kOnnxDomain, 12}};
+  p_model = std::make_unique<Model>("test", true, ModelMetaData(), PathString(),
+                                    IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+                                    std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                                    DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = p_model->MainGraph();
+
+  auto make_type = [](std::initializer_list<int64_t> dims) {
+    TypeProto type;
+    type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    for (auto dim : dims) {
+      type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+    }
+    return type;
+  };
+  const auto x_type = make_type({2, 3});
+  const auto y_type = make_type({2, 4});
+  const auto cx_type = make_type({1, 2, 5, 5});
+  const auto cw_type = make_type({3, 2, 3, 3});
+  const auto cy_type = make_type({1, 3, 3, 3});
+
+  TensorProto b;
+  b.set_name("B");
+  b.add_dims(3);
+  b.add_dims(4);
+  b.set_data_type(TensorProto_DataType_FLOAT);
+  for (int i = 0; i < 12; ++i) {
+    b.add_float_data(static_cast<float>(i % 5) - 2.0f);
+  }
+  graph.AddInitializedTensor(b);
+
+  auto& x = graph.GetOrCreateNodeArg("X", &x_type);
+  auto& b_arg = graph.GetOrCreateNodeArg("B", nullptr);
+  auto& matmul_out = graph.GetOrCreateNodeArg("M", &y_type);
+  auto& y = graph.GetOrCreateNodeArg("Y", &y_type);
+  graph.AddNode("matmul", "MatMul", "", {&x, &b_arg}, {&matmul_out});
+  graph.AddNode("relu", "Relu", "", {&matmul_out}, {&y});
+
+  auto& cx = graph.GetOrCreateNodeArg("CX", &cx_type);
+  auto& cw = graph.GetOrCreateNodeArg("CW", &cw_type);
+  auto& cy = graph.GetOrCreateNodeArg("CY", &cy_type);
+  graph.AddNode("conv", "Conv", "", {&cx, &cw}, {&cy});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+}
+
+// The cost model args of the kernel_time events have the values of the shapes of the run, with both executors.
+TEST(InferenceSessionTests, KernelCostArgsInProfile) {
+  std::unique_ptr<onnxruntime::Model> p_model;
+  CreateKernelCostModel(p_model);
+  std::string model_data;
+  p_model->ToProto().SerializeToString(&model_data);
+
+  auto cpu_allocator = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+  OrtValue x;
+  CreateMLValue<float>(cpu_allocator, {2, 3}, std::vector<float>(6, 1.0f), &x);
+  OrtValue cx;
+  CreateMLValue<float>(cpu_allocator, {1, 2, 5, 5}, std::vector<float>(50, 1.0f), &cx);
+  OrtValue cw;
+  CreateMLValue<float>(cpu_allocator, {3, 2, 3, 3}, std::vector<float>(54, 0.5f), &cw);
+
+  for (auto execution_mode : {ExecutionMode::ORT_SEQUENTIAL, ExecutionMode::ORT_PARALLEL}) {
+    SessionOptions so;
+    so.session_logid = "KernelCostArgsInProfile";
+    so.execution_mode = execution_mode;
+    so.graph_optimization_level = TransformerLevel::Default;
+    so.enable_profiling = true;
+    so.profile_file_prefix = ORT_TSTR("onnxprofile_kernel_cost_test");
+
+    InferenceSession session_object{so, GetEnvironment()};
+    std::stringstream model_stream(model_data);
+    ASSERT_STATUS_OK(session_object.Load(model_stream));
+    ASSERT_STATUS_OK(session_object.Initialize());
+
+    NameMLValMap feeds = {{"X", x}, {"CX", cx}, {"CW", cw}};
+    std::vector<OrtValue> fetches;
+    ASSERT_STATUS_OK(session_object.Run(RunOptions(), feeds, {"Y", "CY"}, &fetches));
+
+    std::ifstream profile(session_object.EndProfiling());
+    ASSERT_TRUE(profile);
+    std::unordered_map<std::string, std::string> kernel_events;
+    std::string line;
+    const std::vector<std::string> node_names = {"matmul", "relu", "conv"};
+    while (std::getline(profile, line)) {
+      for (const auto& node_name : node_names) {
+        if (line.find("\"name\" :\"" + node_name + "_kernel_time\"") != std::string::npos) {
+          kernel_events[node_name] = line;
+        }
+      }
+    }
+
+    auto expect_arg = [&kernel_events](const std::string& node_name, const std::string& arg,
+                                       const std::string& value) {
+      EXPECT_NE(kernel_events[node_name].find("\"" + arg + "\" : \"" + value + "\""), std::string::npos)
+          << node_name << " " << arg << ": " << kernel_events[node_name];
+    };
+
+    // 2 * M * N * K, with the shape of B saved when it was pre-packed
+    expect_arg("matmul", "flops", std::to_string(2.0 * 2 * 4 * 3));
+    expect_arg("matmul", "bytes_read", std::to_string((6.0 + 12.0) * sizeof(float)));
+    expect_arg("matmul", "bytes_written", std::to_string(8.0 * sizeof(float)));
+
+    // one operation per element
+    expect_arg("relu", "flops", std::to_string(8.0));
+    expect_arg("relu", "bytes_read", std::to_string(8.0 * sizeof(float)));
+    expect_arg("relu", "bytes_written", std::to_string(8.0 * sizeof(float)));
+
+    // 2 * C * kH * kW for each of the 27 output elements
+    expect_arg("conv", "flops", std::to_string(2.0 * 27 * 2 * 3 * 3));
+    expect_arg("conv", "bytes_read", std::to_string((50.0 + 54.0) * sizeof(float)));
+    expect_arg("conv", "bytes_written", std::to_string(27.0 * sizeof(float)));
+  }
+}
+
+TEST(InferenceSessionTests, ParallelInitializationWithPhaseProfiling) {
+  SessionOptions so;
+
+  so.session_logid = "ParallelInitialization";
+  so.enable_profiling = true;
+  so.profile_file_prefix = ORT_TSTR("onnxprofile_parallel_init_test");
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigParallelInitialization, "1"));
+
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  RunModel(session_object, run_options);
+  std::string profile_file = session_object.EndProfiling();
+
+  std::ifstream profile(profile_file);
+  ASSERT_TRUE(profile);
+  std::string contents((std::istreambuf_iterator<char>(profile)), std::istreambuf_iterator<char>());
+
+  std::vector<std::string> phases = {"level1_graph_transformation", "graph_partitioning",
+                                     "level2_graph_transformation", "allocation_planning", "initializer_loading",
+                                     "kernel_creation", "session_state_finalization"};
+#ifndef ENABLE_TRAINING
+  phases.push_back("prepacking");
+#endif
+  for (const auto& phase : phases) {
+    EXPECT_NE(contents.find("\"name\" :\"" + phase + "\""), std::string::npos) << phase;
+  }
+}
+
+// X[2,4] -> MatMul(W0) -> MatMul(W1) -> MatMul(W0) -> MatMul(W1) -> Y, with W0 and W1 pre-packed by each of their
+// two consumers before they are released.
+static void CreatePrePackedMatMulChainModel(std::unique_ptr<onnxruntime::Model>& p_model) {
+  std::unordered_map<std::string, int> domain_to_version = {{kOnnxDomain, 12}};
+  p_model = std::make_unique<Model>("test", true, ModelMetaData(), PathString(),
+                                    IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+                                    std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                                    DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = p_model->MainGraph();
+
+  TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(4);
+
+  for (int w = 0; w < 2; ++w) {
+    TensorProto weight;
+    weight.set_name("W" + std::to_string(w));
+    weight.add_dims(4);
+    weight.add_dims(4);
+    weight.set_data_type(TensorProto_DataType_FLOAT);
+    for (int i = 0; i < 16; ++i) {
+      weight.add_float_data(static_cast<float>((i * (w + 3)) % 7 - 3) * 0.25f);
+    }
+    graph.AddInitializedTensor(weight);
+  }
+
+  auto* input = &graph.GetOrCreateNodeArg("X", &float_tensor);
+  for (int i = 0; i < 4; ++i) {
+    auto& weight = graph.GetOrCreateNodeArg("W" + std::to_string(i % 2), nullptr);
+    auto& output = graph.GetOrCreateNodeArg(i == 3 ? "Y" : "T" + std::to_string(i), i == 3 ? &float_tensor : nullptr);
+    graph.AddNode("matmul_" + std::to_string(i), "MatMul", "", {input, &weight}, {&output});
+    input = &output;
+  }
+
+  ASSERT_STATUS_OK(graph.Resolve());
+}
+
+// The parallel initialization pre-packs and releases the same weights as the sequential one.
+TEST(InferenceSessionTests, ParallelInitializationMatchesSequential) {
+  std::unique_ptr<onnxruntime::Model> p_model;
+  CreatePrePackedMatMulChainModel(p_model);
+  std::string model_data;
+  p_model->ToProto().SerializeToString(&model_data);
+
+  std::vector<float> x_values = {1.0f, -2.0f, 0.5f, 3.0f, -1.5f, 2.0f, 0.0f, -0.5f};
+  OrtValue x;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {2, 4}, x_values, &x);
+
+  size_t prepacks[2] = {0, 0};
+  std::vector<float> outputs[2];
+  for (int parallel = 0; parallel < 2; ++parallel) {
+    SessionOptions so;
+    so.session_logid = "ParallelInitializationMatchesSequential";
+    ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigParallelInitialization,
+                                                      parallel ? "1" : "0"));
+    InferenceSessionWrapper session_object{so, GetEnvironment()};
+    std::stringstream model_stream(model_data);
+    ASSERT_STATUS_OK(session_object.Load(model_stream));
+    ASSERT_STATUS_OK(session_object.Initialize());
+
+    const SessionState& session_state = session_object.GetSessionState();
+    prepacks[parallel] = session_state.GetNumberOfPrepacksCounter();
+#ifndef ENABLE_TRAINING
+    // both consumers packed the weights, which are then released
+    EXPECT_EQ(session_state.GetConstantInitializedTensors().size(), size_t{0});
+#endif
+
+    NameMLValMap feeds = {{"X", x}};
+    std::vector<OrtValue> fetches;
+    ASSERT_STATUS_OK(session_object.Run(RunOptions(), feeds, {"Y"}, &fetches));
+    const Tensor& y = fetches[0].Get<Tensor>();
+    ASSERT_EQ(y.Shape(), TensorShape({2, 4}));
+    outputs[parallel].assign(y.Data<float>(), y.Data<float>() + y.Shape().Size());
+  }
+
+#ifndef ENABLE_TRAINING
+  EXPECT_EQ(prepacks[0], size_t{4});
+#endif
+  EXPECT_EQ(prepacks[1], prepacks[0]);
+  EXPECT_EQ(outputs[1], outputs[0]);
+}
+
 TEST(InferenceSessionTests, CheckRunProfilerWithStartProfile) {
   SessionOptions so;
 
@@ -735,6 +975,104 @@ TEST(InferenceSessionTests, CheckRunProfilerStartTime) {
   ASSERT_TRUE(before_start_time <= profiling_start_time && profiling_start_time <= after_start_time);
 }
 
+TEST(InferenceSessionTests, CheckNodeStats) {
+  SessionOptions so;
+  so.session_logid = "CheckNodeStats";
+
+  {
+    // not enabled by default
+    InferenceSession session_object(so, GetEnvironment());
+    ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+    ASSERT_STATUS_OK(session_object.Initialize());
+
+    std::string node_stats;
+    ASSERT_FALSE(session_object.GetNodeStats(node_stats).IsOK());
+  }
+
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigEnableNodeStats, "1"));
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  constexpr int kNumRuns = 3;
+  for (int i = 0; i < kNumRuns; ++i) {
+    RunModel(session_object, run_options);
+  }
+
+  auto report = profiling::CollectNodeStats(session_object.GetSessionState());
+  ASSERT_EQ(report.per_node.size(), 1u);
+  const auto& node_entry = report.per_node.begin()->second;
+  EXPECT_EQ(report.per_node.begin()->first, "mul_1");
+  EXPECT_EQ(node_entry.op_type, "Mul");
+  EXPECT_EQ(node_entry.latency.count, static_cast<uint64_t>(kNumRuns));
+  EXPECT_LE(node_entry.latency.min, node_entry.latency.Percentile(50));
+  EXPECT_LE(node_entry.latency.Percentile(50), node_entry.latency.max);
+  // Mul of two 3x2 float tensors
+  EXPECT_EQ(node_entry.input_bytes, static_cast<uint64_t>(kNumRuns * 2 * 6 * sizeof(float)));
+  EXPECT_EQ(node_entry.output_bytes, static_cast<uint64_t>(kNumRuns * 6 * sizeof(float)));
+
+  ASSERT_EQ(report.per_op_type.size(), 1u);
+  EXPECT_EQ(report.per_op_type.at("Mul").num_nodes, 1u);
+
+  std::string node_stats;
+  ASSERT_STATUS_OK(session_object.GetNodeStats(node_stats));
+  EXPECT_NE(node_stats.find("\"name\":\"mul_1\""), std::string::npos);
+  EXPECT_NE(node_stats.find("\"p99_us\""), std::string::npos);
+
+  ASSERT_STATUS_OK(session_object.ResetNodeStats());
+  report = profiling::CollectNodeStats(session_object.GetSessionState());
+  EXPECT_EQ(report.per_node.at("mul_1").latency.count, 0u);
+}
+
+TEST(InferenceSessionTests, CheckCalibrationStats) {
+  SessionOptions so;
+  so.session_logid = "CheckCalibrationStats";
+
+  {
+    // not collected by default
+    InferenceSession session_object(so, GetEnvironment());
+    ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+    ASSERT_STATUS_OK(session_object.Initialize());
+
+    std::map<std::string, CalibrationCollector::TensorStats> stats;
+    ASSERT_FALSE(session_object.GetCalibrationStats(stats).IsOK());
+  }
+
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigCalibrationTensors, "*"));
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigCalibrationHistogramBins, "4"));
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  constexpr uint64_t kNumRuns = 3;
+  for (uint64_t i = 0; i < kNumRuns; ++i) {
+    RunModel(session_object, run_options);
+  }
+
+  // Y = X * X with X = {1, 2, 3, 4, 5, 6}, the histograms have bins of width threshold / 2
+  std::map<std::string, CalibrationCollector::TensorStats> stats;
+  ASSERT_STATUS_OK(session_object.GetCalibrationStats(stats));
+  ASSERT_EQ(stats.size(), 2u);
+
+  const auto& x_stats = stats.at("X");
+  EXPECT_EQ(x_stats.count, 6 * kNumRuns);
+  EXPECT_EQ(x_stats.min, 1.0f);
+  EXPECT_EQ(x_stats.max, 6.0f);
+  EXPECT_EQ(x_stats.threshold, 6.0f);
+  EXPECT_EQ(x_stats.histogram, (std::vector<uint64_t>{0, 0, 2 * kNumRuns, 4 * kNumRuns}));
+
+  const auto& y_stats = stats.at("Y");
+  EXPECT_EQ(y_stats.min, 1.0f);
+  EXPECT_EQ(y_stats.max, 36.0f);
+  EXPECT_EQ(y_stats.histogram, (std::vector<uint64_t>{0, 0, 4 * kNumRuns, 2 * kNumRuns}));
+
+  ASSERT_STATUS_OK(session_object.ResetCalibrationStats());
+  ASSERT_STATUS_OK(session_object.GetCalibrationStats(stats));
+  EXPECT_TRUE(stats.empty());
+}
+
 TEST(InferenceSessionTests, MultipleSessionsNoTimeout) {
   SessionOptions session_options;
 
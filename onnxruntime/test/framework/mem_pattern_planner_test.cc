@@ -1,7 +1,11 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
+#include <random>
+
 #include "core/framework/mem_pattern_planner.h"
+#include "core/framework/mem_pattern_offset_planner.h"
 #include "gtest/gtest.h"
 
 namespace onnxruntime {
@@ -35,5 +39,134 @@ TEST(MemPatternPlannerTest, TraceAllocaitonTest) {
   EXPECT_EQ(pattern.GetBlock(5)->offset_, 1024u + 256u + 512u);
   EXPECT_EQ(pattern.GetBlock(6)->offset_, 1024u);
 }
+
+TEST(MemPatternPlannerTest, OffsetPlanningStrategies) {
+  // placing in trace order leaves the gap of block 0 unused as block 2 does not fit in it.
+  auto trace = [](MemPatternPlanner& planner) {
+    planner.TraceAllocation(0, 100);
+    planner.TraceAllocation(1, 50);
+    planner.TraceFree(0);
+    planner.TraceAllocation(2, 150);
+  };
+
+  MemPatternPlanner trace_order_planner{false};
+  trace(trace_order_planner);
+  auto pattern = trace_order_planner.GenerateMemPattern();
+  EXPECT_EQ(pattern.PeakSize(), 300u);
+  EXPECT_EQ(pattern.TracedPeakSize(), 300u);
+  EXPECT_EQ(pattern.PlannedPeakSize(), 300u);
+
+  for (auto strategy : {MemPatternStrategy::kGreedyBySize, MemPatternStrategy::kGreedyByBreadth,
+                        MemPatternStrategy::kMinPeak}) {
+    MemPatternPlanner planner{false, strategy};
+    trace(planner);
+    pattern = planner.GenerateMemPattern();
+    EXPECT_EQ(pattern.PeakSize(), 200u);
+    EXPECT_EQ(pattern.TracedPeakSize(), 300u);
+    EXPECT_EQ(pattern.PlannedPeakSize(), 200u);
+    // block 2 reuses the memory of block 0 and block 1 is live with both
+    EXPECT_EQ(pattern.GetBlock(2)->offset_, 0u);
+    EXPECT_EQ(pattern.GetBlock(0)->offset_, 0u);
+    EXPECT_EQ(pattern.GetBlock(1)->offset_, 150u);
+  }
+
+  // the trace order layout is kept when planning does not improve it
+  MemPatternPlanner planner{false, MemPatternStrategy::kGreedyBySize};
+  planner.TraceAllocation(0, 64);
+  planner.TraceAllocation(1, 128);
+  pattern = planner.GenerateMemPattern();
+  EXPECT_EQ(pattern.PeakSize(), 192u);
+  EXPECT_EQ(pattern.TracedPeakSize(), 192u);
+  EXPECT_EQ(pattern.PlannedPeakSize(), 192u);
+  EXPECT_EQ(pattern.GetBlock(0)->offset_, 0u);
+  EXPECT_EQ(pattern.GetBlock(1)->offset_, 64u);
+}
+
+TEST(MemPatternPlannerTest, PlannedPeakNotAboveTracedPeak) {
+  // in trace order block 3 can't use the gap of blocks 0 and 2, which are freed before it is allocated, as block 1
+  // is still live at offset 64. the largest total size of the blocks live at the same time is 192, for blocks 3 and 4.
+  auto trace = [](MemPatternPlanner& planner) {
+    planner.TraceAllocation(0, 64);
+    planner.TraceAllocation(1, 32);
+    planner.TraceAllocation(2, 64);
+    planner.TraceFree(0);
+    planner.TraceFree(2);
+    planner.TraceAllocation(3, 128);
+    planner.TraceFree(1);
+    planner.TraceAllocation(4, 64);
+    planner.TraceFree(3);
+    planner.TraceFree(4);
+  };
+
+  MemPatternPlanner trace_order_planner{false};
+  trace(trace_order_planner);
+  const size_t traced_peak_size = trace_order_planner.GenerateMemPattern().PeakSize();
+  EXPECT_EQ(traced_peak_size, 224u);
+
+  for (auto strategy : {MemPatternStrategy::kGreedyBySize, MemPatternStrategy::kGreedyByBreadth,
+                        MemPatternStrategy::kMinPeak}) {
+    MemPatternPlanner planner{false, strategy};
+    trace(planner);
+    const auto pattern = planner.GenerateMemPattern();
+    EXPECT_EQ(pattern.TracedPeakSize(), traced_peak_size);
+    EXPECT_LE(pattern.PlannedPeakSize(), traced_peak_size);
+    EXPECT_GE(pattern.PlannedPeakSize(), 192u);
+    EXPECT_EQ(pattern.PeakSize(), std::min(pattern.PlannedPeakSize(), pattern.TracedPeakSize()));
+  }
+}
+
+TEST(MemPatternPlannerTest, PlanMemoryOffsetsNoOverlap) {
+  std::default_random_engine random{42};
+  std::uniform_int_distribution<size_t> size_distribution{1, 64};
+  std::uniform_int_distribution<size_t> lifetime_distribution{1, 20};
+
+  std::vector<MemoryBlockLifetime> blocks;
+  for (size_t time = 0; time < 200; ++time) {
+    blocks.push_back({size_distribution(random) * 64, time, time + lifetime_distribution(random)});
+  }
+  // a zero sized block and one that is never freed
+  blocks.push_back({0, 10, 20});
+  blocks.push_back({4096, 50});
+
+  // the peak can't be lower than the largest total size of the blocks live at the same time
+  size_t max_breadth = 0;
+  for (const auto& block : blocks) {
+    size_t breadth = 0;
+    for (const auto& other : blocks) {
+      if (other.alloc_time <= block.alloc_time && block.alloc_time < other.free_time) {
+        breadth += other.size;
+      }
+    }
+    max_breadth = std::max(max_breadth, breadth);
+  }
+
+  for (auto strategy : {MemPatternStrategy::kGreedyBySize, MemPatternStrategy::kGreedyByBreadth,
+                        MemPatternStrategy::kMinPeak}) {
+    std::vector<size_t> offsets;
+    const size_t peak_size = PlanMemoryOffsets(blocks, strategy, offsets);
+    ASSERT_EQ(offsets.size(), blocks.size());
+    EXPECT_GE(peak_size, max_breadth);
+
+    for (size_t i = 0; i < blocks.size(); ++i) {
+      EXPECT_LE(offsets[i] + blocks[i].size, peak_size);
+      for (size_t j = i + 1; j < blocks.size(); ++j) {
+        if (blocks[i].size == 0 || blocks[j].size == 0 || !blocks[i].Overlaps(blocks[j])) {
+          continue;
+        }
+        EXPECT_TRUE(offsets[i] + blocks[i].size <= offsets[j] || offsets[j] + blocks[j].size <= offsets[i])
+            << "blocks " << i << " and " << j << " overlap";
+      }
+    }
+  }
+}
+
+TEST(MemPatternPlannerTest, ParseMemPatternStrategy) {
+  MemPatternStrategy strategy;
+  ASSERT_TRUE(ParseMemPatternStrategy("greedy_by_breadth", strategy).IsOK());
+  EXPECT_EQ(strategy, MemPatternStrategy::kGreedyByBreadth);
+  ASSERT_TRUE(ParseMemPatternStrategy("trace", strategy).IsOK());
+  EXPECT_EQ(strategy, MemPatternStrategy::kTraceOrder);
+  EXPECT_FALSE(ParseMemPatternStrategy("best_fit", strategy).IsOK());
+}
 }  // namespace test
 }  // namespace onnxruntime
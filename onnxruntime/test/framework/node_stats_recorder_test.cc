@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "core/framework/node_stats_recorder.h"
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+using profiling::LatencyHistogram;
+
+TEST(LatencyHistogramTest, BucketBoundaries) {
+  // small values are exact
+  for (uint64_t v = 0; v < 2 * LatencyHistogram::kSubBucketCount; ++v) {
+    EXPECT_EQ(LatencyHistogram::BucketIndex(v), v);
+    EXPECT_EQ(LatencyHistogram::BucketLowerBound(v), v);
+  }
+
+  // every bucket lower bound maps back to its own bucket and buckets are contiguous
+  for (size_t i = 1; i < LatencyHistogram::kNumBuckets; ++i) {
+    const uint64_t lower = LatencyHistogram::BucketLowerBound(i);
+    EXPECT_EQ(LatencyHistogram::BucketIndex(lower), i);
+    EXPECT_EQ(LatencyHistogram::BucketIndex(lower - 1), i - 1);
+  }
+
+  // out of range values are clamped into the last bucket
+  EXPECT_EQ(LatencyHistogram::BucketIndex(std::numeric_limits<uint64_t>::max()), LatencyHistogram::kNumBuckets - 1);
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+  LatencyHistogram histogram;
+  for (uint64_t v = 1; v <= 10000; ++v) {
+    histogram.Record(v * 1000);
+  }
+
+  const auto snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(snapshot.count, 10000u);
+  EXPECT_EQ(snapshot.min, 1000u);
+  EXPECT_EQ(snapshot.max, 10000000u);
+  EXPECT_DOUBLE_EQ(snapshot.Mean(), 5000500.0);
+
+  // buckets have 1/16 relative width
+  auto expect_near_relative = [](uint64_t actual, double expected) {
+    EXPECT_NEAR(static_cast<double>(actual), expected, expected / 16);
+  };
+  expect_near_relative(snapshot.Percentile(50), 5000000.0);
+  expect_near_relative(snapshot.Percentile(99), 9900000.0);
+  expect_near_relative(snapshot.Percentile(0), 1000.0);
+  EXPECT_EQ(snapshot.Percentile(100), snapshot.max);
+
+  histogram.Reset();
+  EXPECT_EQ(histogram.GetSnapshot().count, 0u);
+  EXPECT_EQ(histogram.GetSnapshot().Percentile(50), 0u);
+}
+
+TEST(LatencyHistogramTest, MergeSnapshots) {
+  LatencyHistogram a;
+  LatencyHistogram b;
+  a.Record(10);
+  a.Record(20);
+  b.Record(5000);
+
+  auto merged = a.GetSnapshot();
+  merged.Merge(b.GetSnapshot());
+  EXPECT_EQ(merged.count, 3u);
+  EXPECT_EQ(merged.sum, 5030u);
+  EXPECT_EQ(merged.min, 10u);
+  EXPECT_EQ(merged.max, 5000u);
+  EXPECT_EQ(merged.Percentile(50), 20u);
+}
+
+TEST(LatencyHistogramTest, ConcurrentRecord) {
+  LatencyHistogram histogram;
+  constexpr int kNumThreads = 4;
+  constexpr int kNumRecordsPerThread = 10000;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&histogram, t]() {
+      for (int i = 0; i < kNumRecordsPerThread; ++i) {
+        histogram.Record(static_cast<uint64_t>(t * kNumRecordsPerThread + i));
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(snapshot.count, static_cast<uint64_t>(kNumThreads * kNumRecordsPerThread));
+  EXPECT_EQ(snapshot.min, 0u);
+  EXPECT_EQ(snapshot.max, static_cast<uint64_t>(kNumThreads * kNumRecordsPerThread - 1));
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -0,0 +1,249 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "core/framework/session_state.h"
+#include "core/framework/symbolic_dim_expression.h"
+#include "core/graph/model.h"
+#include "core/session/inference_session.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "test/framework/test_utils.h"
+#include "test/test_environment.h"
+#include "test/util/include/asserts.h"
+#include "test/util/include/inference_session_wrapper.h"
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+static int64_t Evaluate(const std::string& dim_param, const std::vector<int64_t>& symbol_values) {
+  const InlinedHashMap<std::string, size_t> symbol_indices = {{"batch", 0}, {"seq", 1}, {"past seq", 2}};
+  SymbolicDimExpression expression;
+  const auto status = SymbolicDimExpression::Parse(dim_param, symbol_indices, expression);
+  EXPECT_TRUE(status.IsOK()) << status.ErrorMessage();
+  int64_t value = -1;
+  EXPECT_STATUS_OK(expression.Evaluate(symbol_values, value));
+  return value;
+}
+
+// The expressions written by symbolic_shape_infer.py, with the semantics of sympy and the Python operators.
+TEST(SymbolicDimExpressionTest, Evaluate) {
+  const std::vector<int64_t> values = {3, 5, 7};
+  EXPECT_EQ(Evaluate("seq", values), 5);
+  EXPECT_EQ(Evaluate("past seq", values), 7);
+  EXPECT_EQ(Evaluate("2*seq + 1", values), 11);
+  EXPECT_EQ(Evaluate("batch*(seq - 1)", values), 12);
+  EXPECT_EQ(Evaluate("floor(seq/2)", values), 2);
+  EXPECT_EQ(Evaluate("ceiling(seq/2)", values), 3);
+  EXPECT_EQ(Evaluate("seq//2", values), 2);
+  EXPECT_EQ(Evaluate("-seq//2", values), -3);
+  EXPECT_EQ(Evaluate("Mod(seq, 3)", values), 2);
+  EXPECT_EQ(Evaluate("seq % -3", values), -1);
+  EXPECT_EQ(Evaluate("seq**2", values), 25);
+  EXPECT_EQ(Evaluate("-seq**2", values), -25);
+  EXPECT_EQ(Evaluate("Max(batch, seq, 4) - Min(batch, 2)", values), 3);
+  EXPECT_EQ(Evaluate("(batch + 1)*(seq - 1)/4", values), 4);
+}
+
+TEST(SymbolicDimExpressionTest, Invalid) {
+  const InlinedHashMap<std::string, size_t> symbol_indices = {{"seq", 0}};
+  SymbolicDimExpression expression;
+  EXPECT_FALSE(SymbolicDimExpression::Parse("unk + 1", symbol_indices, expression).IsOK());
+  EXPECT_FALSE(SymbolicDimExpression::Parse("2*", symbol_indices, expression).IsOK());
+  EXPECT_FALSE(SymbolicDimExpression::Parse("(seq + 1", symbol_indices, expression).IsOK());
+  EXPECT_FALSE(SymbolicDimExpression::Parse("floor(seq, 2)", symbol_indices, expression).IsOK());
+  EXPECT_FALSE(SymbolicDimExpression::Parse("sqrt(seq)", symbol_indices, expression).IsOK());
+
+  // not an integer
+  ASSERT_STATUS_OK(SymbolicDimExpression::Parse("seq/2", symbol_indices, expression));
+  int64_t value;
+  EXPECT_FALSE(expression.Evaluate(std::vector<int64_t>{5}, value).IsOK());
+  EXPECT_STATUS_OK(expression.Evaluate(std::vector<int64_t>{6}, value));
+  EXPECT_EQ(value, 3);
+}
+
+// X[batch, seq] -> Concat(X, X) -> C[batch, 2*seq] -> Abs -> Neg -> Add(C) -> Y
+static void CreateConcatModel(std::unique_ptr<Model>& p_model) {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 13;
+  p_model = std::make_unique<Model>("test", true, ModelMetaData(), PathString(),
+                                    IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+                                    std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                                    DefaultLoggingManager().DefaultLogger());
+  Graph& graph = p_model->MainGraph();
+
+  auto make_type = [](const char* dim_param) {
+    ONNX_NAMESPACE::TypeProto type;
+    type.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("batch");
+    type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param(dim_param);
+    return type;
+  };
+  const auto input_type = make_type("seq");
+  const auto concat_type = make_type("2*seq");
+
+  auto& x = graph.GetOrCreateNodeArg("X", &input_type);
+  auto& c = graph.GetOrCreateNodeArg("C", &concat_type);
+  auto& a = graph.GetOrCreateNodeArg("A", nullptr);
+  auto& n = graph.GetOrCreateNodeArg("N", nullptr);
+  auto& y = graph.GetOrCreateNodeArg("Y", &concat_type);
+
+  graph.AddNode("concat", "Concat", "", {&x, &x}, {&c}).AddAttribute("axis", int64_t{1});
+  graph.AddNode("abs", "Abs", "", {&c}, {&a});
+  graph.AddNode("neg", "Neg", "", {&a}, {&n});
+  graph.AddNode("add", "Add", "", {&n, &c}, {&y});
+  ASSERT_STATUS_OK(graph.Resolve());
+}
+
+static OrtValue CreateInput(int64_t batch, int64_t seq) {
+  std::vector<float> values(static_cast<size_t>(batch * seq));
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<float>(i) - 2.0f;
+  }
+
+  OrtValue value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {batch, seq}, values,
+                       &value);
+  return value;
+}
+
+// The pattern is available before any Run, with the block of C sized for the shape of the feed.
+TEST(SymbolicMemoryPlanTest, PatternForAnySequenceLength) {
+  SessionOptions so;
+  so.graph_optimization_level = TransformerLevel::Default;
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigSymbolicMemoryPattern, "1"));
+  InferenceSessionWrapper session{so, GetEnvironment()};
+
+  std::unique_ptr<Model> p_model;
+  CreateConcatModel(p_model);
+  std::string model_data;
+  p_model->ToProto().SerializeToString(&model_data);
+  std::stringstream model_stream(model_data);
+  ASSERT_STATUS_OK(session.Load(model_stream));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  const SessionState& session_state = session.GetSessionState();
+  int x_idx = -1;
+  int c_idx = -1;
+  ASSERT_STATUS_OK(session_state.GetOrtValueNameIdxMap().GetIdx("X", x_idx));
+  ASSERT_STATUS_OK(session_state.GetOrtValueNameIdxMap().GetIdx("C", c_idx));
+  const OrtMemoryInfo& cpu_info = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault)->Info();
+
+  for (int64_t seq : {3, 40, 17}) {
+    const std::vector<OrtValue> feeds = {CreateInput(2, seq)};
+    const std::vector<int> feed_idxs = {x_idx};
+    const InlinedHashMap<int, TensorShape>* inferred_shapes = nullptr;
+    const MemoryPatternGroup* group = session_state.GetMemoryPatternGroup(feeds, feed_idxs, inferred_shapes);
+    ASSERT_NE(group, nullptr);
+    const MemoryPattern* pattern = group->GetPatterns(cpu_info);
+    ASSERT_NE(pattern, nullptr);
+
+    size_t c_size = 0;
+    ASSERT_TRUE(IAllocator::CalcMemSizeForArrayWithAlignment<kAllocAlignment>(static_cast<size_t>(2 * 2 * seq),
+                                                                              sizeof(float), &c_size));
+    const MemoryBlock* c_block = pattern->GetBlock(c_idx);
+    ASSERT_NE(c_block, nullptr);
+    EXPECT_EQ(c_block->size_, c_size);
+    EXPECT_GE(pattern->PeakSize(), c_block->offset_ + c_block->size_);
+
+    // the output isn't in the pattern
+    int y_idx = -1;
+    ASSERT_STATUS_OK(session_state.GetOrtValueNameIdxMap().GetIdx("Y", y_idx));
+    EXPECT_EQ(pattern->GetBlock(y_idx), nullptr);
+
+    NameMLValMap run_feeds = {{"X", feeds[0]}};
+    std::vector<OrtValue> fetches;
+    ASSERT_STATUS_OK(session.Run(RunOptions(), run_feeds, {"Y"}, &fetches));
+    const Tensor& output = fetches[0].Get<Tensor>();
+    ASSERT_EQ(output.Shape(), TensorShape({2, 2 * seq}));
+    // Add(-Abs(c), c) is 0 for the positive values and 2c for the negative ones
+    const auto* input_data = feeds[0].Get<Tensor>().Data<float>();
+    const auto* output_data = output.Data<float>();
+    for (int64_t b = 0; b < 2; ++b) {
+      for (int64_t j = 0; j < 2 * seq; ++j) {
+        const float c_value = input_data[b * seq + j % seq];
+        EXPECT_EQ(output_data[b * 2 * seq + j], c_value < 0.0f ? 2.0f * c_value : 0.0f);
+      }
+    }
+  }
+}
+
+// X[batch, seq] -> Concat(X, X) -> C -> Neg -> Expand(Shape(C)) -> E -> Add(C) -> Y
+// The shape of E is unknown as the shape it is expanded to isn't a constant.
+static void CreateExpandModel(std::unique_ptr<Model>& p_model) {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 13;
+  p_model = std::make_unique<Model>("test", true, ModelMetaData(), PathString(),
+                                    IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+                                    std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                                    DefaultLoggingManager().DefaultLogger());
+  Graph& graph = p_model->MainGraph();
+
+  ONNX_NAMESPACE::TypeProto input_type;
+  input_type.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("batch");
+  input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_param("seq");
+
+  auto& x = graph.GetOrCreateNodeArg("X", &input_type);
+  auto& c = graph.GetOrCreateNodeArg("C", nullptr);
+  auto& n = graph.GetOrCreateNodeArg("N", nullptr);
+  auto& s = graph.GetOrCreateNodeArg("S", nullptr);
+  auto& e = graph.GetOrCreateNodeArg("E", nullptr);
+  auto& y = graph.GetOrCreateNodeArg("Y", nullptr);
+
+  graph.AddNode("concat", "Concat", "", {&x, &x}, {&c}).AddAttribute("axis", int64_t{1});
+  graph.AddNode("neg", "Neg", "", {&c}, {&n});
+  graph.AddNode("shape", "Shape", "", {&c}, {&s});
+  graph.AddNode("expand", "Expand", "", {&n, &s}, {&e});
+  graph.AddNode("add", "Add", "", {&e, &c}, {&y});
+  ASSERT_STATUS_OK(graph.Resolve());
+}
+
+// An activation the symbolic plan can't size would never be in a pattern generated by the plan, so the patterns
+// are traced as without the option and the traced pattern holds it.
+TEST(SymbolicMemoryPlanTest, TracedIfAnActivationIsNotPlanned) {
+  SessionOptions so;
+  so.graph_optimization_level = TransformerLevel::Default;
+  ASSERT_STATUS_OK(so.config_options.AddConfigEntry(kOrtSessionOptionsConfigSymbolicMemoryPattern, "1"));
+  InferenceSessionWrapper session{so, GetEnvironment()};
+
+  std::unique_ptr<Model> p_model;
+  CreateExpandModel(p_model);
+  std::string model_data;
+  p_model->ToProto().SerializeToString(&model_data);
+  std::stringstream model_stream(model_data);
+  ASSERT_STATUS_OK(session.Load(model_stream));
+  ASSERT_STATUS_OK(session.Initialize());
+
+  const SessionState& session_state = session.GetSessionState();
+  int x_idx = -1;
+  int e_idx = -1;
+  ASSERT_STATUS_OK(session_state.GetOrtValueNameIdxMap().GetIdx("X", x_idx));
+  ASSERT_STATUS_OK(session_state.GetOrtValueNameIdxMap().GetIdx("E", e_idx));
+  const std::vector<OrtValue> feeds = {CreateInput(2, 5)};
+  const std::vector<int> feed_idxs = {x_idx};
+  const InlinedHashMap<int, TensorShape>* inferred_shapes = nullptr;
+
+#if !defined(ENABLE_TRAINING)
+  // no pattern before the first Run
+  EXPECT_EQ(session_state.GetMemoryPatternGroup(feeds, feed_idxs, inferred_shapes), nullptr);
+#endif
+
+  NameMLValMap run_feeds = {{"X", feeds[0]}};
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session.Run(RunOptions(), run_feeds, {"Y"}, &fetches));
+  ASSERT_EQ(fetches[0].Get<Tensor>().Shape(), TensorShape({2, 10}));
+
+  const MemoryPatternGroup* group = session_state.GetMemoryPatternGroup(feeds, feed_idxs, inferred_shapes);
+  ASSERT_NE(group, nullptr);
+  const MemoryPattern* pattern =
+      group->GetPatterns(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault)->Info());
+  ASSERT_NE(pattern, nullptr);
+  EXPECT_NE(pattern->GetBlock(e_idx), nullptr);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
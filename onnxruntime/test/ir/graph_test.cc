@@ -2115,5 +2115,114 @@ TEST_F(GraphTest, SubgraphOutputIsOuterScopeValue) {
               ::testing::ContainsRegex("Subgraph output \\(.*\\) is an outer scope value being returned directly."));
 }
 
+// Resolve only runs the type and shape inferencing of the nodes which changed, or whose inputs changed.
+TEST_F(GraphTest, IncrementalTypeAndShapeInference) {
+  Model model("graph", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  tensor_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  tensor_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+
+  // x -> Relu -> a -> Sigmoid -> b -> Neg -> y
+  auto& x = graph.GetOrCreateNodeArg("x", &tensor_float);
+  auto& a = graph.GetOrCreateNodeArg("a", nullptr);
+  auto& b = graph.GetOrCreateNodeArg("b", nullptr);
+  auto& y = graph.GetOrCreateNodeArg("y", nullptr);
+  auto& relu = graph.AddNode("relu", "Relu", "", {&x}, {&a});
+  auto& sigmoid = graph.AddNode("sigmoid", "Sigmoid", "", {&a}, {&b});
+  auto& neg = graph.AddNode("neg", "Neg", "", {&b}, {&y});
+  graph.SetIncrementalResolve(true);
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  const int first_resolve = graph.NumResolves();
+  EXPECT_EQ(relu.LastInferencingResolve(), first_resolve);
+  EXPECT_EQ(sigmoid.LastInferencingResolve(), first_resolve);
+  EXPECT_EQ(neg.LastInferencingResolve(), first_resolve);
+  ASSERT_NE(y.Shape(), nullptr);
+  EXPECT_EQ(y.Shape()->dim_size(), 2);
+
+  // nothing changed
+  graph.SetGraphResolveNeeded();
+  ASSERT_STATUS_OK(graph.Resolve());
+  EXPECT_GT(graph.NumResolves(), first_resolve);
+  EXPECT_EQ(relu.LastInferencingResolve(), first_resolve);
+  EXPECT_EQ(sigmoid.LastInferencingResolve(), first_resolve);
+  EXPECT_EQ(neg.LastInferencingResolve(), first_resolve);
+
+  // Sigmoid consumes another value of the same type and shape, so its output doesn't change
+  auto& x2 = graph.GetOrCreateNodeArg("x2", &tensor_float);
+  sigmoid.MutableInputDefs()[0] = &x2;
+  graph.SetGraphResolveNeeded();
+  ASSERT_STATUS_OK(graph.Resolve());
+  EXPECT_EQ(relu.LastInferencingResolve(), first_resolve);
+  EXPECT_EQ(sigmoid.LastInferencingResolve(), graph.NumResolves());
+  EXPECT_EQ(neg.LastInferencingResolve(), first_resolve);
+
+  // a new shape for the output of Sigmoid is propagated to Neg
+  y.ClearShape();
+  b.ClearShape();
+  graph.SetGraphResolveNeeded();
+  ASSERT_STATUS_OK(graph.Resolve());
+  EXPECT_EQ(relu.LastInferencingResolve(), first_resolve);
+  EXPECT_EQ(sigmoid.LastInferencingResolve(), graph.NumResolves());
+  EXPECT_EQ(neg.LastInferencingResolve(), graph.NumResolves());
+  ASSERT_NE(y.Shape(), nullptr);
+  EXPECT_EQ(y.Shape()->dim_size(), 2);
+}
+
+TEST_F(GraphTest, RemoveNodeArg) {
+  Model model("graph", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  auto& x = graph.GetOrCreateNodeArg("x", &tensor_float);
+  auto& a = graph.GetOrCreateNodeArg("a", &tensor_float);
+  auto& y = graph.GetOrCreateNodeArg("y", &tensor_float);
+  graph.AddNode("relu", "Relu", "", {&x}, {&a});
+  graph.AddNode("neg", "Neg", "", {&a}, {&y});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  // the output of a node added then removed
+  auto& b = graph.GetOrCreateNodeArg("b", &tensor_float);
+  auto& sigmoid = graph.AddNode("sigmoid", "Sigmoid", "", {&a}, {&b});
+  EXPECT_FALSE(graph.RemoveNodeArg("b"));
+  graph.RemoveNode(sigmoid.Index());
+  EXPECT_TRUE(graph.RemoveNodeArg("b"));
+  EXPECT_EQ(graph.GetNodeArg("b"), nullptr);
+  EXPECT_FALSE(graph.RemoveNodeArg("b"));
+
+  // still used, or an input or output of the graph
+  EXPECT_FALSE(graph.RemoveNodeArg("a"));
+  EXPECT_FALSE(graph.RemoveNodeArg("x"));
+  EXPECT_FALSE(graph.RemoveNodeArg("y"));
+  EXPECT_NE(graph.GetNodeArg("a"), nullptr);
+  ASSERT_STATUS_OK(graph.Resolve());
+}
+
+TEST_F(GraphTest, NonIncrementalTypeAndShapeInferenceByDefault) {
+  Model model("graph", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  auto& x = graph.GetOrCreateNodeArg("x", &tensor_float);
+  auto& a = graph.GetOrCreateNodeArg("a", nullptr);
+  auto& y = graph.GetOrCreateNodeArg("y", nullptr);
+  auto& relu = graph.AddNode("relu", "Relu", "", {&x}, {&a});
+  auto& neg = graph.AddNode("neg", "Neg", "", {&a}, {&y});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  // every node is inferred and verified again even if nothing changed
+  graph.SetGraphResolveNeeded();
+  ASSERT_STATUS_OK(graph.Resolve());
+  EXPECT_EQ(relu.LastInferencingResolve(), graph.NumResolves());
+  EXPECT_EQ(neg.LastInferencingResolve(), graph.NumResolves());
+}
+
 }  // namespace test
 }  // namespace onnxruntime
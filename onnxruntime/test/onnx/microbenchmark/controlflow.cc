@@ -0,0 +1,246 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <benchmark/benchmark.h>
+#include <core/graph/onnx_protobuf.h>
+#include <core/session/onnxruntime_c_api.h>
+
+#include <string>
+#include <vector>
+
+extern OrtEnv* env;
+extern const OrtApi* g_ort;
+
+using namespace ONNX_NAMESPACE;
+
+#define ORT_BREAK_ON_ERROR(expr)                                \
+  do {                                                          \
+    OrtStatus* onnx_status = (expr);                            \
+    if (onnx_status != NULL) {                                  \
+      state.SkipWithError(g_ort->GetErrorMessage(onnx_status)); \
+      g_ort->ReleaseStatus(onnx_status);                        \
+      return;                                                   \
+    }                                                           \
+  } while (0);
+
+static void AddValueInfo(RepeatedPtrField<ValueInfoProto>* values, const std::string& name,
+                         const std::vector<int64_t>& dims) {
+  auto* value = values->Add();
+  value->set_name(name);
+  auto* tensor_type = value->mutable_type()->mutable_tensor_type();
+  tensor_type->set_elem_type(TensorProto_DataType_FLOAT);
+  auto* shape = tensor_type->mutable_shape();
+  for (auto dim : dims) {
+    shape->add_dim()->set_dim_value(dim);
+  }
+}
+
+// Scan with a trivial body that adds each element of the sequence to the loop state and also outputs the new state.
+// The per-iteration cost of executing the subgraph dominates.
+static std::string CreateScanModel(int64_t seq_len) {
+  ModelProto model;
+  model.set_ir_version(7);
+  auto* opset = model.add_opset_import();
+  opset->set_domain("");
+  opset->set_version(11);
+
+  auto* graph = model.mutable_graph();
+  graph->set_name("scan_benchmark");
+  AddValueInfo(graph->mutable_input(), "initial_state", {1});
+  AddValueInfo(graph->mutable_input(), "sequence", {seq_len, 1});
+  AddValueInfo(graph->mutable_output(), "final_state", {1});
+  AddValueInfo(graph->mutable_output(), "states", {seq_len, 1});
+
+  auto* scan = graph->add_node();
+  scan->set_op_type("Scan");
+  scan->add_input("initial_state");
+  scan->add_input("sequence");
+  scan->add_output("final_state");
+  scan->add_output("states");
+
+  auto* num_scan_inputs = scan->add_attribute();
+  num_scan_inputs->set_name("num_scan_inputs");
+  num_scan_inputs->set_type(AttributeProto_AttributeType_INT);
+  num_scan_inputs->set_i(1);
+
+  auto* body_attr = scan->add_attribute();
+  body_attr->set_name("body");
+  body_attr->set_type(AttributeProto_AttributeType_GRAPH);
+  auto* body = body_attr->mutable_g();
+  body->set_name("scan_body");
+  AddValueInfo(body->mutable_input(), "state_in", {1});
+  AddValueInfo(body->mutable_input(), "element", {1});
+  AddValueInfo(body->mutable_output(), "state_out", {1});
+  AddValueInfo(body->mutable_output(), "state_copy", {1});
+
+  auto* add = body->add_node();
+  add->set_op_type("Add");
+  add->add_input("state_in");
+  add->add_input("element");
+  add->add_output("state_out");
+
+  auto* identity = body->add_node();
+  identity->set_op_type("Identity");
+  identity->add_input("state_out");
+  identity->add_output("state_copy");
+
+  return model.SerializeAsString();
+}
+
+static void BM_ScanTrivialBody(benchmark::State& state) {
+  const int64_t seq_len = state.range(0);
+  const std::string model = CreateScanModel(seq_len);
+
+  OrtSessionOptions* session_options;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionOptions(&session_options));
+  ORT_BREAK_ON_ERROR(g_ort->SetIntraOpNumThreads(session_options, 1));
+  OrtSession* session;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionFromArray(env, model.data(), model.size(), session_options, &session));
+  g_ort->ReleaseSessionOptions(session_options);
+
+  OrtMemoryInfo* memory_info;
+  ORT_BREAK_ON_ERROR(g_ort->CreateCpuMemoryInfo(OrtArenaAllocator, OrtMemTypeDefault, &memory_info));
+
+  std::vector<float> initial_state{0.f};
+  std::vector<float> sequence(static_cast<size_t>(seq_len), 1.f);
+  const int64_t state_dims[] = {1};
+  const int64_t sequence_dims[] = {seq_len, 1};
+
+  OrtValue* inputs[2] = {nullptr, nullptr};
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, initial_state.data(), sizeof(float),
+                                                           state_dims, 1, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT,
+                                                           &inputs[0]));
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, sequence.data(),
+                                                           sequence.size() * sizeof(float), sequence_dims, 2,
+                                                           ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &inputs[1]));
+  g_ort->ReleaseMemoryInfo(memory_info);
+
+  const char* input_names[] = {"initial_state", "sequence"};
+  const char* output_names[] = {"final_state", "states"};
+
+  for (auto _ : state) {
+    OrtValue* outputs[2] = {nullptr, nullptr};
+    ORT_BREAK_ON_ERROR(g_ort->Run(session, nullptr, input_names, inputs, 2, output_names, 2, outputs));
+    state.PauseTiming();
+    g_ort->ReleaseValue(outputs[0]);
+    g_ort->ReleaseValue(outputs[1]);
+    state.ResumeTiming();
+  }
+
+  // items are Scan iterations, so the inverse of the rate is the per-iteration cost
+  state.SetItemsProcessed(state.iterations() * seq_len);
+
+  g_ort->ReleaseValue(inputs[0]);
+  g_ort->ReleaseValue(inputs[1]);
+  g_ort->ReleaseSession(session);
+}
+
+BENCHMARK(BM_ScanTrivialBody)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000);
+
+// Chain of If nodes whose branches pass the previous value through an Identity node, as used by dynamic shape
+// guards. The cost of each If node dominates.
+static std::string CreateIfChainModel(int64_t num_if_nodes) {
+  ModelProto model;
+  model.set_ir_version(7);
+  auto* opset = model.add_opset_import();
+  opset->set_domain("");
+  opset->set_version(13);
+
+  auto* graph = model.mutable_graph();
+  graph->set_name("if_benchmark");
+  auto* cond = graph->add_input();
+  cond->set_name("cond");
+  cond->mutable_type()->mutable_tensor_type()->set_elem_type(TensorProto_DataType_BOOL);
+  cond->mutable_type()->mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+  AddValueInfo(graph->mutable_input(), "X", {16});
+  AddValueInfo(graph->mutable_output(), "Y", {16});
+
+  std::string previous = "X";
+  for (int64_t i = 0; i < num_if_nodes; ++i) {
+    const std::string output = "if_out_" + std::to_string(i);
+
+    auto* if_node = graph->add_node();
+    if_node->set_op_type("If");
+    if_node->add_input("cond");
+    if_node->add_output(output);
+
+    for (const char* branch : {"then_branch", "else_branch"}) {
+      auto* branch_attr = if_node->add_attribute();
+      branch_attr->set_name(branch);
+      branch_attr->set_type(AttributeProto_AttributeType_GRAPH);
+      auto* body = branch_attr->mutable_g();
+      body->set_name(output + "_" + branch);
+      AddValueInfo(body->mutable_output(), output + "_" + branch + "_out", {16});
+
+      auto* identity = body->add_node();
+      identity->set_op_type("Identity");
+      identity->add_input(previous);
+      identity->add_output(output + "_" + branch + "_out");
+    }
+
+    previous = output;
+  }
+
+  auto* identity = graph->add_node();
+  identity->set_op_type("Identity");
+  identity->add_input(previous);
+  identity->add_output("Y");
+
+  return model.SerializeAsString();
+}
+
+static void BM_IfTrivialBranches(benchmark::State& state) {
+  const int64_t num_if_nodes = state.range(0);
+  const std::string model = CreateIfChainModel(num_if_nodes);
+
+  OrtSessionOptions* session_options;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionOptions(&session_options));
+  ORT_BREAK_ON_ERROR(g_ort->SetIntraOpNumThreads(session_options, 1));
+  OrtSession* session;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionFromArray(env, model.data(), model.size(), session_options, &session));
+  g_ort->ReleaseSessionOptions(session_options);
+
+  OrtMemoryInfo* memory_info;
+  ORT_BREAK_ON_ERROR(g_ort->CreateCpuMemoryInfo(OrtArenaAllocator, OrtMemTypeDefault, &memory_info));
+
+  bool cond = true;
+  std::vector<float> x(16, 1.f);
+  const int64_t cond_dims[] = {1};
+  const int64_t x_dims[] = {16};
+
+  OrtValue* inputs[2] = {nullptr, nullptr};
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, &cond, sizeof(bool), cond_dims, 1,
+                                                           ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL, &inputs[0]));
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, x.data(), x.size() * sizeof(float), x_dims,
+                                                           1, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &inputs[1]));
+  g_ort->ReleaseMemoryInfo(memory_info);
+
+  const char* input_names[] = {"cond", "X"};
+  const char* output_names[] = {"Y"};
+
+  for (auto _ : state) {
+    OrtValue* output = nullptr;
+    ORT_BREAK_ON_ERROR(g_ort->Run(session, nullptr, input_names, inputs, 2, output_names, 1, &output));
+    state.PauseTiming();
+    g_ort->ReleaseValue(output);
+    state.ResumeTiming();
+  }
+
+  // items are If nodes, so the inverse of the rate is the cost of an If node
+  state.SetItemsProcessed(state.iterations() * num_if_nodes);
+
+  g_ort->ReleaseValue(inputs[0]);
+  g_ort->ReleaseValue(inputs[1]);
+  g_ort->ReleaseSession(session);
+}
+
+BENCHMARK(BM_IfTrivialBranches)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Arg(10)
+    ->Arg(100);
@@ -0,0 +1,151 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <benchmark/benchmark.h>
+#include <core/graph/onnx_protobuf.h>
+#include <core/session/onnxruntime_c_api.h>
+#include <core/session/onnxruntime_session_options_config_keys.h>
+
+#include <string>
+#include <vector>
+
+extern OrtEnv* env;
+extern const OrtApi* g_ort;
+
+using namespace ONNX_NAMESPACE;
+
+#define ORT_BREAK_ON_ERROR(expr)                                \
+  do {                                                          \
+    OrtStatus* onnx_status = (expr);                            \
+    if (onnx_status != NULL) {                                  \
+      state.SkipWithError(g_ort->GetErrorMessage(onnx_status)); \
+      g_ort->ReleaseStatus(onnx_status);                        \
+      return;                                                   \
+    }                                                           \
+  } while (0);
+
+static void AddValueInfo(RepeatedPtrField<ValueInfoProto>* values, const std::string& name,
+                         const std::vector<int64_t>& dims) {
+  auto* value = values->Add();
+  value->set_name(name);
+  auto* tensor_type = value->mutable_type()->mutable_tensor_type();
+  tensor_type->set_elem_type(TensorProto_DataType_FLOAT);
+  auto* shape = tensor_type->mutable_shape();
+  for (auto dim : dims) {
+    shape->add_dim()->set_dim_value(dim);
+  }
+}
+
+static void AddInitializer(GraphProto* graph, const std::string& name, const std::vector<int64_t>& dims,
+                           const std::vector<float>& values) {
+  auto* initializer = graph->add_initializer();
+  initializer->set_name(name);
+  initializer->set_data_type(TensorProto_DataType_FLOAT);
+  for (auto dim : dims) {
+    initializer->add_dims(dim);
+  }
+  for (auto value : values) {
+    initializer->add_float_data(value);
+  }
+}
+
+static void AddNode(GraphProto* graph, const char* op_type, const std::vector<std::string>& inputs,
+                    const std::string& output) {
+  auto* node = graph->add_node();
+  node->set_op_type(op_type);
+  for (const auto& input : inputs) {
+    node->add_input(input);
+  }
+  node->add_output(output);
+}
+
+// Activation block following the output projection of a transformer layer: bias, scale, residual connection and a
+// tanh based activation, i.e. 0.5 * (1 + tanh((X + bias) * scale + R)). No specialized fusion applies to it so it
+// runs as one pass over the data when the element-wise chain is fused, and as six passes otherwise.
+static std::string CreateActivationBlockModel(int64_t rows, int64_t hidden) {
+  ModelProto model;
+  model.set_ir_version(7);
+  auto* opset = model.add_opset_import();
+  opset->set_domain("");
+  opset->set_version(13);
+
+  auto* graph = model.mutable_graph();
+  graph->set_name("activation_block_benchmark");
+  AddValueInfo(graph->mutable_input(), "X", {rows, hidden});
+  AddValueInfo(graph->mutable_input(), "R", {rows, hidden});
+  AddValueInfo(graph->mutable_output(), "Y", {rows, hidden});
+
+  AddInitializer(graph, "bias", {hidden}, std::vector<float>(static_cast<size_t>(hidden), 0.1f));
+  AddInitializer(graph, "scale", {}, {0.125f});
+  AddInitializer(graph, "one", {}, {1.f});
+  AddInitializer(graph, "half", {}, {0.5f});
+
+  AddNode(graph, "Add", {"X", "bias"}, "biased");
+  AddNode(graph, "Mul", {"biased", "scale"}, "scaled");
+  AddNode(graph, "Add", {"scaled", "R"}, "residual");
+  AddNode(graph, "Tanh", {"residual"}, "activated");
+  AddNode(graph, "Add", {"activated", "one"}, "shifted");
+  AddNode(graph, "Mul", {"shifted", "half"}, "Y");
+
+  return model.SerializeAsString();
+}
+
+// Args are the number of tokens, the hidden size and whether the element-wise fusion is enabled.
+static void BM_ElementwiseActivationBlock(benchmark::State& state) {
+  const int64_t rows = state.range(0);
+  const int64_t hidden = state.range(1);
+  const bool fuse = state.range(2) != 0;
+  const std::string model = CreateActivationBlockModel(rows, hidden);
+
+  OrtSessionOptions* session_options;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionOptions(&session_options));
+  ORT_BREAK_ON_ERROR(g_ort->SetSessionGraphOptimizationLevel(session_options, ORT_ENABLE_EXTENDED));
+  ORT_BREAK_ON_ERROR(g_ort->AddSessionConfigEntry(session_options, kOrtSessionOptionsEnableElementwiseFusion,
+                                                  fuse ? "1" : "0"));
+  OrtSession* session;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionFromArray(env, model.data(), model.size(), session_options, &session));
+  g_ort->ReleaseSessionOptions(session_options);
+
+  OrtMemoryInfo* memory_info;
+  ORT_BREAK_ON_ERROR(g_ort->CreateCpuMemoryInfo(OrtArenaAllocator, OrtMemTypeDefault, &memory_info));
+
+  std::vector<float> x(static_cast<size_t>(rows * hidden), 0.5f);
+  std::vector<float> r(static_cast<size_t>(rows * hidden), -0.25f);
+  const int64_t dims[] = {rows, hidden};
+
+  OrtValue* inputs[2] = {nullptr, nullptr};
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, x.data(), x.size() * sizeof(float), dims, 2,
+                                                           ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &inputs[0]));
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, r.data(), r.size() * sizeof(float), dims, 2,
+                                                           ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &inputs[1]));
+  g_ort->ReleaseMemoryInfo(memory_info);
+
+  const char* input_names[] = {"X", "R"};
+  const char* output_names[] = {"Y"};
+
+  for (auto _ : state) {
+    OrtValue* output = nullptr;
+    ORT_BREAK_ON_ERROR(g_ort->Run(session, nullptr, input_names, inputs, 2, output_names, 1, &output));
+    state.PauseTiming();
+    g_ort->ReleaseValue(output);
+    state.ResumeTiming();
+  }
+
+  state.SetBytesProcessed(state.iterations() * rows * hidden * static_cast<int64_t>(sizeof(float)));
+
+  g_ort->ReleaseValue(inputs[0]);
+  g_ort->ReleaseValue(inputs[1]);
+  g_ort->ReleaseSession(session);
+}
+
+BENCHMARK(BM_ElementwiseActivationBlock)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Args({128, 768, 0})
+    ->Args({128, 768, 1})
+    ->Args({512, 768, 0})
+    ->Args({512, 768, 1})
+    ->Args({128, 3072, 0})
+    ->Args({128, 3072, 1})
+    ->Args({512, 3072, 0})
+    ->Args({512, 3072, 1});
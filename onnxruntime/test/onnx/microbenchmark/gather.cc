@@ -0,0 +1,213 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <benchmark/benchmark.h>
+#include <core/graph/onnx_protobuf.h>
+#include <core/session/onnxruntime_c_api.h>
+
+#include <string>
+#include <vector>
+
+extern OrtEnv* env;
+extern const OrtApi* g_ort;
+
+using namespace ONNX_NAMESPACE;
+
+#define ORT_BREAK_ON_ERROR(expr)                                \
+  do {                                                          \
+    OrtStatus* onnx_status = (expr);                            \
+    if (onnx_status != NULL) {                                  \
+      state.SkipWithError(g_ort->GetErrorMessage(onnx_status)); \
+      g_ort->ReleaseStatus(onnx_status);                        \
+      return;                                                   \
+    }                                                           \
+  } while (0);
+
+static void AddInput(GraphProto* graph, const std::string& name, TensorProto_DataType type,
+                     const std::vector<int64_t>& dims) {
+  auto* input = graph->add_input();
+  input->set_name(name);
+  auto* input_type = input->mutable_type()->mutable_tensor_type();
+  input_type->set_elem_type(type);
+  for (auto dim : dims) {
+    input_type->mutable_shape()->add_dim()->set_dim_value(dim);
+  }
+}
+
+// A single Gather, GatherElements or ScatterElements node on float data with int64 indices.
+static std::string CreateIndexingModel(const std::string& op_type, const std::vector<int64_t>& data_dims,
+                                       const std::vector<int64_t>& indices_dims, int64_t axis,
+                                       const std::string& reduction) {
+  ModelProto model;
+  model.set_ir_version(7);
+  auto* opset = model.add_opset_import();
+  opset->set_domain("");
+  opset->set_version(16);
+
+  auto* graph = model.mutable_graph();
+  graph->set_name("indexing_benchmark");
+
+  AddInput(graph, "data", TensorProto_DataType_FLOAT, data_dims);
+  AddInput(graph, "indices", TensorProto_DataType_INT64, indices_dims);
+
+  auto* output = graph->add_output();
+  output->set_name("output");
+  output->mutable_type()->mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  auto* node = graph->add_node();
+  node->set_op_type(op_type);
+  node->add_input("data");
+  node->add_input("indices");
+  if (op_type == "ScatterElements") {
+    AddInput(graph, "updates", TensorProto_DataType_FLOAT, indices_dims);
+    node->add_input("updates");
+
+    auto* reduction_attr = node->add_attribute();
+    reduction_attr->set_name("reduction");
+    reduction_attr->set_type(AttributeProto_AttributeType_STRING);
+    reduction_attr->set_s(reduction);
+  }
+  node->add_output("output");
+
+  auto* axis_attr = node->add_attribute();
+  axis_attr->set_name("axis");
+  axis_attr->set_type(AttributeProto_AttributeType_INT);
+  axis_attr->set_i(axis);
+
+  return model.SerializeAsString();
+}
+
+// Runs the model with pseudo random indices within [0, axis_dim).
+static void RunIndexingModel(benchmark::State& state, const std::string& op_type,
+                             const std::vector<int64_t>& data_dims, const std::vector<int64_t>& indices_dims,
+                             int64_t axis, const std::string& reduction = "none") {
+  const std::string model = CreateIndexingModel(op_type, data_dims, indices_dims, axis, reduction);
+
+  OrtSessionOptions* session_options;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionOptions(&session_options));
+  OrtSession* session;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionFromArray(env, model.data(), model.size(), session_options, &session));
+  g_ort->ReleaseSessionOptions(session_options);
+
+  OrtMemoryInfo* memory_info;
+  ORT_BREAK_ON_ERROR(g_ort->CreateCpuMemoryInfo(OrtArenaAllocator, OrtMemTypeDefault, &memory_info));
+
+  int64_t data_size = 1;
+  for (auto dim : data_dims) {
+    data_size *= dim;
+  }
+  int64_t indices_size = 1;
+  for (auto dim : indices_dims) {
+    indices_size *= dim;
+  }
+
+  std::vector<float> data(static_cast<size_t>(data_size), 1.0f);
+  std::vector<float> updates(static_cast<size_t>(indices_size), 2.0f);
+  std::vector<int64_t> indices(static_cast<size_t>(indices_size));
+  uint64_t seed = 12345;
+  for (auto& index : indices) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    index = static_cast<int64_t>((seed >> 33) % static_cast<uint64_t>(data_dims[axis]));
+  }
+
+  OrtValue* inputs[3] = {nullptr, nullptr, nullptr};
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, data.data(), data.size() * sizeof(float),
+                                                           data_dims.data(), data_dims.size(),
+                                                           ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &inputs[0]));
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, indices.data(),
+                                                           indices.size() * sizeof(int64_t),
+                                                           indices_dims.data(), indices_dims.size(),
+                                                           ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64, &inputs[1]));
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, updates.data(),
+                                                           updates.size() * sizeof(float),
+                                                           indices_dims.data(), indices_dims.size(),
+                                                           ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &inputs[2]));
+  g_ort->ReleaseMemoryInfo(memory_info);
+
+  const char* input_names[] = {"data", "indices", "updates"};
+  const char* output_names[] = {"output"};
+  const size_t num_inputs = op_type == "ScatterElements" ? 3 : 2;
+
+  for (auto _ : state) {
+    OrtValue* output = nullptr;
+    ORT_BREAK_ON_ERROR(g_ort->Run(session, nullptr, input_names, inputs, num_inputs, output_names, 1, &output));
+    state.PauseTiming();
+    g_ort->ReleaseValue(output);
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() * indices_size);
+
+  for (auto* input : inputs) {
+    g_ort->ReleaseValue(input);
+  }
+  g_ort->ReleaseSession(session);
+}
+
+// Embedding lookup: rows of a [vocabulary, hidden] table. Args are the number of indices and the hidden size.
+static void BM_GatherRows(benchmark::State& state) {
+  const int64_t num_indices = state.range(0);
+  const int64_t hidden_size = state.range(1);
+  RunIndexingModel(state, "Gather", {100000, hidden_size}, {num_indices}, 0);
+}
+
+BENCHMARK(BM_GatherRows)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Args({1000, 64})
+    ->Args({100000, 64})
+    ->Args({100000, 256})
+    ->Args({100000, 1024});
+
+// Single elements along the last axis. Args are the number of rows and the number of indices.
+static void BM_GatherElementsOfLastAxis(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  const int64_t num_indices = state.range(1);
+  RunIndexingModel(state, "Gather", {num_rows, 4096}, {num_indices}, 1);
+}
+
+BENCHMARK(BM_GatherElementsOfLastAxis)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Args({16, 1024})
+    ->Args({256, 1024})
+    ->Args({1, 1000000});
+
+// Args are the number of rows and the row length of 'indices', which has the shape of the data.
+static void BM_GatherElements(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  const int64_t row_size = state.range(1);
+  RunIndexingModel(state, "GatherElements", {num_rows, row_size}, {num_rows, row_size}, 1);
+}
+
+BENCHMARK(BM_GatherElements)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Args({1024, 1024})
+    ->Args({1, 1000000})
+    ->Args({100000, 8});
+
+// Args are the number of rows and the row length of the data and of the updates, scattered along the rows.
+static void BM_ScatterElements(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  const int64_t row_size = state.range(1);
+  RunIndexingModel(state, "ScatterElements", {num_rows, row_size}, {num_rows, row_size}, 0);
+}
+
+BENCHMARK(BM_ScatterElements)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Args({1024, 1024})
+    ->Args({100000, 64});
+
+static void BM_ScatterElementsAdd(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  const int64_t row_size = state.range(1);
+  RunIndexingModel(state, "ScatterElements", {num_rows, row_size}, {num_rows, row_size}, 0, "add");
+}
+
+BENCHMARK(BM_ScatterElementsAdd)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Args({1024, 1024})
+    ->Args({100000, 64});
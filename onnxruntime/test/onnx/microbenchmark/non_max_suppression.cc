@@ -0,0 +1,165 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <benchmark/benchmark.h>
+#include <core/graph/onnx_protobuf.h>
+#include <core/session/onnxruntime_c_api.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+extern OrtEnv* env;
+extern const OrtApi* g_ort;
+
+using namespace ONNX_NAMESPACE;
+
+#define ORT_BREAK_ON_ERROR(expr)                                \
+  do {                                                          \
+    OrtStatus* onnx_status = (expr);                            \
+    if (onnx_status != NULL) {                                  \
+      state.SkipWithError(g_ort->GetErrorMessage(onnx_status)); \
+      g_ort->ReleaseStatus(onnx_status);                        \
+      return;                                                   \
+    }                                                           \
+  } while (0);
+
+static void AddTensorInput(GraphProto* graph, const std::string& name, TensorProto_DataType type,
+                           std::initializer_list<int64_t> dims) {
+  auto* input = graph->add_input();
+  input->set_name(name);
+  auto* input_type = input->mutable_type()->mutable_tensor_type();
+  input_type->set_elem_type(type);
+  for (auto dim : dims) {
+    input_type->mutable_shape()->add_dim()->set_dim_value(dim);
+  }
+}
+
+// NonMaxSuppression as at the end of YOLO detection models, with the thresholds as initializers.
+static std::string CreateNonMaxSuppressionModel(int64_t num_batches, int64_t num_classes, int64_t num_boxes) {
+  ModelProto model;
+  model.set_ir_version(7);
+  auto* opset = model.add_opset_import();
+  opset->set_domain("");
+  opset->set_version(11);
+
+  auto* graph = model.mutable_graph();
+  graph->set_name("nms_benchmark");
+
+  AddTensorInput(graph, "boxes", TensorProto_DataType_FLOAT, {num_batches, num_boxes, 4});
+  AddTensorInput(graph, "scores", TensorProto_DataType_FLOAT, {num_batches, num_classes, num_boxes});
+
+  auto* output = graph->add_output();
+  output->set_name("selected_indices");
+  output->mutable_type()->mutable_tensor_type()->set_elem_type(TensorProto_DataType_INT64);
+
+  auto* max_output = graph->add_initializer();
+  max_output->set_name("max_output_boxes_per_class");
+  max_output->set_data_type(TensorProto_DataType_INT64);
+  max_output->add_int64_data(100);
+
+  auto* iou_threshold = graph->add_initializer();
+  iou_threshold->set_name("iou_threshold");
+  iou_threshold->set_data_type(TensorProto_DataType_FLOAT);
+  iou_threshold->add_float_data(0.45f);
+
+  auto* score_threshold = graph->add_initializer();
+  score_threshold->set_name("score_threshold");
+  score_threshold->set_data_type(TensorProto_DataType_FLOAT);
+  score_threshold->add_float_data(0.25f);
+
+  auto* node = graph->add_node();
+  node->set_op_type("NonMaxSuppression");
+  node->add_input("boxes");
+  node->add_input("scores");
+  node->add_input("max_output_boxes_per_class");
+  node->add_input("iou_threshold");
+  node->add_input("score_threshold");
+  node->add_output("selected_indices");
+
+  return model.SerializeAsString();
+}
+
+// Args are the batch size, the number of classes and the number of candidate boxes, e.g. the 8400 boxes of a 640x640
+// YOLO model with 80 classes. The boxes are clustered around a few hundred objects and most scores are low.
+static void BM_NonMaxSuppression(benchmark::State& state) {
+  const int64_t num_batches = state.range(0);
+  const int64_t num_classes = state.range(1);
+  const int64_t num_boxes = state.range(2);
+  const std::string model = CreateNonMaxSuppressionModel(num_batches, num_classes, num_boxes);
+
+  OrtSessionOptions* session_options;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionOptions(&session_options));
+  OrtSession* session;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionFromArray(env, model.data(), model.size(), session_options, &session));
+  g_ort->ReleaseSessionOptions(session_options);
+
+  std::mt19937 generator(11);
+  std::uniform_real_distribution<float> position(0.0f, 640.0f);
+  std::normal_distribution<float> offset(0.0f, 4.0f);
+  std::uniform_real_distribution<float> size(16.0f, 128.0f);
+  std::uniform_real_distribution<float> score(0.0f, 1.0f);
+
+  std::vector<float> objects(300 * 4);
+  for (size_t i = 0; i < objects.size(); i += 4) {
+    objects[i] = position(generator);
+    objects[i + 1] = position(generator);
+    objects[i + 2] = size(generator);
+    objects[i + 3] = size(generator);
+  }
+
+  // [y1, x1, y2, x2] boxes around the objects
+  std::vector<float> boxes(static_cast<size_t>(num_batches * num_boxes * 4));
+  for (size_t i = 0; i < boxes.size(); i += 4) {
+    const float* object = objects.data() + (i / 4 % 300) * 4;
+    boxes[i] = object[0] + offset(generator);
+    boxes[i + 1] = object[1] + offset(generator);
+    boxes[i + 2] = boxes[i] + object[2] + offset(generator);
+    boxes[i + 3] = boxes[i + 1] + object[3] + offset(generator);
+  }
+
+  std::vector<float> scores(static_cast<size_t>(num_batches * num_classes * num_boxes));
+  for (auto& s : scores) {
+    const float value = score(generator);
+    s = value * value * value;
+  }
+
+  OrtMemoryInfo* memory_info;
+  ORT_BREAK_ON_ERROR(g_ort->CreateCpuMemoryInfo(OrtArenaAllocator, OrtMemTypeDefault, &memory_info));
+
+  const int64_t boxes_dims[] = {num_batches, num_boxes, 4};
+  const int64_t scores_dims[] = {num_batches, num_classes, num_boxes};
+  OrtValue* inputs[2] = {nullptr, nullptr};
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, boxes.data(), boxes.size() * sizeof(float),
+                                                           boxes_dims, 3, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT,
+                                                           &inputs[0]));
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, scores.data(), scores.size() * sizeof(float),
+                                                           scores_dims, 3, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT,
+                                                           &inputs[1]));
+  g_ort->ReleaseMemoryInfo(memory_info);
+
+  const char* input_names[] = {"boxes", "scores"};
+  const char* output_names[] = {"selected_indices"};
+
+  for (auto _ : state) {
+    OrtValue* output = nullptr;
+    ORT_BREAK_ON_ERROR(g_ort->Run(session, nullptr, input_names, inputs, 2, output_names, 1, &output));
+    state.PauseTiming();
+    g_ort->ReleaseValue(output);
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_batches * num_classes * num_boxes);
+
+  g_ort->ReleaseValue(inputs[0]);
+  g_ort->ReleaseValue(inputs[1]);
+  g_ort->ReleaseSession(session);
+}
+
+BENCHMARK(BM_NonMaxSuppression)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Args({1, 80, 8400})
+    ->Args({4, 80, 8400})
+    ->Args({1, 80, 25200})
+    ->Args({1, 1, 20000});
@@ -81,3 +81,44 @@ BENCHMARK_TEMPLATE(BM_NhwcUpsampleBilinear, float)
     ->Args({128, 128})
     ->Args({160, 160})
     ->Args({1, 1000000});
+
+// Bilinear resize of a 3 channel NCHW frame, e.g. Full HD to 4K, which is split in rows between the threads.
+static void BM_UpsampleBilinear(benchmark::State& state) {
+  const int32_t input_height = static_cast<int32_t>(state.range(0));
+  const int32_t input_width = static_cast<int32_t>(state.range(1));
+  const int32_t output_height = static_cast<int32_t>(state.range(2));
+  const int32_t output_width = static_cast<int32_t>(state.range(3));
+  constexpr int32_t batch_size = 1;
+  constexpr int32_t num_channels = 3;
+  const float height_scale = static_cast<float>(output_height) / input_height;
+  const float width_scale = static_cast<float>(output_width) / input_width;
+  const std::vector<float> roi{0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+  const size_t XdataBaseSize = static_cast<size_t>(batch_size) * num_channels * input_height * input_width;
+  const float* const XdataBase = GenerateArrayWithRandomValue<float>(XdataBaseSize, 0.0f, 1.0f);
+  const size_t YdataBaseSize = static_cast<size_t>(batch_size) * num_channels * output_height * output_width;
+  float* const YdataBase = (float*)aligned_alloc(sizeof(float) * YdataBaseSize, 64);
+  AllocatorPtr alloc = std::make_shared<CPUAllocator>();
+  const GetOriginalCoordinateFunc& get_original_coordinate =
+      [](float x_resized, float x_scale, float, float, float, float) {
+        return (x_resized + 0.5f) / x_scale - 0.5f;
+      };
+  OrtThreadPoolParams tpo;
+  tpo.auto_set_affinity = true;
+  std::unique_ptr<concurrency::ThreadPool> tp(
+      concurrency::CreateThreadPool(&onnxruntime::Env::Default(), tpo, concurrency::ThreadPoolType::INTRA_OP));
+
+  for (auto _ : state) {
+    UpsampleBilinear<float>(
+        batch_size, num_channels, input_height, input_width, output_height, output_width,
+        height_scale, width_scale, roi, false, 0.0f, XdataBase, YdataBase,
+        alloc, get_original_coordinate, tp.get());
+  }
+}
+
+BENCHMARK(BM_UpsampleBilinear)
+    ->MeasureProcessCPUTime()
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Args({224, 224, 448, 448})
+    ->Args({1080, 1920, 2160, 3840})
+    ->Args({2160, 3840, 1080, 1920});
@@ -0,0 +1,190 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <benchmark/benchmark.h>
+#include <core/graph/onnx_protobuf.h>
+#include <core/session/onnxruntime_c_api.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+extern OrtEnv* env;
+extern const OrtApi* g_ort;
+
+using namespace ONNX_NAMESPACE;
+
+#define ORT_BREAK_ON_ERROR(expr)                                \
+  do {                                                          \
+    OrtStatus* onnx_status = (expr);                            \
+    if (onnx_status != NULL) {                                  \
+      state.SkipWithError(g_ort->GetErrorMessage(onnx_status)); \
+      g_ort->ReleaseStatus(onnx_status);                        \
+      return;                                                   \
+    }                                                           \
+  } while (0);
+
+static void AddWeights(GraphProto* graph, const std::string& name, const std::vector<int64_t>& dims) {
+  auto* weights = graph->add_initializer();
+  weights->set_name(name);
+  weights->set_data_type(TensorProto_DataType_FLOAT);
+  int64_t size = 1;
+  for (auto dim : dims) {
+    weights->add_dims(dim);
+    size *= dim;
+  }
+  for (int64_t i = 0; i < size; ++i) {
+    weights->add_float_data(static_cast<float>(0.1 * std::sin(0.37 * static_cast<double>(i))));
+  }
+}
+
+// A single layer, forward GRU or RNN with the weights and bias as initializers, so that they are prepacked.
+static std::string CreateRecurrentModel(const std::string& op_type, int64_t num_gates, int64_t seq_length,
+                                        int64_t batch_size, int64_t input_size, int64_t hidden_size,
+                                        bool linear_before_reset) {
+  ModelProto model;
+  model.set_ir_version(7);
+  auto* opset = model.add_opset_import();
+  opset->set_domain("");
+  opset->set_version(14);
+
+  auto* graph = model.mutable_graph();
+  graph->set_name("recurrent_benchmark");
+
+  auto* input = graph->add_input();
+  input->set_name("X");
+  auto* input_type = input->mutable_type()->mutable_tensor_type();
+  input_type->set_elem_type(TensorProto_DataType_FLOAT);
+  for (auto dim : {seq_length, batch_size, input_size}) {
+    input_type->mutable_shape()->add_dim()->set_dim_value(dim);
+  }
+
+  auto* output = graph->add_output();
+  output->set_name("Y");
+  output->mutable_type()->mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  AddWeights(graph, "W", {1, num_gates * hidden_size, input_size});
+  AddWeights(graph, "R", {1, num_gates * hidden_size, hidden_size});
+  AddWeights(graph, "B", {1, 2 * num_gates * hidden_size});
+
+  auto* node = graph->add_node();
+  node->set_op_type(op_type);
+  node->add_input("X");
+  node->add_input("W");
+  node->add_input("R");
+  node->add_input("B");
+  node->add_output("Y");
+
+  auto* hidden_size_attr = node->add_attribute();
+  hidden_size_attr->set_name("hidden_size");
+  hidden_size_attr->set_type(AttributeProto_AttributeType_INT);
+  hidden_size_attr->set_i(hidden_size);
+
+  if (op_type == "RNN") {
+    auto* activations_attr = node->add_attribute();
+    activations_attr->set_name("activations");
+    activations_attr->set_type(AttributeProto_AttributeType_STRINGS);
+    activations_attr->add_strings("Tanh");
+  }
+
+  if (linear_before_reset) {
+    auto* linear_before_reset_attr = node->add_attribute();
+    linear_before_reset_attr->set_name("linear_before_reset");
+    linear_before_reset_attr->set_type(AttributeProto_AttributeType_INT);
+    linear_before_reset_attr->set_i(1);
+  }
+
+  return model.SerializeAsString();
+}
+
+static void RunRecurrentModel(benchmark::State& state, const std::string& model,
+                              int64_t seq_length, int64_t batch_size, int64_t input_size) {
+  OrtSessionOptions* session_options;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionOptions(&session_options));
+  OrtSession* session;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionFromArray(env, model.data(), model.size(), session_options, &session));
+  g_ort->ReleaseSessionOptions(session_options);
+
+  OrtMemoryInfo* memory_info;
+  ORT_BREAK_ON_ERROR(g_ort->CreateCpuMemoryInfo(OrtArenaAllocator, OrtMemTypeDefault, &memory_info));
+
+  std::vector<float> X(static_cast<size_t>(seq_length * batch_size * input_size));
+  for (size_t i = 0; i < X.size(); ++i) {
+    X[i] = static_cast<float>(std::sin(0.01 * static_cast<double>(i)));
+  }
+  const int64_t dims[] = {seq_length, batch_size, input_size};
+
+  OrtValue* input = nullptr;
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, X.data(), X.size() * sizeof(float),
+                                                           dims, 3, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &input));
+  g_ort->ReleaseMemoryInfo(memory_info);
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+
+  for (auto _ : state) {
+    OrtValue* output = nullptr;
+    ORT_BREAK_ON_ERROR(g_ort->Run(session, nullptr, input_names, &input, 1, output_names, 1, &output));
+    state.PauseTiming();
+    g_ort->ReleaseValue(output);
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() * seq_length * batch_size);
+
+  g_ort->ReleaseValue(input);
+  g_ort->ReleaseSession(session);
+}
+
+// 40 input features per frame, as the MFCC or mel filter bank input of keyword spotting models
+constexpr int64_t kInputSize = 40;
+
+// Args are the sequence length, the batch size and the hidden size.
+static void RecurrentArgs(benchmark::internal::Benchmark* b) {
+  for (int64_t seq_length : {50, 100}) {
+    for (int64_t batch_size : {1, 8}) {
+      for (int64_t hidden_size : {64, 128, 256}) {
+        b->Args({seq_length, batch_size, hidden_size});
+      }
+    }
+  }
+}
+
+static void BM_GRU(benchmark::State& state) {
+  const int64_t seq_length = state.range(0);
+  const int64_t batch_size = state.range(1);
+  const int64_t hidden_size = state.range(2);
+  const std::string model = CreateRecurrentModel("GRU", 3, seq_length, batch_size, kInputSize, hidden_size, false);
+  RunRecurrentModel(state, model, seq_length, batch_size, kInputSize);
+}
+
+BENCHMARK(BM_GRU)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Apply(RecurrentArgs);
+
+static void BM_GRULinearBeforeReset(benchmark::State& state) {
+  const int64_t seq_length = state.range(0);
+  const int64_t batch_size = state.range(1);
+  const int64_t hidden_size = state.range(2);
+  const std::string model = CreateRecurrentModel("GRU", 3, seq_length, batch_size, kInputSize, hidden_size, true);
+  RunRecurrentModel(state, model, seq_length, batch_size, kInputSize);
+}
+
+BENCHMARK(BM_GRULinearBeforeReset)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Apply(RecurrentArgs);
+
+static void BM_RNN(benchmark::State& state) {
+  const int64_t seq_length = state.range(0);
+  const int64_t batch_size = state.range(1);
+  const int64_t hidden_size = state.range(2);
+  const std::string model = CreateRecurrentModel("RNN", 1, seq_length, batch_size, kInputSize, hidden_size, false);
+  RunRecurrentModel(state, model, seq_length, batch_size, kInputSize);
+}
+
+BENCHMARK(BM_RNN)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Apply(RecurrentArgs);
@@ -0,0 +1,198 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <benchmark/benchmark.h>
+#include <core/graph/onnx_protobuf.h>
+#include <core/session/onnxruntime_c_api.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+extern OrtEnv* env;
+extern const OrtApi* g_ort;
+
+using namespace ONNX_NAMESPACE;
+
+#define ORT_BREAK_ON_ERROR(expr)                                \
+  do {                                                          \
+    OrtStatus* onnx_status = (expr);                            \
+    if (onnx_status != NULL) {                                  \
+      state.SkipWithError(g_ort->GetErrorMessage(onnx_status)); \
+      g_ort->ReleaseStatus(onnx_status);                        \
+      return;                                                   \
+    }                                                           \
+  } while (0);
+
+static constexpr int64_t kHiddenSize = 256;
+
+// Y = Relu(X * W), a small model for which the cost of waiting on a request is significant.
+static std::string CreateMatMulModel() {
+  ModelProto model;
+  model.set_ir_version(7);
+  auto* opset = model.add_opset_import();
+  opset->set_domain("");
+  opset->set_version(13);
+
+  auto* graph = model.mutable_graph();
+  graph->set_name("run_async_benchmark");
+
+  auto* input = graph->add_input();
+  input->set_name("X");
+  auto* input_type = input->mutable_type()->mutable_tensor_type();
+  input_type->set_elem_type(TensorProto_DataType_FLOAT);
+  input_type->mutable_shape()->add_dim()->set_dim_value(1);
+  input_type->mutable_shape()->add_dim()->set_dim_value(kHiddenSize);
+
+  auto* weight = graph->add_initializer();
+  weight->set_name("W");
+  weight->set_data_type(TensorProto_DataType_FLOAT);
+  weight->add_dims(kHiddenSize);
+  weight->add_dims(kHiddenSize);
+  for (int64_t i = 0; i < kHiddenSize * kHiddenSize; ++i) {
+    weight->add_float_data(static_cast<float>(i % 7) * 0.01f);
+  }
+
+  auto* output = graph->add_output();
+  output->set_name("Y");
+  output->mutable_type()->mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  auto* matmul = graph->add_node();
+  matmul->set_op_type("MatMul");
+  matmul->add_input("X");
+  matmul->add_input("W");
+  matmul->add_output("XW");
+
+  auto* relu = graph->add_node();
+  relu->set_op_type("Relu");
+  relu->add_input("XW");
+  relu->add_output("Y");
+
+  return model.SerializeAsString();
+}
+
+// Counts the completed requests of an iteration.
+struct Completions {
+  std::mutex mutex;
+  std::condition_variable done;
+  int64_t pending = 0;
+  std::atomic<int64_t> failures{0};
+
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this]() { return pending == 0; });
+  }
+
+  static void ORT_API_CALL OnRunCompleted(void* user_data, OrtValue** outputs, size_t /*num_outputs*/,
+                                          OrtStatusPtr status) {
+    auto* completions = static_cast<Completions*>(user_data);
+    if (status != nullptr) {
+      completions->failures++;
+      g_ort->ReleaseStatus(status);
+    } else {
+      g_ort->ReleaseValue(outputs[0]);
+      outputs[0] = nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(completions->mutex);
+    if (--completions->pending == 0) {
+      completions->done.notify_one();
+    }
+  }
+};
+
+// Runs state.range(0) concurrent requests per iteration, either with RunAsync or with one blocked thread per request
+// calling Run. The session has state.range(1) intra op threads.
+static void RunConcurrentRequests(benchmark::State& state, bool use_run_async) {
+  const int64_t num_requests = state.range(0);
+  const std::string model = CreateMatMulModel();
+
+  OrtSessionOptions* session_options;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionOptions(&session_options));
+  ORT_BREAK_ON_ERROR(g_ort->SetIntraOpNumThreads(session_options, static_cast<int>(state.range(1))));
+  OrtSession* session;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionFromArray(env, model.data(), model.size(), session_options, &session));
+  g_ort->ReleaseSessionOptions(session_options);
+
+  OrtMemoryInfo* memory_info;
+  ORT_BREAK_ON_ERROR(g_ort->CreateCpuMemoryInfo(OrtArenaAllocator, OrtMemTypeDefault, &memory_info));
+  std::vector<float> x_data(kHiddenSize, 1.0f);
+  const int64_t x_dims[] = {1, kHiddenSize};
+  OrtValue* x;
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, x_data.data(), x_data.size() * sizeof(float),
+                                                           x_dims, 2, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &x));
+  g_ort->ReleaseMemoryInfo(memory_info);
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+  // one output slot per request, filled by its run
+  std::vector<OrtValue*> outputs(static_cast<size_t>(num_requests), nullptr);
+  Completions completions;
+
+  for (auto _ : state) {
+    if (use_run_async) {
+      completions.pending = num_requests;
+      for (int64_t i = 0; i < num_requests; ++i) {
+        OrtStatus* status = g_ort->RunAsync(session, nullptr, input_names, &x, 1, output_names, 1, &outputs[i],
+                                            Completions::OnRunCompleted, &completions);
+        if (status != nullptr) {
+          // the callback isn't called for a request that wasn't scheduled
+          Completions::OnRunCompleted(&completions, &outputs[i], 1, status);
+        }
+      }
+      completions.Wait();
+    } else {
+      std::vector<std::thread> threads;
+      threads.reserve(static_cast<size_t>(num_requests));
+      for (int64_t i = 0; i < num_requests; ++i) {
+        threads.emplace_back([&, i]() {
+          OrtStatus* status = g_ort->Run(session, nullptr, input_names, &x, 1, output_names, 1, &outputs[i]);
+          if (status != nullptr) {
+            completions.failures++;
+            g_ort->ReleaseStatus(status);
+          } else {
+            g_ort->ReleaseValue(outputs[i]);
+            outputs[i] = nullptr;
+          }
+        });
+      }
+      for (auto& thread : threads) {
+        thread.join();
+      }
+    }
+  }
+
+  if (completions.failures > 0) {
+    state.SkipWithError("Some of the requests failed.");
+  }
+  state.SetItemsProcessed(state.iterations() * num_requests);
+
+  g_ort->ReleaseValue(x);
+  g_ort->ReleaseSession(session);
+}
+
+// Args are the number of concurrent requests and the number of intra op threads.
+static void BM_RunAsyncConcurrentRequests(benchmark::State& state) {
+  RunConcurrentRequests(state, true);
+}
+
+BENCHMARK(BM_RunAsyncConcurrentRequests)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Args({16, 4})
+    ->Args({256, 4})
+    ->Args({512, 8});
+
+static void BM_RunBlockingThreadPerRequest(benchmark::State& state) {
+  RunConcurrentRequests(state, false);
+}
+
+BENCHMARK(BM_RunBlockingThreadPerRequest)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Args({16, 4})
+    ->Args({256, 4})
+    ->Args({512, 8});
@@ -0,0 +1,133 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <benchmark/benchmark.h>
+#include <core/graph/onnx_protobuf.h>
+#include <core/session/onnxruntime_c_api.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+extern OrtEnv* env;
+extern const OrtApi* g_ort;
+
+using namespace ONNX_NAMESPACE;
+
+#define ORT_BREAK_ON_ERROR(expr)                                \
+  do {                                                          \
+    OrtStatus* onnx_status = (expr);                            \
+    if (onnx_status != NULL) {                                  \
+      state.SkipWithError(g_ort->GetErrorMessage(onnx_status)); \
+      g_ort->ReleaseStatus(onnx_status);                        \
+      return;                                                   \
+    }                                                           \
+  } while (0);
+
+// STFT of a batch of real signals with a Hann window, i.e. the spectrogram front end of speech models.
+static std::string CreateSTFTModel(int64_t batch_size, int64_t signal_length, int64_t frame_length,
+                                   int64_t frame_step) {
+  ModelProto model;
+  model.set_ir_version(8);
+  auto* opset = model.add_opset_import();
+  opset->set_domain("");
+  opset->set_version(17);
+
+  auto* graph = model.mutable_graph();
+  graph->set_name("stft_benchmark");
+
+  auto* input = graph->add_input();
+  input->set_name("signal");
+  auto* input_type = input->mutable_type()->mutable_tensor_type();
+  input_type->set_elem_type(TensorProto_DataType_FLOAT);
+  for (auto dim : {batch_size, signal_length, int64_t{1}}) {
+    input_type->mutable_shape()->add_dim()->set_dim_value(dim);
+  }
+
+  auto* output = graph->add_output();
+  output->set_name("spectrogram");
+  output->mutable_type()->mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+
+  auto* step = graph->add_initializer();
+  step->set_name("frame_step");
+  step->set_data_type(TensorProto_DataType_INT64);
+  step->add_int64_data(frame_step);
+
+  auto* length = graph->add_initializer();
+  length->set_name("frame_length");
+  length->set_data_type(TensorProto_DataType_INT64);
+  length->add_int64_data(frame_length);
+
+  auto* window = graph->add_initializer();
+  window->set_name("window");
+  window->set_data_type(TensorProto_DataType_FLOAT);
+  window->add_dims(frame_length);
+  for (int64_t i = 0; i < frame_length; ++i) {
+    window->add_float_data(static_cast<float>(0.5 - 0.5 * std::cos(2.0 * 3.14159265358979323846 * i / frame_length)));
+  }
+
+  auto* node = graph->add_node();
+  node->set_op_type("STFT");
+  node->add_input("signal");
+  node->add_input("frame_step");
+  node->add_input("window");
+  node->add_input("frame_length");
+  node->add_output("spectrogram");
+
+  return model.SerializeAsString();
+}
+
+// Args are the batch size, the number of samples of each signal, the frame length and the frame step. Frames of 400
+// samples use the mixed-radix transform, frames of 512 samples the radix 4 and 2 one.
+static void BM_STFT(benchmark::State& state) {
+  const int64_t batch_size = state.range(0);
+  const int64_t signal_length = state.range(1);
+  const int64_t frame_length = state.range(2);
+  const int64_t frame_step = state.range(3);
+  const std::string model = CreateSTFTModel(batch_size, signal_length, frame_length, frame_step);
+
+  OrtSessionOptions* session_options;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionOptions(&session_options));
+  OrtSession* session;
+  ORT_BREAK_ON_ERROR(g_ort->CreateSessionFromArray(env, model.data(), model.size(), session_options, &session));
+  g_ort->ReleaseSessionOptions(session_options);
+
+  OrtMemoryInfo* memory_info;
+  ORT_BREAK_ON_ERROR(g_ort->CreateCpuMemoryInfo(OrtArenaAllocator, OrtMemTypeDefault, &memory_info));
+
+  std::vector<float> signal(static_cast<size_t>(batch_size * signal_length));
+  for (size_t i = 0; i < signal.size(); ++i) {
+    signal[i] = static_cast<float>(std::sin(0.01 * static_cast<double>(i)));
+  }
+  const int64_t dims[] = {batch_size, signal_length, 1};
+
+  OrtValue* input = nullptr;
+  ORT_BREAK_ON_ERROR(g_ort->CreateTensorWithDataAsOrtValue(memory_info, signal.data(), signal.size() * sizeof(float),
+                                                           dims, 3, ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &input));
+  g_ort->ReleaseMemoryInfo(memory_info);
+
+  const char* input_names[] = {"signal"};
+  const char* output_names[] = {"spectrogram"};
+
+  for (auto _ : state) {
+    OrtValue* output = nullptr;
+    ORT_BREAK_ON_ERROR(g_ort->Run(session, nullptr, input_names, &input, 1, output_names, 1, &output));
+    state.PauseTiming();
+    g_ort->ReleaseValue(output);
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() * batch_size * signal_length);
+
+  g_ort->ReleaseValue(input);
+  g_ort->ReleaseSession(session);
+}
+
+BENCHMARK(BM_STFT)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Args({1, 16000, 400, 160})
+    ->Args({8, 16000, 400, 160})
+    ->Args({1, 16000, 512, 160})
+    ->Args({8, 16000, 512, 160})
+    ->Args({1, 160000, 400, 160});
@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/string_dictionary.h"
+
+// Vocabulary of words of 3 to 12 characters, as in the pools of TfIdfVectorizer and the keys of LabelEncoder and
+// CategoryMapper, and queries of which about a quarter are not in the vocabulary.
+static void CreateVocabulary(size_t size, std::vector<std::string>& vocabulary, std::vector<std::string>& queries) {
+  std::mt19937 generator(17);
+  std::uniform_int_distribution<int> length(3, 12);
+  std::uniform_int_distribution<int> letter('a', 'z');
+
+  vocabulary.resize(size);
+  for (auto& word : vocabulary) {
+    word.resize(length(generator));
+    for (auto& c : word) {
+      c = static_cast<char>(letter(generator));
+    }
+  }
+
+  std::uniform_int_distribution<size_t> index(0, size - 1);
+  queries.resize(4096);
+  for (size_t i = 0; i < queries.size(); ++i) {
+    queries[i] = vocabulary[index(generator)];
+    if (i % 4 == 0) {
+      queries[i] += '_';
+    }
+  }
+}
+
+static void BM_StringLookupUnorderedMap(benchmark::State& state) {
+  std::vector<std::string> vocabulary, queries;
+  CreateVocabulary(static_cast<size_t>(state.range(0)), vocabulary, queries);
+
+  std::unordered_map<std::string, int64_t> map;
+  map.reserve(vocabulary.size());
+  for (size_t i = 0; i < vocabulary.size(); ++i) {
+    map[vocabulary[i]] = static_cast<int64_t>(i);
+  }
+
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (const auto& query : queries) {
+      auto found = map.find(query);
+      sum += found == map.end() ? -1 : found->second;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+BENCHMARK(BM_StringLookupUnorderedMap)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->Arg(1000000);
+
+static void BM_StringLookupDictionary(benchmark::State& state) {
+  std::vector<std::string> vocabulary, queries;
+  CreateVocabulary(static_cast<size_t>(state.range(0)), vocabulary, queries);
+
+  onnxruntime::StringDictionary dictionary;
+  dictionary.Reserve(vocabulary.size());
+  std::vector<int64_t> values;
+  values.reserve(vocabulary.size());
+  for (size_t i = 0; i < vocabulary.size(); ++i) {
+    bool inserted;
+    const auto id = dictionary.Insert(vocabulary[i], inserted);
+    if (inserted) {
+      values.push_back(static_cast<int64_t>(i));
+    } else {
+      values[id] = static_cast<int64_t>(i);
+    }
+  }
+
+  for (auto _ : state) {
+    int64_t sum = 0;
+    for (const auto& query : queries) {
+      const auto id = dictionary.Find(query);
+      sum += id == onnxruntime::StringDictionary::kNotFound ? -1 : values[id];
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * queries.size());
+}
+
+BENCHMARK(BM_StringLookupDictionary)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond)
+    ->Arg(1000)
+    ->Arg(100000)
+    ->Arg(1000000);
@@ -66,6 +66,7 @@
 #include "core/optimizer/unsqueeze_elimination.h"
 #include "core/optimizer/utils.h"
 #include "core/platform/env.h"
+#include "core/platform/threadpool.h"
 #include "core/session/inference_session.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
 #include "core/util/math.h"
@@ -538,6 +539,118 @@ TEST_F(GraphTransformationTests, ConstantFoldingAShapeNodeDeepInTheGraph) {
   ASSERT_TRUE(op_to_count.size() == 0);
 }
 
+TEST_F(GraphTransformationTests, ConstantFoldingSizeLimits) {
+  // Expand creates an initializer of 64 x 64 floats from 20 bytes of inputs, Unsqueeze keeps the size of its input.
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* expand_input = builder.MakeInitializer<float>({1}, {1.0f});
+    auto* expand_shape = builder.MakeInitializer<int64_t>({2}, {64, 64});
+    auto* unsqueeze_input = builder.MakeInitializer<float>({4}, {1.0f, 2.0f, 3.0f, 4.0f});
+    auto* unsqueeze_axes = builder.MakeInitializer<int64_t>({1}, {0});
+    auto* input1 = builder.MakeInput<float>({64, 64}, -1.0f, 1.0f);
+    auto* input2 = builder.MakeInput<float>({1, 4}, -1.0f, 1.0f);
+    auto* expand_out = builder.MakeIntermediate();
+    auto* unsqueeze_out = builder.MakeIntermediate();
+    auto* output1 = builder.MakeOutput();
+    auto* output2 = builder.MakeOutput();
+
+    builder.AddNode("Expand", {expand_input, expand_shape}, {expand_out});
+    builder.AddNode("Unsqueeze", {unsqueeze_input, unsqueeze_axes}, {unsqueeze_out});
+    builder.AddNode("Add", {expand_out, input1}, {output1});
+    builder.AddNode("Add", {unsqueeze_out, input2}, {output2});
+  };
+
+  auto pre_graph_checker = [&](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    ASSERT_EQ(op_to_count["Expand"], 1);
+    ASSERT_EQ(op_to_count["Unsqueeze"], 1);
+  };
+
+  auto expand_not_folded = [&](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    ASSERT_EQ(op_to_count["Expand"], 1);
+    ASSERT_EQ(op_to_count["Unsqueeze"], 0);
+  };
+
+  auto all_folded = [&](Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    ASSERT_EQ(op_to_count["Expand"], 0);
+    ASSERT_EQ(op_to_count["Unsqueeze"], 0);
+  };
+
+  auto e = std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+
+  ConstantFoldingSizeLimits size_limit;
+  size_limit.max_output_size_in_bytes = 1024;
+  TestGraphTransformer(build_test_case, 13, *logger_,
+                       std::make_unique<ConstantFolding>(*e, false, size_limit, nullptr),
+                       TransformerLevel::Level1, 1, pre_graph_checker, expand_not_folded);
+
+  ConstantFoldingSizeLimits ratio_limit;
+  ratio_limit.max_output_to_input_size_ratio = 4.0f;
+  TestGraphTransformer(build_test_case, 13, *logger_,
+                       std::make_unique<ConstantFolding>(*e, false, ratio_limit, nullptr),
+                       TransformerLevel::Level1, 1, pre_graph_checker, expand_not_folded);
+
+  TestGraphTransformer(build_test_case, 13, *logger_,
+                       std::make_unique<ConstantFolding>(*e, false, ConstantFoldingSizeLimits{}, nullptr),
+                       TransformerLevel::Level1, 1, pre_graph_checker, all_folded);
+}
+
+TEST_F(GraphTransformationTests, ConstantFoldingParallel) {
+  // Add and Neg only depend on initializers, then Mul depends on Add, Unsqueeze on Mul and the first Add node
+  // consuming the graph input on both.
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* c1 = builder.MakeInitializer<float>({2, 2}, {1.0f, 2.0f, 3.0f, 4.0f});
+    auto* c2 = builder.MakeInitializer<float>({2, 2}, {1.0f, 1.0f, 1.0f, 1.0f});
+    auto* c3 = builder.MakeInitializer<float>({2, 2}, {2.0f, 2.0f, 2.0f, 2.0f});
+    auto* axes = builder.MakeInitializer<int64_t>({1}, {0});
+    auto* c4 = builder.MakeInitializer<float>({1, 2, 2}, {1.0f, 1.0f, 1.0f, 1.0f});
+    auto* input = builder.MakeInput<float>({1, 2, 2}, -1.0f, 1.0f);
+    auto* add_out = builder.MakeIntermediate();
+    auto* mul_out = builder.MakeIntermediate();
+    auto* unsqueeze_out = builder.MakeIntermediate();
+    auto* neg_out = builder.MakeIntermediate();
+    auto* sum_out = builder.MakeIntermediate();
+    auto* output = builder.MakeOutput();
+
+    builder.AddNode("Add", {c1, c2}, {add_out});
+    builder.AddNode("Mul", {add_out, c3}, {mul_out});
+    builder.AddNode("Unsqueeze", {mul_out, axes}, {unsqueeze_out});
+    builder.AddNode("Neg", {c4}, {neg_out});
+    builder.AddNode("Add", {unsqueeze_out, neg_out}, {sum_out});
+    builder.AddNode("Add", {sum_out, input}, {output});
+  };
+
+  auto pre_graph_checker = [&](Graph& graph) {
+    ASSERT_EQ(graph.NumberOfNodes(), 6);
+  };
+
+  auto post_graph_checker = [&](Graph& graph) {
+    ASSERT_EQ(graph.NumberOfNodes(), 1);
+    const Node& add = *graph.Nodes().begin();
+    const ONNX_NAMESPACE::TensorProto* folded = graph_utils::GetConstantInitializer(graph, add.InputDefs()[0]->Name());
+    ASSERT_NE(folded, nullptr);
+    Initializer folded_values{*folded, graph.ModelPath()};
+    ASSERT_EQ(folded_values.size(), 4);
+    const std::vector<float> expected = {3.0f, 5.0f, 7.0f, 9.0f};
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_EQ(folded_values.data<float>()[i], expected[i]);
+    }
+  };
+
+  auto e = std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+  concurrency::ThreadPool tp(&Env::Default(), ThreadOptions(), ORT_TSTR("ConstantFoldingParallel"), 4, true);
+
+  TestGraphTransformer(build_test_case, 13, *logger_,
+                       std::make_unique<ConstantFolding>(*e, false, ConstantFoldingSizeLimits{}, &tp),
+                       TransformerLevel::Level1, 1, pre_graph_checker, post_graph_checker);
+
+  // the same result without a thread pool
+  TestGraphTransformer(build_test_case, 13, *logger_,
+                       std::make_unique<ConstantFolding>(*e, false, ConstantFoldingSizeLimits{}, nullptr),
+                       TransformerLevel::Level1, 1, pre_graph_checker, post_graph_checker);
+}
+
 // Check transformations in the case of a subgraph with constant inputs.
 TEST_F(GraphTransformationTests, SubgraphWithConstantInputs) {
   auto model_uri = MODEL_FOLDER "constant-subgraph.onnx";
@@ -3252,6 +3365,340 @@ TEST_F(GraphTransformationTests, BiasGeluSwitchedInputOrder) {
   EXPECT_EQ(ret.first, COMPARE_RESULT::SUCCESS) << ret.second;
 }
 
+// Log mel spectrogram of a speech model: power spectrum, mel filter bank and log with a small offset.
+TEST_F(GraphTransformationTests, MelSpectrogramFusion_PowerWithLogOffset) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* signal = builder.MakeInput<float>({2, 400, 1}, -1.0f, 1.0f);
+    auto* frame_step = builder.MakeScalarInitializer<int64_t>(40);
+    auto* window = builder.MakeInitializer<float>({80}, 0.0f, 1.0f);
+    auto* frame_length = builder.MakeScalarInitializer<int64_t>(80);
+    auto* mel_weight_matrix = builder.MakeInitializer<float>({41, 16}, 0.0f, 1.0f);
+    auto* offset = builder.MakeScalarInitializer<float>(1e-6f);
+    auto* stft_out = builder.MakeIntermediate();
+    auto* power_out = builder.MakeIntermediate();
+    auto* matmul_out = builder.MakeIntermediate();
+    auto* add_out = builder.MakeIntermediate();
+    auto* output = builder.MakeOutput();
+
+    builder.AddNode("STFT", {signal, frame_step, window, frame_length}, {stft_out});
+    Node& reduce = builder.AddNode("ReduceSumSquare", {stft_out}, {power_out});
+    reduce.AddAttribute("axes", std::vector<int64_t>{-1});
+    reduce.AddAttribute("keepdims", static_cast<int64_t>(0));
+    builder.AddNode("MatMul", {power_out, mel_weight_matrix}, {matmul_out});
+    builder.AddNode("Add", {matmul_out, offset}, {add_out});
+    builder.AddNode("Log", {add_out}, {output});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["STFT"], 0);
+    EXPECT_EQ(op_to_count["ReduceSumSquare"], 0);
+    EXPECT_EQ(op_to_count["MatMul"], 0);
+    EXPECT_EQ(op_to_count["Add"], 0);
+    EXPECT_EQ(op_to_count["Log"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.MelSpectrogram"], 1);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 17, 1e-4);
+}
+
+// Magnitude spectrum without log.
+TEST_F(GraphTransformationTests, MelSpectrogramFusion_Magnitude) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* signal = builder.MakeInput<float>({1, 300, 1}, -1.0f, 1.0f);
+    auto* frame_step = builder.MakeScalarInitializer<int64_t>(25);
+    auto* window = builder.MakeInitializer<float>({60}, 0.0f, 1.0f);
+    auto* mel_weight_matrix = builder.MakeInitializer<float>({31, 8}, 0.0f, 1.0f);
+    auto* stft_out = builder.MakeIntermediate();
+    auto* magnitude_out = builder.MakeIntermediate();
+    auto* output = builder.MakeOutput();
+
+    builder.AddNode("STFT", {signal, frame_step, window}, {stft_out});
+    Node& reduce = builder.AddNode("ReduceL2", {stft_out}, {magnitude_out});
+    reduce.AddAttribute("axes", std::vector<int64_t>{3});
+    reduce.AddAttribute("keepdims", static_cast<int64_t>(0));
+    builder.AddNode("MatMul", {magnitude_out, mel_weight_matrix}, {output});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["STFT"], 0);
+    EXPECT_EQ(op_to_count["ReduceL2"], 0);
+    EXPECT_EQ(op_to_count["MatMul"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.MelSpectrogram"], 1);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 17, 1e-4);
+}
+
+// The complex spectrum is kept when the STFT is not onesided or when the power spectrum is also a graph output.
+TEST_F(GraphTransformationTests, MelSpectrogramFusion_NotFused) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* signal = builder.MakeInput<float>({1, 256, 1}, -1.0f, 1.0f);
+    auto* frame_step = builder.MakeScalarInitializer<int64_t>(32);
+    auto* window = builder.MakeInitializer<float>({64}, 0.0f, 1.0f);
+    auto* mel_weight_matrix = builder.MakeInitializer<float>({33, 8}, 0.0f, 1.0f);
+    auto* full_mel_weight_matrix = builder.MakeInitializer<float>({64, 8}, 0.0f, 1.0f);
+    auto* stft_out = builder.MakeIntermediate();
+    auto* power_out = builder.MakeOutput();
+    auto* output = builder.MakeOutput();
+    auto* full_stft_out = builder.MakeIntermediate();
+    auto* full_power_out = builder.MakeIntermediate();
+    auto* full_output = builder.MakeOutput();
+
+    builder.AddNode("STFT", {signal, frame_step, window}, {stft_out});
+    Node& reduce = builder.AddNode("ReduceSumSquare", {stft_out}, {power_out});
+    reduce.AddAttribute("axes", std::vector<int64_t>{-1});
+    reduce.AddAttribute("keepdims", static_cast<int64_t>(0));
+    builder.AddNode("MatMul", {power_out, mel_weight_matrix}, {output});
+
+    builder.AddNode("STFT", {signal, frame_step, window}, {full_stft_out})
+        .AddAttribute("onesided", static_cast<int64_t>(0));
+    Node& full_reduce = builder.AddNode("ReduceSumSquare", {full_stft_out}, {full_power_out});
+    full_reduce.AddAttribute("axes", std::vector<int64_t>{-1});
+    full_reduce.AddAttribute("keepdims", static_cast<int64_t>(0));
+    builder.AddNode("MatMul", {full_power_out, full_mel_weight_matrix}, {full_output});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["STFT"], 2);
+    EXPECT_EQ(op_to_count["ReduceSumSquare"], 2);
+    EXPECT_EQ(op_to_count["MatMul"], 2);
+    EXPECT_EQ(op_to_count["com.microsoft.MelSpectrogram"], 0);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 17, 1e-4);
+}
+
+// Sum pooling of a sparse feature with the axes of ReduceSum as an input.
+TEST_F(GraphTransformationTests, EmbeddingBagFusion_ReduceSum) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* table = builder.MakeInitializer<float>({100, 16}, -1.0f, 1.0f);
+    auto* indices = builder.MakeInput<int64_t>({8, 5}, 0, 99);
+    auto* axes = builder.MakeInitializer<int64_t>({1}, {1});
+    auto* gather_out = builder.MakeIntermediate();
+    auto* output = builder.MakeOutput();
+
+    builder.AddNode("Gather", {table, indices}, {gather_out});
+    builder.AddNode("ReduceSum", {gather_out, axes}, {output})
+        .AddAttribute("keepdims", static_cast<int64_t>(0));
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Gather"], 0);
+    EXPECT_EQ(op_to_count["ReduceSum"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.EmbeddingBag"], 1);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 13, 1e-5);
+}
+
+// Mean pooling with the axes of ReduceMean as an attribute.
+TEST_F(GraphTransformationTests, EmbeddingBagFusion_ReduceMean) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* table = builder.MakeInput<float>({50, 8}, -1.0f, 1.0f);
+    auto* indices = builder.MakeInput<int32_t>({4, 6}, -50, 49);
+    auto* gather_out = builder.MakeIntermediate();
+    auto* output = builder.MakeOutput();
+
+    builder.AddNode("Gather", {table, indices}, {gather_out});
+    Node& reduce = builder.AddNode("ReduceMean", {gather_out}, {output});
+    reduce.AddAttribute("axes", std::vector<int64_t>{-2});
+    reduce.AddAttribute("keepdims", static_cast<int64_t>(0));
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Gather"], 0);
+    EXPECT_EQ(op_to_count["ReduceMean"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.EmbeddingBag"], 1);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 13, 1e-5);
+}
+
+// The bag axis is kept, or the reduction is over the embedding axis.
+TEST_F(GraphTransformationTests, EmbeddingBagFusion_NotFused) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* table = builder.MakeInitializer<float>({20, 4}, -1.0f, 1.0f);
+    auto* other_table = builder.MakeInitializer<float>({20, 4}, -1.0f, 1.0f);
+    auto* indices = builder.MakeInput<int64_t>({3, 5}, 0, 19);
+    auto* gather_out = builder.MakeIntermediate();
+    auto* output = builder.MakeOutput();
+    auto* other_gather_out = builder.MakeIntermediate();
+    auto* other_output = builder.MakeOutput();
+
+    builder.AddNode("Gather", {table, indices}, {gather_out});
+    builder.AddNode("ReduceMean", {gather_out}, {output}).AddAttribute("axes", std::vector<int64_t>{1});
+
+    builder.AddNode("Gather", {other_table, indices}, {other_gather_out});
+    Node& reduce = builder.AddNode("ReduceMean", {other_gather_out}, {other_output});
+    reduce.AddAttribute("axes", std::vector<int64_t>{2});
+    reduce.AddAttribute("keepdims", static_cast<int64_t>(0));
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Gather"], 2);
+    EXPECT_EQ(op_to_count["ReduceMean"], 2);
+    EXPECT_EQ(op_to_count["com.microsoft.EmbeddingBag"], 0);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 13, 1e-5);
+}
+
+static void EnableElementwiseFusion(SessionOptions& session_options) {
+  ASSERT_STATUS_OK(session_options.config_options.AddConfigEntry(kOrtSessionOptionsEnableElementwiseFusion, "1"));
+}
+
+// Bias Add followed by the scale and activation of a GPT style block, with the chain value as the second argument
+// of Sub so the fused step is swapped.
+TEST_F(GraphTransformationTests, ElementwiseFusion_ActivationChain) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input = builder.MakeInput<float>({2, 3, 64}, -1.0f, 1.0f);
+    auto* bias = builder.MakeInitializer<float>({64}, -1.0f, 1.0f);
+    auto* scale = builder.MakeScalarInitializer<float>(0.5f);
+    auto* one = builder.MakeScalarInitializer<float>(1.0f);
+    auto* add_out = builder.MakeIntermediate();
+    auto* mul_out = builder.MakeIntermediate();
+    auto* tanh_out = builder.MakeIntermediate();
+    auto* output = builder.MakeOutput();
+
+    builder.AddNode("Add", {input, bias}, {add_out});
+    builder.AddNode("Mul", {add_out, scale}, {mul_out});
+    builder.AddNode("Tanh", {mul_out}, {tanh_out});
+    builder.AddNode("Sub", {one, tanh_out}, {output});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Add"], 0);
+    EXPECT_EQ(op_to_count["Mul"], 0);
+    EXPECT_EQ(op_to_count["Tanh"], 0);
+    EXPECT_EQ(op_to_count["Sub"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedElementwise"], 1);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 13, 1e-5, 0.0,
+                    nullptr, EnableElementwiseFusion);
+}
+
+// Swish: the chain input is also the other argument of the last step.
+TEST_F(GraphTransformationTests, ElementwiseFusion_ChainInputAsOperand) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input = builder.MakeInput<float>({4, 32}, -4.0f, 4.0f);
+    auto* sigmoid_out = builder.MakeIntermediate();
+    auto* output = builder.MakeOutput();
+
+    builder.AddNode("Sigmoid", {input}, {sigmoid_out});
+    builder.AddNode("Mul", {input, sigmoid_out}, {output});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Sigmoid"], 0);
+    EXPECT_EQ(op_to_count["Mul"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedElementwise"], 1);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 13, 1e-5, 0.0,
+                    nullptr, EnableElementwiseFusion);
+}
+
+// An operand broadcast along an inner dimension, and an intermediate value with two consumers, end the chains.
+TEST_F(GraphTransformationTests, ElementwiseFusion_UnsupportedBroadcastAndSharedValue) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input = builder.MakeInput<float>({2, 3, 8}, -1.0f, 1.0f);
+    auto* operand = builder.MakeInitializer<float>({2, 1, 8}, -1.0f, 1.0f);
+    auto* add_out = builder.MakeIntermediate();
+    auto* relu_out = builder.MakeIntermediate();
+    auto* output1 = builder.MakeOutput();
+    auto* output2 = builder.MakeOutput();
+
+    builder.AddNode("Add", {input, operand}, {add_out});
+    builder.AddNode("Relu", {add_out}, {relu_out});
+    builder.AddNode("Exp", {relu_out}, {output1});
+    builder.AddNode("Neg", {relu_out}, {output2});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Add"], 1);
+    EXPECT_EQ(op_to_count["Relu"], 1);
+    EXPECT_EQ(op_to_count["Exp"], 1);
+    EXPECT_EQ(op_to_count["Neg"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedElementwise"], 0);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 13, 0.0, 0.0,
+                    nullptr, EnableElementwiseFusion);
+}
+
+// The fused steps compute Exp, Log and Relu with Eigen and Sigmoid and Tanh with MLAS as the unfused kernels, so a
+// chain of them over several blocks gives the results of the unfused graph.
+TEST_F(GraphTransformationTests, ElementwiseFusion_SameResultsAsUnfused) {
+  auto build_test_case = [](ModelTestBuilder& builder) {
+    auto* input = builder.MakeInput<float>({8, 300}, -3.0f, 3.0f);
+    auto* bias = builder.MakeInitializer<float>({300}, -1.0f, 1.0f);
+    auto* one = builder.MakeScalarInitializer<float>(1.0f);
+    auto* add_out = builder.MakeIntermediate();
+    auto* exp_out = builder.MakeIntermediate();
+    auto* add_one_out = builder.MakeIntermediate();
+    auto* log_out = builder.MakeIntermediate();
+    auto* sub_out = builder.MakeIntermediate();
+    auto* relu_out = builder.MakeIntermediate();
+    auto* sigmoid_out = builder.MakeIntermediate();
+    auto* output = builder.MakeOutput();
+
+    builder.AddNode("Add", {input, bias}, {add_out});
+    builder.AddNode("Exp", {add_out}, {exp_out});
+    builder.AddNode("Add", {exp_out, one}, {add_one_out});
+    builder.AddNode("Log", {add_one_out}, {log_out});
+    builder.AddNode("Sub", {log_out, one}, {sub_out});
+    builder.AddNode("Relu", {sub_out}, {relu_out});
+    builder.AddNode("Sigmoid", {relu_out}, {sigmoid_out});
+    builder.AddNode("Tanh", {sigmoid_out}, {output});
+  };
+
+  auto check_graph = [](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["Exp"], 0);
+    EXPECT_EQ(op_to_count["Log"], 0);
+    EXPECT_EQ(op_to_count["Relu"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedElementwise"], 1);
+  };
+
+  TransformerTester(build_test_case, check_graph, TransformerLevel::Level1, TransformerLevel::Level2, 13, 1e-6, 0.0,
+                    nullptr, EnableElementwiseFusion);
+}
+
+static void VerifyElementwiseFusion(bool is_enabled, SessionOptions& session_options) {
+  std::unique_ptr<CPUExecutionProvider> e =
+      std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
+
+  bool has_elementwise_fusion = false;
+  auto transformers = optimizer_utils::GenerateTransformers(TransformerLevel::Level2, session_options, *e.get(), {});
+  for (auto& transformer : transformers) {
+    if (transformer->Name() == "ElementwiseFusion") {
+      has_elementwise_fusion = true;
+    }
+  }
+
+  EXPECT_EQ(has_elementwise_fusion, is_enabled);
+}
+
+TEST_F(GraphTransformationTests, ElementwiseFusion_SessionOptionConfig) {
+  SessionOptions session_options;
+
+  // ElementwiseFusion is not enabled by default.
+  VerifyElementwiseFusion(false, session_options);
+
+  ASSERT_STATUS_OK(session_options.config_options.AddConfigEntry(kOrtSessionOptionsEnableElementwiseFusion, "1"));
+  VerifyElementwiseFusion(true, session_options);
+}
+
 static void VerifyGeluApproximation(bool is_enabled, SessionOptions& session_options) {
   std::unique_ptr<CPUExecutionProvider> e =
       std::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo());
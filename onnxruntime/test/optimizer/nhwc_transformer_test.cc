@@ -8,6 +8,8 @@
 #include "graph_transform_test_builder.h"
 
 #include "core/graph/graph.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "test/util/include/asserts.h"
 
 namespace onnxruntime {
 namespace test {
@@ -500,6 +502,116 @@ TEST(NhwcTransformerTests, ConvMixTensorRanks) {
                     TransformerLevel::Level3);
 }
 
+static void EnableNhwcFloatLayout(SessionOptions& session_options) {
+  ASSERT_STATUS_OK(session_options.config_options.AddConfigEntry(kOrtSessionOptionsEnableNhwcFloatLayout, "1"));
+}
+
+TEST(NhwcTransformerTests, FloatConvBlock) {
+  auto build_test_case = [&](ModelTestBuilder& builder) {
+    auto* input_arg = builder.MakeInput<float>({1, 16, 15, 15}, -1.0f, 1.0f);
+    auto* conv1_output_arg = builder.MakeIntermediate();
+    auto* relu_output_arg = builder.MakeIntermediate();
+    auto* conv2_output_arg = builder.MakeIntermediate();
+    auto* conv3_output_arg = builder.MakeIntermediate();
+    auto* maxpool_output_arg = builder.MakeIntermediate();
+    auto* output_arg = builder.MakeOutput();
+
+    // 3x3 convolution, activation fused by the level 2 optimizers
+    auto* conv1_weight_arg = builder.MakeInitializer<float>({24, 16, 3, 3}, -0.5f, 0.5f);
+    auto* conv1_bias_arg = builder.MakeInitializer<float>({24}, -0.5f, 0.5f);
+    Node& conv1_node = builder.AddNode("Conv", {input_arg, conv1_weight_arg, conv1_bias_arg}, {conv1_output_arg});
+    conv1_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+    builder.AddNode("Relu", {conv1_output_arg}, {relu_output_arg});
+
+    // depthwise convolution
+    auto* conv2_weight_arg = builder.MakeInitializer<float>({24, 1, 3, 3}, -0.5f, 0.5f);
+    Node& conv2_node = builder.AddConvNode(relu_output_arg, conv2_weight_arg, conv2_output_arg);
+    conv2_node.AddAttribute("group", static_cast<int64_t>(24));
+    conv2_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+    conv2_node.AddAttribute("strides", std::vector<int64_t>{2, 2});
+
+    // pointwise convolution
+    auto* conv3_weight_arg = builder.MakeInitializer<float>({20, 24, 1, 1}, -0.5f, 0.5f);
+    auto* conv3_bias_arg = builder.MakeInitializer<float>({20}, -0.5f, 0.5f);
+    builder.AddNode("Conv", {conv2_output_arg, conv3_weight_arg, conv3_bias_arg}, {conv3_output_arg});
+
+    Node& maxpool_node = builder.AddNode("MaxPool", {conv3_output_arg}, {maxpool_output_arg});
+    maxpool_node.AddAttribute("kernel_shape", std::vector<int64_t>{3, 3});
+    maxpool_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+    builder.AddNode("GlobalAveragePool", {maxpool_output_arg}, {output_arg});
+  };
+
+  auto check_nhwc_graph = [&](InferenceSessionWrapper& session) {
+    auto op_to_count = CountOpsInGraph(session.GetGraph());
+    EXPECT_EQ(op_to_count["com.ms.internal.nhwc.Conv"], 3);
+    EXPECT_EQ(op_to_count["com.ms.internal.nhwc.MaxPool"], 1);
+    EXPECT_EQ(op_to_count["com.ms.internal.nhwc.GlobalAveragePool"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedConv"], 0);
+    EXPECT_EQ(op_to_count["Transpose"], 2);
+  };
+
+  TransformerTester(build_test_case,
+                    check_nhwc_graph,
+                    TransformerLevel::Level2,
+                    TransformerLevel::Level3,
+                    12,
+                    1e-5,
+                    1e-4,
+                    nullptr,
+                    EnableNhwcFloatLayout);
+}
+
+// The Transpose nodes are pushed through the element-wise operators between the NHWC nodes.
+TEST(NhwcTransformerTests, FloatConvAddAveragePool) {
+  auto test_case = [&](int64_t count_include_pad) {
+    auto build_test_case = [&](ModelTestBuilder& builder) {
+      auto* input_arg = builder.MakeInput<float>({2, 8, 9, 9}, -1.0f, 1.0f);
+      auto* conv1_output_arg = builder.MakeIntermediate();
+      auto* conv2_output_arg = builder.MakeIntermediate();
+      auto* add_output_arg = builder.MakeIntermediate();
+      auto* output_arg = builder.MakeOutput();
+
+      // grouped convolution
+      auto* conv1_weight_arg = builder.MakeInitializer<float>({12, 4, 3, 3}, -0.5f, 0.5f);
+      Node& conv1_node = builder.AddConvNode(input_arg, conv1_weight_arg, conv1_output_arg);
+      conv1_node.AddAttribute("group", static_cast<int64_t>(2));
+      conv1_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+
+      auto* conv2_weight_arg = builder.MakeInitializer<float>({12, 8, 1, 1}, -0.5f, 0.5f);
+      builder.AddConvNode(input_arg, conv2_weight_arg, conv2_output_arg);
+
+      builder.AddNode("Add", {conv1_output_arg, conv2_output_arg}, {add_output_arg});
+
+      Node& pool_node = builder.AddNode("AveragePool", {add_output_arg}, {output_arg});
+      pool_node.AddAttribute("kernel_shape", std::vector<int64_t>{3, 3});
+      pool_node.AddAttribute("pads", std::vector<int64_t>{1, 1, 1, 1});
+      pool_node.AddAttribute("strides", std::vector<int64_t>{2, 2});
+      pool_node.AddAttribute("count_include_pad", count_include_pad);
+    };
+
+    auto check_nhwc_graph = [&](InferenceSessionWrapper& session) {
+      auto op_to_count = CountOpsInGraph(session.GetGraph());
+      EXPECT_EQ(op_to_count["com.ms.internal.nhwc.Conv"], 2);
+      EXPECT_EQ(op_to_count["com.ms.internal.nhwc.AveragePool"], 1);
+      EXPECT_EQ(op_to_count["Add"], 1);
+      EXPECT_EQ(op_to_count["Transpose"], 2);
+    };
+
+    TransformerTester(build_test_case,
+                      check_nhwc_graph,
+                      TransformerLevel::Level2,
+                      TransformerLevel::Level3,
+                      12,
+                      1e-5,
+                      1e-4,
+                      nullptr,
+                      EnableNhwcFloatLayout);
+  };
+
+  test_case(0);
+  test_case(1);
+}
+
 #endif  // DISABLE_CONTRIB_OPS
 
 }  // namespace test
@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "graph_transform_test_builder.h"
+
+#include "core/graph/graph.h"
+#include "core/optimizer/rematerialization.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
+#include "test/util/include/asserts.h"
+
+namespace onnxruntime {
+namespace test {
+
+// A Resize output of 64KB used by the first and the last node, with a peak of four such values in between:
+// Resize -> Sigmoid -> Softmax -> Softmax -> Add(Softmax outputs) -> Add(Resize output).
+static void BuildResizeModel(ModelTestBuilder& builder) {
+  auto* input_arg = builder.MakeInput<float>({1, 1, 32, 32}, -1.0f, 1.0f);
+  auto* roi_arg = builder.MakeInitializer<float>({0}, {});
+  auto* scales_arg = builder.MakeInitializer<float>({4}, {1.0f, 1.0f, 4.0f, 4.0f});
+  auto* resize_output_arg = builder.MakeIntermediate();
+  auto* sigmoid_output_arg = builder.MakeIntermediate();
+  auto* softmax1_output_arg = builder.MakeIntermediate();
+  auto* softmax2_output_arg = builder.MakeIntermediate();
+  auto* add_output_arg = builder.MakeIntermediate();
+  auto* output_arg = builder.MakeOutput();
+
+  builder.AddNode("Resize", {input_arg, roi_arg, scales_arg}, {resize_output_arg});
+  builder.AddNode("Sigmoid", {resize_output_arg}, {sigmoid_output_arg});
+  builder.AddNode("Softmax", {sigmoid_output_arg}, {softmax1_output_arg});
+  builder.AddNode("Softmax", {softmax1_output_arg}, {softmax2_output_arg});
+  builder.AddNode("Add", {softmax1_output_arg, softmax2_output_arg}, {add_output_arg});
+  builder.AddNode("Add", {add_output_arg, resize_output_arg}, {output_arg});
+}
+
+static void TestResizeModel(size_t memory_budget, ExecutionOrder execution_order, int expected_resize_count,
+                            size_t expected_peak) {
+  auto check_graph = [&](InferenceSessionWrapper& session) {
+    const Graph& graph = session.GetGraph();
+    auto op_to_count = CountOpsInGraph(graph);
+    EXPECT_EQ(op_to_count["Resize"], expected_resize_count);
+    EXPECT_EQ(Rematerialization::EstimatePeakActivationSize(graph, execution_order), expected_peak);
+  };
+
+  auto add_session_options = [&](SessionOptions& session_options) {
+    session_options.execution_order = execution_order;
+    ASSERT_STATUS_OK(session_options.config_options.AddConfigEntry(kOrtSessionOptionsRematerializationMemoryBudget,
+                                                                   std::to_string(memory_budget).c_str()));
+  };
+
+  TransformerTester(BuildResizeModel,
+                    check_graph,
+                    TransformerLevel::Level2,
+                    TransformerLevel::Level3,
+                    12,
+                    0.0,
+                    0.0,
+                    nullptr,
+                    add_session_options);
+}
+
+constexpr size_t kValueSize = 128 * 128 * sizeof(float);
+
+// The Resize output is freed after the Sigmoid and recomputed before the last Add, which lowers the peak from four
+// values to three.
+TEST(RematerializationTests, RecomputeResize) {
+  TestResizeModel(200000, ExecutionOrder::DEFAULT, 2, 3 * kValueSize);
+  TestResizeModel(200000, ExecutionOrder::PRIORITY_BASED, 2, 3 * kValueSize);
+}
+
+TEST(RematerializationTests, BudgetAlreadyMet) {
+  TestResizeModel(4 * kValueSize, ExecutionOrder::DEFAULT, 1, 4 * kValueSize);
+}
+
+// The remaining values at the peak are produced by Softmax nodes, which aren't recomputed.
+TEST(RematerializationTests, BudgetNotReached) {
+  TestResizeModel(kValueSize, ExecutionOrder::DEFAULT, 2, 3 * kValueSize);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -8,6 +8,8 @@
 #include "asserts.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/model.h"
+#include "core/optimizer/constant_folding.h"
+#include "core/optimizer/conv_add_fusion.h"
 #include "core/optimizer/graph_transformer.h"
 #include "core/optimizer/graph_transformer_mgr.h"
 #include "dummy_graph_transformer.h"
@@ -71,5 +73,144 @@ TEST(RuleBasedGraphTransformerTest, TestSettingStepsInGraphTransformerManager) {
   ASSERT_STATUS_OK(graph_transformation_mgr.GetSteps(steps_queried));
   ASSERT_EQ(steps_queried, static_cast<unsigned> (10));
 }
+namespace {
+
+// Transformer counting how many times it is applied, which reports that it modified the graph the first
+// num_modifications times.
+class CountingGraphTransformer : public GraphTransformer {
+ public:
+  CountingGraphTransformer(const std::string& name, int num_modifications,
+                           std::vector<std::string> target_op_types = {}) noexcept
+      : GraphTransformer(name), num_modifications_(num_modifications), target_op_types_(target_op_types) {}
+
+  int NumApplications() const { return num_applications_; }
+
+  std::vector<std::string> TargetOpTypes() const override { return target_op_types_; }
+
+ private:
+  Status ApplyImpl(Graph& /*graph*/, bool& modified, int /*graph_level*/, const logging::Logger&) const override {
+    modified = num_applications_++ < num_modifications_;
+    return Status::OK();
+  }
+
+  const int num_modifications_;
+  const std::vector<std::string> target_op_types_;
+  mutable int num_applications_ = 0;
+};
+
+void ApplyCountingTransformers(bool incremental, int& num_unmodified_applications, int& num_mismatched_applications) {
+  auto model_uri = ORT_TSTR("testdata/transform/fusion/fuse-conv-bn-mul-add-unsqueeze.onnx");
+  std::shared_ptr<Model> model;
+  ASSERT_STATUS_OK(Model::Load(model_uri, model, nullptr, DefaultLoggingManager().DefaultLogger()));
+
+  auto modifying = std::make_unique<CountingGraphTransformer>("Modifying", 2);
+  auto unmodifying = std::make_unique<CountingGraphTransformer>("Unmodifying", 0);
+  auto mismatched = std::make_unique<CountingGraphTransformer>("Mismatched", 1, std::vector<std::string>{"Gemm"});
+  const auto* unmodifying_ptr = unmodifying.get();
+  const auto* mismatched_ptr = mismatched.get();
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.SetIncremental(incremental);
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(modifying), TransformerLevel::Level2));
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(unmodifying), TransformerLevel::Level2));
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(mismatched), TransformerLevel::Level2));
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(model->MainGraph(), TransformerLevel::Level2,
+                                                              DefaultLoggingManager().DefaultLogger()));
+
+  num_unmodified_applications = unmodifying_ptr->NumApplications();
+  num_mismatched_applications = mismatched_ptr->NumApplications();
+}
+
+}  // namespace
+
+TEST(RuleBasedGraphTransformerTest, IncrementalGraphTransformerManager) {
+  int num_unmodified_applications = 0;
+  int num_mismatched_applications = 0;
+
+  // the transformers are applied in each step until one doesn't modify the graph
+  ApplyCountingTransformers(false, num_unmodified_applications, num_mismatched_applications);
+  EXPECT_EQ(num_unmodified_applications, 3);
+  EXPECT_EQ(num_mismatched_applications, 3);
+
+  // the transformer which didn't modify the graph is applied again when another transformer modified it since, and
+  // the one matching Gemm is not applied to a graph without Gemm
+  ApplyCountingTransformers(true, num_unmodified_applications, num_mismatched_applications);
+  EXPECT_EQ(num_unmodified_applications, 2);
+  EXPECT_EQ(num_mismatched_applications, 0);
+}
+
+// X -> Conv(W) -> Add(Neg(B)) -> Y, with W and B initializers.
+static void CreateConvAddFoldableModel(std::unique_ptr<Model>& p_model) {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 12;
+  p_model = std::make_unique<Model>("test", true, ModelMetaData(), PathString(),
+                                    IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+                                    std::vector<ONNX_NAMESPACE::FunctionProto>(),
+                                    DefaultLoggingManager().DefaultLogger());
+  Graph& graph = p_model->MainGraph();
+
+  auto add_initializer = [&graph](const std::string& name, const std::vector<int64_t>& dims) {
+    TensorProto initializer;
+    initializer.set_name(name);
+    initializer.set_data_type(TensorProto_DataType_FLOAT);
+    int64_t size = 1;
+    for (int64_t dim : dims) {
+      initializer.add_dims(dim);
+      size *= dim;
+    }
+    for (int64_t i = 0; i < size; ++i) {
+      initializer.add_float_data(static_cast<float>(i + 1));
+    }
+    graph.AddInitializedTensor(initializer);
+  };
+  add_initializer("W", {2, 2, 1, 1});
+  add_initializer("B", {2, 1, 1});
+
+  TypeProto input_type;
+  input_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  for (int64_t dim : {1, 2, 4, 4}) {
+    input_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+  }
+
+  auto& x = graph.GetOrCreateNodeArg("X", &input_type);
+  auto& w = graph.GetOrCreateNodeArg("W", nullptr);
+  auto& b = graph.GetOrCreateNodeArg("B", nullptr);
+  auto& neg_b = graph.GetOrCreateNodeArg("neg_B", nullptr);
+  auto& conv = graph.GetOrCreateNodeArg("conv", nullptr);
+  auto& y = graph.GetOrCreateNodeArg("Y", nullptr);
+  graph.AddNode("neg", "Neg", "", {&b}, {&neg_b});
+  graph.AddNode("conv", "Conv", "", {&x, &w}, {&conv});
+  graph.AddNode("add", "Add", "", {&conv, &neg_b}, {&y});
+  ASSERT_STATUS_OK(graph.Resolve());
+}
+
+// A rule-based transformer applied incrementally revisits the consumers of the nodes replaced by constant folding,
+// as the rules may need their input to be a constant.
+TEST(RuleBasedGraphTransformerTest, IncrementalRuleAfterConstantFolding) {
+  for (bool incremental : {false, true}) {
+    std::unique_ptr<Model> p_model;
+    CreateConvAddFoldableModel(p_model);
+    Graph& graph = p_model->MainGraph();
+
+    auto rule_transformer = std::make_unique<RuleBasedGraphTransformer>("RuleTransformer");
+    ASSERT_STATUS_OK(rule_transformer->Register(std::make_unique<ConvAddFusion>()));
+
+    // the rules run first, when the Add input is still computed by Neg
+    onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+    graph_transformation_mgr.SetIncremental(incremental);
+    ASSERT_STATUS_OK(graph_transformation_mgr.Register(std::move(rule_transformer), TransformerLevel::Level1));
+    ASSERT_STATUS_OK(graph_transformation_mgr.Register(
+        std::make_unique<ConstantFolding>(*TestCPUExecutionProvider(), false /*skip_dequantize_linear*/),
+        TransformerLevel::Level1));
+    ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1,
+                                                                DefaultLoggingManager().DefaultLogger()));
+
+    auto op_to_count = CountOpsInGraph(graph);
+    EXPECT_EQ(op_to_count["Neg"], 0) << "incremental: " << incremental;
+    EXPECT_EQ(op_to_count["Add"], 0) << "incremental: " << incremental;
+    EXPECT_EQ(op_to_count["Conv"], 1) << "incremental: " << incremental;
+  }
+}
+
 }  // namespace test
-}  // namespace onnxruntime
\ No newline at end of file
+}  // namespace onnxruntime
@@ -413,6 +413,163 @@ TEST(If, ConditionalBranchesOnlyContainConstantNodes_ElseBranchExecution) {
   test.Run();
 }
 
+// The 'then' branch returns an outer scope value through an Identity node and the 'else' branch returns a constant.
+// Both are trivial branches whose outputs are aliased by the If node instead of executing the subgraph.
+// The If output is consumed by a Concat node as a graph output can't be aliased.
+class IfOpTesterWithTrivialBranches : public OpTester {
+ public:
+  IfOpTesterWithTrivialBranches() : OpTester("If") {
+  }
+
+ protected:
+  void AddNodes(onnxruntime::Graph& graph,
+                std::vector<onnxruntime::NodeArg*>& graph_input_defs,
+                std::vector<onnxruntime::NodeArg*>& graph_output_defs,
+                std::vector<std::function<void(onnxruntime::Node& node)>>& /*add_attribute_funcs*/) override {
+    // Graph inputs are 0:Cond for If, 1:Outer scope value for the 'then' branch
+    ASSERT_EQ(graph_input_defs.size(), 2u);
+    ASSERT_EQ(graph_output_defs.size(), 1u);
+
+    TypeProto float_tensor;
+    float_tensor.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+    auto& if_output = graph.GetOrCreateNodeArg("if_output", &float_tensor);
+    auto& if_node = graph.AddNode("if", "If", "If node", {graph_input_defs[0]}, {&if_output});
+
+    {
+      Model model("Then", false, DefaultLoggingManager().DefaultLogger());
+      auto& subgraph = model.MainGraph();
+      auto& outer_scope_value = subgraph.GetOrCreateNodeArg(graph_input_defs[1]->Name(), &float_tensor);
+      subgraph.AddOuterScopeNodeArg(graph_input_defs[1]->Name());
+      auto& then_output = subgraph.GetOrCreateNodeArg("then_output", &float_tensor);
+      subgraph.AddNode("identity", "Identity", "Identity", {&outer_scope_value}, {&then_output});
+      ASSERT_STATUS_OK(subgraph.Resolve());
+      if_node.AddAttribute("then_branch", subgraph.ToGraphProto());
+    }
+
+    {
+      Model model("Else", false, DefaultLoggingManager().DefaultLogger());
+      auto& subgraph = model.MainGraph();
+      auto& else_output = subgraph.GetOrCreateNodeArg("else_output", &float_tensor);
+      auto& constant_node = subgraph.AddNode("constant", "Constant", "Constant", {}, {&else_output});
+
+      AttributeProto value_attr;
+      value_attr.set_name("value");
+      value_attr.set_type(AttributeProto_AttributeType_TENSOR);
+      auto* value = value_attr.mutable_t();
+      value->set_data_type(TensorProto_DataType_FLOAT);
+      value->add_dims(2);
+      value->add_float_data(100.f);
+      value->add_float_data(200.f);
+      constant_node.AddAttributeProto(std::move(value_attr));
+
+      ASSERT_STATUS_OK(subgraph.Resolve());
+      if_node.AddAttribute("else_branch", subgraph.ToGraphProto());
+    }
+
+    auto& concat_node = graph.AddNode("concat", "Concat", "Concat", {&if_output, graph_input_defs[1]},
+                                      {graph_output_defs[0]});
+    concat_node.AddAttribute("axis", static_cast<int64_t>(0));
+  }
+};
+
+TEST(If, TrivialBranches_ThenBranchExecution) {
+  IfOpTesterWithTrivialBranches test;
+  test.AddInput<bool>("If_input", {1}, {true});
+  test.AddInput<float>("X", {2}, {1.f, 2.f});
+  test.AddOutput<float>("Y", {4}, {1.f, 2.f, 1.f, 2.f});
+  test.Run();
+}
+
+TEST(If, TrivialBranches_ElseBranchExecution) {
+  IfOpTesterWithTrivialBranches test;
+  test.AddInput<bool>("If_input", {1}, {false});
+  test.AddInput<float>("X", {2}, {1.f, 2.f});
+  test.AddOutput<float>("Y", {4}, {100.f, 200.f, 1.f, 2.f});
+  test.Run();
+}
+
+// The 'then' branch returns an activation of the parent graph, X2 = Neg(X). X2 is freed after the If node, so with the
+// memory pattern its block is given to Z2 = Neg(Z) which has a different size. The If output must not alias X2.
+class IfOpTesterWithActivationBranch : public OpTester {
+ public:
+  IfOpTesterWithActivationBranch() : OpTester("If") {
+  }
+
+ protected:
+  void AddNodes(onnxruntime::Graph& graph,
+                std::vector<onnxruntime::NodeArg*>& graph_input_defs,
+                std::vector<onnxruntime::NodeArg*>& graph_output_defs,
+                std::vector<std::function<void(onnxruntime::Node& node)>>& /*add_attribute_funcs*/) override {
+    // Graph inputs are 0:Cond for If, 1:X, 2:Z
+    ASSERT_EQ(graph_input_defs.size(), 3u);
+    ASSERT_EQ(graph_output_defs.size(), 1u);
+
+    TypeProto float_tensor;
+    float_tensor.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+    auto& x2 = graph.GetOrCreateNodeArg("X2", &float_tensor);
+    graph.AddNode("neg_x", "Neg", "Neg", {graph_input_defs[1]}, {&x2});
+
+    auto& if_output = graph.GetOrCreateNodeArg("if_output", &float_tensor);
+    auto& if_node = graph.AddNode("if", "If", "If node", {graph_input_defs[0]}, {&if_output});
+
+    {
+      Model model("Then", false, DefaultLoggingManager().DefaultLogger());
+      auto& subgraph = model.MainGraph();
+      auto& outer_scope_value = subgraph.GetOrCreateNodeArg(x2.Name(), &float_tensor);
+      subgraph.AddOuterScopeNodeArg(x2.Name());
+      auto& then_output = subgraph.GetOrCreateNodeArg("then_output", &float_tensor);
+      subgraph.AddNode("identity", "Identity", "Identity", {&outer_scope_value}, {&then_output});
+      ASSERT_STATUS_OK(subgraph.Resolve());
+      if_node.AddAttribute("then_branch", subgraph.ToGraphProto());
+    }
+
+    {
+      Model model("Else", false, DefaultLoggingManager().DefaultLogger());
+      auto& subgraph = model.MainGraph();
+      auto& else_output = subgraph.GetOrCreateNodeArg("else_output", &float_tensor);
+      auto& constant_node = subgraph.AddNode("constant", "Constant", "Constant", {}, {&else_output});
+
+      AttributeProto value_attr;
+      value_attr.set_name("value");
+      value_attr.set_type(AttributeProto_AttributeType_TENSOR);
+      auto* value = value_attr.mutable_t();
+      value->set_data_type(TensorProto_DataType_FLOAT);
+      value->add_dims(2);
+      value->add_float_data(100.f);
+      value->add_float_data(200.f);
+      constant_node.AddAttributeProto(std::move(value_attr));
+
+      ASSERT_STATUS_OK(subgraph.Resolve());
+      if_node.AddAttribute("else_branch", subgraph.ToGraphProto());
+    }
+
+    auto& z2 = graph.GetOrCreateNodeArg("Z2", nullptr);
+    graph.AddNode("neg_z", "Neg", "Neg", {graph_input_defs[2]}, {&z2});
+
+    auto& concat_node = graph.AddNode("concat", "Concat", "Concat", {&if_output, &z2}, {graph_output_defs[0]});
+    concat_node.AddAttribute("axis", static_cast<int64_t>(0));
+  }
+};
+
+// Several runs so the later ones use the memory pattern traced by the first one.
+TEST(If, TrivialBranches_ActivationWithMemoryPattern) {
+  IfOpTesterWithActivationBranch test;
+  test.AddInput<bool>("If_input", {1}, {true});
+  test.AddInput<float>("X", {2}, {1.f, 2.f});
+  test.AddInput<float>("Z", {3}, {3.f, 4.f, 5.f});
+  test.AddOutput<float>("Y", {5}, {-1.f, -2.f, -3.f, -4.f, -5.f});
+  test.SetNumRunCalls(3);
+
+  SessionOptions so;
+  so.enable_mem_pattern = true;
+  so.execution_mode = ExecutionMode::ORT_SEQUENTIAL;
+  test.Run(so);
+}
+
 // This is to test an "If" node with just a "SequenceEmpty" node in the "then" and "else" conditional branches
 class IfOpTesterWithSequencesAsOutput : public OpTester {
  public:
@@ -126,6 +126,32 @@ TEST(LabelEncoder, StringToFloatOpset2) {
   test.Run();
 }
 
+// A key given more than once is mapped to its last value, and the empty string is a valid key.
+TEST(LabelEncoder, StringToFloatDuplicateKeysOpset2) {
+  std::vector<std::int64_t> dims{6};
+
+  std::vector<std::string> input{"AA", "", "BB", "A", "AAA", "key 999"};
+  std::vector<float> output{3.0f, 4.0f, 2.0f, -1.0f, -1.0f, 999.0f};
+
+  OpTester test("LabelEncoder", 2, onnxruntime::kMLDomain);
+
+  std::vector<std::string> keys{"AA", "BB", "AA", ""};
+  std::vector<float> values{1.0f, 2.0f, 3.0f, 4.0f};
+  for (int i = 0; i < 1000; ++i) {
+    keys.push_back("key " + std::to_string(i));
+    values.push_back(static_cast<float>(i));
+  }
+
+  test.AddAttribute("keys_strings", keys);
+  test.AddAttribute("values_floats", values);
+  test.AddAttribute("default_float", -1.0f);
+
+  test.AddInput<std::string>("X", dims, input);
+  test.AddOutput<float>("Y", dims, output);
+
+  test.Run();
+}
+
 TEST(LabelEncoder, FloatToInt64Opset2) {
   std::vector<std::int64_t> dims{5};
 
@@ -1,6 +1,8 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <cmath>
+
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
 
@@ -114,6 +116,61 @@ TEST(MLOpTest, SVMRegressorNuSVCPolyKernel) {
   test.Run();
 }
 
+// More support vectors than the block size the kernel function is applied with, and inputs equal to support vectors
+// far from the origin, whose distance to them is computed again from the vectors.
+TEST(MLOpTest, SVMRegressorRBFManySupportVectors) {
+  constexpr int64_t num_vectors = 1500;
+  constexpr int64_t num_features = 7;
+  constexpr int64_t num_batches = 5;
+  constexpr float gamma = 0.05f;
+
+  std::vector<float> support_vectors(num_vectors * num_features);
+  std::vector<float> coefficients(num_vectors);
+  for (int64_t i = 0; i < num_vectors; ++i) {
+    for (int64_t f = 0; f < num_features; ++f) {
+      support_vectors[i * num_features + f] = 100.f + static_cast<float>((i * 7 + f * 3) % 23) / 4.f;
+    }
+    coefficients[i] = static_cast<float>(i % 5) / 10.f - 0.2f;
+  }
+
+  std::vector<float> X(num_batches * num_features);
+  for (int64_t n = 0; n < num_batches; ++n) {
+    for (int64_t f = 0; f < num_features; ++f) {
+      // the even batches are support vectors
+      X[n * num_features + f] = n % 2 == 0 ? support_vectors[(n * 311) * num_features + f]
+                                           : 101.f + static_cast<float>((n + f) % 9) / 3.f;
+    }
+  }
+
+  const float rho = 0.5f;
+  std::vector<float> predictions(num_batches);
+  for (int64_t n = 0; n < num_batches; ++n) {
+    double sum = rho;
+    for (int64_t i = 0; i < num_vectors; ++i) {
+      double distance = 0;
+      for (int64_t f = 0; f < num_features; ++f) {
+        const double diff = static_cast<double>(X[n * num_features + f]) - support_vectors[i * num_features + f];
+        distance += diff * diff;
+      }
+      sum += coefficients[i] * std::exp(-gamma * distance);
+    }
+    predictions[n] = static_cast<float>(sum);
+  }
+
+  OpTester test("SVMRegressor", 1, onnxruntime::kMLDomain);
+  test.AddAttribute("kernel_type", std::string("RBF"));
+  test.AddAttribute("coefficients", coefficients);
+  test.AddAttribute("support_vectors", support_vectors);
+  test.AddAttribute("rho", std::vector<float>{rho});
+  test.AddAttribute("kernel_params", std::vector<float>{gamma, 0.f, 3.f});
+  test.AddAttribute("n_supports", num_vectors);
+
+  test.AddInput<float>("X", {num_batches, num_features}, X);
+  test.AddOutput<float>("Y", {num_batches, 1}, predictions);
+  test.SetOutputAbsErr("Y", 1e-3f);
+  test.Run();
+}
+
 TEST(MLOpTest, SVMRegressorLinear) {
   OpTester test("SVMRegressor", 1, onnxruntime::kMLDomain);
   std::vector<float> coefficients = {0.28290501f, -0.0266512f, 0.01674867f};
@@ -1,8 +1,7 @@
 ﻿// Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
-#if ((__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L)))
-//TODO: handle the u8string.
-#else
+#include <algorithm>
+
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
 
@@ -38,6 +37,9 @@ void InitTestAttr(OpTester& test, const std::string& case_change_action,
 
 using namespace str_normalizer_test;
 
+#if ((__cplusplus >= 201703L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 201703L)))
+//TODO: handle the u8string.
+#else
 TEST(ContribOpTest, StringNormalizerTest) {
   // - casesensitive approach
   // - no stopwords.
@@ -201,7 +203,88 @@ TEST(ContribOpTest, StringNormalizerTest) {
     test.Run(OpTester::ExpectResult::kExpectSuccess);
   }
 }
+#endif
+
+// The tests below write the utf8 strings as bytes so they build with C++17.
+
+static std::string AsciiUpper(std::string str) {
+  std::transform(str.begin(), str.end(), str.begin(), [](char c) {
+    return c >= 'a' && c <= 'z' ? static_cast<char>(c - 0x20) : c;
+  });
+  return str;
+}
+
+static std::string AsciiLower(std::string str) {
+  std::transform(str.begin(), str.end(), str.begin(), [](char c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c + 0x20) : c;
+  });
+  return str;
+}
+
+// Lengths around the 8 characters cased at a time by the ASCII fast path, with the characters next to the letters.
+TEST(ContribOpTest, StringNormalizerAsciiLengths) {
+  const std::vector<std::string> input = {"aBc@[`{",            // 7
+                                          "@AZ[`az{",           // 8
+                                          "Hello W0r",          // 9
+                                          "The Quick Brown F",  // 17
+                                          "", "z", "Z"};
+  const std::vector<int64_t> dims{static_cast<int64_t>(input.size())};
+
+  for (const char* action : {"UPPER", "LOWER"}) {
+    const bool upper = std::string(action) == "UPPER";
+    OpTester test("StringNormalizer", opset_ver, domain);
+    InitTestAttr(test, action, true, {}, test_locale);
+    test.AddInput<std::string>("T", dims, input);
+
+    std::vector<std::string> output;
+    for (const auto& str : input) {
+      output.push_back(upper ? AsciiUpper(str) : AsciiLower(str));
+    }
+    test.AddOutput<std::string>("Y", dims, output);
+    test.Run(OpTester::ExpectResult::kExpectSuccess);
+  }
+}
+
+// A non-ASCII character in the first 8 characters of a string or after them takes it off the ASCII fast path.
+TEST(ContribOpTest, StringNormalizerNonAsciiInWord) {
+  // r\xC3\xA9sum\xC3\xA9s is "résumés", caf\xC3\xA9ine is "caféine" and \xC3\xA9 is é.
+  const std::vector<std::string> input = {"r\xC3\xA9sum\xC3\xA9s", "abcdefghcaf\xC3\xA9ine", "abcdefgh", "Monday"};
+  const std::vector<std::string> output = {"R\xC3\x89SUM\xC3\x89S", "ABCDEFGHCAF\xC3\x89INE", "ABCDEFGH"};
+
+  OpTester test("StringNormalizer", opset_ver, domain);
+  InitTestAttr(test, "UPPER", false, {"monday"}, test_locale);
+  test.AddInput<std::string>("T", {4}, input);
+  test.AddOutput<std::string>("Y", {3}, output);
+  test.Run(OpTester::ExpectResult::kExpectSuccess);
+}
+
+// Enough strings for the casing and filtering to be split across the threads of the pool.
+TEST(ContribOpTest, StringNormalizerParallel) {
+  constexpr int64_t num_strings = 20000;
+  std::vector<std::string> input;
+  std::vector<std::string> output;
+  input.reserve(num_strings);
+  for (int64_t i = 0; i < num_strings; ++i) {
+    if (i % 7 == 3) {
+      input.push_back(i % 2 ? "STOP" : "Stop");
+      continue;
+    }
+
+    // mixed case ASCII strings of varying lengths, and some non-ASCII ones
+    std::string str = "Word" + std::to_string(i) + std::string(static_cast<size_t>(i % 11), i % 2 ? 'x' : 'Y');
+    if (i % 13 == 0) {
+      str += "caf\xC3\xA9";
+    }
+    input.push_back(str);
+    output.push_back(AsciiLower(str));
+  }
+
+  OpTester test("StringNormalizer", opset_ver, domain);
+  InitTestAttr(test, "LOWER", false, {"stop"}, test_locale);
+  test.AddInput<std::string>("T", {num_strings}, input);
+  test.AddOutput<std::string>("Y", {static_cast<int64_t>(output.size())}, output);
+  test.Run(OpTester::ExpectResult::kExpectSuccess);
+}
 
 }  // namespace test
 }  // namespace onnxruntime
-#endif
\ No newline at end of file
@@ -1,7 +1,11 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
+#include <random>
+
 #include "gtest/gtest.h"
+#include "core/providers/cpu/object_detection/non_max_suppression_helper.h"
 #include "test/providers/provider_test_utils.h"
 
 namespace onnxruntime {
@@ -383,5 +387,92 @@ TEST(NonMaxSuppressionOpTest, WithIOUThresholdOpset11) {
   test.Run();
 }
 
+// Enough (batch, class) pairs and boxes for the pairs to be processed in parallel and the IOU to be computed with
+// several blocks of selected boxes, compared with a greedy selection in score order using SuppressByIOU.
+static void RunManyBoxesTest(int64_t center_point_box) {
+  constexpr int64_t num_batches = 2;
+  constexpr int64_t num_classes = 12;
+  constexpr int64_t num_boxes = 400;
+  constexpr int64_t max_output_boxes_per_class = 40;
+  constexpr float iou_threshold = 0.45f;
+  constexpr float score_threshold = 0.25f;
+
+  std::mt19937 generator(5);
+  std::uniform_real_distribution<float> position(0.0f, 100.0f);
+  std::uniform_real_distribution<float> size(1.0f, 15.0f);
+  std::uniform_real_distribution<float> score(0.0f, 1.0f);
+
+  std::vector<float> boxes(num_batches * num_boxes * 4);
+  for (size_t i = 0; i < boxes.size(); i += 4) {
+    if (center_point_box == 0) {
+      boxes[i] = position(generator);
+      boxes[i + 1] = position(generator);
+      boxes[i + 2] = boxes[i] + size(generator);
+      boxes[i + 3] = boxes[i + 1] + size(generator);
+    } else {
+      boxes[i] = position(generator);
+      boxes[i + 1] = position(generator);
+      boxes[i + 2] = size(generator);
+      boxes[i + 3] = size(generator);
+    }
+  }
+
+  // some equal scores so that the order of the box indexes matters
+  std::vector<float> scores(num_batches * num_classes * num_boxes);
+  for (size_t i = 0; i < scores.size(); ++i) {
+    scores[i] = i % 11 == 0 ? 0.5f : score(generator);
+  }
+
+  std::vector<int64_t> expected;
+  int64_t num_selected = 0;
+  for (int64_t b = 0; b < num_batches; ++b) {
+    for (int64_t c = 0; c < num_classes; ++c) {
+      const float* class_scores = scores.data() + (b * num_classes + c) * num_boxes;
+      std::vector<int64_t> order;
+      for (int64_t i = 0; i < num_boxes; ++i) {
+        if (class_scores[i] > score_threshold) {
+          order.push_back(i);
+        }
+      }
+      std::stable_sort(order.begin(), order.end(),
+                       [class_scores](int64_t lhs, int64_t rhs) { return class_scores[lhs] > class_scores[rhs]; });
+
+      std::vector<int64_t> selected;
+      for (int64_t i : order) {
+        if (static_cast<int64_t>(selected.size()) == max_output_boxes_per_class) {
+          break;
+        }
+        const bool suppressed = std::any_of(selected.begin(), selected.end(), [&](int64_t j) {
+          return nms_helpers::SuppressByIOU(boxes.data() + b * num_boxes * 4, i, j, center_point_box,
+                                            iou_threshold);
+        });
+        if (!suppressed) {
+          selected.push_back(i);
+          expected.insert(expected.end(), {b, c, i});
+          ++num_selected;
+        }
+      }
+    }
+  }
+
+  OpTester test("NonMaxSuppression", 11, kOnnxDomain);
+  test.AddAttribute<int64_t>("center_point_box", center_point_box);
+  test.AddInput<float>("boxes", {num_batches, num_boxes, 4}, boxes);
+  test.AddInput<float>("scores", {num_batches, num_classes, num_boxes}, scores);
+  test.AddInput<int64_t>("max_output_boxes_per_class", {}, {max_output_boxes_per_class});
+  test.AddInput<float>("iou_threshold", {}, {iou_threshold});
+  test.AddInput<float>("score_threshold", {}, {score_threshold});
+  test.AddOutput<int64_t>("selected_indices", {num_selected, 3}, expected);
+  test.Run();
+}
+
+TEST(NonMaxSuppressionOpTest, ManyClassesAndBoxes) {
+  RunManyBoxesTest(0);
+}
+
+TEST(NonMaxSuppressionOpTest, ManyClassesAndBoxesCenterPointBoxFormat) {
+  RunManyBoxesTest(1);
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -1,6 +1,9 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
 #include <functional>
 #include <vector>
 
@@ -15,6 +18,7 @@ namespace onnxruntime {
 namespace test {
 
 static const int kMinOpsetVersion = 17;
+static constexpr double kPi = 3.14159265358979323846;
 
 static void TestNaiveDFTFloat(bool onesided) {
   OpTester test("DFT", kMinOpsetVersion);
@@ -139,6 +143,88 @@ TEST(SignalOpsTest, DFT_invertible_real) { TestDFTInvertible(false); }
 
 TEST(SignalOpsTest, DFT_invertible_complex) { TestDFTInvertible(true); }
 
+// Naive O(n^2) transform of a [batch, length, 1 or 2] signal along axis 1 in double precision, used as the reference
+// for the FFT based kernels. The signal is truncated or zero padded to dft_length and multiplied by the window.
+static vector<float> NaiveDFT(const vector<float>& input, int64_t batch, int64_t length, bool complex,
+                              int64_t dft_length, bool inverse, bool onesided, const vector<float>& window = {}) {
+  const int64_t components = complex ? 2 : 1;
+  const int64_t output_length = onesided ? (dft_length >> 1) + 1 : dft_length;
+  const double sign = inverse ? 1.0 : -1.0;
+  vector<float> output;
+  output.reserve(batch * output_length * 2);
+  for (int64_t b = 0; b < batch; ++b) {
+    for (int64_t k = 0; k < output_length; ++k) {
+      std::complex<double> sum;
+      for (int64_t j = 0; j < std::min(length, dft_length); ++j) {
+        const float* x = input.data() + (b * length + j) * components;
+        std::complex<double> value(x[0], complex ? x[1] : 0.0);
+        if (!window.empty()) {
+          value *= window[j];
+        }
+        const double angle = sign * 2.0 * kPi * static_cast<double>((j * k) % dft_length) / dft_length;
+        sum += value * std::polar(1.0, angle);
+      }
+      if (inverse) {
+        sum /= static_cast<double>(dft_length);
+      }
+      output.push_back(static_cast<float>(sum.real()));
+      output.push_back(static_cast<float>(sum.imag()));
+    }
+  }
+
+  return output;
+}
+
+// Compare the DFT kernel to the naive transform for lengths using each radix of the mixed-radix decomposition, and
+// for prime lengths computed with Bluestein's algorithm.
+static void TestDFTMatchesNaive(bool complex, bool onesided, bool inverse) {
+  RandomValueGenerator random(GetTestRandomSeed());
+  const int64_t batch = 3;
+  for (int64_t length : {1, 2, 3, 4, 5, 6, 12, 15, 30, 49, 97, 160, 400}) {
+    OpTester test("DFT", kMinOpsetVersion);
+    vector<int64_t> shape{batch, length, complex ? 2 : 1};
+    vector<float> input = random.Uniform<float>(shape, -1.f, 1.f);
+    const int64_t output_length = onesided ? (length >> 1) + 1 : length;
+
+    test.AddInput<float>("input", shape, input);
+    test.AddAttribute<int64_t>("onesided", static_cast<int64_t>(onesided));
+    test.AddAttribute<int64_t>("inverse", static_cast<int64_t>(inverse));
+    test.AddOutput<float>("output", {batch, output_length, 2},
+                          NaiveDFT(input, batch, length, complex, length, inverse, onesided));
+    test.SetOutputAbsErr("output", 1e-4f);
+    test.Run();
+  }
+}
+
+TEST(SignalOpsTest, DFTFloat_matches_naive_real) { TestDFTMatchesNaive(false, false, false); }
+
+TEST(SignalOpsTest, DFTFloat_matches_naive_real_onesided) { TestDFTMatchesNaive(false, true, false); }
+
+TEST(SignalOpsTest, DFTFloat_matches_naive_complex) { TestDFTMatchesNaive(true, false, false); }
+
+TEST(SignalOpsTest, DFTFloat_matches_naive_inverse) {
+  TestDFTMatchesNaive(false, false, true);
+  TestDFTMatchesNaive(true, false, true);
+}
+
+TEST(SignalOpsTest, DFTFloat_dft_length) {
+  RandomValueGenerator random(GetTestRandomSeed());
+  const int64_t length = 10;
+  vector<int64_t> shape{2, length, 1};
+  vector<float> input = random.Uniform<float>(shape, -1.f, 1.f);
+
+  // truncated to a prime length and zero padded to a mixed-radix one
+  for (int64_t dft_length : {7, 24}) {
+    OpTester test("DFT", kMinOpsetVersion);
+    test.AddInput<float>("input", shape, input);
+    test.AddInput<int64_t>("dft_length", {}, {dft_length});
+    test.AddOutput<float>("output", {2, dft_length, 2},
+                          NaiveDFT(input, 2, length, false, dft_length, false, false));
+    test.SetOutputAbsErr("output", 1e-4f);
+    test.Run();
+  }
+}
+
 TEST(SignalOpsTest, STFTFloat) {
   OpTester test("STFT", kMinOpsetVersion);
 
@@ -166,6 +252,43 @@ TEST(SignalOpsTest, STFTFloat) {
   test.Run();
 }
 
+// The frame length of 400 samples with a hop of 160 samples is the usual front end of speech models.
+TEST(SignalOpsTest, STFTFloat_mixed_radix) {
+  RandomValueGenerator random(GetTestRandomSeed());
+  const int64_t batch = 2;
+  const int64_t signal_length = 1600;
+  const int64_t frame_length = 400;
+  const int64_t frame_step = 160;
+  const int64_t n_frames = (signal_length - frame_length) / frame_step + 1;
+  const int64_t output_length = (frame_length >> 1) + 1;
+
+  vector<int64_t> signal_shape{batch, signal_length, 1};
+  vector<float> signal = random.Uniform<float>(signal_shape, -1.f, 1.f);
+  vector<float> window(frame_length);
+  for (int64_t i = 0; i < frame_length; ++i) {
+    window[i] = static_cast<float>(0.5 - 0.5 * std::cos(2.0 * kPi * i / frame_length));
+  }
+
+  // the frames of the signal as a batch of signals for the reference
+  vector<float> frames;
+  for (int64_t b = 0; b < batch; ++b) {
+    for (int64_t f = 0; f < n_frames; ++f) {
+      const auto begin = signal.begin() + b * signal_length + f * frame_step;
+      frames.insert(frames.end(), begin, begin + frame_length);
+    }
+  }
+
+  OpTester test("STFT", kMinOpsetVersion);
+  test.AddInput<float>("signal", signal_shape, signal);
+  test.AddInput<int64_t>("frame_step", {}, {frame_step});
+  test.AddInput<float>("window", {frame_length}, window);
+  test.AddInput<int64_t>("frame_length", {}, {frame_length});
+  test.AddOutput<float>("output", {batch, n_frames, output_length, 2},
+                        NaiveDFT(frames, batch * n_frames, frame_length, false, frame_length, false, true, window));
+  test.SetOutputAbsErr("output", 1e-4f);
+  test.Run();
+}
+
 TEST(SignalOpsTest, HannWindowFloat) {
   OpTester test("HannWindow", kMinOpsetVersion);
 
@@ -253,5 +253,27 @@ TEST(GatherElementsOpTest, BigIndices) {
   test1.Run();
 }
 
+// A single row that is split in several chunks, with negative indices.
+TEST(GatherElementsOpTest, LongRowNegativeIndices) {
+  OpTester test("GatherElements", 13);
+  test.AddAttribute<int64_t>("axis", 0LL);
+
+  constexpr int64_t kSize = 20 * 1000;
+  std::vector<float> input(kSize);
+  std::iota(std::begin(input), std::end(input), 0.f);
+
+  std::vector<int64_t> indices(kSize);
+  std::vector<float> output(kSize);
+  for (int64_t i = 0; i < kSize; ++i) {
+    indices[i] = -1 - i;
+    output[i] = static_cast<float>(kSize - 1 - i);
+  }
+
+  test.AddInput<float>("data", {kSize}, input);
+  test.AddInput<int64_t>("indices", {kSize}, indices);
+  test.AddOutput<float>("output", {kSize}, output);
+  test.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -435,5 +435,88 @@ TEST(GatherOpTest, Gather_axis1_neg_indices2d_int8) {
   test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});  // TensorRT: Assertion `regionRanges != nullptr' failed
 }
 
+// Rows large enough to be copied with prefetching, with negative and repeated indices.
+TEST(GatherOpTest, Gather_axis0_large_rows) {
+  constexpr int64_t kNumRows = 1000;
+  constexpr int64_t kRowSize = 128;
+  constexpr int64_t kNumIndices = 3000;
+
+  std::vector<float> data(kNumRows * kRowSize);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<float>(i);
+  }
+
+  std::vector<int64_t> indices(kNumIndices);
+  std::vector<float> output;
+  output.reserve(kNumIndices * kRowSize);
+  for (int64_t i = 0; i < kNumIndices; ++i) {
+    const int64_t row = (i * 37) % kNumRows;
+    indices[i] = i % 2 == 0 ? row : row - kNumRows;
+    output.insert(output.end(), data.begin() + row * kRowSize, data.begin() + (row + 1) * kRowSize);
+  }
+
+  OpTester test("Gather", 13);
+  test.AddAttribute<int64_t>("axis", 0LL);
+  test.AddInput<float>("data", {kNumRows, kRowSize}, data);
+  test.AddInput<int64_t>("indices", {kNumIndices}, indices);
+  test.AddOutput<float>("output", {kNumIndices, kRowSize}, output);
+  test.Run();
+}
+
+// Single elements gathered along the last axis, for each element size.
+template <typename T>
+void RunGatherLastAxisTest() {
+  constexpr int64_t kNumBatches = 50;
+  constexpr int64_t kAxisDim = 40;
+  constexpr int64_t kNumIndices = 300;
+
+  std::vector<T> data(kNumBatches * kAxisDim);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<T>(i % 127);
+  }
+
+  std::vector<int32_t> indices(kNumIndices);
+  for (int64_t i = 0; i < kNumIndices; ++i) {
+    indices[i] = static_cast<int32_t>((i * 7) % kAxisDim - (i % 3 == 0 ? kAxisDim : 0));
+  }
+
+  std::vector<T> output;
+  output.reserve(kNumBatches * kNumIndices);
+  for (int64_t b = 0; b < kNumBatches; ++b) {
+    for (int32_t idx : indices) {
+      output.push_back(data[b * kAxisDim + (idx < 0 ? idx + kAxisDim : idx)]);
+    }
+  }
+
+  OpTester test("Gather", 13);
+  test.AddAttribute<int64_t>("axis", 1LL);
+  test.AddInput<T>("data", {kNumBatches, kAxisDim}, data);
+  test.AddInput<int32_t>("indices", {kNumIndices}, indices);
+  test.AddOutput<T>("output", {kNumBatches, kNumIndices}, output);
+  test.Run();
+}
+
+TEST(GatherOpTest, Gather_last_axis_elements) {
+  RunGatherLastAxisTest<int8_t>();
+  RunGatherLastAxisTest<int16_t>();
+  RunGatherLastAxisTest<float>();
+  RunGatherLastAxisTest<int64_t>();
+}
+
+TEST(GatherOpTest, Gather_axis0_string_rows) {
+  OpTester test("Gather", 13);
+  test.AddAttribute<int64_t>("axis", 0LL);
+  test.AddInput<std::string>("data", {3, 2},
+                             {"a", "b",
+                              "c", "d",
+                              "e", "f"});
+  test.AddInput<int64_t>("indices", {3}, {2, -3, 1});
+  test.AddOutput<std::string>("output", {3, 2},
+                              {"e", "f",
+                               "a", "b",
+                               "c", "d"});
+  test.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
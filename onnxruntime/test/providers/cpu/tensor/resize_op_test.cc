@@ -1712,5 +1712,107 @@ TEST(ResizeOpTest, ResizeOpTypeCheck_Ver13) {
   ResizeOpTypeCheck_Ver_11_13<uint8_t>(13);
 }
 
+// NHWC input with channels that are not resized, which are copied in blocks, and enough rows to be parallelized.
+TEST(ResizeOpTest, ResizeOpNearestUpSample_NhwcChannelsNotResized) {
+  OpTester test("Resize", 13);
+  std::vector<float> roi{};
+  std::vector<float> scales{1.0f, 2.0f, 2.0f, 1.0f};
+
+  test.AddAttribute("mode", "nearest");
+  test.AddAttribute("coordinate_transformation_mode", "asymmetric");
+  test.AddAttribute("nearest_mode", "floor");
+
+  constexpr int64_t N = 2, H = 16, W = 12, C = 3;
+  std::vector<float> X(N * H * W * C);
+  for (size_t i = 0; i < X.size(); ++i) {
+    X[i] = static_cast<float>(i);
+  }
+
+  std::vector<float> Y;
+  for (int64_t n = 0; n < N; ++n) {
+    for (int64_t y = 0; y < 2 * H; ++y) {
+      for (int64_t x = 0; x < 2 * W; ++x) {
+        for (int64_t c = 0; c < C; ++c) {
+          Y.push_back(X[((n * H + y / 2) * W + x / 2) * C + c]);
+        }
+      }
+    }
+  }
+
+  test.AddInput<float>("X", {N, H, W, C}, X);
+  test.AddInput<float>("roi", {0}, roi);
+  test.AddInput<float>("scales", {4}, scales);
+  test.AddOutput<float>("Y", {N, 2 * H, 2 * W, C}, Y);
+  test.Run();
+}
+
+// Bilinear interpolation with aligned corners reproduces a linear function of the coordinates, for every channel.
+TEST(ResizeOpTest, ResizeOpLinearUpSample_AlignCornersManyChannels) {
+  OpTester test("Resize", 13);
+  std::vector<float> roi{};
+  std::vector<float> scales{};
+
+  test.AddAttribute("mode", "linear");
+  test.AddAttribute("coordinate_transformation_mode", "align_corners");
+
+  constexpr int64_t N = 2, C = 4, H = 5, W = 7;
+  constexpr int64_t OH = 17, OW = 25;
+  auto value = [](int64_t image, float y, float x) { return static_cast<float>(image) + 0.5f * y - 0.25f * x; };
+
+  std::vector<float> X;
+  for (int64_t image = 0; image < N * C; ++image) {
+    for (int64_t y = 0; y < H; ++y) {
+      for (int64_t x = 0; x < W; ++x) {
+        X.push_back(value(image, static_cast<float>(y), static_cast<float>(x)));
+      }
+    }
+  }
+
+  std::vector<float> Y;
+  for (int64_t image = 0; image < N * C; ++image) {
+    for (int64_t y = 0; y < OH; ++y) {
+      for (int64_t x = 0; x < OW; ++x) {
+        Y.push_back(value(image, static_cast<float>(y) * (H - 1) / (OH - 1),
+                          static_cast<float>(x) * (W - 1) / (OW - 1)));
+      }
+    }
+  }
+
+  test.AddInput<float>("X", {N, C, H, W}, X);
+  test.AddInput<float>("roi", {0}, roi);
+  test.AddInput<float>("scales", {0}, scales);
+  test.AddInput<int64_t>("sizes", {4}, {N, C, OH, OW});
+  test.AddOutput<float>("Y", {N, C, OH, OW}, Y);
+  test.SetOutputAbsErr("Y", 1e-4f);
+  test.Run();
+}
+
+// The cubic weights sum to 1 so every channel of constant images stays constant, with and without exclude_outside.
+TEST(ResizeOpTest, ResizeOpCubicUpSample_ConstantImagesManyChannels) {
+  for (int64_t exclude_outside : {0, 1}) {
+    OpTester test("Resize", 13);
+    std::vector<float> roi{};
+    std::vector<float> scales{1.0f, 1.0f, 2.0f, 1.5f};
+
+    test.AddAttribute("mode", "cubic");
+    test.AddAttribute("exclude_outside", exclude_outside);
+
+    constexpr int64_t N = 2, C = 3, H = 8, W = 8;
+    std::vector<float> X;
+    std::vector<float> Y;
+    for (int64_t image = 0; image < N * C; ++image) {
+      X.insert(X.end(), H * W, static_cast<float>(image + 1));
+      Y.insert(Y.end(), H * 2 * W * 3 / 2, static_cast<float>(image + 1));
+    }
+
+    test.AddInput<float>("X", {N, C, H, W}, X);
+    test.AddInput<float>("roi", {0}, roi);
+    test.AddInput<float>("scales", {4}, scales);
+    test.AddOutput<float>("Y", {N, C, H * 2, W * 3 / 2}, Y);
+    test.SetOutputRelErr("Y", 1e-5f);
+    test.Run();
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -210,5 +210,39 @@ TEST(Scatter, BoolInputWithAxis) {
   scatter_bool_with_axis_tests("ScatterElements", 11);
 }
 
+// Updates smaller than the data, with repeated indices so that several updates are reduced into the same elements.
+TEST(Scatter, ReductionAddRepeatedIndicesLarge) {
+  constexpr int64_t kRows = 8;
+  constexpr int64_t kCols = 3000;
+  constexpr int64_t kUpdateRows = 6;
+  constexpr int64_t kUpdateCols = 2500;
+
+  std::vector<float> data(kRows * kCols);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<float>(i % 5);
+  }
+
+  std::vector<int64_t> indices(kUpdateRows * kUpdateCols);
+  std::vector<float> updates(kUpdateRows * kUpdateCols);
+  std::vector<float> output = data;
+  for (int64_t r = 0; r < kUpdateRows; ++r) {
+    for (int64_t c = 0; c < kUpdateCols; ++c) {
+      const int64_t i = r * kUpdateCols + c;
+      indices[i] = (r + c) % 3 - (c % 2 == 0 ? kRows : 0);
+      updates[i] = static_cast<float>((r + 1) * (c % 7));
+      output[((r + c) % 3 + kRows) % kRows * kCols + c] += updates[i];
+    }
+  }
+
+  OpTester test("ScatterElements", 16);
+  test.AddAttribute<int64_t>("axis", 0);
+  test.AddAttribute<std::string>("reduction", "add");
+  test.AddInput<float>("data", {kRows, kCols}, data);
+  test.AddInput<int64_t>("indices", {kUpdateRows, kUpdateCols}, indices);
+  test.AddInput<float>("updates", {kUpdateRows, kUpdateCols}, updates);
+  test.AddOutput<float>("y", {kRows, kCols}, output);
+  test.Run();
+}
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -3,6 +3,7 @@
 # pylint: disable=C0116,W0212,R1720,C0114
 
 # -*- coding: UTF-8 -*-
+import asyncio
 import gc
 import os
 import platform
@@ -375,6 +376,90 @@ class TestInferenceSession(unittest.TestCase):
         output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
         np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
 
+    def testRunModelZeroCopyOutputs(self):
+        so = onnxrt.SessionOptions()
+        so.add_session_config_entry("session.python_zero_copy_outputs", "1")
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"), sess_options=so, providers=["CPUExecutionProvider"])
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        res = sess.run(["Y"], {"X": x})
+        self.assertFalse(res[0].flags.owndata)
+        self.assertIsNotNone(res[0].base)
+
+        # the outputs of another run don't share memory with the first one
+        res2 = sess.run(["Y"], {"X": x + 1})
+        self.assertFalse(np.shares_memory(res[0], res2[0]))
+
+        # the array keeps the buffer alive after the session is released
+        del sess
+        output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
+        np.testing.assert_allclose(output_expected, res[0], rtol=1e-05, atol=1e-08)
+        view = res[0][1:]
+        del res
+        np.testing.assert_allclose(output_expected[1:], view, rtol=1e-05, atol=1e-08)
+
+    def testRunModelZeroCopyOutputsSharedWithSession(self):
+        from onnx import TensorProto, helper
+
+        # W is an initializer and X a graph input, both also graph outputs
+        graph = helper.make_graph(
+            [helper.make_node("Add", ["X", "W"], ["Y"])],
+            "shared_outputs",
+            [helper.make_tensor_value_info("X", TensorProto.FLOAT, [2])],
+            [
+                helper.make_tensor_value_info("Y", TensorProto.FLOAT, [2]),
+                helper.make_tensor_value_info("W", TensorProto.FLOAT, [2]),
+                helper.make_tensor_value_info("X", TensorProto.FLOAT, [2]),
+            ],
+            [helper.make_tensor("W", TensorProto.FLOAT, [2], [1.0, 2.0])],
+        )
+        model = helper.make_model(graph, opset_imports=[helper.make_opsetid("", 13)])
+
+        so = onnxrt.SessionOptions()
+        so.add_session_config_entry("session.python_zero_copy_outputs", "1")
+        sess = onnxrt.InferenceSession(model.SerializeToString(), sess_options=so, providers=["CPUExecutionProvider"])
+        x = np.array([3.0, 4.0], dtype=np.float32)
+        y, w, x_out = sess.run(["Y", "W", "X"], {"X": x})
+
+        # the activation wraps the buffer of ORT, the initializer and the graph input are copied
+        self.assertFalse(y.flags.owndata)
+        self.assertTrue(w.flags.owndata)
+        self.assertTrue(x_out.flags.owndata)
+        self.assertFalse(np.shares_memory(x, x_out))
+
+        # writing to the outputs changes neither the initializer nor the feed
+        w[:] = 0.0
+        x_out[:] = 0.0
+        np.testing.assert_allclose(x, np.array([3.0, 4.0], dtype=np.float32))
+        y2, w2 = sess.run(["Y", "W"], {"X": x})
+        np.testing.assert_allclose(y2, np.array([4.0, 6.0], dtype=np.float32))
+        np.testing.assert_allclose(w2, np.array([1.0, 2.0], dtype=np.float32))
+
+    def testRunModelAsync(self):
+        so = onnxrt.SessionOptions()
+        so.intra_op_num_threads = 2
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"), sess_options=so, providers=["CPUExecutionProvider"])
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        output_expected = np.array([[1.0, 4.0], [9.0, 16.0], [25.0, 36.0]], dtype=np.float32)
+
+        futures = [sess.run_async(["Y"], {"X": x * i}) for i in range(1, 33)]
+        for i, future in enumerate(futures, 1):
+            np.testing.assert_allclose(output_expected * i * i, future.result()[0], rtol=1e-05, atol=1e-08)
+
+        # the callback is called with the results or the error message
+        completions = []
+        sess.run_async(["Y"], {"X": x}, lambda results, error: completions.append((results, error))).result()
+        self.assertIsNone(completions[0][1])
+        np.testing.assert_allclose(output_expected, completions[0][0][0], rtol=1e-05, atol=1e-08)
+
+        with self.assertRaises(Fail) as context:
+            sess.run_async(["Z"], {"X": x}).result()
+        self.assertIn("Invalid Output Name", str(context.exception))
+
+        async def run_in_coroutine():
+            return await asyncio.wrap_future(sess.run_async(["Y"], {"X": x}))
+
+        np.testing.assert_allclose(output_expected, asyncio.run(run_in_coroutine())[0], rtol=1e-05, atol=1e-08)
+
     def testRunModelFromBytes(self):
         with open(get_name("mul_1.onnx"), "rb") as f:
             content = f.read()
@@ -694,6 +779,31 @@ class TestInferenceSession(unittest.TestCase):
         # Chronological profiling's start time
         self.assertTrue(start_time_1 <= start_time_2 <= start_time_3)
 
+    def testNodeStats(self):
+        so = onnxrt.SessionOptions()
+        so.add_session_config_entry("session.enable_node_stats", "1")
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"), sess_options=so, providers=["CPUExecutionProvider"])
+        x = np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)
+        for _ in range(3):
+            sess.run([], {"X": x})
+
+        stats = sess.get_node_stats()
+        self.assertEqual(len(stats["nodes"]), 1)
+        node = stats["nodes"][0]
+        self.assertEqual(node["name"], "mul_1")
+        self.assertEqual(node["op_type"], "Mul")
+        self.assertEqual(node["count"], 3)
+        self.assertLessEqual(node["p50_us"], node["p99_us"])
+        self.assertEqual(node["output_bytes"], 3 * x.nbytes)
+        self.assertEqual(stats["op_types"][0]["num_nodes"], 1)
+
+        sess.reset_node_stats()
+        self.assertEqual(sess.get_node_stats()["nodes"][0]["count"], 0)
+
+        # collection is disabled by default
+        sess = onnxrt.InferenceSession(get_name("mul_1.onnx"), providers=["CPUExecutionProvider"])
+        self.assertRaises(Exception, sess.get_node_stats)
+
     def testGraphOptimizationLevel(self):
         opt = onnxrt.SessionOptions()
         # default should be all optimizations optimization
@@ -66,6 +66,25 @@ class TestIOBinding(unittest.TestCase):
         # Validate results
         self.assertTrue(np.array_equal(self.create_expected_output(), ort_output))
 
+    def test_copy_outputs_to_cpu_zero_copy(self):
+        so = onnxrt.SessionOptions()
+        so.add_session_config_entry("session.python_zero_copy_outputs", "1")
+        session = onnxrt.InferenceSession(get_name("mul_1.onnx"), sess_options=so, providers=["CPUExecutionProvider"])
+        io_binding = session.io_binding()
+        io_binding.bind_cpu_input("X", self.create_numpy_input())
+        io_binding.bind_output("Y")
+        session.run_with_iobinding(io_binding)
+
+        # the arrays share the buffer of the bound output
+        ort_output = io_binding.copy_outputs_to_cpu()[0]
+        self.assertFalse(ort_output.flags.owndata)
+        self.assertTrue(np.shares_memory(ort_output, io_binding.copy_outputs_to_cpu()[0]))
+
+        # and keep it alive after the binding and the session are released
+        del io_binding
+        del session
+        self.assertTrue(np.array_equal(self.create_expected_output(), ort_output))
+
     def test_bind_input_types(self):
 
         opset = onnx_opset_version()
@@ -15,7 +15,7 @@ import onnx
 from onnx import TensorProto, helper, numpy_helper
 
 import onnxruntime
-from onnxruntime.quantization.calibrate import CalibrationDataReader, create_calibrator
+from onnxruntime.quantization.calibrate import CalibrationDataReader, CalibrationMethod, create_calibrator
 
 
 def generate_input_initializer(tensor_shape, tensor_dtype, input_name):
@@ -358,6 +358,59 @@ class TestCalibrateMinMaxCalibrator(unittest.TestCase):
         for output_name in output_min_max_dict.keys():
             self.assertEqual(output_min_max_dict[output_name], tensors_range[output_name])
 
+    def test_compute_range_native_collection(self):
+        test_model_path = Path(self._tmp_model_dir.name).joinpath("./test_model_native.onnx")
+        self.construct_test_compute_range_model(test_model_path.as_posix())
+        data_reader = TestDataReader()
+
+        calibrater = create_calibrator(
+            test_model_path,
+            augmented_model_path=Path(self._tmp_model_dir.name).joinpath("./augmented_test_model_4.onnx").as_posix(),
+        )
+        calibrater.collect_data(data_reader)
+        tensors_range = calibrater.compute_range()
+
+        data_reader.rewind()
+        native_calibrater = create_calibrator(
+            test_model_path,
+            augmented_model_path=Path(self._tmp_model_dir.name).joinpath("./native_test_model.onnx").as_posix(),
+            extra_options={"use_native_collection": True},
+        )
+        # the model is not augmented
+        self.assertEqual(len(native_calibrater.get_augment_model().graph.node), 6)
+        native_calibrater.collect_data(data_reader)
+        native_tensors_range = native_calibrater.compute_range()
+
+        self.assertEqual(set(tensors_range.keys()), set(native_tensors_range.keys()))
+        for tensor, (min_value, max_value) in tensors_range.items():
+            self.assertAlmostEqual(min_value, native_tensors_range[tensor][0], places=6)
+            self.assertAlmostEqual(max_value, native_tensors_range[tensor][1], places=6)
+
+    def test_histogram_native_collection(self):
+        test_model_path = Path(self._tmp_model_dir.name).joinpath("./test_model_native_histogram.onnx")
+        self.construct_test_compute_range_model(test_model_path.as_posix())
+        data_reader = TestDataReader()
+
+        for method in [CalibrationMethod.Entropy, CalibrationMethod.Percentile]:
+            data_reader.rewind()
+            calibrater = create_calibrator(
+                test_model_path,
+                augmented_model_path=Path(self._tmp_model_dir.name).joinpath("./native_histogram.onnx").as_posix(),
+                calibrate_method=method,
+                extra_options={"use_native_collection": True, "num_bins": 512},
+            )
+            calibrater.collect_data(data_reader)
+
+            # 4 runs of 9 values for each tensor
+            histogram_dict = calibrater.collector.get_histogram_dict()
+            self.assertEqual(len(histogram_dict), 7)
+            for histogram in histogram_dict.values():
+                self.assertEqual(histogram[0].sum(), 36)
+                self.assertEqual(histogram[0].size + 1, histogram[1].size)
+
+            tensors_range = calibrater.compute_range()
+            self.assertEqual(len(tensors_range), 7)
+
     def test_augment_graph_with_zero_value_dimension(self):
         """TEST_CONFIG_5"""
         #   Conv
@@ -9,6 +9,7 @@
 #include <atomic>
 #include <mutex>
 #include <algorithm>
+#include <future>
 #include <thread>
 
 #include "gtest/gtest.h"
@@ -1051,6 +1052,102 @@ TEST(CApiTest, io_binding) {
   binding.ClearBoundOutputs();
 }
 
+TEST(CApiTest, run_async) {
+  Ort::SessionOptions session_options;
+  session_options.SetIntraOpNumThreads(2);
+  Ort::Session session(*ort_env, MODEL_URI, session_options);
+
+  Ort::MemoryInfo info_cpu = Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemTypeDefault);
+  const std::array<int64_t, 2> x_shape = {3, 2};
+  std::array<float, 3 * 2> x_values = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  Ort::Value x = Ort::Value::CreateTensor(info_cpu, x_values.data(), x_values.size(), x_shape.data(), x_shape.size());
+  const std::array<float, 3 * 2> expected_y = {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f};
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+
+  // many runs in flight at once
+  std::vector<std::future<std::vector<Ort::Value>>> futures;
+  for (int i = 0; i < 64; ++i) {
+    futures.push_back(session.RunAsync(Ort::RunOptions(), input_names, &x, 1, output_names, 1));
+  }
+  for (auto& future : futures) {
+    std::vector<Ort::Value> outputs = future.get();
+    ASSERT_EQ(outputs.size(), 1U);
+    const float* y = outputs[0].GetTensorData<float>();
+    ASSERT_TRUE(std::equal(y, y + expected_y.size(), std::begin(expected_y)));
+  }
+
+  // the error of a run is held by its future
+  const char* invalid_output_names[] = {"Z"};
+  auto failed_run = session.RunAsync(Ort::RunOptions(), input_names, &x, 1, invalid_output_names, 1);
+  bool failed = false;
+  try {
+    failed_run.get();
+  } catch (const Ort::Exception& e) {
+    failed = e.GetOrtErrorCode() == ORT_INVALID_ARGUMENT;
+  }
+  ASSERT_TRUE(failed);
+}
+
+TEST(CApiTest, run_async_with_callback) {
+  Ort::SessionOptions session_options;
+  session_options.SetIntraOpNumThreads(2);
+  Ort::Session session(*ort_env, MODEL_URI, session_options);
+
+  Ort::MemoryInfo info_cpu = Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemTypeDefault);
+  const std::array<int64_t, 2> x_shape = {3, 2};
+  std::array<float, 3 * 2> x_values = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  Ort::Value x = Ort::Value::CreateTensor(info_cpu, x_values.data(), x_values.size(), x_shape.data(), x_shape.size());
+
+  // preallocated output
+  std::array<float, 3 * 2> y_values = {};
+  Ort::Value y = Ort::Value::CreateTensor(info_cpu, y_values.data(), y_values.size(), x_shape.data(), x_shape.size());
+
+  struct Completion {
+    std::promise<bool> succeeded;
+    OrtValue* output;
+  } completion{{}, nullptr};
+
+  auto callback = [](void* user_data, OrtValue** outputs, size_t num_outputs, OrtStatusPtr status) {
+    auto* completion = static_cast<Completion*>(user_data);
+    completion->output = num_outputs == 1 ? outputs[0] : nullptr;
+    completion->succeeded.set_value(status == nullptr);
+    Ort::GetApi().ReleaseStatus(status);
+  };
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+  auto succeeded = completion.succeeded.get_future();
+  session.RunAsync(Ort::RunOptions(), input_names, &x, 1, output_names, &y, 1, callback, &completion);
+  ASSERT_TRUE(succeeded.get());
+  ASSERT_EQ(completion.output, static_cast<OrtValue*>(y));
+
+  const std::array<float, 3 * 2> expected_y = {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f};
+  ASSERT_TRUE(std::equal(std::begin(y_values), std::end(y_values), std::begin(expected_y)));
+}
+
+TEST(CApiTest, run_async_requires_thread_pool) {
+  Ort::SessionOptions session_options;
+  session_options.SetIntraOpNumThreads(1);
+  Ort::Session session(*ort_env, MODEL_URI, session_options);
+
+  Ort::MemoryInfo info_cpu = Ort::MemoryInfo::CreateCpu(OrtAllocatorType::OrtArenaAllocator, OrtMemTypeDefault);
+  const std::array<int64_t, 2> x_shape = {3, 2};
+  std::array<float, 3 * 2> x_values = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  Ort::Value x = Ort::Value::CreateTensor(info_cpu, x_values.data(), x_values.size(), x_shape.data(), x_shape.size());
+
+  const char* input_names[] = {"X"};
+  const char* output_names[] = {"Y"};
+  bool failed = false;
+  try {
+    session.RunAsync(Ort::RunOptions(), input_names, &x, 1, output_names, 1);
+  } catch (const Ort::Exception& e) {
+    failed = std::string(e.what()).find("intra op thread pool") != std::string::npos;
+  }
+  ASSERT_TRUE(failed);
+}
+
 #if defined(USE_CUDA) || defined(USE_TENSORRT)
 TEST(CApiTest, io_binding_cuda) {
   struct CudaMemoryDeleter {
@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+# Copyright (c) Microsoft Corporation. All rights reserved.
+# Licensed under the MIT License.
+
+import argparse
+import json
+import os
+import pathlib
+import sys
+import tempfile
+from collections import OrderedDict
+
+# Summarize the per-node cost model data written to an ONNX Runtime profile and classify each node as compute or
+# memory bound against the roofline of the machine.
+#
+# Nodes whose kernel provides a cost model have 'flops', 'bytes_read', 'bytes_written' and 'compute_ns' args in their
+# '<node>_kernel_time' events. The roofline is either provided with --peak_gflops and --peak_gbps, or measured by
+# running a large MatMul (compute peak) and a large Add (memory bandwidth peak) with ONNX Runtime.
+
+
+def _read_profile_events(profile_path):
+    with open(profile_path, "r") as f:
+        data = json.load(f)
+
+    # the profile is either a list of events or a dictionary with a 'traceEvents' list
+    return data["traceEvents"] if isinstance(data, dict) else data
+
+
+def collect_node_costs(profile_path):
+    """
+    Aggregate the cost model data of each node in a profile over all the runs.
+    :param profile_path: Path to the profile JSON written by ONNX Runtime.
+    :return: OrderedDict of node name to a dict with op_type, count, flops, bytes and duration_ns totals.
+    """
+    nodes = OrderedDict()
+    for event in _read_profile_events(profile_path):
+        name = event.get("name", "")
+        args = event.get("args", {})
+        if event.get("cat") != "Node" or not name.endswith("_kernel_time") or "flops" not in args:
+            continue
+
+        node_name = name[: -len("_kernel_time")]
+        node = nodes.setdefault(
+            node_name,
+            {"op_type": args.get("op_name", ""), "count": 0, "flops": 0.0, "bytes": 0.0, "duration_ns": 0.0},
+        )
+        node["count"] += 1
+        node["flops"] += float(args["flops"])
+        node["bytes"] += float(args["bytes_read"]) + float(args["bytes_written"])
+        node["duration_ns"] += float(args.get("compute_ns", event.get("dur", 0) * 1000.0))
+
+    return nodes
+
+
+def _measure_peak(model, feeds, op_type, metric, num_runs):
+    import onnxruntime as ort
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        so = ort.SessionOptions()
+        so.enable_profiling = True
+        so.profile_file_prefix = os.path.join(tmpdir, "roofline")
+        sess = ort.InferenceSession(model.SerializeToString(), so, providers=["CPUExecutionProvider"])
+        for _ in range(num_runs):
+            sess.run(None, feeds)
+        profile_path = sess.end_profiling()
+
+        best = 0.0
+        for event in _read_profile_events(profile_path):
+            args = event.get("args", {})
+            if args.get("op_name") == op_type and metric in args:
+                best = max(best, float(args[metric]))
+
+    return best
+
+
+def measure_machine_roofline(num_runs=10):
+    """
+    Measure the peak compute throughput and memory bandwidth that ONNX Runtime achieves on this machine.
+    :return: Tuple of (peak GFLOP/s, peak GB/s).
+    """
+    import numpy as np
+    from onnx import TensorProto, helper
+
+    matmul_dim = 1024
+    matmul_model = helper.make_model(
+        helper.make_graph(
+            [helper.make_node("MatMul", ["A", "B"], ["Y"])],
+            "roofline_matmul",
+            [
+                helper.make_tensor_value_info("A", TensorProto.FLOAT, [matmul_dim, matmul_dim]),
+                helper.make_tensor_value_info("B", TensorProto.FLOAT, [matmul_dim, matmul_dim]),
+            ],
+            [helper.make_tensor_value_info("Y", TensorProto.FLOAT, [matmul_dim, matmul_dim])],
+        )
+    )
+    matmul_feeds = {
+        "A": np.random.rand(matmul_dim, matmul_dim).astype(np.float32),
+        "B": np.random.rand(matmul_dim, matmul_dim).astype(np.float32),
+    }
+
+    # large enough to not fit in the last level cache
+    add_size = 32 * 1024 * 1024
+    add_model = helper.make_model(
+        helper.make_graph(
+            [helper.make_node("Add", ["A", "B"], ["Y"])],
+            "roofline_add",
+            [
+                helper.make_tensor_value_info("A", TensorProto.FLOAT, [add_size]),
+                helper.make_tensor_value_info("B", TensorProto.FLOAT, [add_size]),
+            ],
+            [helper.make_tensor_value_info("Y", TensorProto.FLOAT, [add_size])],
+        )
+    )
+    add_feeds = {"A": np.random.rand(add_size).astype(np.float32), "B": np.random.rand(add_size).astype(np.float32)}
+
+    peak_gflops = _measure_peak(matmul_model, matmul_feeds, "MatMul", "gflops_per_sec", num_runs)
+    peak_gbps = _measure_peak(add_model, add_feeds, "Add", "gbytes_per_sec", num_runs)
+    return peak_gflops, peak_gbps
+
+
+def classify_nodes(nodes, peak_gflops, peak_gbps):
+    """
+    Classify each node against the roofline.
+    A node is compute bound if its arithmetic intensity (FLOPs per byte) is above the ridge point of the roofline,
+    i.e. peak_gflops / peak_gbps, and memory bound otherwise.
+    :return: List of dicts with the node metrics, sorted by total duration.
+    """
+    ridge_point = peak_gflops / peak_gbps
+    results = []
+    for node_name, node in nodes.items():
+        duration_ns = max(node["duration_ns"], 1.0)
+        intensity = node["flops"] / node["bytes"] if node["bytes"] > 0 else float("inf")
+        achieved_gflops = node["flops"] / duration_ns
+        achieved_gbps = node["bytes"] / duration_ns
+        attainable_gflops = min(peak_gflops, intensity * peak_gbps)
+        results.append(
+            {
+                "name": node_name,
+                "op_type": node["op_type"],
+                "count": node["count"],
+                "duration_us": node["duration_ns"] / 1000.0,
+                "intensity": intensity,
+                "gflops_per_sec": achieved_gflops,
+                "gbytes_per_sec": achieved_gbps,
+                "bound": "compute" if intensity >= ridge_point else "memory",
+                # fraction of the roofline reached by the node
+                "efficiency": achieved_gflops / attainable_gflops if attainable_gflops > 0 else 0.0,
+            }
+        )
+
+    results.sort(key=lambda r: r["duration_us"], reverse=True)
+    return results
+
+
+def print_summary(results, peak_gflops, peak_gbps, file=sys.stdout):
+    print(
+        f"Roofline: peak {peak_gflops:.1f} GFLOP/s, {peak_gbps:.1f} GB/s, "
+        f"ridge point {peak_gflops / peak_gbps:.2f} FLOP/byte",
+        file=file,
+    )
+    header = (
+        f"{'node':40} {'op_type':16} {'count':>6} {'time_us':>12} {'FLOP/byte':>10} "
+        f"{'GFLOP/s':>10} {'GB/s':>10} {'bound':>8} {'eff':>6}"
+    )
+    print(header, file=file)
+    print("-" * len(header), file=file)
+    for r in results:
+        print(
+            f"{r['name'][:40]:40} {r['op_type'][:16]:16} {r['count']:>6} {r['duration_us']:>12.1f} "
+            f"{r['intensity']:>10.2f} {r['gflops_per_sec']:>10.2f} {r['gbytes_per_sec']:>10.2f} "
+            f"{r['bound']:>8} {r['efficiency']:>6.1%}",
+            file=file,
+        )
+
+
+def profile_roofline_helper():
+    parser = argparse.ArgumentParser(
+        f"{os.path.basename(__file__)}:{profile_roofline_helper.__name__}",
+        description="""
+                    Classify the nodes in an ONNX Runtime profile as compute or memory bound.
+                    The profile must be created with profiling enabled. Only nodes whose kernel provides a cost
+                    model are included.""",
+    )
+
+    parser.add_argument(
+        "--peak_gflops",
+        type=float,
+        required=False,
+        help="Peak compute throughput of the machine in GFLOP/s. Measured if not provided.",
+    )
+    parser.add_argument(
+        "--peak_gbps",
+        type=float,
+        required=False,
+        help="Peak memory bandwidth of the machine in GB/s. Measured if not provided.",
+    )
+    parser.add_argument("--json", action="store_true", help="Output the results as JSON.")
+    parser.add_argument("profile", type=pathlib.Path, help="Provide path to the profile JSON file.")
+
+    args = parser.parse_args()
+
+    nodes = collect_node_costs(str(args.profile.resolve(strict=True)))
+    if not nodes:
+        print("No nodes with cost model data found in the profile.")
+        sys.exit(-1)
+
+    peak_gflops = args.peak_gflops
+    peak_gbps = args.peak_gbps
+    if not peak_gflops or not peak_gbps:
+        measured_gflops, measured_gbps = measure_machine_roofline()
+        peak_gflops = peak_gflops or measured_gflops
+        peak_gbps = peak_gbps or measured_gbps
+
+    results = classify_nodes(nodes, peak_gflops, peak_gbps)
+    if args.json:
+        print(json.dumps({"peak_gflops": peak_gflops, "peak_gbps": peak_gbps, "nodes": results}, indent=2))
+    else:
+        print_summary(results, peak_gflops, peak_gbps)
+
+
+if __name__ == "__main__":
+    profile_roofline_helper()